@@ -0,0 +1,22 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#define LIBCELLML_BENCHMARKS_RESOURCE_LOCATION "@BENCHMARKS_RESOURCE_LOCATION@"
+#define LIBCELLML_BENCHMARKS_BUILD_TYPE "@BENCHMARKS_BUILD_TYPE@"
+#define LIBCELLML_BENCHMARKS_COMPILER "@CMAKE_CXX_COMPILER_ID@ @CMAKE_CXX_COMPILER_VERSION@"
+#define LIBCELLML_BENCHMARKS_SYSTEM "@CMAKE_SYSTEM_NAME@ @CMAKE_SYSTEM_PROCESSOR@"
@@ -0,0 +1,341 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "libcellml/generator.h"
+#include "libcellml/model.h"
+#include "libcellml/parser.h"
+#include "libcellml/printer.h"
+#include "libcellml/validator.h"
+
+#include "benchmark_config.h"
+#include "harness.h"
+#include "syntheticmodel.h"
+
+// The models on which our benchmarks are run, i.e. the largest models of our
+// test resources, and a version of the Hodgkin-Huxley model that imports its
+// components. Synthetic models can also be added to them.
+
+struct BenchmarkModel
+{
+    std::string name;
+    std::string fileName;
+};
+
+static const std::vector<BenchmarkModel> BENCHMARK_MODELS = {
+    {"hodgkin_huxley_1952", "generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"},
+    {"hodgkin_huxley_1952_imports", "modelflattening/hodgkin_huxley_squid_axon_model_1952/model.cellml"},
+    {"noble_1962", "generator/noble_model_1962/model.cellml"},
+    {"garny_2003", "generator/garny_kohl_hunter_boyett_noble_rabbit_san_model_2003/model.cellml"},
+    {"fabbri_2017", "generator/fabbri_fantini_wilders_severi_human_san_model_2017/model.cellml"},
+    {"ohara_rudy_2011", "Ohara_Rudy_2011.cellml"},
+};
+
+static std::vector<BenchmarkModel> syntheticBenchmarkModels(const std::vector<size_t> &sizes)
+{
+    // Write, to the current directory, a sparse and a dense synthetic model of
+    // each of the given sizes, so that we can get scaling curves for all our
+    // operations. The sparse models also have encapsulated cells, imports,
+    // a deep hierarchy of units and long equation chains, while the dense
+    // models only have top-level cells that are all connected to one another.
+
+    std::vector<BenchmarkModel> res;
+
+    for (auto size : sizes) {
+        SyntheticModelSettings sparseSettings;
+        SyntheticModelSettings denseSettings;
+
+        sparseSettings.componentCount = size;
+        sparseSettings.encapsulationDepth = 5;
+        sparseSettings.importCount = size / 10;
+        sparseSettings.unitsDepth = 5;
+        sparseSettings.equationChainLength = 5;
+
+        denseSettings.componentCount = size;
+        denseSettings.equivalenceNetwork = SyntheticModelSettings::EquivalenceNetwork::DENSE;
+
+        for (const auto &synthetic : std::vector<std::pair<std::string, SyntheticModelSettings>> {
+                 {"synthetic_sparse_" + std::to_string(size), sparseSettings},
+                 {"synthetic_dense_" + std::to_string(size), denseSettings},
+             }) {
+            auto fileName = synthetic.first + ".cellml";
+
+            if (writeSyntheticModel(createSyntheticModel(synthetic.second), fileName)) {
+                res.push_back({synthetic.first, fileName});
+            } else {
+                std::cerr << "Warning: '" << fileName << "' could not be written." << std::endl;
+            }
+        }
+    }
+
+    return res;
+}
+
+static std::string fileContents(const std::string &fileName)
+{
+    std::ifstream file(fileName);
+    std::stringstream buffer;
+
+    buffer << file.rdbuf();
+
+    return buffer.str();
+}
+
+static libcellml::ModelPtr parseModel(const std::string &contents)
+{
+    return libcellml::Parser::create()->parseModel(contents);
+}
+
+static libcellml::ModelPtr flatModel(const std::string &contents, const std::string &fileName)
+{
+    auto res = parseModel(contents);
+
+    if (res->hasImports()) {
+        res->resolveImports(fileName);
+        res->flatten();
+    }
+
+    return res;
+}
+
+static std::vector<Benchmark> benchmarks(const BenchmarkModel &benchmarkModel)
+{
+    // Create the benchmarks for the given model. Our operations share some
+    // state with their set up, hence we keep it in shared pointers that get
+    // captured by both of them.
+
+    std::vector<Benchmark> res;
+    auto fileName = benchmarkModel.fileName;
+    auto contents = fileContents(fileName);
+
+    if (contents.empty()) {
+        std::cerr << "Warning: '" << fileName << "' could not be read." << std::endl;
+
+        return res;
+    }
+
+    auto model = parseModel(contents);
+    auto flattenedModel = flatModel(contents, fileName);
+    auto parser = libcellml::Parser::create();
+    auto validator = libcellml::Validator::create();
+    auto printer = libcellml::Printer::create();
+    auto workModel = std::make_shared<libcellml::ModelPtr>();
+    auto generator = std::make_shared<libcellml::GeneratorPtr>();
+    auto name = benchmarkModel.name;
+
+    res.push_back({"Parser::parseModel", name, nullptr, [=]() {
+                       parser->parseModel(contents);
+                   }});
+    res.push_back({"Validator::validateModel", name, nullptr, [=]() {
+                       validator->validateModel(model);
+                   }});
+
+    if (model->hasImports()) {
+        res.push_back({"Model::resolveImports", name, [=]() {
+                           *workModel = parseModel(contents);
+                       },
+                       [=]() {
+                           (*workModel)->resolveImports(fileName);
+                       }});
+        res.push_back({"Model::flatten", name, [=]() {
+                           *workModel = parseModel(contents);
+
+                           (*workModel)->resolveImports(fileName);
+                       },
+                       [=]() {
+                           (*workModel)->flatten();
+                       }});
+    }
+
+    res.push_back({"Model::clone", name, nullptr, [=]() {
+                       model->clone();
+                   }});
+    res.push_back({"Printer::printModel", name, nullptr, [=]() {
+                       printer->printModel(model);
+                   }});
+    res.push_back({"Generator::processModel", name, [=]() {
+                       *generator = libcellml::Generator::create();
+                   },
+                   [=]() {
+                       (*generator)->processModel(flattenedModel);
+                   }});
+    res.push_back({"Generator::implementationCode", name, [=]() {
+                       *generator = libcellml::Generator::create();
+
+                       (*generator)->processModel(flattenedModel);
+                   },
+                   [=]() {
+                       (*generator)->interfaceCode();
+                       (*generator)->implementationCode();
+                   }});
+
+    return res;
+}
+
+static void usage(const char *program)
+{
+    std::cout << "Usage: " << program << " [options]\n"
+              << "\n"
+              << "Options:\n"
+              << "  --filter=<text>          Only run the benchmarks which name contains <text>.\n"
+              << "  --json=<file>            Write the results as JSON to <file>.\n"
+              << "  --min-time=<seconds>     Minimum time spent running an operation (default: 0.5).\n"
+              << "  --min-iterations=<n>     Minimum number of runs of an operation (default: 5).\n"
+              << "  --max-iterations=<n>     Maximum number of runs of an operation (default: 1000).\n"
+              << "  --synthetic=<n>[,<n>...] Also run the benchmarks on synthetic models with <n>\n"
+              << "                           cells, with <n> at least 1, which are written to the\n"
+              << "                           current directory.\n"
+              << "  --list                   List the benchmarks without running them.\n"
+              << "  --help                   Show this help.\n";
+}
+
+static bool startsWith(const std::string &string, const std::string &prefix, std::string &value)
+{
+    if (string.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+
+    value = string.substr(prefix.size());
+
+    return true;
+}
+
+static std::vector<size_t> sizes(const std::string &value)
+{
+    std::vector<size_t> res;
+    std::stringstream stream(value);
+    std::string size;
+
+    while (std::getline(stream, size, ',')) {
+        res.push_back(std::stoul(size));
+
+        if (res.back() == 0) {
+            throw std::invalid_argument(size);
+        }
+    }
+
+    return res;
+}
+
+int main(int argc, char *argv[])
+{
+    BenchmarkSettings settings;
+    std::string filter;
+    std::string jsonFileName;
+    std::vector<size_t> syntheticSizes;
+    bool list = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        std::string value;
+
+        try {
+            if (startsWith(argument, "--filter=", value)) {
+                filter = value;
+            } else if (startsWith(argument, "--json=", value)) {
+                jsonFileName = value;
+            } else if (startsWith(argument, "--min-time=", value)) {
+                settings.minimumTime = std::stod(value);
+            } else if (startsWith(argument, "--min-iterations=", value)) {
+                settings.minimumIterations = std::stoul(value);
+            } else if (startsWith(argument, "--max-iterations=", value)) {
+                settings.maximumIterations = std::stoul(value);
+            } else if (startsWith(argument, "--synthetic=", value)) {
+                syntheticSizes = sizes(value);
+            } else if (argument == "--list") {
+                list = true;
+            } else if (argument == "--help") {
+                usage(argv[0]);
+
+                return 0;
+            } else {
+                throw std::invalid_argument(argument);
+            }
+        } catch (const std::exception &) {
+            std::cerr << "Error: invalid argument '" << argument << "'.\n\n";
+
+            usage(argv[0]);
+
+            return 1;
+        }
+    }
+
+    std::vector<BenchmarkResult> results;
+
+    if (!list && !canCountAllocations()) {
+        std::cerr << "Warning: the allocations done by libCellML cannot be counted on this platform." << std::endl;
+    }
+
+    std::vector<BenchmarkModel> benchmarkModels;
+
+    for (const auto &benchmarkModel : BENCHMARK_MODELS) {
+        benchmarkModels.push_back({benchmarkModel.name, std::string(LIBCELLML_BENCHMARKS_RESOURCE_LOCATION) + "/" + benchmarkModel.fileName});
+    }
+
+    if (!syntheticSizes.empty()) {
+        auto syntheticModels = syntheticBenchmarkModels(syntheticSizes);
+
+        benchmarkModels.insert(benchmarkModels.end(), syntheticModels.begin(), syntheticModels.end());
+    }
+
+    for (const auto &benchmarkModel : benchmarkModels) {
+        for (const auto &benchmark : benchmarks(benchmarkModel)) {
+            auto name = benchmark.operation + "/" + benchmark.model;
+
+            if (name.find(filter) == std::string::npos) {
+                continue;
+            }
+
+            if (list) {
+                std::cout << name << std::endl;
+
+                continue;
+            }
+
+            std::cerr << "Running " << name << "..." << std::endl;
+
+            results.push_back(runBenchmark(benchmark, settings));
+        }
+    }
+
+    if (list) {
+        return 0;
+    }
+
+    writeTable(std::cout, results);
+
+    if (!jsonFileName.empty()) {
+        std::ofstream jsonFile(jsonFileName);
+
+        writeJson(jsonFile, results, settings);
+
+        if (!jsonFile) {
+            std::cerr << "Error: '" << jsonFileName << "' could not be written." << std::endl;
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
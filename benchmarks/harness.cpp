@@ -0,0 +1,347 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "harness.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <limits>
+#include <new>
+#include <sstream>
+
+#include "libcellml/model.h"
+#include "libcellml/version.h"
+
+#include "benchmark_config.h"
+
+// Count the allocations by replacing the global allocation functions. The
+// counters are atomic since some operations (e.g. Generator::processModel) may
+// allocate from several threads.
+
+static std::atomic<size_t> allocationCount(0);
+static std::atomic<size_t> allocatedByteCount(0);
+
+static void *allocate(size_t size)
+{
+    ++allocationCount;
+    allocatedByteCount += size;
+
+    void *res = std::malloc((size == 0) ? 1 : size);
+
+    if (res == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return res;
+}
+
+static void *allocate(size_t size, const std::nothrow_t &) noexcept
+{
+    ++allocationCount;
+    allocatedByteCount += size;
+
+    return std::malloc((size == 0) ? 1 : size);
+}
+
+void *operator new(size_t size)
+{
+    return allocate(size);
+}
+
+void *operator new[](size_t size)
+{
+    return allocate(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &nothrow) noexcept
+{
+    return allocate(size, nothrow);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &nothrow) noexcept
+{
+    return allocate(size, nothrow);
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept
+{
+    std::free(pointer);
+}
+
+static double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+
+    auto middle = values.size() / 2;
+
+    return ((values.size() % 2) == 0) ?
+               0.5 * (values[middle - 1] + values[middle]) :
+               values[middle];
+}
+
+BenchmarkResult runBenchmark(const Benchmark &benchmark, const BenchmarkSettings &settings)
+{
+    // Run our benchmark once to warm up (e.g. to get files in the file system
+    // cache), and then as many times as needed.
+
+    if (benchmark.setUp) {
+        benchmark.setUp();
+    }
+
+    benchmark.run();
+
+    BenchmarkResult res;
+    std::vector<double> times;
+    double totalTime = 0.0;
+    size_t totalAllocationCount = 0;
+    size_t totalAllocatedByteCount = 0;
+
+    res.operation = benchmark.operation;
+    res.model = benchmark.model;
+
+    while (times.empty()
+           || ((times.size() < settings.maximumIterations)
+               && ((times.size() < settings.minimumIterations)
+                   || (totalTime < 1.0e9 * settings.minimumTime)))) {
+        if (benchmark.setUp) {
+            benchmark.setUp();
+        }
+
+        auto initialAllocationCount = allocationCount.load();
+        auto initialAllocatedByteCount = allocatedByteCount.load();
+        auto start = std::chrono::steady_clock::now();
+
+        benchmark.run();
+
+        auto end = std::chrono::steady_clock::now();
+        auto time = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+        totalAllocationCount += allocationCount.load() - initialAllocationCount;
+        totalAllocatedByteCount += allocatedByteCount.load() - initialAllocatedByteCount;
+
+        times.push_back(time);
+
+        totalTime += time;
+    }
+
+    auto iterations = static_cast<double>(times.size());
+    double variance = 0.0;
+
+    res.iterations = times.size();
+    res.meanTime = totalTime / iterations;
+    res.medianTime = median(times);
+    res.minimumTime = *std::min_element(times.begin(), times.end());
+    res.maximumTime = *std::max_element(times.begin(), times.end());
+
+    for (auto time : times) {
+        variance += (time - res.meanTime) * (time - res.meanTime);
+    }
+
+    res.standardDeviation = (times.size() > 1) ? std::sqrt(variance / (iterations - 1.0)) : 0.0;
+    res.allocations = static_cast<double>(totalAllocationCount) / iterations;
+    res.allocatedBytes = static_cast<double>(totalAllocatedByteCount) / iterations;
+
+    return res;
+}
+
+bool canCountAllocations()
+{
+    // Check whether an allocation done by libCellML itself gets counted.
+
+    auto initialAllocationCount = allocationCount.load();
+    auto model = libcellml::Model::create();
+
+    return allocationCount.load() != initialAllocationCount;
+}
+
+static std::string timeString(double time)
+{
+    // Return the given time, in nanoseconds, using the most suitable unit.
+
+    static const std::vector<std::pair<double, const char *>> UNITS = {
+        {1.0e9, "s"},
+        {1.0e6, "ms"},
+        {1.0e3, "us"},
+        {1.0, "ns"},
+    };
+
+    std::ostringstream res;
+
+    for (const auto &unit : UNITS) {
+        if ((time >= unit.first) || (unit.first == 1.0)) {
+            res << std::fixed << std::setprecision(3) << time / unit.first << " " << unit.second;
+
+            break;
+        }
+    }
+
+    return res.str();
+}
+
+void writeTable(std::ostream &stream, const std::vector<BenchmarkResult> &results)
+{
+    size_t operationWidth = std::string("Operation").size();
+    size_t modelWidth = std::string("Model").size();
+
+    for (const auto &result : results) {
+        operationWidth = std::max(operationWidth, result.operation.size());
+        modelWidth = std::max(modelWidth, result.model.size());
+    }
+
+    stream << std::left << std::setw(static_cast<int>(operationWidth)) << "Operation" << "  "
+           << std::setw(static_cast<int>(modelWidth)) << "Model" << "  "
+           << std::right << std::setw(12) << "Median" << "  "
+           << std::setw(12) << "Mean" << "  "
+           << std::setw(12) << "Std dev" << "  "
+           << std::setw(10) << "Iterations" << "  "
+           << std::setw(12) << "Allocs/op" << "  "
+           << std::setw(14) << "Bytes/op" << "\n";
+
+    for (const auto &result : results) {
+        stream << std::left << std::setw(static_cast<int>(operationWidth)) << result.operation << "  "
+               << std::setw(static_cast<int>(modelWidth)) << result.model << "  "
+               << std::right << std::setw(12) << timeString(result.medianTime) << "  "
+               << std::setw(12) << timeString(result.meanTime) << "  "
+               << std::setw(12) << timeString(result.standardDeviation) << "  "
+               << std::setw(10) << result.iterations << "  "
+               << std::setw(12) << std::fixed << std::setprecision(0) << result.allocations << "  "
+               << std::setw(14) << result.allocatedBytes << "\n";
+    }
+}
+
+static std::string jsonString(const std::string &string)
+{
+    // Return the given string as a JSON string.
+
+    std::string res = "\"";
+
+    for (auto character : string) {
+        if ((character == '"') || (character == '\\')) {
+            res += '\\';
+            res += character;
+        } else if (static_cast<unsigned char>(character) < 0x20) {
+            char buffer[7];
+
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(character));
+
+            res += buffer;
+        } else {
+            res += character;
+        }
+    }
+
+    return res + "\"";
+}
+
+static std::string jsonNumber(double number)
+{
+    std::ostringstream res;
+
+    res << std::setprecision(std::numeric_limits<double>::max_digits10) << number;
+
+    return res.str();
+}
+
+static std::string currentDate()
+{
+    // Return the current date and time in the ISO 8601 format.
+
+    auto now = std::time(nullptr);
+    std::tm time;
+    char buffer[32];
+
+#ifdef _WIN32
+    gmtime_s(&time, &now);
+#else
+    gmtime_r(&now, &time);
+#endif
+
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &time);
+
+    return buffer;
+}
+
+void writeJson(std::ostream &stream, const std::vector<BenchmarkResult> &results,
+               const BenchmarkSettings &settings)
+{
+    stream << "{\n"
+           << "  \"context\": {\n"
+           << "    \"date\": " << jsonString(currentDate()) << ",\n"
+           << "    \"libcellml_version\": " << jsonString(libcellml::versionString()) << ",\n"
+           << "    \"build_type\": " << jsonString(LIBCELLML_BENCHMARKS_BUILD_TYPE) << ",\n"
+           << "    \"compiler\": " << jsonString(LIBCELLML_BENCHMARKS_COMPILER) << ",\n"
+           << "    \"system\": " << jsonString(LIBCELLML_BENCHMARKS_SYSTEM) << ",\n"
+           << "    \"allocations_counted\": " << (canCountAllocations() ? "true" : "false") << ",\n"
+           << "    \"minimum_time\": " << jsonNumber(settings.minimumTime) << ",\n"
+           << "    \"minimum_iterations\": " << settings.minimumIterations << ",\n"
+           << "    \"maximum_iterations\": " << settings.maximumIterations << ",\n"
+           << "    \"time_unit\": \"ns\"\n"
+           << "  },\n"
+           << "  \"benchmarks\": [";
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto &result = results[i];
+
+        stream << ((i == 0) ? "\n" : ",\n")
+               << "    {\n"
+               << "      \"name\": " << jsonString(result.operation + "/" + result.model) << ",\n"
+               << "      \"operation\": " << jsonString(result.operation) << ",\n"
+               << "      \"model\": " << jsonString(result.model) << ",\n"
+               << "      \"iterations\": " << result.iterations << ",\n"
+               << "      \"mean_time\": " << jsonNumber(result.meanTime) << ",\n"
+               << "      \"median_time\": " << jsonNumber(result.medianTime) << ",\n"
+               << "      \"min_time\": " << jsonNumber(result.minimumTime) << ",\n"
+               << "      \"max_time\": " << jsonNumber(result.maximumTime) << ",\n"
+               << "      \"stddev_time\": " << jsonNumber(result.standardDeviation) << ",\n"
+               << "      \"allocations_per_op\": " << jsonNumber(result.allocations) << ",\n"
+               << "      \"allocated_bytes_per_op\": " << jsonNumber(result.allocatedBytes) << "\n"
+               << "    }";
+    }
+
+    stream << (results.empty() ? "]\n" : "\n  ]\n")
+           << "}\n";
+}
@@ -0,0 +1,117 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief A benchmark.
+ *
+ * A benchmark times an operation on a model. The set up of the operation
+ * (e.g. parsing a fresh model for an operation that modifies it) is done
+ * before each run of the operation and is neither timed nor counted in the
+ * allocations of the operation.
+ */
+struct Benchmark
+{
+    std::string operation; /**< The name of the operation, e.g. "Parser::parseModel". */
+    std::string model; /**< The name of the model on which the operation is done. */
+    std::function<void()> setUp; /**< The set up of the operation, if any. */
+    std::function<void()> run; /**< The operation. */
+};
+
+/**
+ * @brief The result of a benchmark.
+ *
+ * The times are in nanoseconds, while the allocations and the bytes are
+ * averaged over the runs of the operation.
+ */
+struct BenchmarkResult
+{
+    std::string operation; /**< The name of the operation. */
+    std::string model; /**< The name of the model. */
+    size_t iterations = 0; /**< The number of timed runs of the operation. */
+    double meanTime = 0.0; /**< The mean time of a run. */
+    double medianTime = 0.0; /**< The median time of a run. */
+    double minimumTime = 0.0; /**< The minimum time of a run. */
+    double maximumTime = 0.0; /**< The maximum time of a run. */
+    double standardDeviation = 0.0; /**< The standard deviation of the time of a run. */
+    double allocations = 0.0; /**< The number of allocations per run. */
+    double allocatedBytes = 0.0; /**< The number of allocated bytes per run. */
+};
+
+/**
+ * @brief The settings of a benchmark run.
+ */
+struct BenchmarkSettings
+{
+    double minimumTime = 0.5; /**< The minimum time, in seconds, spent running an operation. */
+    size_t minimumIterations = 5; /**< The minimum number of timed runs of an operation. */
+    size_t maximumIterations = 1000; /**< The maximum number of timed runs of an operation. */
+};
+
+/**
+ * @brief Run the given benchmark.
+ *
+ * Run the given benchmark once to warm up, and then until both the minimum
+ * time and the minimum number of iterations of the given settings have been
+ * reached, or until the maximum number of iterations has been reached.
+ *
+ * @param benchmark The benchmark to run.
+ * @param settings The settings to use.
+ *
+ * @return The result of the benchmark.
+ */
+BenchmarkResult runBenchmark(const Benchmark &benchmark, const BenchmarkSettings &settings);
+
+/**
+ * @brief Test if allocations can be counted.
+ *
+ * Allocations are counted by replacing the global allocation functions, which
+ * may not cover the allocations done by a shared libCellML library on all
+ * platforms (e.g. on Windows). Allocations done through @c malloc (e.g. by
+ * libxml2) are never counted.
+ *
+ * @return @c true if allocations can be counted, @c false otherwise.
+ */
+bool canCountAllocations();
+
+/**
+ * @brief Write the given results as a table.
+ *
+ * @param stream The stream to write to.
+ * @param results The results to write.
+ */
+void writeTable(std::ostream &stream, const std::vector<BenchmarkResult> &results);
+
+/**
+ * @brief Write the given results as JSON.
+ *
+ * The JSON document has a @c context object, which describes the libCellML
+ * library and the settings used, and a @c benchmarks array with one object
+ * per result.
+ *
+ * @param stream The stream to write to.
+ * @param results The results to write.
+ * @param settings The settings used to get the results.
+ */
+void writeJson(std::ostream &stream, const std::vector<BenchmarkResult> &results,
+               const BenchmarkSettings &settings);
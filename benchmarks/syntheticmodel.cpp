@@ -0,0 +1,326 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "syntheticmodel.h"
+
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include "libcellml/component.h"
+#include "libcellml/importsource.h"
+#include "libcellml/model.h"
+#include "libcellml/printer.h"
+#include "libcellml/units.h"
+#include "libcellml/variable.h"
+
+static const std::string BASE_CELL_COMPONENT_NAME = "cell";
+static const std::string TIME_NAME = "t";
+static const std::string STATE_NAME = "x";
+static const std::string RATE_CONSTANT_NAME = "k";
+
+static std::string timeUnitsName(size_t unitsDepth)
+{
+    return "time_" + std::to_string((unitsDepth == 0) ? 0 : unitsDepth - 1);
+}
+
+static std::string perTimeUnitsName()
+{
+    return "per_time";
+}
+
+static std::string chainVariableName(size_t index)
+{
+    return (index == 0) ? STATE_NAME : "a_" + std::to_string(index);
+}
+
+static std::string inputVariableName(const std::string &componentName)
+{
+    return STATE_NAME + "_" + componentName;
+}
+
+static void addUnits(const libcellml::ModelPtr &model, size_t unitsDepth)
+{
+    // Define our units of time through a hierarchy of units, i.e. time_0 is a
+    // millisecond and time_i is time_(i-1), and our units of rates as their
+    // inverse.
+
+    auto units = libcellml::Units::create("time_0");
+
+    units->addUnit(libcellml::Units::StandardUnit::SECOND, libcellml::Units::Prefix::MILLI);
+
+    model->addUnits(units);
+
+    for (size_t i = 1; i < unitsDepth; ++i) {
+        units = libcellml::Units::create("time_" + std::to_string(i));
+
+        units->addUnit("time_" + std::to_string(i - 1));
+
+        model->addUnits(units);
+    }
+
+    units = libcellml::Units::create(perTimeUnitsName());
+
+    units->addUnit(timeUnitsName(unitsDepth), -1.0);
+
+    model->addUnits(units);
+}
+
+static libcellml::VariablePtr addVariable(const libcellml::ComponentPtr &component, const std::string &name,
+                                          const std::string &units)
+{
+    auto res = libcellml::Variable::create(name);
+
+    res->setUnits(units);
+
+    component->addVariable(res);
+
+    return res;
+}
+
+static std::string ciCode(const std::string &name)
+{
+    return "<ci>" + name + "</ci>";
+}
+
+static std::string cnCode(const std::string &value)
+{
+    return "<cn cellml:units=\"dimensionless\">" + value + "</cn>";
+}
+
+static std::string applyCode(const std::string &operation, const std::string &arguments)
+{
+    return "<apply><" + operation + "/>" + arguments + "</apply>";
+}
+
+static std::string equationCode(const std::string &lhs, const std::string &rhs)
+{
+    return applyCode("eq", lhs + rhs);
+}
+
+static libcellml::ComponentPtr createCell(const std::string &name, size_t index, size_t unitsDepth,
+                                          size_t equationChainLength, const std::vector<std::string> &inputs)
+{
+    // Create a cell, i.e. a component with:
+    //  - a state x;
+    //  - a chain of algebraic variables a_i = (a_(i-1)+1)/2, with a_0 = x; and
+    //  - an ODE dx/dt = k*(u-a_n), with u the mean of the inputs or 1 if there
+    //    are no inputs.
+
+    auto res = libcellml::Component::create(name);
+    auto state = addVariable(res, STATE_NAME, "dimensionless");
+    auto rateConstant = addVariable(res, RATE_CONSTANT_NAME, perTimeUnitsName());
+
+    addVariable(res, TIME_NAME, timeUnitsName(unitsDepth));
+
+    state->setInitialValue(0.1 * static_cast<double>(index % 10 + 1));
+    rateConstant->setInitialValue(0.01 * static_cast<double>(index % 7 + 1));
+
+    std::string math = "<math xmlns=\"http://www.w3.org/1998/Math/MathML\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\">";
+
+    for (size_t i = 1; i <= equationChainLength; ++i) {
+        addVariable(res, chainVariableName(i), "dimensionless");
+
+        math += equationCode(ciCode(chainVariableName(i)),
+                             applyCode("divide",
+                                       applyCode("plus", ciCode(chainVariableName(i - 1)) + cnCode("1"))
+                                           + cnCode("2")));
+    }
+
+    std::string input;
+
+    if (inputs.empty()) {
+        input = cnCode("1");
+    } else {
+        std::string inputsCode;
+
+        for (const auto &inputName : inputs) {
+            addVariable(res, inputVariableName(inputName), "dimensionless");
+
+            inputsCode += ciCode(inputVariableName(inputName));
+        }
+
+        input = (inputs.size() == 1) ?
+                    inputsCode :
+                    applyCode("divide", applyCode("plus", inputsCode) + cnCode(std::to_string(inputs.size())));
+    }
+
+    math += equationCode(applyCode("diff", "<bvar>" + ciCode(TIME_NAME) + "</bvar>" + ciCode(STATE_NAME)),
+                         applyCode("times",
+                                   ciCode(RATE_CONSTANT_NAME)
+                                       + applyCode("minus", input + ciCode(chainVariableName(equationChainLength)))));
+    math += "</math>";
+
+    res->setMath(math);
+
+    return res;
+}
+
+static libcellml::ModelPtr createBaseCellModel(const SyntheticModelSettings &settings)
+{
+    auto res = libcellml::Model::create("base_cell");
+    auto cell = createCell(BASE_CELL_COMPONENT_NAME, 0, settings.unitsDepth, settings.equationChainLength, {});
+
+    addUnits(res, settings.unitsDepth);
+
+    cell->variable(TIME_NAME)->setInterfaceType(libcellml::Variable::InterfaceType::PUBLIC);
+    cell->variable(STATE_NAME)->setInterfaceType(libcellml::Variable::InterfaceType::PUBLIC);
+
+    res->addComponent(cell);
+
+    return res;
+}
+
+libcellml::ModelPtr createSyntheticModel(const SyntheticModelSettings &settings)
+{
+    if (settings.componentCount == 0) {
+        throw std::invalid_argument("A synthetic model must have at least one cell.");
+    }
+
+    if (settings.encapsulationDepth == 0) {
+        throw std::invalid_argument("A chain of encapsulated cells must have at least one cell.");
+    }
+
+    auto res = libcellml::Model::create("synthetic_model");
+    auto environment = libcellml::Component::create("environment");
+    auto time = addVariable(environment, TIME_NAME, timeUnitsName(settings.unitsDepth));
+
+    addUnits(res, settings.unitsDepth);
+
+    res->addComponent(environment);
+
+    // Create our cells, which come in chains of encapsulated cells, and
+    // determine their parent and the cells they are connected to.
+
+    auto encapsulationDepth = settings.encapsulationDepth;
+    auto equationChainLength = settings.equationChainLength;
+    std::vector<libcellml::ComponentPtr> cells;
+    std::vector<libcellml::ComponentPtr> topLevelCells;
+
+    for (size_t i = 0; i < settings.componentCount; ++i) {
+        auto name = "cell_" + std::to_string(i);
+        auto hasParent = (i % encapsulationDepth) != 0;
+        std::vector<std::string> inputs;
+
+        if (hasParent) {
+            inputs.push_back(cells[i - 1]->name());
+        } else if (settings.equivalenceNetwork == SyntheticModelSettings::EquivalenceNetwork::DENSE) {
+            for (size_t j = 0; j < settings.componentCount; j += encapsulationDepth) {
+                if (j != i) {
+                    inputs.push_back("cell_" + std::to_string(j));
+                }
+            }
+        } else if (!topLevelCells.empty()) {
+            inputs.push_back(topLevelCells.back()->name());
+        }
+
+        auto cell = createCell(name, i, settings.unitsDepth, equationChainLength, inputs);
+
+        if (hasParent) {
+            cells[i - 1]->addComponent(cell);
+        } else {
+            res->addComponent(cell);
+
+            topLevelCells.push_back(cell);
+        }
+
+        cells.push_back(cell);
+    }
+
+    // Connect our cells to their parent or to the environment for the time,
+    // and to the cells they depend on.
+
+    for (size_t i = 0; i < cells.size(); ++i) {
+        auto cell = cells[i];
+        auto hasParent = (i % encapsulationDepth) != 0;
+
+        libcellml::Variable::addEquivalence(hasParent ?
+                                                cells[i - 1]->variable(TIME_NAME) :
+                                                time,
+                                            cell->variable(TIME_NAME));
+
+        for (size_t j = 0; j < cell->variableCount(); ++j) {
+            auto variable = cell->variable(j);
+            auto prefix = STATE_NAME + "_";
+
+            if (variable->name().compare(0, prefix.size(), prefix) == 0) {
+                auto input = res->component(variable->name().substr(prefix.size()));
+
+                libcellml::Variable::addEquivalence(input->variable(STATE_NAME), variable);
+            }
+        }
+    }
+
+    // Import the cell of our base cell model, if needed, connecting the time
+    // of each imported cell to the environment.
+
+    if (settings.importCount != 0) {
+        auto importSource = libcellml::ImportSource::create();
+
+        importSource->setUrl(settings.baseCellUrl);
+        importSource->setModel(createBaseCellModel(settings));
+
+        for (size_t i = 0; i < settings.importCount; ++i) {
+            auto importedCell = libcellml::Component::create("imported_cell_" + std::to_string(i));
+            auto importedTime = libcellml::Variable::create(TIME_NAME);
+
+            importedCell->setSourceComponent(importSource, BASE_CELL_COMPONENT_NAME);
+            importedCell->addVariable(importedTime);
+
+            res->addComponent(importedCell);
+
+            libcellml::Variable::addEquivalence(time, importedTime);
+        }
+    }
+
+    res->fixVariableInterfaces();
+
+    return res;
+}
+
+static bool writeFile(const std::string &fileName, const std::string &contents)
+{
+    std::ofstream file(fileName);
+
+    file << contents;
+
+    return static_cast<bool>(file);
+}
+
+bool writeSyntheticModel(const libcellml::ModelPtr &model, const std::string &fileName)
+{
+    auto printer = libcellml::Printer::create();
+
+    if (!writeFile(fileName, printer->printModel(model))) {
+        return false;
+    }
+
+    // Write the model of the first import source that has one, i.e. our base
+    // cell model, next to our model.
+
+    for (size_t i = 0; i < model->componentCount(); ++i) {
+        auto component = model->component(i);
+
+        if (component->isImport() && component->importSource()->hasModel()) {
+            auto directory = fileName.substr(0, fileName.find_last_of("/\\") + 1);
+
+            return writeFile(directory + component->importSource()->url(),
+                             printer->printModel(component->importSource()->model()));
+        }
+    }
+
+    return true;
+}
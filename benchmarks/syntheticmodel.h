@@ -0,0 +1,86 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "libcellml/types.h"
+
+/**
+ * @brief The settings of a synthetic model.
+ *
+ * A synthetic model has an @c environment component, which holds the variable
+ * of integration, and a number of cells. Each cell has a state, a rate
+ * constant and a chain of algebraic variables, the last of which drives the
+ * rate of the state together with the states of the cells it is connected to.
+ */
+struct SyntheticModelSettings
+{
+    /**
+     * @brief The EquivalenceNetwork enum class.
+     *
+     * How the cells of a synthetic model are connected to one another:
+     *   - SPARSE: a cell is connected to its parent or, if it has no parent,
+     *             to the previous cell without a parent; and
+     *   - DENSE: a cell is connected to its parent and to all its siblings.
+     */
+    enum class EquivalenceNetwork
+    {
+        SPARSE,
+        DENSE
+    };
+
+    size_t componentCount = 10; /**< The number of cells, which must be at least 1. */
+    size_t encapsulationDepth = 1; /**< The number of cells in a chain of encapsulated cells, which must be at least 1. */
+    EquivalenceNetwork equivalenceNetwork = EquivalenceNetwork::SPARSE; /**< The way cells are connected. */
+    size_t importCount = 0; /**< The number of imports of the cell of the base cell model. */
+    size_t unitsDepth = 1; /**< The number of units in the hierarchy of units defining the units of time. */
+    size_t equationChainLength = 1; /**< The number of algebraic variables in the chain of a cell. */
+    std::string baseCellUrl = "base_cell.cellml"; /**< The URL of the base cell model. */
+};
+
+/**
+ * @brief Create a synthetic model.
+ *
+ * Create a synthetic model using the given settings. The imported cells, if
+ * any, import the @c cell component of a base cell model, which is set as the
+ * model of their import source, so that the synthetic model can be flattened
+ * without having to resolve its imports.
+ *
+ * @throws std::invalid_argument if the settings ask for no cells or for
+ * chains of encapsulated cells without any cell.
+ *
+ * @param settings The settings of the synthetic model.
+ *
+ * @return The synthetic model.
+ */
+libcellml::ModelPtr createSyntheticModel(const SyntheticModelSettings &settings);
+
+/**
+ * @brief Write a synthetic model to a file.
+ *
+ * Write the given synthetic model to the given file and its base cell model,
+ * if any, to a file which name is the URL of its import source, relative to
+ * the given file.
+ *
+ * @param model The synthetic model to write.
+ * @param fileName The name of the file to write to.
+ *
+ * @return @c true if the model(s) could be written, @c false otherwise.
+ */
+bool writeSyntheticModel(const libcellml::ModelPtr &model, const std::string &fileName);
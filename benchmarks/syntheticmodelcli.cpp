@@ -0,0 +1,186 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "libcellml/generator.h"
+#include "libcellml/issue.h"
+#include "libcellml/model.h"
+#include "libcellml/parser.h"
+#include "libcellml/validator.h"
+
+#include "syntheticmodel.h"
+
+static void usage(const char *program)
+{
+    std::cout << "Usage: " << program << " [options] <file>\n"
+              << "\n"
+              << "Write a synthetic CellML model to <file> and, if it has imports, its base cell\n"
+              << "model next to it.\n"
+              << "\n"
+              << "Options:\n"
+              << "  --components=<n>         Number of cells, at least 1 (default: 10).\n"
+              << "  --depth=<n>              Number of cells in a chain of encapsulated cells, at\n"
+              << "                           least 1 (default: 1).\n"
+              << "  --network=<sparse|dense> Equivalence network between the cells (default: sparse).\n"
+              << "  --imports=<n>            Number of imports of the base cell (default: 0).\n"
+              << "  --units-depth=<n>        Depth of the hierarchy of units (default: 1).\n"
+              << "  --chain-length=<n>       Number of algebraic variables in a cell (default: 1).\n"
+              << "  --check                  Check that the written model can be parsed, have its\n"
+              << "                           imports resolved, be flattened, validated and have\n"
+              << "                           code generated for it without any issues.\n"
+              << "  --help                   Show this help.\n";
+}
+
+static bool startsWith(const std::string &string, const std::string &prefix, std::string &value)
+{
+    if (string.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+
+    value = string.substr(prefix.size());
+
+    return true;
+}
+
+static size_t positiveCount(const std::string &value)
+{
+    auto res = std::stoul(value);
+
+    if (res == 0) {
+        throw std::invalid_argument(value);
+    }
+
+    return res;
+}
+
+static size_t reportIssues(const std::string &what, const libcellml::LoggerPtr &logger)
+{
+    for (size_t i = 0; i < logger->issueCount(); ++i) {
+        std::cerr << what << ": " << logger->issue(i)->description() << std::endl;
+    }
+
+    return logger->issueCount();
+}
+
+static bool checkModel(const std::string &fileName)
+{
+    std::ifstream file(fileName);
+    std::stringstream buffer;
+
+    buffer << file.rdbuf();
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(buffer.str());
+    size_t issueCount = reportIssues("Parser", parser);
+
+    model->resolveImports(fileName);
+
+    if (model->hasUnresolvedImports()) {
+        std::cerr << "Model: some imports could not be resolved." << std::endl;
+
+        ++issueCount;
+    }
+
+    model->flatten();
+
+    auto validator = libcellml::Validator::create();
+
+    validator->validateModel(model);
+
+    issueCount += reportIssues("Validator", validator);
+
+    auto generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    issueCount += reportIssues("Generator", generator);
+
+    if (issueCount == 0) {
+        std::cout << "The model has " << generator->stateCount() << " states and "
+                  << generator->variableCount() << " variables." << std::endl;
+    }
+
+    return issueCount == 0;
+}
+
+int main(int argc, char *argv[])
+{
+    SyntheticModelSettings settings;
+    std::string fileName;
+    bool check = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        std::string value;
+
+        try {
+            if (startsWith(argument, "--components=", value)) {
+                settings.componentCount = positiveCount(value);
+            } else if (startsWith(argument, "--depth=", value)) {
+                settings.encapsulationDepth = positiveCount(value);
+            } else if (startsWith(argument, "--network=", value)) {
+                if (value == "sparse") {
+                    settings.equivalenceNetwork = SyntheticModelSettings::EquivalenceNetwork::SPARSE;
+                } else if (value == "dense") {
+                    settings.equivalenceNetwork = SyntheticModelSettings::EquivalenceNetwork::DENSE;
+                } else {
+                    throw std::invalid_argument(value);
+                }
+            } else if (startsWith(argument, "--imports=", value)) {
+                settings.importCount = std::stoul(value);
+            } else if (startsWith(argument, "--units-depth=", value)) {
+                settings.unitsDepth = std::stoul(value);
+            } else if (startsWith(argument, "--chain-length=", value)) {
+                settings.equationChainLength = std::stoul(value);
+            } else if (argument == "--check") {
+                check = true;
+            } else if (argument == "--help") {
+                usage(argv[0]);
+
+                return 0;
+            } else if ((argument.compare(0, 2, "--") != 0) && fileName.empty()) {
+                fileName = argument;
+            } else {
+                throw std::invalid_argument(argument);
+            }
+        } catch (const std::exception &) {
+            std::cerr << "Error: invalid argument '" << argument << "'.\n\n";
+
+            usage(argv[0]);
+
+            return 1;
+        }
+    }
+
+    if (fileName.empty()) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    if (!writeSyntheticModel(createSyntheticModel(settings), fileName)) {
+        std::cerr << "Error: '" << fileName << "' could not be written." << std::endl;
+
+        return 1;
+    }
+
+    return (check && !checkModel(fileName)) ? 1 : 0;
+}
@@ -1,2 +1,4 @@
+include(CMakeFindDependencyMacro)
+find_dependency(Threads)
 @LIBXML2_CONFIG_MODE_INFORMATION@
 include("${CMAKE_CURRENT_LIST_DIR}/libcellml-targets.cmake")
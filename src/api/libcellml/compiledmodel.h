@@ -0,0 +1,238 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+
+#include "libcellml/logger.h"
+#include "libcellml/types.h"
+
+namespace libcellml {
+
+/**
+ * @brief The CompiledModel class.
+ *
+ * The CompiledModel class is for compiling the C code generated by a
+ * @c Generator into a shared library, loading that shared library, and
+ * giving access to the methods it contains. Compiled shared libraries are
+ * cached on disk, keyed by a hash of the generated code, compiler and compiler
+ * flags, so that compiling the same code again only requires loading it.
+ *
+ * Compiling and loading code is only supported on platforms that provide
+ * @c dlopen().
+ */
+class LIBCELLML_EXPORT CompiledModel: public Logger
+{
+public:
+    using InitializeStatesAndConstantsFunction = void (*)(double *states, double *variables); /**< Type definition for the method to initialise the states and constants. */
+    using ComputeComputedConstantsFunction = void (*)(double *variables); /**< Type definition for the method to compute the computed constants. */
+    using ComputeRatesFunction = void (*)(double voi, double *states, double *rates, double *variables); /**< Type definition for the method to compute the rates. */
+    using ComputeVariablesFunction = void (*)(double voi, double *states, double *rates, double *variables); /**< Type definition for the method to compute the variables. */
+
+    ~CompiledModel() override; /**< Destructor */
+    CompiledModel(const CompiledModel &rhs) = delete; /**< Copy constructor */
+    CompiledModel(CompiledModel &&rhs) noexcept = delete; /**< Move constructor */
+    CompiledModel &operator=(CompiledModel rhs) = delete; /**< Assignment operator */
+
+    /**
+     * @brief Create a @c CompiledModel object.
+     *
+     * Factory method to create a @c CompiledModel.  Create a
+     * compiled model with::
+     *
+     *   CompiledModelPtr compiledModel = libcellml::CompiledModel::create();
+     *
+     * @return A smart pointer to a @c CompiledModel object.
+     */
+    static CompiledModelPtr create() noexcept;
+
+    /**
+     * @brief Get the compiler.
+     *
+     * Return the command used to invoke the C compiler. The default is
+     * @c "cc".
+     *
+     * @return The compiler.
+     */
+    std::string compiler() const;
+
+    /**
+     * @brief Set the compiler.
+     *
+     * Set the command used to invoke the C compiler.
+     *
+     * @param compiler The compiler to use.
+     */
+    void setCompiler(const std::string &compiler);
+
+    /**
+     * @brief Get the compiler flags.
+     *
+     * Return the flags passed to the C compiler, in addition to the ones
+     * needed to build a shared library. The default is @c "-O2".
+     *
+     * @return The compiler flags.
+     */
+    std::string compilerFlags() const;
+
+    /**
+     * @brief Set the compiler flags.
+     *
+     * Set the flags passed to the C compiler, in addition to the ones needed
+     * to build a shared library.
+     *
+     * @param compilerFlags The compiler flags to use.
+     */
+    void setCompilerFlags(const std::string &compilerFlags);
+
+    /**
+     * @brief Get the cache directory.
+     *
+     * Return the directory in which compiled shared libraries are cached. The
+     * default is @c $XDG_CACHE_HOME/libcellml or, if @c XDG_CACHE_HOME is not
+     * set, @c $HOME/.cache/libcellml.
+     *
+     * @return The cache directory.
+     */
+    std::string cacheDirectory() const;
+
+    /**
+     * @brief Set the cache directory.
+     *
+     * Set the directory in which compiled shared libraries are cached. The
+     * directory is created, if needed, when compiling.
+     *
+     * @param cacheDirectory The cache directory to use.
+     */
+    void setCacheDirectory(const std::string &cacheDirectory);
+
+    /**
+     * @brief Compile the code generated by the given @c Generator.
+     *
+     * Compile the interface and implementation code generated by the given
+     * @c Generator, using its (C) @c GeneratorProfile, into a shared library,
+     * unless it can be found in the cache, and load it. Any previously loaded
+     * shared library is unloaded first. Any errors will be logged in the
+     * @c CompiledModel. Since the functions of a @c CompiledModel work with
+     * doubles, the @c GeneratorProfile must use double precision.
+     *
+     * @param generator The @c Generator whose code is to be compiled.
+     *
+     * @return @c true if the code could be compiled and loaded, @c false
+     * otherwise.
+     */
+    bool compile(const GeneratorPtr &generator);
+
+    /**
+     * @brief Test if some code has been compiled and loaded.
+     *
+     * Test if some code has been compiled and loaded.
+     *
+     * @return @c true if some code has been compiled and loaded, @c false
+     * otherwise.
+     */
+    bool isCompiled() const;
+
+    /**
+     * @brief Test if the loaded shared library came from the cache.
+     *
+     * Test if the shared library loaded by the last call to @c compile() was
+     * found in the cache, i.e. if no compilation was needed.
+     *
+     * @return @c true if the loaded shared library came from the cache,
+     * @c false otherwise.
+     */
+    bool isFromCache() const;
+
+    /**
+     * @brief Get the cache key.
+     *
+     * Return the key under which the shared library loaded by the last call to
+     * @c compile() is cached, i.e. the SHA-1 hash of the generated code,
+     * compiler and compiler flags. If no code has been compiled then an empty
+     * string is returned.
+     *
+     * @return The cache key.
+     */
+    std::string cacheKey() const;
+
+    /**
+     * @brief Get the number of states.
+     *
+     * Return the number of states of the compiled model.
+     *
+     * @return The number of states.
+     */
+    size_t stateCount() const;
+
+    /**
+     * @brief Get the number of variables.
+     *
+     * Return the number of variables of the compiled model.
+     *
+     * @return The number of variables.
+     */
+    size_t variableCount() const;
+
+    /**
+     * @brief Get the method to initialise the states and constants.
+     *
+     * Return the method to initialise the states and constants of the compiled
+     * model, or @c nullptr if there is no such method.
+     *
+     * @return The method to initialise the states and constants.
+     */
+    InitializeStatesAndConstantsFunction initializeStatesAndConstants() const;
+
+    /**
+     * @brief Get the method to compute the computed constants.
+     *
+     * Return the method to compute the computed constants of the compiled
+     * model, or @c nullptr if there is no such method.
+     *
+     * @return The method to compute the computed constants.
+     */
+    ComputeComputedConstantsFunction computeComputedConstants() const;
+
+    /**
+     * @brief Get the method to compute the rates.
+     *
+     * Return the method to compute the rates of the compiled model, or
+     * @c nullptr if there is no such method (e.g. for an algebraic model).
+     *
+     * @return The method to compute the rates.
+     */
+    ComputeRatesFunction computeRates() const;
+
+    /**
+     * @brief Get the method to compute the variables.
+     *
+     * Return the method to compute the variables of the compiled model, or
+     * @c nullptr if there is no such method.
+     *
+     * @return The method to compute the variables.
+     */
+    ComputeVariablesFunction computeVariables() const;
+
+private:
+    CompiledModel(); /**< Constructor */
+
+    struct CompiledModelImpl; /**< Forward declaration for pImpl idiom. */
+    CompiledModelImpl *mPimpl; /**< Private member to implementation pointer. */
+};
+
+} // namespace libcellml
@@ -16,6 +16,7 @@ limitations under the License.
 
 #pragma once
 
+#include <iosfwd>
 #include <string>
 
 #include "libcellml/logger.h"
@@ -94,6 +95,31 @@ public:
      */
     GeneratorVariable::Type type() const;
 
+    /**
+     * @brief Get the index of this @c GeneratorVariable.
+     *
+     * Return the index of this @c GeneratorVariable in the generated states
+     * array (in the case of a state) or variables array (in the case of a
+     * constant, computed constant or algebraic variable). It depends on the
+     * @c Generator::VariableOrdering used by the @c Generator.
+     *
+     * @return The index.
+     */
+    size_t index() const;
+
+    /**
+     * @brief Get the default index of this @c GeneratorVariable.
+     *
+     * Return the index that this @c GeneratorVariable has in the generated
+     * states or variables array when using the
+     * @c Generator::VariableOrdering::DEFAULT variable ordering. Together with
+     * @c index(), it gives the permutation applied by the variable ordering
+     * used by the @c Generator.
+     *
+     * @return The default index.
+     */
+    size_t defaultIndex() const;
+
 private:
     GeneratorVariable(); /**< Constructor */
 
@@ -101,6 +127,320 @@ private:
     GeneratorVariableImpl *mPimpl;
 };
 
+/**
+ * @brief The GeneratorAst class.
+ *
+ * The GeneratorAst class is for representing a node of the abstract syntax
+ * tree (AST) of an equation in the context of a CellML Generator, as well as
+ * the subtree of which it is the root. An equation is represented by an
+ * assignment node, the left child of which is the computed variable (or the
+ * derivative of the computed state) and the right child of which is the
+ * expression used to compute it.
+ */
+class LIBCELLML_EXPORT GeneratorAst
+{
+    friend class Generator;
+
+public:
+    enum class Type
+    {
+        // Assignment.
+
+        ASSIGNMENT, /**< The assignment operator, i.e. the root of an equation. */
+
+        // Relational and logical operators.
+
+        EQ, /**< The equal to operator. */
+        NEQ, /**< The not equal to operator. */
+        LT, /**< The less than operator. */
+        LEQ, /**< The less than or equal to operator. */
+        GT, /**< The greater than operator. */
+        GEQ, /**< The greater than or equal to operator. */
+        AND, /**< The and operator. */
+        OR, /**< The or operator. */
+        XOR, /**< The exclusive or operator. */
+        NOT, /**< The not operator. */
+
+        // Arithmetic operators.
+
+        PLUS, /**< The plus operator, which is unary if there is no right child. */
+        MINUS, /**< The minus operator, which is unary if there is no right child. */
+        TIMES, /**< The times operator. */
+        DIVIDE, /**< The divide operator. */
+        POWER, /**< The power operator. */
+        ROOT, /**< The root operator, which has a @c DEGREE left child if it is not a square root. */
+        ABS, /**< The absolute value function. */
+        EXP, /**< The exponential function. */
+        LN, /**< The natural logarithm function. */
+        LOG, /**< The logarithm function, which has a @c LOGBASE left child if it is not in base 10. */
+        CEILING, /**< The ceiling function. */
+        FLOOR, /**< The floor function. */
+        MIN, /**< The minimum function. */
+        MAX, /**< The maximum function. */
+        REM, /**< The remainder function. */
+
+        // Calculus elements.
+
+        DIFF, /**< The derivative of the right child with respect to the @c BVAR left child. */
+
+        // Trigonometric operators.
+
+        SIN, /**< The sine function. */
+        COS, /**< The cosine function. */
+        TAN, /**< The tangent function. */
+        SEC, /**< The secant function. */
+        CSC, /**< The cosecant function. */
+        COT, /**< The cotangent function. */
+        SINH, /**< The hyperbolic sine function. */
+        COSH, /**< The hyperbolic cosine function. */
+        TANH, /**< The hyperbolic tangent function. */
+        SECH, /**< The hyperbolic secant function. */
+        CSCH, /**< The hyperbolic cosecant function. */
+        COTH, /**< The hyperbolic cotangent function. */
+        ASIN, /**< The arc sine function. */
+        ACOS, /**< The arc cosine function. */
+        ATAN, /**< The arc tangent function. */
+        ASEC, /**< The arc secant function. */
+        ACSC, /**< The arc cosecant function. */
+        ACOT, /**< The arc cotangent function. */
+        ASINH, /**< The arc hyperbolic sine function. */
+        ACOSH, /**< The arc hyperbolic cosine function. */
+        ATANH, /**< The arc hyperbolic tangent function. */
+        ASECH, /**< The arc hyperbolic secant function. */
+        ACSCH, /**< The arc hyperbolic cosecant function. */
+        ACOTH, /**< The arc hyperbolic cotangent function. */
+
+        // Piecewise statement.
+
+        PIECEWISE, /**< A piecewise statement, the left child of which is a @c PIECE and the right child of which is the rest of the statement, if any. */
+        PIECE, /**< A piece, the left child of which is its value and the right child of which is its condition. */
+        OTHERWISE, /**< The otherwise value of a piecewise statement. */
+
+        // Token elements.
+
+        CI, /**< A variable. */
+        CN, /**< A number, the value of which is given by @c value(). */
+
+        // Qualifier elements.
+
+        DEGREE, /**< The degree of a root. */
+        LOGBASE, /**< The base of a logarithm. */
+        BVAR, /**< The bound variable of a derivative. */
+
+        // Constants.
+
+        TRUE_VALUE, /**< The true constant (not TRUE, which may be a macro). */
+        FALSE_VALUE, /**< The false constant (not FALSE, which may be a macro). */
+        E, /**< The e constant. */
+        PI, /**< The pi constant. */
+        INF, /**< The infinity constant. */
+        NAN_VALUE /**< The not-a-number constant (not NAN, which is a macro). */
+    };
+
+    ~GeneratorAst(); /**< Destructor */
+    GeneratorAst(const GeneratorAst &rhs) = delete; /**< Copy constructor */
+    GeneratorAst(GeneratorAst &&rhs) noexcept = delete; /**< Move constructor */
+    GeneratorAst &operator=(GeneratorAst rhs) = delete; /**< Assignment operator */
+
+    /**
+     * @brief Create a @c GeneratorAst object.
+     *
+     * Factory method to create a @c GeneratorAst.  Create a
+     * generator AST with::
+     *
+     *   GeneratorAstPtr generatorAst = libcellml::GeneratorAst::create();
+     *
+     * @return A smart pointer to a @c GeneratorAst object.
+     */
+    static GeneratorAstPtr create() noexcept;
+
+    /**
+     * @brief Get the @c Type for this @c GeneratorAst.
+     *
+     * Return the @c Type of this @c GeneratorAst.
+     *
+     * @return The @c Type.
+     */
+    GeneratorAst::Type type() const;
+
+    /**
+     * @brief Get the value for this @c GeneratorAst.
+     *
+     * Return the value of this @c GeneratorAst, i.e. the number it represents
+     * in the case of a @c Type::CN node, or an empty string otherwise.
+     *
+     * @return The value.
+     */
+    std::string value() const;
+
+    /**
+     * @brief Get the @c GeneratorVariable for this @c GeneratorAst.
+     *
+     * Return the @c GeneratorVariable represented by this @c GeneratorAst in
+     * the case of a @c Type::CI node, or @c nullptr otherwise. Its type and
+     * index tell where its value is to be found in the generated code.
+     *
+     * @return The @c GeneratorVariable.
+     */
+    GeneratorVariablePtr variable() const;
+
+    /**
+     * @brief Get the parent of this @c GeneratorAst.
+     *
+     * Return the parent of this @c GeneratorAst, or @c nullptr if it is the
+     * root of an equation.
+     *
+     * @return The parent.
+     */
+    GeneratorAstPtr parent() const;
+
+    /**
+     * @brief Get the left child of this @c GeneratorAst.
+     *
+     * Return the left child of this @c GeneratorAst, or @c nullptr if it
+     * doesn't have one.
+     *
+     * @return The left child.
+     */
+    GeneratorAstPtr leftChild() const;
+
+    /**
+     * @brief Get the right child of this @c GeneratorAst.
+     *
+     * Return the right child of this @c GeneratorAst, or @c nullptr if it
+     * doesn't have one.
+     *
+     * @return The right child.
+     */
+    GeneratorAstPtr rightChild() const;
+
+private:
+    GeneratorAst(); /**< Constructor */
+
+    struct GeneratorAstImpl;
+    GeneratorAstImpl *mPimpl;
+};
+
+/**
+ * @brief The GeneratorEquation class.
+ *
+ * The GeneratorEquation class is for representing an equation in the context
+ * of a CellML Generator, i.e. the computation of a computed constant, a rate
+ * or an algebraic variable, as scheduled by the Generator.
+ */
+class LIBCELLML_EXPORT GeneratorEquation
+{
+    friend class Generator;
+
+public:
+    enum class Type
+    {
+        TRUE_CONSTANT, /**< An equation that computes a computed constant using only constants and numbers. */
+        VARIABLE_BASED_CONSTANT, /**< An equation that computes a computed constant using (computed) constants. */
+        RATE, /**< An equation that computes the rate of a state. */
+        ALGEBRAIC /**< An equation that computes an algebraic variable. */
+    };
+
+    ~GeneratorEquation(); /**< Destructor */
+    GeneratorEquation(const GeneratorEquation &rhs) = delete; /**< Copy constructor */
+    GeneratorEquation(GeneratorEquation &&rhs) noexcept = delete; /**< Move constructor */
+    GeneratorEquation &operator=(GeneratorEquation rhs) = delete; /**< Assignment operator */
+
+    /**
+     * @brief Create a @c GeneratorEquation object.
+     *
+     * Factory method to create a @c GeneratorEquation.  Create a
+     * generator equation with::
+     *
+     *   GeneratorEquationPtr generatorEquation = libcellml::GeneratorEquation::create();
+     *
+     * @return A smart pointer to a @c GeneratorEquation object.
+     */
+    static GeneratorEquationPtr create() noexcept;
+
+    /**
+     * @brief Get the @c Type for this @c GeneratorEquation.
+     *
+     * Return the @c Type of this @c GeneratorEquation.
+     *
+     * @return The @c Type.
+     */
+    GeneratorEquation::Type type() const;
+
+    /**
+     * @brief Get the @c GeneratorAst for this @c GeneratorEquation.
+     *
+     * Return the @c GeneratorAst of this @c GeneratorEquation, i.e. its
+     * assignment node.
+     *
+     * @return The @c GeneratorAst.
+     */
+    GeneratorAstPtr ast() const;
+
+    /**
+     * @brief Get the @c GeneratorVariable computed by this
+     * @c GeneratorEquation.
+     *
+     * Return the @c GeneratorVariable computed by this @c GeneratorEquation,
+     * i.e. the state of which the rate is computed in the case of a
+     * @c Type::RATE equation.
+     *
+     * @return The @c GeneratorVariable.
+     */
+    GeneratorVariablePtr variable() const;
+
+    /**
+     * @brief Get the @c Component for this @c GeneratorEquation.
+     *
+     * Return the @c Component in which this @c GeneratorEquation is defined.
+     *
+     * @return The @c Component.
+     */
+    ComponentPtr component() const;
+
+    /**
+     * @brief Get the number of dependencies of this @c GeneratorEquation.
+     *
+     * Return the number of equations that must be computed before this
+     * @c GeneratorEquation can be computed.
+     *
+     * @return The number of dependencies.
+     */
+    size_t dependencyCount() const;
+
+    /**
+     * @brief Get the dependency at @p index.
+     *
+     * Return the equation at the index @p index of the equations that must be
+     * computed before this @c GeneratorEquation can be computed, or
+     * @c nullptr if the index is invalid.
+     *
+     * @param index The index of the dependency to return.
+     *
+     * @return The dependency.
+     */
+    GeneratorEquationPtr dependency(size_t index) const;
+
+    /**
+     * @brief Test to determine if this @c GeneratorEquation is state/rate
+     * based.
+     *
+     * Test to determine if this @c GeneratorEquation relies, directly or
+     * indirectly, on a state or a rate, in which case it needs to be computed
+     * whenever the rates are computed, and not only when the variables are.
+     *
+     * @return @c true if this @c GeneratorEquation is state/rate based,
+     * @c false otherwise.
+     */
+    bool isStateRateBased() const;
+
+private:
+    GeneratorEquation(); /**< Constructor */
+
+    struct GeneratorEquationImpl;
+    GeneratorEquationImpl *mPimpl;
+};
+
 /**
  * @brief The Generator class.
  *
@@ -120,6 +460,13 @@ public:
         UNSUITABLY_CONSTRAINED
     };
 
+    enum class VariableOrdering
+    {
+        DEFAULT, /**< States and variables are ordered by type and then by name or equation order. */
+        FIRST_USE, /**< States and variables are ordered by first use when computing the rates. */
+        FIRST_USE_BY_COMPONENT /**< As FIRST_USE, but with states and variables grouped by component. */
+    };
+
     ~Generator() override; /**< Destructor */
     Generator(const Generator &rhs) = delete; /**< Copy constructor */
     Generator(Generator &&rhs) noexcept = delete; /**< Move constructor */
@@ -155,6 +502,468 @@ public:
      */
     void setProfile(const GeneratorProfilePtr &profile);
 
+    /**
+     * @brief Add a required output to this @c Generator.
+     *
+     * Add the given @c Variable as a required output of this @c Generator. If
+     * there is at least one required output, then the generated code to
+     * compute the variables will only compute the required outputs and the
+     * variables on which they depend. A @c Variable that is already a required
+     * output is not added again.
+     *
+     * An issue is reported, either now or when the model gets processed, if
+     * the given @c Variable is not an algebraic variable of the model, i.e. if
+     * it is not computed by the generated code to compute the variables.
+     *
+     * @param variable The @c Variable to add as a required output.
+     */
+    void addRequiredOutput(const VariablePtr &variable);
+
+    /**
+     * @brief Remove all the required outputs from this @c Generator.
+     *
+     * Clear all the required outputs from this @c Generator, meaning that the
+     * generated code to compute the variables will compute all of them.
+     */
+    void removeAllRequiredOutputs();
+
+    /**
+     * @brief Get the number of required outputs.
+     *
+     * Return the number of required outputs of this @c Generator.
+     *
+     * @return The number of required outputs.
+     */
+    size_t requiredOutputCount() const;
+
+    /**
+     * @brief Get the required output at @p index.
+     *
+     * Return the required output at the index @p index of this @c Generator.
+     * If @p index is not valid then @c nullptr is returned.
+     *
+     * @param index The index of the required output to return.
+     *
+     * @return A reference to the required output at @p index on success,
+     * @c nullptr otherwise.
+     */
+    VariablePtr requiredOutput(size_t index) const;
+
+    /**
+     * @brief Add a sensitivity parameter to this @c Generator.
+     *
+     * Add the given @c Variable as a sensitivity parameter of this
+     * @c Generator. If there is at least one sensitivity parameter, then the
+     * generated code includes a method to compute the rates of the forward
+     * sensitivities of the states with respect to the sensitivity parameters,
+     * i.e. dS/dt = J.S + df/dp, where J is the Jacobian of the rates with
+     * respect to the states and df/dp the derivatives of the rates with
+     * respect to the sensitivity parameters. Those derivatives are obtained by
+     * symbolic differentiation. Integrating that method alongside the method
+     * to compute the rates gives the sensitivities of all the states with
+     * respect to all the sensitivity parameters in one go.
+     *
+     * A sensitivity parameter must be a constant of the processed @c Model
+     * (i.e. a @c GeneratorVariable of type
+     * @c GeneratorVariable::Type::CONSTANT), otherwise it is ignored when
+     * generating code. The sensitivity of the state at index @c i with
+     * respect to the @c k-th sensitivity parameter that is not ignored is
+     * stored at index @c k*STATE_COUNT+i of the sensitivities array.
+     * Sensitivities should initially be zero.
+     *
+     * @param variable The @c Variable to add as a sensitivity parameter. A
+     * @c nullptr is not added.
+     */
+    void addSensitivityParameter(const VariablePtr &variable);
+
+    /**
+     * @brief Remove all the sensitivity parameters from this @c Generator.
+     *
+     * Clear all the sensitivity parameters from this @c Generator, meaning that
+     * no code to compute sensitivities will be generated.
+     */
+    void removeAllSensitivityParameters();
+
+    /**
+     * @brief Get the number of sensitivity parameters.
+     *
+     * Return the number of sensitivity parameters of this @c Generator.
+     *
+     * @return The number of sensitivity parameters.
+     */
+    size_t sensitivityParameterCount() const;
+
+    /**
+     * @brief Get the sensitivity parameter at @p index.
+     *
+     * Return the sensitivity parameter at the index @p index of this
+     * @c Generator. If @p index is not valid then @c nullptr is returned.
+     *
+     * @param index The index of the sensitivity parameter to return.
+     *
+     * @return A reference to the sensitivity parameter at @p index on success,
+     * @c nullptr otherwise.
+     */
+    VariablePtr sensitivityParameter(size_t index) const;
+
+    /**
+     * @brief Add a sweep parameter to this @c Generator.
+     *
+     * Add the given @c Variable as a sweep parameter of this @c Generator. If
+     * there is at least one sweep parameter, then the generated code includes
+     * methods to initialise the states and (computed) constants, and to
+     * compute the rates, of a batch of instances of the model, each instance
+     * having its own values for the sweep parameters. The other constants are
+     * the same for all the instances, so their value is baked into those
+     * methods.
+     *
+     * The sweep parameters are read from a matrix with one row per instance,
+     * i.e. the value of the @c k-th sweep parameter that is not ignored for
+     * instance @c i is at index @c i*SWEEP_PARAMETER_COUNT+k of the parameters
+     * array. The states, rates and variables arrays are laid out so that the
+     * instances are contiguous, i.e. the state (or rate or variable) at index
+     * @c j for instance @c i is at index @c j*instanceCount+i, which allows the
+     * loop over the instances to be vectorised.
+     *
+     * A sweep parameter must be a constant of the processed @c Model (i.e. a
+     * @c GeneratorVariable of type @c GeneratorVariable::Type::CONSTANT),
+     * otherwise it is ignored when generating code.
+     *
+     * @param variable The @c Variable to add as a sweep parameter. A
+     * @c nullptr is not added.
+     */
+    void addSweepParameter(const VariablePtr &variable);
+
+    /**
+     * @brief Remove all the sweep parameters from this @c Generator.
+     *
+     * Clear all the sweep parameters from this @c Generator, meaning that no
+     * batch methods will be generated.
+     */
+    void removeAllSweepParameters();
+
+    /**
+     * @brief Get the number of sweep parameters.
+     *
+     * Return the number of sweep parameters of this @c Generator.
+     *
+     * @return The number of sweep parameters.
+     */
+    size_t sweepParameterCount() const;
+
+    /**
+     * @brief Get the sweep parameter at @p index.
+     *
+     * Return the sweep parameter at the index @p index of this @c Generator.
+     * If @p index is not valid then @c nullptr is returned.
+     *
+     * @param index The index of the sweep parameter to return.
+     *
+     * @return A reference to the sweep parameter at @p index on success,
+     * @c nullptr otherwise.
+     */
+    VariablePtr sweepParameter(size_t index) const;
+
+    /**
+     * @brief Set the lookup table to be used by this @c Generator.
+     *
+     * Set the lookup table to be used by this @c Generator. The generated code
+     * will precompute, on a uniform grid ranging from @p minimum to
+     * @p maximum with the given @p step, the subexpressions that involve an
+     * expensive function (e.g. an exponential) and that depend only on the
+     * given state @c Variable and on true constants (i.e. computed constants
+     * that do not depend on any variable). Those subexpressions are then
+     * evaluated using linear interpolation, falling back to their exact value
+     * outside the range of the lookup table. If @p variable is @c nullptr, then
+     * the state on which the most such subexpressions depend is used. The
+     * lookup table is private to the generated code and is the same for all
+     * of its callers, whatever the values of their constants.
+     *
+     * A lookup table is only used if @p minimum is less than @p maximum and
+     * @p step is positive. The grid should avoid the points where a tabulated
+     * subexpression cannot be evaluated (e.g. a removable singularity), since
+     * such an entry would spoil the interpolation around it.
+     *
+     * @param variable The state @c Variable to use as the argument of the
+     * lookup table, or @c nullptr to detect it automatically.
+     * @param minimum The minimum value of the argument of the lookup table.
+     * @param maximum The maximum value of the argument of the lookup table.
+     * @param step The step of the argument of the lookup table.
+     */
+    void setLookupTable(const VariablePtr &variable, double minimum,
+                        double maximum, double step);
+
+    /**
+     * @brief Remove the lookup table from this @c Generator.
+     *
+     * Remove the lookup table from this @c Generator, meaning that the
+     * generated code will compute all the subexpressions exactly.
+     */
+    void removeLookupTable();
+
+    /**
+     * @brief Test if this @c Generator has a lookup table.
+     *
+     * Test if this @c Generator has a lookup table.
+     *
+     * @return @c true if this @c Generator has a lookup table, @c false
+     * otherwise.
+     */
+    bool hasLookupTable() const;
+
+    /**
+     * @brief Get the @c Variable of the lookup table.
+     *
+     * Return the state @c Variable used as the argument of the lookup table of
+     * this @c Generator. If there is no lookup table or if the state is to be
+     * detected automatically then @c nullptr is returned.
+     *
+     * @return The @c Variable of the lookup table.
+     */
+    VariablePtr lookupTableVariable() const;
+
+    /**
+     * @brief Get the minimum value of the argument of the lookup table.
+     *
+     * Return the minimum value of the argument of the lookup table of this
+     * @c Generator.
+     *
+     * @return The minimum value of the argument of the lookup table.
+     */
+    double lookupTableMinimum() const;
+
+    /**
+     * @brief Get the maximum value of the argument of the lookup table.
+     *
+     * Return the maximum value of the argument of the lookup table of this
+     * @c Generator.
+     *
+     * @return The maximum value of the argument of the lookup table.
+     */
+    double lookupTableMaximum() const;
+
+    /**
+     * @brief Get the step of the argument of the lookup table.
+     *
+     * Return the step of the argument of the lookup table of this
+     * @c Generator.
+     *
+     * @return The step of the argument of the lookup table.
+     */
+    double lookupTableStep() const;
+
+    /**
+     * @brief Set whether this @c Generator generates specialised methods.
+     *
+     * Set whether the generated code includes, alongside the generic methods
+     * to compute the rates and variables, specialised versions of them in
+     * which the constants and computed constants are literals. The value of a
+     * constant is its current initial value, while the value of a computed
+     * constant is folded from those values when generating code, so the C
+     * compiler can propagate them, simplify the expressions that use them and
+     * drop the pieces of piecewise expressions that never apply. A computed
+     * constant that cannot be folded (e.g. because it would not be finite) is
+     * still read from the variables array, so the states and constants must
+     * still be initialised and the computed constants computed as usual.
+     * Specialised methods are only generated if the profile has strings for
+     * them, i.e. only for C by default.
+     *
+     * @param hasSpecializedMethods A @c bool to determine whether this
+     * @c Generator generates specialised methods.
+     */
+    void setHasSpecializedMethods(bool hasSpecializedMethods);
+
+    /**
+     * @brief Test if this @c Generator generates specialised methods.
+     *
+     * Test if this @c Generator generates specialised methods.
+     *
+     * @return @c true if this @c Generator generates specialised methods,
+     * @c false otherwise.
+     */
+    bool hasSpecializedMethods() const;
+
+    /**
+     * @brief Set the maximum number of statements per method.
+     *
+     * Set the maximum number of statements in the generated methods to compute
+     * the computed constants, rates and variables. A method with more
+     * statements is split into chunks of at most @p maximumStatementCount
+     * statements, which the method then calls in sequence. This keeps the
+     * generated functions small, which helps with the compilation time of
+     * large models. A value of @c 0, the default, means that methods are not
+     * split.
+     *
+     * @param maximumStatementCount The maximum number of statements per
+     * method.
+     */
+    void setMaximumStatementCount(size_t maximumStatementCount);
+
+    /**
+     * @brief Get the maximum number of statements per method.
+     *
+     * Return the maximum number of statements in the generated methods to
+     * compute the computed constants, rates and variables, or @c 0 if methods
+     * are not split.
+     *
+     * @return The maximum number of statements per method.
+     */
+    size_t maximumStatementCount() const;
+
+    /**
+     * @brief Set the number of equations per parallel task.
+     *
+     * Set the number of equations per parallel task in the generated methods
+     * to compute the rates and variables. A value other than @c 0 means that
+     * the equations computed by those methods are grouped into levels, using
+     * their dependencies, with the equations of a level being independent of
+     * one another. Each level is then split into tasks of at most
+     * @p parallelChunkSize equations, which can be run in parallel, allowing
+     * the evaluation of a large model to use several cores. The parallel code
+     * relies on the parallel region, level and task strings of the
+     * @c GeneratorProfile (e.g. OpenMP directives for the C profile, which are
+     * ignored by a C compiler that doesn't support OpenMP or if OpenMP is not
+     * enabled). If the profile has no such strings then sequential code is
+     * generated. A value of @c 0, the default, means that sequential code is
+     * generated, which may be split according to @c maximumStatementCount().
+     *
+     * @param parallelChunkSize The number of equations per parallel task.
+     */
+    void setParallelChunkSize(size_t parallelChunkSize);
+
+    /**
+     * @brief Get the number of equations per parallel task.
+     *
+     * Return the number of equations per parallel task in the generated
+     * methods to compute the rates and variables, or @c 0 if sequential code
+     * is generated.
+     *
+     * @return The number of equations per parallel task.
+     */
+    size_t parallelChunkSize() const;
+
+    /**
+     * @brief Set the minimum number of instances for an instance kernel.
+     *
+     * Set the minimum number of instances of a component for the generated
+     * methods to compute the rates and variables to use an instance kernel for
+     * them. Instances of a component (e.g. the cells of a fibre, which were
+     * imported several times before the model was flattened) are detected by
+     * comparing the structure of the equations of each component, and those
+     * instances whose states, rates and variables are at evenly spaced indices
+     * get computed by a kernel that loops over them rather than by a copy of
+     * their equations for each instance. A component must have at least two
+     * instances for a kernel to be used. Instance kernels are not used with
+     * parallel code or with a lookup table. A value of @c 0, the default,
+     * means that no instance kernels are used.
+     *
+     * @param minimumInstanceCount The minimum number of instances for an
+     * instance kernel.
+     */
+    void setMinimumInstanceCount(size_t minimumInstanceCount);
+
+    /**
+     * @brief Get the minimum number of instances for an instance kernel.
+     *
+     * Return the minimum number of instances of a component for the generated
+     * methods to compute the rates and variables to use an instance kernel for
+     * them, or @c 0 if no instance kernels are used.
+     *
+     * @return The minimum number of instances for an instance kernel.
+     */
+    size_t minimumInstanceCount() const;
+
+    /**
+     * @brief Set the maximum number of threads used to process a model.
+     *
+     * Set the maximum number of threads used by @c processModel() to process
+     * the math of the components of a model, which can be done independently
+     * for each component. The variables referenced by that math are then
+     * resolved sequentially, so the result of @c processModel() doesn't depend
+     * on the number of threads used. A thread is only used for a reasonable
+     * number of components, so a small model is always processed using only
+     * the calling thread. A value of @c 0, the default, means that as many
+     * threads as the hardware supports may be used.
+     *
+     * @param maximumThreadCount The maximum number of threads used to process
+     * a model.
+     */
+    void setMaximumThreadCount(size_t maximumThreadCount);
+
+    /**
+     * @brief Get the maximum number of threads used to process a model.
+     *
+     * Return the maximum number of threads used by @c processModel() to
+     * process the math of the components of a model, or @c 0 if as many
+     * threads as the hardware supports may be used.
+     *
+     * @return The maximum number of threads used to process a model.
+     */
+    size_t maximumThreadCount() const;
+
+    /**
+     * @brief Set the @c VariableOrdering.
+     *
+     * Set the order in which the states and variables are stored in the
+     * generated states and variables arrays. With
+     * @c VariableOrdering::FIRST_USE, they are ordered by first use in the
+     * generated method to compute the rates (or to compute the variables, in
+     * the case of an algebraic model), so that the values used together are
+     * stored close to one another, something that reduces the number of cache
+     * lines touched when evaluating the rates of a large model. States and
+     * variables that are not used in that method come last, in their default
+     * order. With @c VariableOrdering::FIRST_USE_BY_COMPONENT, states and
+     * variables are additionally grouped by component, components being
+     * ordered by first use. The default is @c VariableOrdering::DEFAULT.
+     *
+     * The resulting permutation is available through
+     * @c GeneratorVariable::index() and @c GeneratorVariable::defaultIndex().
+     *
+     * @param variableOrdering The @c VariableOrdering to use.
+     */
+    void setVariableOrdering(VariableOrdering variableOrdering);
+
+    /**
+     * @brief Get the @c VariableOrdering.
+     *
+     * Return the order in which the states and variables are stored in the
+     * generated states and variables arrays.
+     *
+     * @return The @c VariableOrdering.
+     */
+    VariableOrdering variableOrdering() const;
+
+    /**
+     * @brief Set the size of the analysis cache.
+     *
+     * Set the maximum number of analyses kept by this @c Generator. The
+     * analysis of a @c Model, i.e. its classified variables, their indices and
+     * its scheduled equations, is cached using a hash of the structure of the
+     * @c Model (i.e. of its components, variables, equivalences, maths and
+     * resets). Processing a @c Model with the same structure as a cached one,
+     * be it the same @c Model or another instance of it (e.g. parsed from the
+     * same file), then only requires that hash to be computed and the cached
+     * analysis to be re-attached to the @c Model, using the names of its
+     * components and variables. Only the analyses that result in no issues are
+     * cached and, once the cache is full, the least recently used analysis is
+     * removed from it. A cached analysis does not keep the @c Model from which
+     * it was computed, or any of its components and variables, alive. A value
+     * of @c 0, the default, means that no analyses are cached.
+     *
+     * @param analysisCacheSize The maximum number of cached analyses.
+     */
+    void setAnalysisCacheSize(size_t analysisCacheSize);
+
+    /**
+     * @brief Get the size of the analysis cache.
+     *
+     * Return the maximum number of analyses kept by this @c Generator, or
+     * @c 0 if no analyses are cached.
+     *
+     * @return The maximum number of cached analyses.
+     */
+    size_t analysisCacheSize() const;
+
     /**
      * @brief Process the @c Model.
      *
@@ -223,6 +1032,29 @@ public:
      */
     GeneratorVariablePtr variable(size_t index) const;
 
+    /**
+     * @brief Get the number of equations in the @c Model.
+     *
+     * Return the number of equations in the @c Model processed by this
+     * @c Generator.
+     *
+     * @return The number of equations.
+     */
+    size_t equationCount() const;
+
+    /**
+     * @brief Get the equation at @p index.
+     *
+     * Return the equation at the index @p index for the @c Model processed by
+     * this @c Generator. Equations are scheduled, i.e. an equation is always
+     * preceded by its dependencies, so that a back-end can compute the
+     * equations of a given @c GeneratorEquation::Type in the order in which
+     * they are returned, without having to parse the generated code.
+     *
+     * @param index The index of the equation to return.
+     */
+    GeneratorEquationPtr equation(size_t index) const;
+
     /**
      * @brief Get the interface code for the @c Model.
      *
@@ -239,10 +1071,46 @@ public:
      * Return the implementation code for the @c Model processed by this
      * @c Generator, using its @c GeneratorProfile.
      *
+     * If the @c Model is an ODE model with resets, then the code also includes
+     * a method to compute the root of each reset, i.e. the difference between
+     * its test variable and its test value, and a method to apply the resets
+     * flagged as active in an array of events. Both methods consider the
+     * resets sorted by order. A simulator is expected to locate a change of
+     * sign of a root and to then apply the corresponding reset, with the reset
+     * of lowest order taking precedence for a given variable. Only states can
+     * be reset, a reset of any other variable making the @c Model invalid.
+     *
      * @return The code.
      */
     std::string implementationCode() const;
 
+    /**
+     * @brief Write the interface code for the @c Model to the given stream.
+     *
+     * Write the same code as @sa interfaceCode to the given @p stream (e.g. a
+     * @c std::ofstream to write it to a file). The code is written block by
+     * block, so that it never needs to be kept in memory as a whole.
+     *
+     * @param stream The stream to which the code is written.
+     */
+    void writeInterfaceCode(std::ostream &stream) const;
+
+    /**
+     * @brief Write the implementation code for the @c Model to the given
+     * stream.
+     *
+     * Write the same code as @sa implementationCode to the given @p stream
+     * (e.g. a @c std::ofstream to write it to a file). The code is written
+     * through a buffer of fixed size. The methods that compute the model are
+     * written equation by equation, so that neither the code nor the body of
+     * those methods is ever kept in memory as a whole, unless those methods
+     * have to be split into chunks, computed in parallel or computed using
+     * instance kernels. The body of the other methods is kept in memory.
+     *
+     * @param stream The stream to which the code is written.
+     */
+    void writeImplementationCode(std::ostream &stream) const;
+
 private:
     Generator(); /**< Constructor */
 
@@ -32,10 +32,36 @@ namespace libcellml {
 class LIBCELLML_EXPORT GeneratorProfile
 {
 public:
+    /**
+     * @brief The profile enumeration.
+     *
+     * The NumPy profile is a variant of the Python profile where the states,
+     * rates and variables arrays are 2-D NumPy arrays with one row per
+     * state/variable and one column per instance of the model, so that a
+     * single call to a method evaluates all the instances at once.
+     */
     enum class Profile
     {
-        C,
-        PYTHON
+        C, /**< The C profile. */
+        PYTHON, /**< The Python profile. */
+        NUMPY /**< The NumPy (i.e. vectorised Python) profile. */
+    };
+
+    /**
+     * @brief The precision enumeration.
+     *
+     * The precision determines the type used to store the states, rates and
+     * variables (i.e. the storage type), and the type used to compute them
+     * (i.e. the compute type). With a mixed precision, values are stored as
+     * single-precision numbers, but they are cast to double-precision numbers
+     * when they are read, so that computations are done in double precision.
+     * The precision only affects the C profile.
+     */
+    enum class Precision
+    {
+        DOUBLE, /**< Double-precision storage and computations. */
+        SINGLE, /**< Single-precision storage and computations. */
+        MIXED /**< Single-precision storage and double-precision computations. */
     };
 
     ~GeneratorProfile(); /**< Destructor */
@@ -75,6 +101,28 @@ public:
      */
     void setProfile(Profile profile);
 
+    /**
+     * @brief Get the @c Precision for this @c GeneratorProfile.
+     *
+     * Return the @c Precision for this @c GeneratorProfile.
+     *
+     * @return The @c Precision for this @c GeneratorProfile.
+     */
+    Precision precision() const;
+
+    /**
+     * @brief Set the @c Precision.
+     *
+     * Set this @c GeneratorProfile to the given @c Precision. Like when
+     * setting the @c Profile, the strings of this @c GeneratorProfile are
+     * reloaded, this time using the storage type, compute type, mathematical
+     * functions (e.g. @c expf rather than @c exp) and floating-point literals
+     * of the given @c Precision.
+     *
+     * @param precision The @c Precision to use.
+     */
+    void setPrecision(Precision precision);
+
     // Whether the profile requires an interface to be generated.
 
     /**
@@ -102,6 +150,123 @@ public:
      */
     void setHasInterface(bool hasInterface);
 
+    // Whether the profile requires the generated code to be optimised.
+
+    /**
+     * @brief Test if this @c GeneratorProfile requires the generated code to
+     * be optimised.
+     *
+     * Test if this @c GeneratorProfile requires the generated code to be
+     * optimised, i.e. whether constant sub-expressions are to be folded,
+     * powers with a small integer exponent replaced with multiplications, and
+     * unary minus operators and identity operations simplified.
+     *
+     * @return @c true if the @c GeneratorProfile requires the generated code
+     * to be optimised, @c false otherwise.
+     */
+    bool hasCodeOptimization() const;
+
+    /**
+     * @brief Set whether this @c GeneratorProfile requires the generated code
+     * to be optimised.
+     *
+     * Set whether this @c GeneratorProfile requires the generated code to be
+     * optimised.
+     *
+     * @param hasCodeOptimization A @c bool to determine whether this
+     * @c GeneratorProfile requires the generated code to be optimised.
+     */
+    void setHasCodeOptimization(bool hasCodeOptimization);
+
+    // Whether the profile requires the Jacobian to be generated.
+
+    /**
+     * @brief Test if this @c GeneratorProfile requires the Jacobian of the
+     * rates to be generated.
+     *
+     * Test if this @c GeneratorProfile requires the Jacobian of the rates with
+     * respect to the states to be generated, i.e. its sparsity pattern, in
+     * compressed sparse row format, and a method to compute its non-zero
+     * entries. The Jacobian is only generated for an ODE model.
+     *
+     * @return @c true if the @c GeneratorProfile requires the Jacobian of the
+     * rates to be generated, @c false otherwise.
+     */
+    bool hasJacobian() const;
+
+    /**
+     * @brief Set whether this @c GeneratorProfile requires the Jacobian of the
+     * rates to be generated.
+     *
+     * Set whether this @c GeneratorProfile requires the Jacobian of the rates
+     * to be generated.
+     *
+     * @param hasJacobian A @c bool to determine whether this
+     * @c GeneratorProfile requires the Jacobian of the rates to be generated.
+     */
+    void setHasJacobian(bool hasJacobian);
+
+    // Whether the profile requires a Rush-Larsen step to be generated.
+
+    /**
+     * @brief Test if this @c GeneratorProfile requires a Rush-Larsen step to be
+     * generated.
+     *
+     * Test if this @c GeneratorProfile requires a method to be generated that
+     * advances the states by one Rush-Larsen step, i.e. states that are linear
+     * in themselves, such as gating variables, are updated using an exact
+     * exponential update while the other states are updated using forward
+     * Euler.
+     *
+     * @return @c true if the @c GeneratorProfile requires a Rush-Larsen step to
+     * be generated, @c false otherwise.
+     */
+    bool hasRushLarsen() const;
+
+    /**
+     * @brief Set whether this @c GeneratorProfile requires a Rush-Larsen step
+     * to be generated.
+     *
+     * Set whether this @c GeneratorProfile requires a Rush-Larsen step to be
+     * generated.
+     *
+     * @param hasRushLarsen A @c bool to determine whether this
+     * @c GeneratorProfile requires a Rush-Larsen step to be generated.
+     */
+    void setHasRushLarsen(bool hasRushLarsen);
+
+    // Whether the profile requires piecewise statements to be branchless.
+
+    /**
+     * @brief Test if this @c GeneratorProfile requires piecewise statements to
+     * be branchless.
+     *
+     * Test if this @c GeneratorProfile requires piecewise statements to be
+     * branchless, i.e. whether all the pieces of a piecewise statement are to
+     * be evaluated and the value of the first piece which condition is true
+     * then selected, so that a loop over the compute methods can be
+     * vectorised. The value of a piece that is not selected, be it a NaN or
+     * an infinity, never affects the result. The code to retrieve a value from
+     * a lookup table still branches, so that the lookup table is never read
+     * outside of its range.
+     *
+     * @return @c true if the @c GeneratorProfile requires piecewise statements
+     * to be branchless, @c false otherwise.
+     */
+    bool hasBranchlessPiecewise() const;
+
+    /**
+     * @brief Set whether this @c GeneratorProfile requires piecewise statements
+     * to be branchless.
+     *
+     * Set whether this @c GeneratorProfile requires piecewise statements to be
+     * branchless.
+     *
+     * @param hasBranchlessPiecewise A @c bool to determine whether this
+     * @c GeneratorProfile requires piecewise statements to be branchless.
+     */
+    void setHasBranchlessPiecewise(bool hasBranchlessPiecewise);
+
     // Assignment.
 
     /**
@@ -1307,6 +1472,58 @@ public:
      */
     void setConditionalOperatorElseString(const std::string &conditionalOperatorElseString);
 
+    /**
+     * @brief Get the @c std::string for the if part of a branchless piecewise
+     * statement.
+     *
+     * Return the @c std::string for the if part of a branchless piecewise
+     * statement.
+     *
+     * @return The @c std::string for the if part of a branchless piecewise
+     * statement.
+     */
+    std::string branchlessPiecewiseIfString() const;
+
+    /**
+     * @brief Set the @c std::string for the if part of a branchless piecewise
+     * statement.
+     *
+     * Set this @c std::string for the if part of a branchless piecewise
+     * statement. To be useful, the string should contain the <CONDITION> and
+     * <IF_STATEMENT> tags, which will be replaced with the condition and the
+     * value of a piece.
+     *
+     * @param branchlessPiecewiseIfString The @c std::string to use for the if
+     * part of a branchless piecewise statement.
+     */
+    void setBranchlessPiecewiseIfString(const std::string &branchlessPiecewiseIfString);
+
+    /**
+     * @brief Get the @c std::string for the else part of a branchless piecewise
+     * statement.
+     *
+     * Return the @c std::string for the else part of a branchless piecewise
+     * statement.
+     *
+     * @return The @c std::string for the else part of a branchless piecewise
+     * statement.
+     */
+    std::string branchlessPiecewiseElseString() const;
+
+    /**
+     * @brief Set the @c std::string for the else part of a branchless piecewise
+     * statement.
+     *
+     * Set this @c std::string for the else part of a branchless piecewise
+     * statement. To be useful, the string should contain the <ELSE_STATEMENT>
+     * tag, which will be replaced with the value of the rest of the piecewise
+     * statement.
+     *
+     * @param branchlessPiecewiseElseString The @c std::string to use for the
+     * else part of a branchless piecewise statement.
+     */
+    void setBranchlessPiecewiseElseString(const std::string &branchlessPiecewiseElseString);
+
     /**
      * @brief Get the @c std::string for the if part of a piecewise statement.
      *
@@ -1475,6 +1692,25 @@ public:
      */
     void setNanString(const std::string &nanString);
 
+    /**
+     * @brief Get the @c std::string for the suffix of a floating-point literal.
+     *
+     * Return the @c std::string for the suffix of a floating-point literal.
+     *
+     * @return The @c std::string for the suffix of a floating-point literal.
+     */
+    std::string floatingPointLiteralSuffixString() const;
+
+    /**
+     * @brief Set the @c std::string for the suffix of a floating-point literal.
+     *
+     * Set this @c std::string for the suffix of a floating-point literal.
+     *
+     * @param floatingPointLiteralSuffixString The @c std::string to use for the
+     * suffix of a floating-point literal.
+     */
+    void setFloatingPointLiteralSuffixString(const std::string &floatingPointLiteralSuffixString);
+
     // Arithmetic functions.
 
     /**
@@ -1701,6 +1937,27 @@ public:
      */
     void setMaxFunctionString(const std::string &maxFunctionString);
 
+    /**
+     * @brief Get the @c std::string for the blend function.
+     *
+     * Return the @c std::string for the blend function.
+     *
+     * @return The @c std::string for the blend function.
+     */
+    std::string blendFunctionString() const;
+
+    /**
+     * @brief Set the @c std::string for the blend function.
+     *
+     * Set this @c std::string for the blend function, which is used by
+     * branchless piecewise statements to select one of two values that have
+     * both already been evaluated.
+     *
+     * @param blendFunctionString The @c std::string to use for the blend
+     * function.
+     */
+    void setBlendFunctionString(const std::string &blendFunctionString);
+
     // Trigonometric functions.
 
     /**
@@ -2511,6 +2768,228 @@ public:
      */
     void setImplementationVariableInfoString(const std::string &implementationVariableInfoString);
 
+    /**
+     * @brief Get the @c std::string for the interface of the sparsity pattern
+     * of the Jacobian.
+     *
+     * Return the @c std::string for the interface of the sparsity pattern of
+     * the Jacobian.
+     *
+     * @return The @c std::string for the interface of the sparsity pattern of
+     * the Jacobian.
+     */
+    std::string interfaceJacobianSparsityString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the sparsity pattern
+     * of the Jacobian.
+     *
+     * Set this @c std::string for the interface of the sparsity pattern of the
+     * Jacobian.
+     *
+     * @param interfaceJacobianSparsityString The @c std::string to use for the
+     * interface of the sparsity pattern of the Jacobian.
+     */
+    void setInterfaceJacobianSparsityString(const std::string &interfaceJacobianSparsityString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the sparsity
+     * pattern of the Jacobian.
+     *
+     * Return the @c std::string for the implementation of the sparsity pattern
+     * of the Jacobian.
+     *
+     * @return The @c std::string for the implementation of the sparsity pattern
+     * of the Jacobian.
+     */
+    std::string implementationJacobianSparsityString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the sparsity
+     * pattern of the Jacobian.
+     *
+     * Set this @c std::string for the implementation of the sparsity pattern of
+     * the Jacobian. To be useful, the string should contain the
+     * <NON_ZERO_COUNT>, <ROW_POINTERS> and <COLUMN_INDICES> tags, which will be
+     * replaced with the number of non-zero entries in the Jacobian and with the
+     * row pointers and column indices of the Jacobian in compressed sparse row
+     * format.
+     *
+     * @param implementationJacobianSparsityString The @c std::string to use for
+     * the implementation of the sparsity pattern of the Jacobian.
+     */
+    void setImplementationJacobianSparsityString(const std::string &implementationJacobianSparsityString);
+
+    /**
+     * @brief Get the @c std::string for the column indices of a Jacobian
+     * without any non-zero entry.
+     *
+     * Return the @c std::string for the column indices of a Jacobian without
+     * any non-zero entry.
+     *
+     * @return The @c std::string for the column indices of a Jacobian without
+     * any non-zero entry.
+     */
+    std::string emptyJacobianColumnIndicesString() const;
+
+    /**
+     * @brief Set the @c std::string for the column indices of a Jacobian
+     * without any non-zero entry.
+     *
+     * Set this @c std::string for the column indices of a Jacobian without any
+     * non-zero entry. The string is used in place of the <COLUMN_INDICES> tag
+     * of the implementation of the sparsity pattern of the Jacobian when the
+     * Jacobian has no non-zero entries, e.g. since an empty initialiser list is
+     * not valid in C.
+     *
+     * @param emptyJacobianColumnIndicesString The @c std::string to use for the
+     * column indices of a Jacobian without any non-zero entry.
+     */
+    void setEmptyJacobianColumnIndicesString(const std::string &emptyJacobianColumnIndicesString);
+
+    /**
+     * @brief Get the @c std::string for the interface of the number of
+     * sensitivity parameters.
+     *
+     * Return the @c std::string for the interface of the number of sensitivity
+     * parameters.
+     *
+     * @return The @c std::string for the interface of the number of sensitivity
+     * parameters.
+     */
+    std::string interfaceSensitivityParameterCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the number of
+     * sensitivity parameters.
+     *
+     * Set this @c std::string for the interface of the number of sensitivity
+     * parameters.
+     *
+     * @param interfaceSensitivityParameterCountString The @c std::string to use
+     * for the interface of the number of sensitivity parameters.
+     */
+    void setInterfaceSensitivityParameterCountString(const std::string &interfaceSensitivityParameterCountString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the number of
+     * sensitivity parameters.
+     *
+     * Return the @c std::string for the implementation of the number of
+     * sensitivity parameters.
+     *
+     * @return The @c std::string for the implementation of the number of
+     * sensitivity parameters.
+     */
+    std::string implementationSensitivityParameterCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the number of
+     * sensitivity parameters.
+     *
+     * Set this @c std::string for the implementation of the number of
+     * sensitivity parameters. To be useful, the string should contain the
+     * <SENSITIVITY_PARAMETER_COUNT> tag, which will be replaced with the number
+     * of sensitivity parameters.
+     *
+     * @param implementationSensitivityParameterCountString The @c std::string
+     * to use for the implementation of the number of sensitivity parameters.
+     */
+    void setImplementationSensitivityParameterCountString(const std::string &implementationSensitivityParameterCountString);
+
+    /**
+     * @brief Get the @c std::string for the interface of the number of sweep
+     * parameters.
+     *
+     * Return the @c std::string for the interface of the number of sweep
+     * parameters.
+     *
+     * @return The @c std::string for the interface of the number of sweep
+     * parameters.
+     */
+    std::string interfaceSweepParameterCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the number of sweep
+     * parameters.
+     *
+     * Set this @c std::string for the interface of the number of sweep
+     * parameters.
+     *
+     * @param interfaceSweepParameterCountString The @c std::string to use for
+     * the interface of the number of sweep parameters.
+     */
+    void setInterfaceSweepParameterCountString(const std::string &interfaceSweepParameterCountString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the number of
+     * sweep parameters.
+     *
+     * Return the @c std::string for the implementation of the number of sweep
+     * parameters.
+     *
+     * @return The @c std::string for the implementation of the number of sweep
+     * parameters.
+     */
+    std::string implementationSweepParameterCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the number of
+     * sweep parameters.
+     *
+     * Set this @c std::string for the implementation of the number of sweep
+     * parameters. To be useful, the string should contain the
+     * <SWEEP_PARAMETER_COUNT> tag, which will be replaced with the number of
+     * sweep parameters.
+     *
+     * @param implementationSweepParameterCountString The @c std::string to use
+     * for the implementation of the number of sweep parameters.
+     */
+    void setImplementationSweepParameterCountString(const std::string &implementationSweepParameterCountString);
+
+    /**
+     * @brief Get the @c std::string for the interface of the number of resets.
+     *
+     * Return the @c std::string for the interface of the number of resets.
+     *
+     * @return The @c std::string for the interface of the number of resets.
+     */
+    std::string interfaceResetCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the number of resets.
+     *
+     * Set this @c std::string for the interface of the number of resets.
+     *
+     * @param interfaceResetCountString The @c std::string to use for the
+     * interface of the number of resets.
+     */
+    void setInterfaceResetCountString(const std::string &interfaceResetCountString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the number of
+     * resets.
+     *
+     * Return the @c std::string for the implementation of the number of resets.
+     *
+     * @return The @c std::string for the implementation of the number of
+     * resets.
+     */
+    std::string implementationResetCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the number of
+     * resets.
+     *
+     * Set this @c std::string for the implementation of the number of resets.
+     * To be useful, the string should contain the <RESET_COUNT> tag, which will
+     * be replaced with the number of resets.
+     *
+     * @param implementationResetCountString The @c std::string to use for the
+     * implementation of the number of resets.
+     */
+    void setImplementationResetCountString(const std::string &implementationResetCountString);
+
     /**
      * @brief Get the @c std::string for an entry in an array for some
      * information about a variable.
@@ -2584,6 +3063,25 @@ public:
      */
     void setVoiString(const std::string &voiString);
 
+    /**
+     * @brief Get the @c std::string for the name of the time step.
+     *
+     * Return the @c std::string for the name of the time step.
+     *
+     * @return The @c std::string for the name of the time step.
+     */
+    std::string timeStepString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the time step.
+     *
+     * Set this @c std::string for the name of the time step.
+     *
+     * @param timeStepString The @c std::string to use for the name of the time
+     * step.
+     */
+    void setTimeStepString(const std::string &timeStepString);
+
     /**
      * @brief Get the @c std::string for the name of the states array.
      *
@@ -2642,91 +3140,306 @@ public:
     void setVariablesArrayString(const std::string &variablesArrayString);
 
     /**
-     * @brief Get the @c std::string for the interface to create the states
-     * array.
+     * @brief Get the @c std::string for the name of the Jacobian array.
      *
-     * Return the @c std::string for the interface to create the states array.
+     * Return the @c std::string for the name of the Jacobian array.
      *
-     * @return The @c std::string for the interface to create the states array.
+     * @return The @c std::string for the name of the Jacobian array.
      */
-    std::string interfaceCreateStatesArrayMethodString() const;
+    std::string jacobianArrayString() const;
 
     /**
-     * @brief Set the @c std::string for the interface to create the states
-     * array.
+     * @brief Set the @c std::string for the name of the Jacobian array.
      *
-     * Set this @c std::string for the interface to create the states array. To
-     * be useful, the string should contain the <CODE> tag, which will be
-     * replaced with some code to create the states array.
+     * Set this @c std::string for the name of the Jacobian array.
      *
-     * @param interfaceCreateStatesArrayMethodString The @c std::string to use
-     * for the interface to create the states array.
+     * @param jacobianArrayString The @c std::string to use for the name of the
+     * Jacobian array.
      */
-    void setInterfaceCreateStatesArrayMethodString(const std::string &interfaceCreateStatesArrayMethodString);
+    void setJacobianArrayString(const std::string &jacobianArrayString);
 
     /**
-     * @brief Get the @c std::string for the implementation to create the states
-     * array.
+     * @brief Get the @c std::string for the name of the sensitivities array.
      *
-     * Return the @c std::string for the implementation to create the states
-     * array.
+     * Return the @c std::string for the name of the sensitivities array.
      *
-     * @return The @c std::string for the implementation to create the states
-     * array.
+     * @return The @c std::string for the name of the sensitivities array.
      */
-    std::string implementationCreateStatesArrayMethodString() const;
+    std::string sensitivitiesArrayString() const;
 
     /**
-     * @brief Set the @c std::string for the implementation to create the states
-     * array.
+     * @brief Set the @c std::string for the name of the sensitivities array.
      *
-     * Set this @c std::string for the implementation to create the states
-     * array. To be useful, the string should contain the <CODE> tag, which will
-     * be replaced with some code to create the states array.
+     * Set this @c std::string for the name of the sensitivities array.
      *
-     * @param implementationCreateStatesArrayMethodString The @c std::string to
-     * use for the implementation to create the states array.
+     * @param sensitivitiesArrayString The @c std::string to use for the name of
+     * the sensitivities array.
      */
-    void setImplementationCreateStatesArrayMethodString(const std::string &implementationCreateStatesArrayMethodString);
+    void setSensitivitiesArrayString(const std::string &sensitivitiesArrayString);
 
     /**
-     * @brief Get the @c std::string for the interface to create variables
+     * @brief Get the @c std::string for the name of the sensitivity rates
      * array.
      *
-     * Return the @c std::string for the interface to create variables array.
+     * Return the @c std::string for the name of the sensitivity rates array.
      *
-     * @return The @c std::string for the interface to create variables array.
+     * @return The @c std::string for the name of the sensitivity rates array.
      */
-    std::string interfaceCreateVariablesArrayMethodString() const;
+    std::string sensitivityRatesArrayString() const;
 
     /**
-     * @brief Set the @c std::string for the interface to create variables
+     * @brief Set the @c std::string for the name of the sensitivity rates
      * array.
      *
-     * Set this @c std::string for the interface to create variables array. To
-     * be useful, the string should contain the <CODE> tag, which will be
-     * replaced with some code to create the variables array.
+     * Set this @c std::string for the name of the sensitivity rates array.
      *
-     * @param interfaceCreateVariablesArrayMethodString The @c std::string to
-     * use for the interface to create variables array.
+     * @param sensitivityRatesArrayString The @c std::string to use for the name
+     * of the sensitivity rates array.
      */
-    void setInterfaceCreateVariablesArrayMethodString(const std::string &interfaceCreateVariablesArrayMethodString);
+    void setSensitivityRatesArrayString(const std::string &sensitivityRatesArrayString);
 
     /**
-     * @brief Get the @c std::string for the implementation to create the
-     * variables array.
+     * @brief Get the @c std::string for the name of the sweep parameters array.
      *
-     * Return the @c std::string for the implementation to create the variables
-     * array.
+     * Return the @c std::string for the name of the sweep parameters array.
      *
-     * @return The @c std::string for the implementation to create the variables
-     * array.
+     * @return The @c std::string for the name of the sweep parameters array.
      */
-    std::string implementationCreateVariablesArrayMethodString() const;
+    std::string sweepParametersArrayString() const;
 
     /**
-     * @brief Set the @c std::string for the implementation to create the
-     * variables array.
+     * @brief Set the @c std::string for the name of the sweep parameters array.
+     *
+     * Set this @c std::string for the name of the sweep parameters array.
+     *
+     * @param sweepParametersArrayString The @c std::string to use for the name
+     * of the sweep parameters array.
+     */
+    void setSweepParametersArrayString(const std::string &sweepParametersArrayString);
+
+    /**
+     * @brief Get the @c std::string for the index of an element of the states,
+     * rates or variables array in a batch method.
+     *
+     * Return the @c std::string for the index of an element of the states,
+     * rates or variables array in a batch method.
+     *
+     * @return The @c std::string for the index of an element of the states,
+     * rates or variables array in a batch method.
+     */
+    std::string batchArrayIndexString() const;
+
+    /**
+     * @brief Set the @c std::string for the index of an element of the states,
+     * rates or variables array in a batch method.
+     *
+     * Set this @c std::string for the index of an element of the states, rates
+     * or variables array in a batch method. To be useful, the string should
+     * contain the <INDEX> tag, which will be replaced with the index of the
+     * state, rate or variable for one instance.
+     *
+     * @param batchArrayIndexString The @c std::string to use for the index of
+     * an element of the states, rates or variables array in a batch method.
+     */
+    void setBatchArrayIndexString(const std::string &batchArrayIndexString);
+
+    /**
+     * @brief Get the @c std::string for the index of an element of the sweep
+     * parameters array in a batch method.
+     *
+     * Return the @c std::string for the index of an element of the sweep
+     * parameters array in a batch method.
+     *
+     * @return The @c std::string for the index of an element of the sweep
+     * parameters array in a batch method.
+     */
+    std::string batchSweepParameterIndexString() const;
+
+    /**
+     * @brief Set the @c std::string for the index of an element of the sweep
+     * parameters array in a batch method.
+     *
+     * Set this @c std::string for the index of an element of the sweep
+     * parameters array in a batch method. To be useful, the string should
+     * contain the <INDEX> tag, which will be replaced with the index of the
+     * sweep parameter.
+     *
+     * @param batchSweepParameterIndexString The @c std::string to use for the
+     * index of an element of the sweep parameters array in a batch method.
+     */
+    void setBatchSweepParameterIndexString(const std::string &batchSweepParameterIndexString);
+
+    /**
+     * @brief Get the @c std::string for the index of an element of the states,
+     * rates or variables array in an instance kernel.
+     *
+     * Return the @c std::string for the index of an element of the states,
+     * rates or variables array in an instance kernel.
+     *
+     * @return The @c std::string for the index of an element of the states,
+     * rates or variables array in an instance kernel.
+     */
+    std::string instanceArrayIndexString() const;
+
+    /**
+     * @brief Set the @c std::string for the index of an element of the states,
+     * rates or variables array in an instance kernel.
+     *
+     * Set this @c std::string for the index of an element of the states, rates
+     * or variables array in an instance kernel. To be useful, the string should
+     * contain the <INDEX> and <STRIDE> tags, which will be replaced with the
+     * index of the state, rate or variable for the first instance and with the
+     * distance between the indices of two consecutive instances.
+     *
+     * @param instanceArrayIndexString The @c std::string to use for the index
+     * of an element of the states, rates or variables array in an instance
+     * kernel.
+     */
+    void setInstanceArrayIndexString(const std::string &instanceArrayIndexString);
+
+    /**
+     * @brief Get the @c std::string for the name of the roots array.
+     *
+     * Return the @c std::string for the name of the roots array.
+     *
+     * @return The @c std::string for the name of the roots array.
+     */
+    std::string rootsArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the roots array.
+     *
+     * Set this @c std::string for the name of the roots array.
+     *
+     * @param rootsArrayString The @c std::string to use for the name of the
+     * roots array.
+     */
+    void setRootsArrayString(const std::string &rootsArrayString);
+
+    /**
+     * @brief Get the @c std::string for the name of the events array.
+     *
+     * Return the @c std::string for the name of the events array.
+     *
+     * @return The @c std::string for the name of the events array.
+     */
+    std::string eventsArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the events array.
+     *
+     * Set this @c std::string for the name of the events array.
+     *
+     * @param eventsArrayString The @c std::string to use for the name of the
+     * events array.
+     */
+    void setEventsArrayString(const std::string &eventsArrayString);
+
+    /**
+     * @brief Get the @c std::string for the name of the reset values array.
+     *
+     * Return the @c std::string for the name of the reset values array.
+     *
+     * @return The @c std::string for the name of the reset values array.
+     */
+    std::string resetValuesArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the reset values array.
+     *
+     * Set this @c std::string for the name of the reset values array.
+     *
+     * @param resetValuesArrayString The @c std::string to use for the name of
+     * the reset values array.
+     */
+    void setResetValuesArrayString(const std::string &resetValuesArrayString);
+
+    /**
+     * @brief Get the @c std::string for the interface to create the states
+     * array.
+     *
+     * Return the @c std::string for the interface to create the states array.
+     *
+     * @return The @c std::string for the interface to create the states array.
+     */
+    std::string interfaceCreateStatesArrayMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to create the states
+     * array.
+     *
+     * Set this @c std::string for the interface to create the states array. To
+     * be useful, the string should contain the <CODE> tag, which will be
+     * replaced with some code to create the states array.
+     *
+     * @param interfaceCreateStatesArrayMethodString The @c std::string to use
+     * for the interface to create the states array.
+     */
+    void setInterfaceCreateStatesArrayMethodString(const std::string &interfaceCreateStatesArrayMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to create the states
+     * array.
+     *
+     * Return the @c std::string for the implementation to create the states
+     * array.
+     *
+     * @return The @c std::string for the implementation to create the states
+     * array.
+     */
+    std::string implementationCreateStatesArrayMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to create the states
+     * array.
+     *
+     * Set this @c std::string for the implementation to create the states
+     * array. To be useful, the string should contain the <CODE> tag, which will
+     * be replaced with some code to create the states array.
+     *
+     * @param implementationCreateStatesArrayMethodString The @c std::string to
+     * use for the implementation to create the states array.
+     */
+    void setImplementationCreateStatesArrayMethodString(const std::string &implementationCreateStatesArrayMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to create variables
+     * array.
+     *
+     * Return the @c std::string for the interface to create variables array.
+     *
+     * @return The @c std::string for the interface to create variables array.
+     */
+    std::string interfaceCreateVariablesArrayMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to create variables
+     * array.
+     *
+     * Set this @c std::string for the interface to create variables array. To
+     * be useful, the string should contain the <CODE> tag, which will be
+     * replaced with some code to create the variables array.
+     *
+     * @param interfaceCreateVariablesArrayMethodString The @c std::string to
+     * use for the interface to create variables array.
+     */
+    void setInterfaceCreateVariablesArrayMethodString(const std::string &interfaceCreateVariablesArrayMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to create the
+     * variables array.
+     *
+     * Return the @c std::string for the implementation to create the variables
+     * array.
+     *
+     * @return The @c std::string for the implementation to create the variables
+     * array.
+     */
+    std::string implementationCreateVariablesArrayMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to create the
+     * variables array.
      *
      * Set this @c std::string for the implementation to create the variables
      * array. To be useful, the string should contain the <CODE> tag, which will
@@ -2873,6 +3586,59 @@ public:
      */
     void setImplementationComputeComputedConstantsMethodString(const std::string &implementationComputeComputedConstantsMethodString);
 
+    /**
+     * @brief Get the @c std::string for the implementation of a chunk of the
+     * method to compute the computed constants.
+     *
+     * Return the @c std::string for the implementation of a chunk of the method
+     * to compute the computed constants.
+     *
+     * @return The @c std::string for the implementation of a chunk of the
+     * method to compute the computed constants.
+     */
+    std::string implementationComputeComputedConstantsMethodChunkString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of a chunk of the
+     * method to compute the computed constants.
+     *
+     * Set this @c std::string for the implementation of a chunk of the method
+     * to compute the computed constants. To be useful, the string should
+     * contain the <INDEX> and <CODE> tags, which will be replaced with the
+     * index of the chunk and with some code to compute the computed constants.
+     *
+     * @param implementationComputeComputedConstantsMethodChunkString The
+     * @c std::string to use for the implementation of a chunk of the method to
+     * compute the computed constants.
+     */
+    void setImplementationComputeComputedConstantsMethodChunkString(const std::string &implementationComputeComputedConstantsMethodChunkString);
+
+    /**
+     * @brief Get the @c std::string for the call to a chunk of the method to
+     * compute the computed constants.
+     *
+     * Return the @c std::string for the call to a chunk of the method to
+     * compute the computed constants.
+     *
+     * @return The @c std::string for the call to a chunk of the method to
+     * compute the computed constants.
+     */
+    std::string computeComputedConstantsMethodChunkCallString() const;
+
+    /**
+     * @brief Set the @c std::string for the call to a chunk of the method to
+     * compute the computed constants.
+     *
+     * Set this @c std::string for the call to a chunk of the method to compute
+     * the computed constants. To be useful, the string should contain the
+     * <INDEX> tag, which will be replaced with the index of the chunk.
+     *
+     * @param computeComputedConstantsMethodChunkCallString The @c std::string
+     * to use for the call to a chunk of the method to compute the computed
+     * constants.
+     */
+    void setComputeComputedConstantsMethodChunkCallString(const std::string &computeComputedConstantsMethodChunkCallString);
+
     /**
      * @brief Get the @c std::string for the interface to compute rates.
      *
@@ -2911,6 +3677,110 @@ public:
      */
     void setImplementationComputeRatesMethodString(const std::string &implementationComputeRatesMethodString);
 
+    /**
+     * @brief Get the @c std::string for the implementation of a chunk of the
+     * method to compute the rates.
+     *
+     * Return the @c std::string for the implementation of a chunk of the method
+     * to compute the rates.
+     *
+     * @return The @c std::string for the implementation of a chunk of the
+     * method to compute the rates.
+     */
+    std::string implementationComputeRatesMethodChunkString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of a chunk of the
+     * method to compute the rates.
+     *
+     * Set this @c std::string for the implementation of a chunk of the method
+     * to compute the rates. To be useful, the string should contain the <INDEX>
+     * and <CODE> tags, which will be replaced with the index of the chunk and
+     * with some code to compute the rates.
+     *
+     * @param implementationComputeRatesMethodChunkString The @c std::string to
+     * use for the implementation of a chunk of the method to compute the rates.
+     */
+    void setImplementationComputeRatesMethodChunkString(const std::string &implementationComputeRatesMethodChunkString);
+
+    /**
+     * @brief Get the @c std::string for the call to a chunk of the method to
+     * compute the rates.
+     *
+     * Return the @c std::string for the call to a chunk of the method to
+     * compute the rates.
+     *
+     * @return The @c std::string for the call to a chunk of the method to
+     * compute the rates.
+     */
+    std::string computeRatesMethodChunkCallString() const;
+
+    /**
+     * @brief Set the @c std::string for the call to a chunk of the method to
+     * compute the rates.
+     *
+     * Set this @c std::string for the call to a chunk of the method to compute
+     * the rates. To be useful, the string should contain the <INDEX> tag, which
+     * will be replaced with the index of the chunk.
+     *
+     * @param computeRatesMethodChunkCallString The @c std::string to use for
+     * the call to a chunk of the method to compute the rates.
+     */
+    void setComputeRatesMethodChunkCallString(const std::string &computeRatesMethodChunkCallString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of an instance
+     * kernel of the method to compute the rates.
+     *
+     * Return the @c std::string for the implementation of an instance kernel of
+     * the method to compute the rates.
+     *
+     * @return The @c std::string for the implementation of an instance kernel
+     * of the method to compute the rates.
+     */
+    std::string implementationComputeRatesMethodKernelString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of an instance
+     * kernel of the method to compute the rates.
+     *
+     * Set this @c std::string for the implementation of an instance kernel of
+     * the method to compute the rates. To be useful, the string should contain
+     * the <INDEX>, <INSTANCE_COUNT> and <CODE> tags, which will be replaced
+     * with the index of the kernel, with the number of instances and with some
+     * code to compute the rates of one instance.
+     *
+     * @param implementationComputeRatesMethodKernelString The @c std::string to
+     * use for the implementation of an instance kernel of the method to compute
+     * the rates.
+     */
+    void setImplementationComputeRatesMethodKernelString(const std::string &implementationComputeRatesMethodKernelString);
+
+    /**
+     * @brief Get the @c std::string for the call to an instance kernel of the
+     * method to compute the rates.
+     *
+     * Return the @c std::string for the call to an instance kernel of the
+     * method to compute the rates.
+     *
+     * @return The @c std::string for the call to an instance kernel of the
+     * method to compute the rates.
+     */
+    std::string computeRatesMethodKernelCallString() const;
+
+    /**
+     * @brief Set the @c std::string for the call to an instance kernel of the
+     * method to compute the rates.
+     *
+     * Set this @c std::string for the call to an instance kernel of the method
+     * to compute the rates. To be useful, the string should contain the <INDEX>
+     * tag, which will be replaced with the index of the kernel.
+     *
+     * @param computeRatesMethodKernelCallString The @c std::string to use for
+     * the call to an instance kernel of the method to compute the rates.
+     */
+    void setComputeRatesMethodKernelCallString(const std::string &computeRatesMethodKernelCallString);
+
     /**
      * @brief Get the @c std::string for the interface to compute variables.
      *
@@ -2952,99 +3822,890 @@ public:
     void setImplementationComputeVariablesMethodString(const std::string &implementationComputeVariablesMethodString);
 
     /**
-     * @brief Get the @c std::string for an empty method.
+     * @brief Get the @c std::string for the implementation of a chunk of the
+     * method to compute the variables.
      *
-     * Return the @c std::string for an empty method.
+     * Return the @c std::string for the implementation of a chunk of the method
+     * to compute the variables.
      *
-     * @return The @c std::string for an empty method.
+     * @return The @c std::string for the implementation of a chunk of the
+     * method to compute the variables.
      */
-    std::string emptyMethodString() const;
+    std::string implementationComputeVariablesMethodChunkString() const;
 
     /**
-     * @brief Set the @c std::string for an empty method.
+     * @brief Set the @c std::string for the implementation of a chunk of the
+     * method to compute the variables.
      *
-     * Set this @c std::string for an empty method.
+     * Set this @c std::string for the implementation of a chunk of the method
+     * to compute the variables. To be useful, the string should contain the
+     * <INDEX> and <CODE> tags, which will be replaced with the index of the
+     * chunk and with some code to compute the variables.
      *
-     * @param emptyMethodString The @c std::string to use for an empty method.
+     * @param implementationComputeVariablesMethodChunkString The @c std::string
+     * to use for the implementation of a chunk of the method to compute the
+     * variables.
      */
-    void setEmptyMethodString(const std::string &emptyMethodString);
+    void setImplementationComputeVariablesMethodChunkString(const std::string &implementationComputeVariablesMethodChunkString);
 
     /**
-     * @brief Get the @c std::string for an indent.
+     * @brief Get the @c std::string for the call to a chunk of the method to
+     * compute the variables.
      *
-     * Return the @c std::string for an indent.
+     * Return the @c std::string for the call to a chunk of the method to
+     * compute the variables.
      *
-     * @return The @c std::string for an indent.
+     * @return The @c std::string for the call to a chunk of the method to
+     * compute the variables.
      */
-    std::string indentString() const;
+    std::string computeVariablesMethodChunkCallString() const;
 
     /**
-     * @brief Set the @c std::string for an indent.
+     * @brief Set the @c std::string for the call to a chunk of the method to
+     * compute the variables.
      *
-     * Set this @c std::string for an indent.
+     * Set this @c std::string for the call to a chunk of the method to compute
+     * the variables. To be useful, the string should contain the <INDEX> tag,
+     * which will be replaced with the index of the chunk.
      *
-     * @param indentString The @c std::string to use for an indent.
+     * @param computeVariablesMethodChunkCallString The @c std::string to use
+     * for the call to a chunk of the method to compute the variables.
      */
-    void setIndentString(const std::string &indentString);
+    void setComputeVariablesMethodChunkCallString(const std::string &computeVariablesMethodChunkCallString);
 
     /**
-     * @brief Get the @c std::string for opening an array initializer.
+     * @brief Get the @c std::string for the implementation of an instance
+     * kernel of the method to compute the variables.
      *
-     * Return the @c std::string for opening an array initializer.
+     * Return the @c std::string for the implementation of an instance kernel of
+     * the method to compute the variables.
      *
-     * @return The @c std::string for opening an array initializer.
+     * @return The @c std::string for the implementation of an instance kernel
+     * of the method to compute the variables.
      */
-    std::string openArrayInitializerString() const;
+    std::string implementationComputeVariablesMethodKernelString() const;
 
     /**
-     * @brief Set the @c std::string for opening an array initializer.
+     * @brief Set the @c std::string for the implementation of an instance
+     * kernel of the method to compute the variables.
      *
-     * Set this @c std::string for opening an array initializer.
+     * Set this @c std::string for the implementation of an instance kernel of
+     * the method to compute the variables. To be useful, the string should
+     * contain the <INDEX>, <INSTANCE_COUNT> and <CODE> tags, which will be
+     * replaced with the index of the kernel, with the number of instances and
+     * with some code to compute the variables of one instance.
      *
-     * @param openArrayInitializerString The @c std::string to use for opening
-     * an array initializer.
+     * @param implementationComputeVariablesMethodKernelString The
+     * @c std::string to use for the implementation of an instance kernel of the
+     * method to compute the variables.
      */
-    void setOpenArrayInitializerString(const std::string &openArrayInitializerString);
+    void setImplementationComputeVariablesMethodKernelString(const std::string &implementationComputeVariablesMethodKernelString);
 
     /**
-     * @brief Get the @c std::string for closing an array initializer.
+     * @brief Get the @c std::string for the call to an instance kernel of the
+     * method to compute the variables.
      *
-     * Return the @c std::string for closing an array initializer.
+     * Return the @c std::string for the call to an instance kernel of the
+     * method to compute the variables.
      *
-     * @return The @c std::string for closing an array initializer.
+     * @return The @c std::string for the call to an instance kernel of the
+     * method to compute the variables.
      */
-    std::string closeArrayInitializerString() const;
+    std::string computeVariablesMethodKernelCallString() const;
 
     /**
-     * @brief Set the @c std::string for closing an array initializer.
+     * @brief Set the @c std::string for the call to an instance kernel of the
+     * method to compute the variables.
      *
-     * Set this @c std::string for closing an array initializer.
+     * Set this @c std::string for the call to an instance kernel of the method
+     * to compute the variables. To be useful, the string should contain the
+     * <INDEX> tag, which will be replaced with the index of the kernel.
      *
-     * @param closeArrayInitializerString The @c std::string to use for closing
-     *  an array initializer.
+     * @param computeVariablesMethodKernelCallString The @c std::string to use
+     * for the call to an instance kernel of the method to compute the
+     * variables.
      */
-    void setCloseArrayInitializerString(const std::string &closeArrayInitializerString);
+    void setComputeVariablesMethodKernelCallString(const std::string &computeVariablesMethodKernelCallString);
 
     /**
-     * @brief Get the @c std::string for opening an array.
+     * @brief Get the @c std::string for a parallel region.
      *
-     * Return the @c std::string for opening an array.
+     * Return the @c std::string for a parallel region.
      *
-     * @return The @c std::string for opening an array.
+     * @return The @c std::string for a parallel region.
      */
-    std::string openArrayString() const;
+    std::string parallelRegionString() const;
 
     /**
-     * @brief Set the @c std::string for opening an array.
+     * @brief Set the @c std::string for a parallel region.
      *
-     * Set this @c std::string for opening an array.
+     * Set this @c std::string for a parallel region. To be useful, the string
+     * should contain the <CODE> tag, which will be replaced with the code for
+     * the different levels of the method to compute the rates or the variables.
      *
-     * @param openArrayString The @c std::string to use for opening an array.
+     * @param parallelRegionString The @c std::string to use for a parallel
+     * region.
      */
-    void setOpenArrayString(const std::string &openArrayString);
+    void setParallelRegionString(const std::string &parallelRegionString);
 
     /**
-     * @brief Get the @c std::string for closing an array.
+     * @brief Get the @c std::string for a level of a parallel region.
+     *
+     * Return the @c std::string for a level of a parallel region.
+     *
+     * @return The @c std::string for a level of a parallel region.
+     */
+    std::string parallelLevelString() const;
+
+    /**
+     * @brief Set the @c std::string for a level of a parallel region.
+     *
+     * Set this @c std::string for a level of a parallel region. To be useful,
+     * the string should contain the <CODE> tag, which will be replaced with the
+     * code for the tasks of the level, which can all be run in parallel.
+     *
+     * @param parallelLevelString The @c std::string to use for a level of a
+     * parallel region.
+     */
+    void setParallelLevelString(const std::string &parallelLevelString);
+
+    /**
+     * @brief Get the @c std::string for a task of a level of a parallel region.
+     *
+     * Return the @c std::string for a task of a level of a parallel region.
+     *
+     * @return The @c std::string for a task of a level of a parallel region.
+     */
+    std::string parallelTaskString() const;
+
+    /**
+     * @brief Set the @c std::string for a task of a level of a parallel region.
+     *
+     * Set this @c std::string for a task of a level of a parallel region. To be
+     * useful, the string should contain the <CODE> tag, which will be replaced
+     * with the code for the equations computed by the task.
+     *
+     * @param parallelTaskString The @c std::string to use for a task of a level
+     * of a parallel region.
+     */
+    void setParallelTaskString(const std::string &parallelTaskString);
+
+    /**
+     * @brief Get the @c std::string for the interface to compute the Jacobian.
+     *
+     * Return the @c std::string for the interface to compute the Jacobian.
+     *
+     * @return The @c std::string for the interface to compute the Jacobian.
+     */
+    std::string interfaceComputeJacobianMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute the Jacobian.
+     *
+     * Set this @c std::string for the interface to compute the Jacobian.
+     *
+     * @param interfaceComputeJacobianMethodString The @c std::string to use for
+     * the interface to compute the Jacobian.
+     */
+    void setInterfaceComputeJacobianMethodString(const std::string &interfaceComputeJacobianMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the
+     * Jacobian.
+     *
+     * Return the @c std::string for the implementation to compute the Jacobian.
+     *
+     * @return The @c std::string for the implementation to compute the
+     * Jacobian.
+     */
+    std::string implementationComputeJacobianMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the
+     * Jacobian.
+     *
+     * Set this @c std::string for the implementation to compute the Jacobian.
+     *
+     * @param implementationComputeJacobianMethodString The @c std::string to
+     * use for the implementation to compute the Jacobian.
+     */
+    void setImplementationComputeJacobianMethodString(const std::string &implementationComputeJacobianMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to compute a Rush-Larsen
+     * step.
+     *
+     * Return the @c std::string for the interface to compute a Rush-Larsen
+     * step.
+     *
+     * @return The @c std::string for the interface to compute a Rush-Larsen
+     * step.
+     */
+    std::string interfaceComputeRushLarsenStepMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute a Rush-Larsen
+     * step.
+     *
+     * Set this @c std::string for the interface to compute a Rush-Larsen step.
+     *
+     * @param interfaceComputeRushLarsenStepMethodString The @c std::string to
+     * use for the interface to compute a Rush-Larsen step.
+     */
+    void setInterfaceComputeRushLarsenStepMethodString(const std::string &interfaceComputeRushLarsenStepMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute a
+     * Rush-Larsen step.
+     *
+     * Return the @c std::string for the implementation to compute a Rush-Larsen
+     * step.
+     *
+     * @return The @c std::string for the implementation to compute a
+     * Rush-Larsen step.
+     */
+    std::string implementationComputeRushLarsenStepMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute a
+     * Rush-Larsen step.
+     *
+     * Set this @c std::string for the implementation to compute a Rush-Larsen
+     * step. To be useful, the string should contain the <CODE> tag, which will
+     * be replaced with some code to compute the rates and to update the states.
+     * It may also contain the <STATE_COUNT> tag, which will be replaced with
+     * the number of states, e.g. to declare a local array for the rates.
+     *
+     * @param implementationComputeRushLarsenStepMethodString The @c std::string
+     * to use for the implementation to compute a Rush-Larsen step.
+     */
+    void setImplementationComputeRushLarsenStepMethodString(const std::string &implementationComputeRushLarsenStepMethodString);
+
+    /**
+     * @brief Get the @c std::string for the name of the local variable that
+     * holds the exponent of a Rush-Larsen step.
+     *
+     * Return the @c std::string for the name of the local variable that holds
+     * the exponent of a Rush-Larsen step.
+     *
+     * @return The @c std::string for the name of the local variable that holds
+     * the exponent of a Rush-Larsen step.
+     */
+    std::string rushLarsenExponentString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the local variable that
+     * holds the exponent of a Rush-Larsen step.
+     *
+     * Set this @c std::string for the name of the local variable that holds the
+     * exponent of a Rush-Larsen step.
+     *
+     * @param rushLarsenExponentString The @c std::string to use for the name of
+     * the local variable that holds the exponent of a Rush-Larsen step.
+     */
+    void setRushLarsenExponentString(const std::string &rushLarsenExponentString);
+
+    /**
+     * @brief Get the @c std::string for the declaration of the local variable
+     * that holds the exponent of a Rush-Larsen step.
+     *
+     * Return the @c std::string for the declaration of the local variable that
+     * holds the exponent of a Rush-Larsen step.
+     *
+     * @return The @c std::string for the declaration of the local variable that
+     * holds the exponent of a Rush-Larsen step.
+     */
+    std::string implementationRushLarsenExponentString() const;
+
+    /**
+     * @brief Set the @c std::string for the declaration of the local variable
+     * that holds the exponent of a Rush-Larsen step.
+     *
+     * Set this @c std::string for the declaration of the local variable that
+     * holds the exponent of a Rush-Larsen step. The declaration is only
+     * generated if at least one state is updated using the Rush-Larsen method
+     * rather than forward Euler.
+     *
+     * @param implementationRushLarsenExponentString The @c std::string to use
+     * for the declaration of the local variable that holds the exponent of a
+     * Rush-Larsen step.
+     */
+    void setImplementationRushLarsenExponentString(const std::string &implementationRushLarsenExponentString);
+
+    /**
+     * @brief Get the @c std::string for the interface to compute the
+     * sensitivity rates.
+     *
+     * Return the @c std::string for the interface to compute the sensitivity
+     * rates.
+     *
+     * @return The @c std::string for the interface to compute the sensitivity
+     * rates.
+     */
+    std::string interfaceComputeSensitivityRatesMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute the
+     * sensitivity rates.
+     *
+     * Set this @c std::string for the interface to compute the sensitivity
+     * rates.
+     *
+     * @param interfaceComputeSensitivityRatesMethodString The @c std::string to
+     * use for the interface to compute the sensitivity rates.
+     */
+    void setInterfaceComputeSensitivityRatesMethodString(const std::string &interfaceComputeSensitivityRatesMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the
+     * sensitivity rates.
+     *
+     * Return the @c std::string for the implementation to compute the
+     * sensitivity rates.
+     *
+     * @return The @c std::string for the implementation to compute the
+     * sensitivity rates.
+     */
+    std::string implementationComputeSensitivityRatesMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the
+     * sensitivity rates.
+     *
+     * Set this @c std::string for the implementation to compute the sensitivity
+     * rates.
+     *
+     * @param implementationComputeSensitivityRatesMethodString The
+     * @c std::string to use for the implementation to compute the sensitivity
+     * rates.
+     */
+    void setImplementationComputeSensitivityRatesMethodString(const std::string &implementationComputeSensitivityRatesMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to initialise the states
+     * and (computed) constants of a batch of instances.
+     *
+     * Return the @c std::string for the interface to initialise the states and
+     * (computed) constants of a batch of instances.
+     *
+     * @return The @c std::string for the interface to initialise the states and
+     * (computed) constants of a batch of instances.
+     */
+    std::string interfaceInitializeStatesAndConstantsBatchMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to initialise the states
+     * and (computed) constants of a batch of instances.
+     *
+     * Set this @c std::string for the interface to initialise the states and
+     * (computed) constants of a batch of instances.
+     *
+     * @param interfaceInitializeStatesAndConstantsBatchMethodString The
+     * @c std::string to use for the interface to initialise the states and
+     * (computed) constants of a batch of instances.
+     */
+    void setInterfaceInitializeStatesAndConstantsBatchMethodString(const std::string &interfaceInitializeStatesAndConstantsBatchMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to initialise the
+     * states and (computed) constants of a batch of instances.
+     *
+     * Return the @c std::string for the implementation to initialise the states
+     * and (computed) constants of a batch of instances.
+     *
+     * @return The @c std::string for the implementation to initialise the
+     * states and (computed) constants of a batch of instances.
+     */
+    std::string implementationInitializeStatesAndConstantsBatchMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to initialise the
+     * states and (computed) constants of a batch of instances.
+     *
+     * Set this @c std::string for the implementation to initialise the states
+     * and (computed) constants of a batch of instances.
+     *
+     * @param implementationInitializeStatesAndConstantsBatchMethodString The
+     * @c std::string to use for the implementation to initialise the states and
+     * (computed) constants of a batch of instances.
+     */
+    void setImplementationInitializeStatesAndConstantsBatchMethodString(const std::string &implementationInitializeStatesAndConstantsBatchMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to compute the rates of a
+     * batch of instances.
+     *
+     * Return the @c std::string for the interface to compute the rates of a
+     * batch of instances.
+     *
+     * @return The @c std::string for the interface to compute the rates of a
+     * batch of instances.
+     */
+    std::string interfaceComputeRatesBatchMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute the rates of a
+     * batch of instances.
+     *
+     * Set this @c std::string for the interface to compute the rates of a batch
+     * of instances.
+     *
+     * @param interfaceComputeRatesBatchMethodString The @c std::string to use
+     * for the interface to compute the rates of a batch of instances.
+     */
+    void setInterfaceComputeRatesBatchMethodString(const std::string &interfaceComputeRatesBatchMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the rates
+     * of a batch of instances.
+     *
+     * Return the @c std::string for the implementation to compute the rates of
+     * a batch of instances.
+     *
+     * @return The @c std::string for the implementation to compute the rates of
+     * a batch of instances.
+     */
+    std::string implementationComputeRatesBatchMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the rates
+     * of a batch of instances.
+     *
+     * Set this @c std::string for the implementation to compute the rates of a
+     * batch of instances.
+     *
+     * @param implementationComputeRatesBatchMethodString The @c std::string to
+     * use for the implementation to compute the rates of a batch of instances.
+     */
+    void setImplementationComputeRatesBatchMethodString(const std::string &implementationComputeRatesBatchMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to compute the rates
+     * using the current values of the (computed) constants.
+     *
+     * Return the @c std::string for the interface to compute the rates using
+     * the current values of the (computed) constants.
+     *
+     * @return The @c std::string for the interface to compute the rates using
+     * the current values of the (computed) constants.
+     */
+    std::string interfaceComputeRatesSpecializedMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute the rates
+     * using the current values of the (computed) constants.
+     *
+     * Set this @c std::string for the interface to compute the rates using the
+     * current values of the (computed) constants.
+     *
+     * @param interfaceComputeRatesSpecializedMethodString The @c std::string to
+     * use for the interface to compute the rates using the current values of
+     * the (computed) constants.
+     */
+    void setInterfaceComputeRatesSpecializedMethodString(const std::string &interfaceComputeRatesSpecializedMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the rates
+     * using the current values of the (computed) constants.
+     *
+     * Return the @c std::string for the implementation to compute the rates
+     * using the current values of the (computed) constants.
+     *
+     * @return The @c std::string for the implementation to compute the rates
+     * using the current values of the (computed) constants.
+     */
+    std::string implementationComputeRatesSpecializedMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the rates
+     * using the current values of the (computed) constants.
+     *
+     * Set this @c std::string for the implementation to compute the rates using
+     * the current values of the (computed) constants.
+     *
+     * @param implementationComputeRatesSpecializedMethodString The
+     * @c std::string to use for the implementation to compute the rates using
+     * the current values of the (computed) constants.
+     */
+    void setImplementationComputeRatesSpecializedMethodString(const std::string &implementationComputeRatesSpecializedMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to compute the variables
+     * using the current values of the (computed) constants.
+     *
+     * Return the @c std::string for the interface to compute the variables
+     * using the current values of the (computed) constants.
+     *
+     * @return The @c std::string for the interface to compute the variables
+     * using the current values of the (computed) constants.
+     */
+    std::string interfaceComputeVariablesSpecializedMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute the variables
+     * using the current values of the (computed) constants.
+     *
+     * Set this @c std::string for the interface to compute the variables using
+     * the current values of the (computed) constants.
+     *
+     * @param interfaceComputeVariablesSpecializedMethodString The
+     * @c std::string to use for the interface to compute the variables using
+     * the current values of the (computed) constants.
+     */
+    void setInterfaceComputeVariablesSpecializedMethodString(const std::string &interfaceComputeVariablesSpecializedMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the
+     * variables using the current values of the (computed) constants.
+     *
+     * Return the @c std::string for the implementation to compute the variables
+     * using the current values of the (computed) constants.
+     *
+     * @return The @c std::string for the implementation to compute the
+     * variables using the current values of the (computed) constants.
+     */
+    std::string implementationComputeVariablesSpecializedMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the
+     * variables using the current values of the (computed) constants.
+     *
+     * Set this @c std::string for the implementation to compute the variables
+     * using the current values of the (computed) constants.
+     *
+     * @param implementationComputeVariablesSpecializedMethodString The
+     * @c std::string to use for the implementation to compute the variables
+     * using the current values of the (computed) constants.
+     */
+    void setImplementationComputeVariablesSpecializedMethodString(const std::string &implementationComputeVariablesSpecializedMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to compute the roots.
+     *
+     * Return the @c std::string for the interface to compute the roots.
+     *
+     * @return The @c std::string for the interface to compute the roots.
+     */
+    std::string interfaceComputeRootsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute the roots.
+     *
+     * Set this @c std::string for the interface to compute the roots.
+     *
+     * @param interfaceComputeRootsMethodString The @c std::string to use for
+     * the interface to compute the roots.
+     */
+    void setInterfaceComputeRootsMethodString(const std::string &interfaceComputeRootsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the
+     * roots.
+     *
+     * Return the @c std::string for the implementation to compute the roots.
+     *
+     * @return The @c std::string for the implementation to compute the roots.
+     */
+    std::string implementationComputeRootsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the
+     * roots.
+     *
+     * Set this @c std::string for the implementation to compute the roots.
+     *
+     * @param implementationComputeRootsMethodString The @c std::string to use
+     * for the implementation to compute the roots.
+     */
+    void setImplementationComputeRootsMethodString(const std::string &implementationComputeRootsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to apply the resets.
+     *
+     * Return the @c std::string for the interface to apply the resets.
+     *
+     * @return The @c std::string for the interface to apply the resets.
+     */
+    std::string interfaceApplyResetsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to apply the resets.
+     *
+     * Set this @c std::string for the interface to apply the resets.
+     *
+     * @param interfaceApplyResetsMethodString The @c std::string to use for the
+     * interface to apply the resets.
+     */
+    void setInterfaceApplyResetsMethodString(const std::string &interfaceApplyResetsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to apply the resets.
+     *
+     * Return the @c std::string for the implementation to apply the resets.
+     *
+     * @return The @c std::string for the implementation to apply the resets.
+     */
+    std::string implementationApplyResetsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to apply the resets.
+     *
+     * Set this @c std::string for the implementation to apply the resets. To be
+     * useful, the string should contain the <RESET_VARIABLE_COUNT> tag, which
+     * will be replaced with the number of variables that can be reset.
+     *
+     * @param implementationApplyResetsMethodString The @c std::string to use
+     * for the implementation to apply the resets.
+     */
+    void setImplementationApplyResetsMethodString(const std::string &implementationApplyResetsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the name of the argument of the lookup
+     * table.
+     *
+     * Return the @c std::string for the name of the argument of the lookup
+     * table.
+     *
+     * @return The @c std::string for the name of the argument of the lookup
+     * table.
+     */
+    std::string lookupTableArgumentString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the argument of the lookup
+     * table.
+     *
+     * Set this @c std::string for the name of the argument of the lookup table.
+     *
+     * @param lookupTableArgumentString The @c std::string to use for the name
+     * of the argument of the lookup table.
+     */
+    void setLookupTableArgumentString(const std::string &lookupTableArgumentString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the lookup table
+     * and of the function to interpolate it.
+     *
+     * Return the @c std::string for the implementation of the lookup table and
+     * of the function to interpolate it.
+     *
+     * @return The @c std::string for the implementation of the lookup table and
+     * of the function to interpolate it.
+     */
+    std::string implementationLookupTableString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the lookup table
+     * and of the function to interpolate it.
+     *
+     * Set this @c std::string for the implementation of the lookup table and of
+     * the function to interpolate it. To be useful, the string should contain
+     * the <ROW_COUNT>, <COLUMN_COUNT>, <MINIMUM>, <STEP> and <MAXIMUM_INDEX>
+     * tags, which will be replaced with the number of rows and columns of the
+     * lookup table, with the minimum value and step of its argument, and with
+     * the index of the last row from which to interpolate (i.e. the number of
+     * rows minus two), so that the lookup table is never read past its end.
+     *
+     * @param implementationLookupTableString The @c std::string to use for the
+     * implementation of the lookup table and of the function to interpolate it.
+     */
+    void setImplementationLookupTableString(const std::string &implementationLookupTableString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute the
+     * lookup table.
+     *
+     * Return the @c std::string for the implementation to compute the lookup
+     * table.
+     *
+     * @return The @c std::string for the implementation to compute the lookup
+     * table.
+     */
+    std::string implementationComputeLookupTableMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute the
+     * lookup table.
+     *
+     * Set this @c std::string for the implementation to compute the lookup
+     * table. To be useful, the string should contain the <CODE> tag, which will
+     * be replaced with some code to compute a row of the lookup table. It
+     * should also contain the <ROW_COUNT>, <MINIMUM> and <STEP> tags, which
+     * will be replaced with the number of rows of the lookup table, and with
+     * the minimum value and step of its argument. The lookup table only depends
+     * on true constants and is shared by all the callers of the generated
+     * code, so it should only be computed the first time that the method is
+     * called.
+     *
+     * @param implementationComputeLookupTableMethodString The @c std::string to
+     * use for the implementation to compute the lookup table.
+     */
+    void setImplementationComputeLookupTableMethodString(const std::string &implementationComputeLookupTableMethodString);
+
+    /**
+     * @brief Get the @c std::string for the call to compute the lookup table.
+     *
+     * Return the @c std::string for the call to compute the lookup table.
+     *
+     * @return The @c std::string for the call to compute the lookup table.
+     */
+    std::string computeLookupTableCallString() const;
+
+    /**
+     * @brief Set the @c std::string for the call to compute the lookup table.
+     *
+     * Set this @c std::string for the call to compute the lookup table.
+     *
+     * @param computeLookupTableCallString The @c std::string to use for the
+     * call to compute the lookup table.
+     */
+    void setComputeLookupTableCallString(const std::string &computeLookupTableCallString);
+
+    /**
+     * @brief Get the @c std::string for an entry of the current row of the
+     * lookup table.
+     *
+     * Return the @c std::string for an entry of the current row of the lookup
+     * table.
+     *
+     * @return The @c std::string for an entry of the current row of the lookup
+     * table.
+     */
+    std::string lookupTableEntryString() const;
+
+    /**
+     * @brief Set the @c std::string for an entry of the current row of the
+     * lookup table.
+     *
+     * Set this @c std::string for an entry of the current row of the lookup
+     * table. To be useful, the string should contain the <COLUMN> tag, which
+     * will be replaced with the column of the entry.
+     *
+     * @param lookupTableEntryString The @c std::string to use for an entry of
+     * the current row of the lookup table.
+     */
+    void setLookupTableEntryString(const std::string &lookupTableEntryString);
+
+    /**
+     * @brief Get the @c std::string for an interpolated value from the lookup
+     * table.
+     *
+     * Return the @c std::string for an interpolated value from the lookup
+     * table.
+     *
+     * @return The @c std::string for an interpolated value from the lookup
+     * table.
+     */
+    std::string lookupTableValueString() const;
+
+    /**
+     * @brief Set the @c std::string for an interpolated value from the lookup
+     * table.
+     *
+     * Set this @c std::string for an interpolated value from the lookup table.
+     * To be useful, the string should contain the <COLUMN> and <VALUE> tags,
+     * which will be replaced with the column of the lookup table to interpolate
+     * and with the value of its argument.
+     *
+     * @param lookupTableValueString The @c std::string to use for an
+     * interpolated value from the lookup table.
+     */
+    void setLookupTableValueString(const std::string &lookupTableValueString);
+
+    /**
+     * @brief Get the @c std::string for an empty method.
+     *
+     * Return the @c std::string for an empty method.
+     *
+     * @return The @c std::string for an empty method.
+     */
+    std::string emptyMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for an empty method.
+     *
+     * Set this @c std::string for an empty method.
+     *
+     * @param emptyMethodString The @c std::string to use for an empty method.
+     */
+    void setEmptyMethodString(const std::string &emptyMethodString);
+
+    /**
+     * @brief Get the @c std::string for an indent.
+     *
+     * Return the @c std::string for an indent.
+     *
+     * @return The @c std::string for an indent.
+     */
+    std::string indentString() const;
+
+    /**
+     * @brief Set the @c std::string for an indent.
+     *
+     * Set this @c std::string for an indent.
+     *
+     * @param indentString The @c std::string to use for an indent.
+     */
+    void setIndentString(const std::string &indentString);
+
+    /**
+     * @brief Get the @c std::string for opening an array initializer.
+     *
+     * Return the @c std::string for opening an array initializer.
+     *
+     * @return The @c std::string for opening an array initializer.
+     */
+    std::string openArrayInitializerString() const;
+
+    /**
+     * @brief Set the @c std::string for opening an array initializer.
+     *
+     * Set this @c std::string for opening an array initializer.
+     *
+     * @param openArrayInitializerString The @c std::string to use for opening
+     * an array initializer.
+     */
+    void setOpenArrayInitializerString(const std::string &openArrayInitializerString);
+
+    /**
+     * @brief Get the @c std::string for closing an array initializer.
+     *
+     * Return the @c std::string for closing an array initializer.
+     *
+     * @return The @c std::string for closing an array initializer.
+     */
+    std::string closeArrayInitializerString() const;
+
+    /**
+     * @brief Set the @c std::string for closing an array initializer.
+     *
+     * Set this @c std::string for closing an array initializer.
+     *
+     * @param closeArrayInitializerString The @c std::string to use for closing
+     *  an array initializer.
+     */
+    void setCloseArrayInitializerString(const std::string &closeArrayInitializerString);
+
+    /**
+     * @brief Get the @c std::string for opening an array.
+     *
+     * Return the @c std::string for opening an array.
+     *
+     * @return The @c std::string for opening an array.
+     */
+    std::string openArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for opening an array.
+     *
+     * Set this @c std::string for opening an array.
+     *
+     * @param openArrayString The @c std::string to use for opening an array.
+     */
+    void setOpenArrayString(const std::string &openArrayString);
+
+    /**
+     * @brief Get the @c std::string for closing an array.
      *
      * Return the @c std::string for closing an array.
      *
@@ -3061,6 +4722,30 @@ public:
      */
     void setCloseArrayString(const std::string &closeArrayString);
 
+    /**
+     * @brief Get the @c std::string for the cast of a value read from an array
+     * to the type used for computations.
+     *
+     * Return the @c std::string for the cast of a value read from an array to
+     * the type used for computations.
+     *
+     * @return The @c std::string for the cast of a value read from an array to
+     * the type used for computations.
+     */
+    std::string computeCastString() const;
+
+    /**
+     * @brief Set the @c std::string for the cast of a value read from an array
+     * to the type used for computations.
+     *
+     * Set this @c std::string for the cast of a value read from an array to the
+     * type used for computations.
+     *
+     * @param computeCastString The @c std::string to use for the cast of a
+     * value read from an array to the type used for computations.
+     */
+    void setComputeCastString(const std::string &computeCastString);
+
     /**
      * @brief Get the @c std::string for separating elements in an array.
      *
@@ -3119,8 +4804,12 @@ public:
     void setCommandSeparatorString(const std::string &commandSeparatorString);
 
 private:
+    friend class Generator;
+
     explicit GeneratorProfile(Profile profile = Profile::C); /**< Constructor */
 
+    size_t revision() const; /**< Revision of this profile, which changes every time it is modified. */
+
     struct GeneratorProfileImpl;
     GeneratorProfileImpl *mPimpl;
 };
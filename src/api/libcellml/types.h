@@ -21,10 +21,16 @@ limitations under the License.
 namespace libcellml {
 
 // General classes.
+class CompiledModel; /**< Forward declaration of CompiledModel class. */
+using CompiledModelPtr = std::shared_ptr<CompiledModel>; /**< Type definition for shared compiled model pointer. */
 class Issue; /**< Forward declaration of Issue class. */
 using IssuePtr = std::shared_ptr<Issue>; /**< Type definition for shared issue pointer. */
 class Generator; /**< Forward declaration of Generator class. */
 using GeneratorPtr = std::shared_ptr<Generator>; /**< Type definition for shared generator pointer. */
+class GeneratorAst; /**< Forward declaration of GeneratorAst class. */
+using GeneratorAstPtr = std::shared_ptr<GeneratorAst>; /**< Type definition for shared generator AST pointer. */
+class GeneratorEquation; /**< Forward declaration of GeneratorEquation class. */
+using GeneratorEquationPtr = std::shared_ptr<GeneratorEquation>; /**< Type definition for shared generator equation pointer. */
 class GeneratorProfile; /**< Forward declaration of GeneratorProfile class. */
 using GeneratorProfilePtr = std::shared_ptr<GeneratorProfile>; /**< Type definition for shared generator variable pointer. */
 class GeneratorVariable; /**< Forward declaration of GeneratorVariable class. */
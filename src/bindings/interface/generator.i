@@ -24,6 +24,68 @@
 %feature("docstring") libcellml::GeneratorVariable::type
 "Return the :enum:`GeneratorVariable::Type`.";
 
+%feature("docstring") libcellml::GeneratorVariable::index
+"Return the index of this :class:`GeneratorVariable` in the states or variables
+array, which depends on the variable ordering used by the :class:`Generator`.";
+
+%feature("docstring") libcellml::GeneratorVariable::defaultIndex
+"Return the index of this :class:`GeneratorVariable` in the states or variables
+array when using the default variable ordering.";
+
+%feature("docstring") libcellml::GeneratorAst
+"Defines a node of the abstract syntax tree of an equation created by processing
+a :class:`Model` with the :class:`Generator`.";
+
+%feature("docstring") libcellml::GeneratorAst::type
+"Return the :enum:`GeneratorAst::Type`.";
+
+%feature("docstring") libcellml::GeneratorAst::value
+"Return the value of this :class:`GeneratorAst`, i.e. the number it represents
+if it is a CN node, or an empty string otherwise.";
+
+%feature("docstring") libcellml::GeneratorAst::variable
+"Return the :class:`GeneratorVariable` represented by this :class:`GeneratorAst`
+if it is a CI node, or `None` otherwise.";
+
+%feature("docstring") libcellml::GeneratorAst::parent
+"Return the parent of this :class:`GeneratorAst`, or `None` if it is the root of
+an equation.";
+
+%feature("docstring") libcellml::GeneratorAst::leftChild
+"Return the left child of this :class:`GeneratorAst`, or `None` if it doesn't
+have one.";
+
+%feature("docstring") libcellml::GeneratorAst::rightChild
+"Return the right child of this :class:`GeneratorAst`, or `None` if it doesn't
+have one.";
+
+%feature("docstring") libcellml::GeneratorEquation
+"Defines an equation created by processing a :class:`Model` with the :class:`Generator`.";
+
+%feature("docstring") libcellml::GeneratorEquation::type
+"Return the :enum:`GeneratorEquation::Type`.";
+
+%feature("docstring") libcellml::GeneratorEquation::ast
+"Return the :class:`GeneratorAst` of this :class:`GeneratorEquation`, i.e. its
+assignment node.";
+
+%feature("docstring") libcellml::GeneratorEquation::variable
+"Return the :class:`GeneratorVariable` computed by this :class:`GeneratorEquation`.";
+
+%feature("docstring") libcellml::GeneratorEquation::component
+"Return the :class:`Component` in which this :class:`GeneratorEquation` is defined.";
+
+%feature("docstring") libcellml::GeneratorEquation::dependencyCount
+"Return the number of equations that must be computed before this
+:class:`GeneratorEquation`.";
+
+%feature("docstring") libcellml::GeneratorEquation::dependency
+"Return the dependency at the given index, or `None` if the index is invalid.";
+
+%feature("docstring") libcellml::GeneratorEquation::isStateRateBased
+"Tests if this :class:`GeneratorEquation` relies, directly or indirectly, on a
+state or a rate.";
+
 %feature("docstring") libcellml::Generator
 "Can generate code from a :class:`Model` according to a code generation profile.";
 
@@ -33,6 +95,153 @@
 %feature("docstring") libcellml::Generator::setProfile
 "Sets this :class:`Generator`'s profile.";
 
+%feature("docstring") libcellml::Generator::addRequiredOutput
+"Adds a required output to this :class:`Generator`. If there is at least one
+required output, then only the required outputs and the variables on which
+they depend are computed. An issue is reported if the variable is not an
+algebraic variable of the model.";
+
+%feature("docstring") libcellml::Generator::removeAllRequiredOutputs
+"Removes all the required outputs from this :class:`Generator`.";
+
+%feature("docstring") libcellml::Generator::requiredOutputCount
+"Returns the number of required outputs of this :class:`Generator`.";
+
+%feature("docstring") libcellml::Generator::requiredOutput
+"Returns the required output at the given index, or `None` if the index is invalid.";
+
+%feature("docstring") libcellml::Generator::addSensitivityParameter
+"Adds a sensitivity parameter to this :class:`Generator`. If there is at least
+one sensitivity parameter, then a method to compute the rates of the forward
+sensitivities of the states with respect to the sensitivity parameters is
+generated. A sensitivity parameter must be a constant.";
+
+%feature("docstring") libcellml::Generator::removeAllSensitivityParameters
+"Removes all the sensitivity parameters from this :class:`Generator`.";
+
+%feature("docstring") libcellml::Generator::sensitivityParameterCount
+"Returns the number of sensitivity parameters of this :class:`Generator`.";
+
+%feature("docstring") libcellml::Generator::sensitivityParameter
+"Returns the sensitivity parameter at the given index, or `None` if the index is invalid.";
+
+%feature("docstring") libcellml::Generator::addSweepParameter
+"Adds a sweep parameter to this :class:`Generator`. If there is at least one
+sweep parameter, then methods to initialise and compute the rates of a batch of
+instances of the model, each with its own values for the sweep parameters, are
+generated. The other constants are baked into those methods. A sweep parameter
+must be a constant.";
+
+%feature("docstring") libcellml::Generator::removeAllSweepParameters
+"Removes all the sweep parameters from this :class:`Generator`.";
+
+%feature("docstring") libcellml::Generator::sweepParameterCount
+"Returns the number of sweep parameters of this :class:`Generator`.";
+
+%feature("docstring") libcellml::Generator::sweepParameter
+"Returns the sweep parameter at the given index, or `None` if the index is invalid.";
+
+%feature("docstring") libcellml::Generator::setLookupTable
+"Sets the lookup table to be used by this :class:`Generator`, i.e. the state
+variable to use as its argument (or `None` to detect it automatically), and the
+minimum, maximum and step of that argument.";
+
+%feature("docstring") libcellml::Generator::removeLookupTable
+"Removes the lookup table from this :class:`Generator`.";
+
+%feature("docstring") libcellml::Generator::hasLookupTable
+"Tests if this :class:`Generator` has a lookup table.";
+
+%feature("docstring") libcellml::Generator::lookupTableVariable
+"Returns the state variable used as the argument of the lookup table, or `None`
+if there is no lookup table or if that state is to be detected automatically.";
+
+%feature("docstring") libcellml::Generator::lookupTableMinimum
+"Returns the minimum value of the argument of the lookup table.";
+
+%feature("docstring") libcellml::Generator::lookupTableMaximum
+"Returns the maximum value of the argument of the lookup table.";
+
+%feature("docstring") libcellml::Generator::lookupTableStep
+"Returns the step of the argument of the lookup table.";
+
+%feature("docstring") libcellml::Generator::setHasSpecializedMethods
+"Sets whether this :class:`Generator` generates specialised versions of the
+methods to compute the rates and variables, in which the constants and computed
+constants are literals. The constants take their current initial value and the
+computed constants are folded from those values when generating code.";
+
+%feature("docstring") libcellml::Generator::hasSpecializedMethods
+"Tests if this :class:`Generator` generates specialised versions of the methods
+to compute the rates and variables.";
+
+%feature("docstring") libcellml::Generator::setMaximumStatementCount
+"Sets the maximum number of statements in the methods to compute the computed
+constants, rates and variables. Methods with more statements are split into
+chunks that they call in sequence. A value of 0 means that methods are not
+split.";
+
+%feature("docstring") libcellml::Generator::maximumStatementCount
+"Returns the maximum number of statements in the methods to compute the
+computed constants, rates and variables, or 0 if methods are not split.";
+
+%feature("docstring") libcellml::Generator::setParallelChunkSize
+"Sets the number of equations per parallel task in the methods to compute the
+rates and variables. The equations of those methods are then grouped into
+levels of independent equations, each level being split into tasks that can be
+run in parallel. A value of 0 means that sequential code is generated.";
+
+%feature("docstring") libcellml::Generator::parallelChunkSize
+"Returns the number of equations per parallel task in the methods to compute
+the rates and variables, or 0 if sequential code is generated.";
+
+%feature("docstring") libcellml::Generator::setMinimumInstanceCount
+"Sets the minimum number of instances of a component for the methods to compute
+the rates and variables to use an instance kernel for them. Instances are
+components with the same equations, e.g. a component imported several times,
+and those whose states, rates and variables are at evenly spaced indices get
+computed by a kernel that loops over them. A value of 0 means that no instance
+kernels are used.";
+
+%feature("docstring") libcellml::Generator::minimumInstanceCount
+"Returns the minimum number of instances of a component for the methods to
+compute the rates and variables to use an instance kernel for them, or 0 if no
+instance kernels are used.";
+
+%feature("docstring") libcellml::Generator::setMaximumThreadCount
+"Sets the maximum number of threads used to process the math of the components
+of a :class:`Model`. The result of processing a :class:`Model` doesn't depend
+on the number of threads used, and a small :class:`Model` is always processed
+using only the calling thread. A value of 0 means that as many threads as the
+hardware supports may be used.";
+
+%feature("docstring") libcellml::Generator::maximumThreadCount
+"Returns the maximum number of threads used to process the math of the
+components of a :class:`Model`, or 0 if as many threads as the hardware
+supports may be used.";
+
+%feature("docstring") libcellml::Generator::setVariableOrdering
+"Sets the order in which the states and variables are stored in the states and
+variables arrays, i.e. by default, by first use in the method to compute the
+rates, or by first use in that method but grouped by component.";
+
+%feature("docstring") libcellml::Generator::variableOrdering
+"Returns the order in which the states and variables are stored in the states
+and variables arrays.";
+
+%feature("docstring") libcellml::Generator::setAnalysisCacheSize
+"Sets the maximum number of analyses kept by this :class:`Generator`. The
+analysis of a :class:`Model` is cached using a hash of its structure, so that
+processing a :class:`Model` with the same structure as a cached one only
+requires the cached analysis to be re-attached to it. Only the analyses that
+result in no issues are cached and, once the cache is full, the least recently
+used analysis is removed from it. A value of 0 means that no analyses are
+cached.";
+
+%feature("docstring") libcellml::Generator::analysisCacheSize
+"Returns the maximum number of analyses kept by this :class:`Generator`, or 0
+if no analyses are cached.";
+
 %feature("docstring") libcellml::Generator::processModel
 "Process the :class:`Model` given, analysing, and
 preparing for code generation.";
@@ -55,11 +264,24 @@ preparing for code generation.";
 %feature("docstring") libcellml::Generator::variable
 "Return the variable at the given index from the variable array.";
 
+%feature("docstring") libcellml::Generator::equationCount
+"Return the number of equations found in the processed :class:`Model`.";
+
+%feature("docstring") libcellml::Generator::equation
+"Return the equation at the given index. Equations are scheduled, i.e. an
+equation always comes after its dependencies.";
+
 %feature("docstring") libcellml::Generator::interfaceCode
 "Return the interface code for the :class:`Model` processed.";
 
 %feature("docstring") libcellml::Generator::implementationCode
-"Return the implementation code for the :class:`Model` processed.";
+"Return the implementation code for the :class:`Model` processed. For an ODE
+model with resets, this includes methods to compute the root of each reset and
+to apply the resets flagged as active in an array of events. Only states can be
+reset.";
+
+%ignore libcellml::Generator::writeInterfaceCode;
+%ignore libcellml::Generator::writeImplementationCode;
 
 %{
 #include "libcellml/generator.h"
@@ -72,6 +294,8 @@ self.setProfile(profile)
 %}
 
 %create_constructor(GeneratorVariable)
+%create_constructor(GeneratorAst)
+%create_constructor(GeneratorEquation)
 %create_constructor(Generator)
 
 %include "libcellml/types.h"
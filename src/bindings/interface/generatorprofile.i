@@ -17,12 +17,43 @@ according to this profile.";
 %feature("docstring") libcellml::GeneratorProfile::setProfile
 "Set the :enum:`GeneratorProfile::Profile` for this :class:`GeneratorProfile`.";
 
+%feature("docstring") libcellml::GeneratorProfile::precision
+"Return the :enum:`GeneratorProfile::Precision` for this :class:`GeneratorProfile`.";
+
+%feature("docstring") libcellml::GeneratorProfile::setPrecision
+"Set the :enum:`GeneratorProfile::Precision` for this :class:`GeneratorProfile`,
+reloading its strings accordingly.";
+
 %feature("docstring") libcellml::GeneratorProfile::hasInterface
 "Test if this :class:`GeneratorProfile` requires an interface.";
 
 %feature("docstring") libcellml::GeneratorProfile::setHasInterface
 "Set whether this :class:`GeneratorProfile` requires an interface.";
 
+%feature("docstring") libcellml::GeneratorProfile::hasCodeOptimization
+"Test if this :class:`GeneratorProfile` requires the generated code to be optimised.";
+
+%feature("docstring") libcellml::GeneratorProfile::setHasCodeOptimization
+"Set whether this :class:`GeneratorProfile` requires the generated code to be optimised.";
+
+%feature("docstring") libcellml::GeneratorProfile::hasJacobian
+"Test if this :class:`GeneratorProfile` requires the Jacobian of the rates to be generated.";
+
+%feature("docstring") libcellml::GeneratorProfile::setHasJacobian
+"Set whether this :class:`GeneratorProfile` requires the Jacobian of the rates to be generated.";
+
+%feature("docstring") libcellml::GeneratorProfile::hasRushLarsen
+"Test if this :class:`GeneratorProfile` requires a Rush-Larsen step to be generated.";
+
+%feature("docstring") libcellml::GeneratorProfile::setHasRushLarsen
+"Set whether this :class:`GeneratorProfile` requires a Rush-Larsen step to be generated.";
+
+%feature("docstring") libcellml::GeneratorProfile::hasBranchlessPiecewise
+"Test if this :class:`GeneratorProfile` requires piecewise statements to be branchless.";
+
+%feature("docstring") libcellml::GeneratorProfile::setHasBranchlessPiecewise
+"Set whether this :class:`GeneratorProfile` requires piecewise statements to be branchless.";
+
 %feature("docstring") libcellml::GeneratorProfile::assignmentString
 "Return the assigment operator.";
 
@@ -407,6 +438,22 @@ according to this profile.";
 %feature("docstring") libcellml::GeneratorProfile::setConditionalOperatorElseString
 "Set the else part of a condition statement.";
 
+%feature("docstring") libcellml::GeneratorProfile::branchlessPiecewiseIfString
+"Return the string for the if part of a branchless piecewise statement.";
+
+%feature("docstring") libcellml::GeneratorProfile::setBranchlessPiecewiseIfString
+"Set the string for the if part of a branchless piecewise statement.
+To be useful, the string should contain the <CONDITION> and <IF_STATEMENT>
+tags, which will be replaced with the condition and the value of a piece.";
+
+%feature("docstring") libcellml::GeneratorProfile::branchlessPiecewiseElseString
+"Return the string for the else part of a branchless piecewise statement.";
+
+%feature("docstring") libcellml::GeneratorProfile::setBranchlessPiecewiseElseString
+"Set the string for the else part of a branchless piecewise statement.
+To be useful, the string should contain the <ELSE_STATEMENT> tag, which
+will be replaced with the value of the rest of the piecewise statement.";
+
 %feature("docstring") libcellml::GeneratorProfile::piecewiseIfString
 "Return the if part of a piecewise statement.";
 
@@ -461,6 +508,12 @@ according to this profile.";
 %feature("docstring") libcellml::GeneratorProfile::setNanString
 "Set the string for NaN.";
 
+%feature("docstring") libcellml::GeneratorProfile::floatingPointLiteralSuffixString
+"Return the string for the suffix of a floating-point literal.";
+
+%feature("docstring") libcellml::GeneratorProfile::setFloatingPointLiteralSuffixString
+"Set the string for the suffix of a floating-point literal.";
+
 %feature("docstring") libcellml::GeneratorProfile::eqFunctionString
 "Return the string for the equivalence function.";
 
@@ -533,6 +586,13 @@ according to this profile.";
 %feature("docstring") libcellml::GeneratorProfile::setMaxFunctionString
 "Set the string for the maximum function.";
 
+%feature("docstring") libcellml::GeneratorProfile::blendFunctionString
+"Return the string for the blend function.";
+
+%feature("docstring") libcellml::GeneratorProfile::setBlendFunctionString
+"Set the string for the blend function, which is used by branchless piecewise
+statements to select one of two values that have both already been evaluated.";
+
 %feature("docstring") libcellml::GeneratorProfile::secFunctionString
 "Return the string for the secant function.";
 
@@ -792,6 +852,73 @@ the different variables. To be useful, the string should contain the
 <CODE> tag, which will be replaced with some information about the
 different variables.";
 
+%feature("docstring") libcellml::GeneratorProfile::interfaceJacobianSparsityString
+"Return the string for the interface of the sparsity pattern of the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceJacobianSparsityString
+"Set the string for the interface of the sparsity pattern of the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationJacobianSparsityString
+"Return the string for the implementation of the sparsity pattern of the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationJacobianSparsityString
+"Set the string for the implementation of the sparsity pattern of the Jacobian.
+To be useful, the string should contain the <NON_ZERO_COUNT>,
+<ROW_POINTERS> and <COLUMN_INDICES> tags, which will be replaced with the
+number of non-zero entries in the Jacobian and with the row pointers and
+column indices of the Jacobian in compressed sparse row format.";
+
+%feature("docstring") libcellml::GeneratorProfile::emptyJacobianColumnIndicesString
+"Return the string for the column indices of a Jacobian without any non-zero entry.";
+
+%feature("docstring") libcellml::GeneratorProfile::setEmptyJacobianColumnIndicesString
+"Set the string for the column indices of a Jacobian without any non-zero entry.
+The string is used in place of the <COLUMN_INDICES> tag of the implementation
+of the sparsity pattern of the Jacobian when the Jacobian has no non-zero
+entries, e.g. since an empty initialiser list is not valid in C.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceSensitivityParameterCountString
+"Return the string for the interface of the number of sensitivity parameters.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceSensitivityParameterCountString
+"Set the string for the interface of the number of sensitivity parameters.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationSensitivityParameterCountString
+"Return the string for the implementation of the number of sensitivity parameters.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationSensitivityParameterCountString
+"Set the string for the implementation of the number of sensitivity parameters.
+To be useful, the string should contain the <SENSITIVITY_PARAMETER_COUNT>
+tag, which will be replaced with the number of sensitivity parameters.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceSweepParameterCountString
+"Return the string for the interface of the number of sweep parameters.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceSweepParameterCountString
+"Set the string for the interface of the number of sweep parameters.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationSweepParameterCountString
+"Return the string for the implementation of the number of sweep parameters.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationSweepParameterCountString
+"Set the string for the implementation of the number of sweep parameters.
+To be useful, the string should contain the <SWEEP_PARAMETER_COUNT> tag,
+which will be replaced with the number of sweep parameters.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceResetCountString
+"Return the string for the interface of the number of resets.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceResetCountString
+"Set the string for the interface of the number of resets.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationResetCountString
+"Return the string for the implementation of the number of resets.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationResetCountString
+"Set the string for the implementation of the number of resets.
+To be useful, the string should contain the <RESET_COUNT> tag, which will
+be replaced with the number of resets.";
+
 %feature("docstring") libcellml::GeneratorProfile::variableInfoEntryString
 "Return the string for an entry in an array for some information
 about a variable.";
@@ -818,6 +945,12 @@ with the name of the component, name and units of a variable.";
 %feature("docstring") libcellml::GeneratorProfile::setVoiString
 "Set the string for the name of the variable of integration.";
 
+%feature("docstring") libcellml::GeneratorProfile::timeStepString
+"Return the string for the name of the time step.";
+
+%feature("docstring") libcellml::GeneratorProfile::setTimeStepString
+"Set the string for the name of the time step.";
+
 %feature("docstring") libcellml::GeneratorProfile::statesArrayString
 "Return the string for the name of the states array.";
 
@@ -836,6 +969,74 @@ with the name of the component, name and units of a variable.";
 %feature("docstring") libcellml::GeneratorProfile::setVariablesArrayString
 "Set the string for the name of the variables array.";
 
+%feature("docstring") libcellml::GeneratorProfile::jacobianArrayString
+"Return the string for the name of the Jacobian array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setJacobianArrayString
+"Set the string for the name of the Jacobian array.";
+
+%feature("docstring") libcellml::GeneratorProfile::sensitivitiesArrayString
+"Return the string for the name of the sensitivities array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setSensitivitiesArrayString
+"Set the string for the name of the sensitivities array.";
+
+%feature("docstring") libcellml::GeneratorProfile::sensitivityRatesArrayString
+"Return the string for the name of the sensitivity rates array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setSensitivityRatesArrayString
+"Set the string for the name of the sensitivity rates array.";
+
+%feature("docstring") libcellml::GeneratorProfile::sweepParametersArrayString
+"Return the string for the name of the sweep parameters array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setSweepParametersArrayString
+"Set the string for the name of the sweep parameters array.";
+
+%feature("docstring") libcellml::GeneratorProfile::batchArrayIndexString
+"Return the string for the index of an element of the states, rates or variables array in a batch method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setBatchArrayIndexString
+"Set the string for the index of an element of the states, rates or variables array in a batch method.
+To be useful, the string should contain the <INDEX> tag, which will be
+replaced with the index of the state, rate or variable for one instance.";
+
+%feature("docstring") libcellml::GeneratorProfile::batchSweepParameterIndexString
+"Return the string for the index of an element of the sweep parameters array in a batch method.";
+
+%feature("docstring") libcellml::GeneratorProfile::setBatchSweepParameterIndexString
+"Set the string for the index of an element of the sweep parameters array in a batch method.
+To be useful, the string should contain the <INDEX> tag, which will be
+replaced with the index of the sweep parameter.";
+
+%feature("docstring") libcellml::GeneratorProfile::instanceArrayIndexString
+"Return the string for the index of an element of the states, rates or variables array in an instance kernel.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInstanceArrayIndexString
+"Set the string for the index of an element of the states, rates or variables array in an instance kernel.
+To be useful, the string should contain the <INDEX> and <STRIDE> tags,
+which will be replaced with the index of the state, rate or variable for the
+first instance and with the distance between the indices of two consecutive
+instances.";
+
+%feature("docstring") libcellml::GeneratorProfile::rootsArrayString
+"Return the string for the name of the roots array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setRootsArrayString
+"Set the string for the name of the roots array.";
+
+%feature("docstring") libcellml::GeneratorProfile::eventsArrayString
+"Return the string for the name of the events array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setEventsArrayString
+"Set the string for the name of the events array.";
+
+%feature("docstring") libcellml::GeneratorProfile::resetValuesArrayString
+"Return the string for the name of the reset values array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setResetValuesArrayString
+"Set the string for the name of the reset values array.";
+
 %feature("docstring") libcellml::GeneratorProfile::setReturnCreatedArrayString
 "Set the string for returning a created array. To be useful, the
 string should contain the <ARRAY_SIZE> tag, which will be replaced with
@@ -910,6 +1111,23 @@ be replaced with some code to create the variables array.";
 %feature("docstring") libcellml::GeneratorProfile::setImplementationComputeComputedConstantsMethodString
 "Set the string for the implementation to compute computed constants.";
 
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeComputedConstantsMethodChunkString
+"Return the string for the implementation of a chunk of the method to compute the computed constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeComputedConstantsMethodChunkString
+"Set the string for the implementation of a chunk of the method to compute the computed constants.
+To be useful, the string should contain the <INDEX> and <CODE> tags, which
+will be replaced with the index of the chunk and with some code to
+compute the computed constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::computeComputedConstantsMethodChunkCallString
+"Return the string for the call to a chunk of the method to compute the computed constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::setComputeComputedConstantsMethodChunkCallString
+"Set the string for the call to a chunk of the method to compute the computed constants.
+To be useful, the string should contain the <INDEX> tag, which will be
+replaced with the index of the chunk.";
+
 %feature("docstring") libcellml::GeneratorProfile::interfaceComputeRatesMethodString
 "Return the string for the interface to compute rates.";
 
@@ -922,6 +1140,40 @@ be replaced with some code to create the variables array.";
 %feature("docstring") libcellml::GeneratorProfile::setImplementationComputeRatesMethodString
 "Set the string for the implementation to compute rates.";
 
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeRatesMethodChunkString
+"Return the string for the implementation of a chunk of the method to compute the rates.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeRatesMethodChunkString
+"Set the string for the implementation of a chunk of the method to compute the rates.
+To be useful, the string should contain the <INDEX> and <CODE> tags, which
+will be replaced with the index of the chunk and with some code to
+compute the rates.";
+
+%feature("docstring") libcellml::GeneratorProfile::computeRatesMethodChunkCallString
+"Return the string for the call to a chunk of the method to compute the rates.";
+
+%feature("docstring") libcellml::GeneratorProfile::setComputeRatesMethodChunkCallString
+"Set the string for the call to a chunk of the method to compute the rates.
+To be useful, the string should contain the <INDEX> tag, which will be
+replaced with the index of the chunk.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeRatesMethodKernelString
+"Return the string for the implementation of an instance kernel of the method to compute the rates.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeRatesMethodKernelString
+"Set the string for the implementation of an instance kernel of the method to compute the rates.
+To be useful, the string should contain the <INDEX>, <INSTANCE_COUNT> and
+<CODE> tags, which will be replaced with the index of the kernel, with the
+number of instances and with some code to compute the rates of one instance.";
+
+%feature("docstring") libcellml::GeneratorProfile::computeRatesMethodKernelCallString
+"Return the string for the call to an instance kernel of the method to compute the rates.";
+
+%feature("docstring") libcellml::GeneratorProfile::setComputeRatesMethodKernelCallString
+"Set the string for the call to an instance kernel of the method to compute the rates.
+To be useful, the string should contain the <INDEX> tag, which will be
+replaced with the index of the kernel.";
+
 %feature("docstring") libcellml::GeneratorProfile::interfaceComputeVariablesMethodString
 "Return the string for the interface to compute variables.";
 
@@ -934,6 +1186,248 @@ be replaced with some code to create the variables array.";
 %feature("docstring") libcellml::GeneratorProfile::setImplementationComputeVariablesMethodString
 "Set the string for the implementation to compute variables.";
 
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeVariablesMethodChunkString
+"Return the string for the implementation of a chunk of the method to compute the variables.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeVariablesMethodChunkString
+"Set the string for the implementation of a chunk of the method to compute the variables.
+To be useful, the string should contain the <INDEX> and <CODE> tags, which
+will be replaced with the index of the chunk and with some code to
+compute the variables.";
+
+%feature("docstring") libcellml::GeneratorProfile::computeVariablesMethodChunkCallString
+"Return the string for the call to a chunk of the method to compute the variables.";
+
+%feature("docstring") libcellml::GeneratorProfile::setComputeVariablesMethodChunkCallString
+"Set the string for the call to a chunk of the method to compute the variables.
+To be useful, the string should contain the <INDEX> tag, which will be
+replaced with the index of the chunk.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeVariablesMethodKernelString
+"Return the string for the implementation of an instance kernel of the method to compute the variables.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeVariablesMethodKernelString
+"Set the string for the implementation of an instance kernel of the method to compute the variables.
+To be useful, the string should contain the <INDEX>, <INSTANCE_COUNT> and
+<CODE> tags, which will be replaced with the index of the kernel, with the
+number of instances and with some code to compute the variables of one
+instance.";
+
+%feature("docstring") libcellml::GeneratorProfile::computeVariablesMethodKernelCallString
+"Return the string for the call to an instance kernel of the method to compute the variables.";
+
+%feature("docstring") libcellml::GeneratorProfile::setComputeVariablesMethodKernelCallString
+"Set the string for the call to an instance kernel of the method to compute the variables.
+To be useful, the string should contain the <INDEX> tag, which will be
+replaced with the index of the kernel.";
+
+%feature("docstring") libcellml::GeneratorProfile::parallelRegionString
+"Return the string for a parallel region.";
+
+%feature("docstring") libcellml::GeneratorProfile::setParallelRegionString
+"Set the string for a parallel region.
+To be useful, the string should contain the <CODE> tag, which will be
+replaced with the code for the different levels of the method to compute the
+rates or the variables.";
+
+%feature("docstring") libcellml::GeneratorProfile::parallelLevelString
+"Return the string for a level of a parallel region.";
+
+%feature("docstring") libcellml::GeneratorProfile::setParallelLevelString
+"Set the string for a level of a parallel region.
+To be useful, the string should contain the <CODE> tag, which will be
+replaced with the code for the tasks of the level, which can all be run in
+parallel.";
+
+%feature("docstring") libcellml::GeneratorProfile::parallelTaskString
+"Return the string for a task of a level of a parallel region.";
+
+%feature("docstring") libcellml::GeneratorProfile::setParallelTaskString
+"Set the string for a task of a level of a parallel region.
+To be useful, the string should contain the <CODE> tag, which will be
+replaced with the code for the equations computed by the task.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeJacobianMethodString
+"Return the string for the interface to compute the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeJacobianMethodString
+"Set the string for the interface to compute the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeJacobianMethodString
+"Return the string for the implementation to compute the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeJacobianMethodString
+"Set the string for the implementation to compute the Jacobian.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeRushLarsenStepMethodString
+"Return the string for the interface to compute a Rush-Larsen step.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeRushLarsenStepMethodString
+"Set the string for the interface to compute a Rush-Larsen step.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeRushLarsenStepMethodString
+"Return the string for the implementation to compute a Rush-Larsen step.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeRushLarsenStepMethodString
+"Set the string for the implementation to compute a Rush-Larsen step.
+To be useful, the string should contain the <CODE> tag, which will be
+replaced with some code to compute the rates and to update the states. It
+may also contain the <STATE_COUNT> tag, which will be replaced with the
+number of states, e.g. to declare a local array for the rates.";
+
+%feature("docstring") libcellml::GeneratorProfile::rushLarsenExponentString
+"Return the string for the name of the local variable that holds the exponent of a Rush-Larsen step.";
+
+%feature("docstring") libcellml::GeneratorProfile::setRushLarsenExponentString
+"Set the string for the name of the local variable that holds the exponent of a Rush-Larsen step.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationRushLarsenExponentString
+"Return the string for the declaration of the local variable that holds the exponent of a Rush-Larsen step.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationRushLarsenExponentString
+"Set the string for the declaration of the local variable that holds the exponent of a Rush-Larsen step.
+The declaration is only generated if at least one state is updated using the
+Rush-Larsen method rather than forward Euler.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeSensitivityRatesMethodString
+"Return the string for the interface to compute the sensitivity rates.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeSensitivityRatesMethodString
+"Set the string for the interface to compute the sensitivity rates.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeSensitivityRatesMethodString
+"Return the string for the implementation to compute the sensitivity rates.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeSensitivityRatesMethodString
+"Set the string for the implementation to compute the sensitivity rates.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceInitializeStatesAndConstantsBatchMethodString
+"Return the string for the interface to initialise the states and (computed) constants of a batch of instances.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceInitializeStatesAndConstantsBatchMethodString
+"Set the string for the interface to initialise the states and (computed) constants of a batch of instances.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationInitializeStatesAndConstantsBatchMethodString
+"Return the string for the implementation to initialise the states and (computed) constants of a batch of instances.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationInitializeStatesAndConstantsBatchMethodString
+"Set the string for the implementation to initialise the states and (computed) constants of a batch of instances.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeRatesBatchMethodString
+"Return the string for the interface to compute the rates of a batch of instances.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeRatesBatchMethodString
+"Set the string for the interface to compute the rates of a batch of instances.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeRatesBatchMethodString
+"Return the string for the implementation to compute the rates of a batch of instances.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeRatesBatchMethodString
+"Set the string for the implementation to compute the rates of a batch of instances.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeRatesSpecializedMethodString
+"Return the string for the interface to compute the rates using the current values of the (computed) constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeRatesSpecializedMethodString
+"Set the string for the interface to compute the rates using the current values of the (computed) constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeRatesSpecializedMethodString
+"Return the string for the implementation to compute the rates using the current values of the (computed) constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeRatesSpecializedMethodString
+"Set the string for the implementation to compute the rates using the current values of the (computed) constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeVariablesSpecializedMethodString
+"Return the string for the interface to compute the variables using the current values of the (computed) constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeVariablesSpecializedMethodString
+"Set the string for the interface to compute the variables using the current values of the (computed) constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeVariablesSpecializedMethodString
+"Return the string for the implementation to compute the variables using the current values of the (computed) constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeVariablesSpecializedMethodString
+"Set the string for the implementation to compute the variables using the current values of the (computed) constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeRootsMethodString
+"Return the string for the interface to compute the roots.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeRootsMethodString
+"Set the string for the interface to compute the roots.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeRootsMethodString
+"Return the string for the implementation to compute the roots.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeRootsMethodString
+"Set the string for the implementation to compute the roots.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceApplyResetsMethodString
+"Return the string for the interface to apply the resets.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceApplyResetsMethodString
+"Set the string for the interface to apply the resets.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationApplyResetsMethodString
+"Return the string for the implementation to apply the resets.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationApplyResetsMethodString
+"Set the string for the implementation to apply the resets.
+To be useful, the string should contain the <RESET_VARIABLE_COUNT> tag,
+which will be replaced with the number of variables that can be reset.";
+
+%feature("docstring") libcellml::GeneratorProfile::lookupTableArgumentString
+"Return the string for the name of the argument of the lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::setLookupTableArgumentString
+"Set the string for the name of the argument of the lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationLookupTableString
+"Return the string for the implementation of the lookup table and of the function to interpolate it.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationLookupTableString
+"Set the string for the implementation of the lookup table and of the function to interpolate it.
+To be useful, the string should contain the <ROW_COUNT>, <COLUMN_COUNT>,
+<MINIMUM>, <STEP> and <MAXIMUM_INDEX> tags, which will be replaced with the
+number of rows and columns of the lookup table, with the minimum value and step
+of its argument, and with the index of the last row from which to interpolate
+(i.e. the number of rows minus two).";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeLookupTableMethodString
+"Return the string for the implementation to compute the lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeLookupTableMethodString
+"Set the string for the implementation to compute the lookup table.
+To be useful, the string should contain the <CODE> tag, which will be
+replaced with some code to compute a row of the lookup table. It should also
+contain the <ROW_COUNT>, <MINIMUM> and <STEP> tags, which will be replaced
+with the number of rows of the lookup table, and with the minimum value and
+step of its argument. The lookup table only depends on true constants and is
+shared by all the callers of the generated code, so it should only be computed
+the first time that the method is called.";
+
+%feature("docstring") libcellml::GeneratorProfile::computeLookupTableCallString
+"Return the string for the call to compute the lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::setComputeLookupTableCallString
+"Set the string for the call to compute the lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::lookupTableEntryString
+"Return the string for an entry of the current row of the lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::setLookupTableEntryString
+"Set the string for an entry of the current row of the lookup table.
+To be useful, the string should contain the <COLUMN> tag, which will be
+replaced with the column of the entry.";
+
+%feature("docstring") libcellml::GeneratorProfile::lookupTableValueString
+"Return the string for an interpolated value from the lookup table.";
+
+%feature("docstring") libcellml::GeneratorProfile::setLookupTableValueString
+"Set the string for an interpolated value from the lookup table.
+To be useful, the string should contain the <COLUMN> and <VALUE> tags,
+which will be replaced with the column of the lookup table to interpolate
+and with the value of its argument.";
+
 %feature("docstring") libcellml::GeneratorProfile::emptyMethodString
 "Return the string for an empty method.";
 
@@ -970,6 +1464,12 @@ be replaced with some code to create the variables array.";
 %feature("docstring") libcellml::GeneratorProfile::setCloseArrayString
 "Set the string for closing an array.";
 
+%feature("docstring") libcellml::GeneratorProfile::computeCastString
+"Return the string for the cast of a value read from an array to the type used for computations.";
+
+%feature("docstring") libcellml::GeneratorProfile::setComputeCastString
+"Set the string for the cast of a value read from an array to the type used for computations.";
+
 %feature("docstring") libcellml::GeneratorProfile::arrayElementSeparatorString
 "Return the string for separating elements in an array.";
 
@@ -73,12 +73,36 @@ Only meant to be included, shouldn't be passed to cmake as a module!
   }
 }
 
+%typemap(in) libcellml::Generator::VariableOrdering (int val, int ecode) {
+  ecode = SWIG_AsVal(int)($input, &val);
+  if (!SWIG_IsOK(ecode)) {
+    %argument_fail(ecode, "$type", $symname, $argnum);
+  } else {
+    if (val < %static_cast(libcellml::Generator::VariableOrdering::DEFAULT, int) || %static_cast(libcellml::Generator::VariableOrdering::FIRST_USE_BY_COMPONENT, int) < val) {
+      %argument_fail(ecode, "$type is not a valid value for the enumeration.", $symname, $argnum);
+    }
+    $1 = %static_cast(val,$basetype);
+  }
+}
+
 %typemap(in) libcellml::GeneratorProfile::Profile (int val, int ecode) {
   ecode = SWIG_AsVal(int)($input, &val);
   if (!SWIG_IsOK(ecode)) {
     %argument_fail(ecode, "$type", $symname, $argnum);
   } else {
-    if (val < %static_cast(libcellml::GeneratorProfile::Profile::C, int) || %static_cast(libcellml::GeneratorProfile::Profile::PYTHON, int) < val) {
+    if (val < %static_cast(libcellml::GeneratorProfile::Profile::C, int) || %static_cast(libcellml::GeneratorProfile::Profile::NUMPY, int) < val) {
+      %argument_fail(ecode, "$type is not a valid value for the enumeration.", $symname, $argnum);
+    }
+    $1 = %static_cast(val,$basetype);
+  }
+}
+
+%typemap(in) libcellml::GeneratorProfile::Precision (int val, int ecode) {
+  ecode = SWIG_AsVal(int)($input, &val);
+  if (!SWIG_IsOK(ecode)) {
+    %argument_fail(ecode, "$type", $symname, $argnum);
+  } else {
+    if (val < %static_cast(libcellml::GeneratorProfile::Precision::DOUBLE, int) || %static_cast(libcellml::GeneratorProfile::Precision::MIXED, int) < val) {
       %argument_fail(ecode, "$type is not a valid value for the enumeration.", $symname, $argnum);
     }
     $1 = %static_cast(val,$basetype);
@@ -10,6 +10,8 @@ The purpose of libCellML is to create, manipulate, serialise, deserialise,
 import libcellml
 from libcellml.component import Component
 from libcellml.generator import Generator
+from libcellml.generator import GeneratorAst
+from libcellml.generator import GeneratorEquation
 from libcellml.generator import GeneratorVariable
 from libcellml.generatorprofile import GeneratorProfile
 from libcellml.importsource import ImportSource
@@ -70,9 +72,93 @@ convert(Generator, 'ModelType', [
     'OVERCONSTRAINED',
     'UNSUITABLY_CONSTRAINED',
 ])
+convert(Generator, 'VariableOrdering', [
+    'DEFAULT',
+    'FIRST_USE',
+    'FIRST_USE_BY_COMPONENT',
+])
+convert(GeneratorAst, 'Type', [
+    'ASSIGNMENT',
+    'EQ',
+    'NEQ',
+    'LT',
+    'LEQ',
+    'GT',
+    'GEQ',
+    'AND',
+    'OR',
+    'XOR',
+    'NOT',
+    'PLUS',
+    'MINUS',
+    'TIMES',
+    'DIVIDE',
+    'POWER',
+    'ROOT',
+    'ABS',
+    'EXP',
+    'LN',
+    'LOG',
+    'CEILING',
+    'FLOOR',
+    'MIN',
+    'MAX',
+    'REM',
+    'DIFF',
+    'SIN',
+    'COS',
+    'TAN',
+    'SEC',
+    'CSC',
+    'COT',
+    'SINH',
+    'COSH',
+    'TANH',
+    'SECH',
+    'CSCH',
+    'COTH',
+    'ASIN',
+    'ACOS',
+    'ATAN',
+    'ASEC',
+    'ACSC',
+    'ACOT',
+    'ASINH',
+    'ACOSH',
+    'ATANH',
+    'ASECH',
+    'ACSCH',
+    'ACOTH',
+    'PIECEWISE',
+    'PIECE',
+    'OTHERWISE',
+    'CI',
+    'CN',
+    'DEGREE',
+    'LOGBASE',
+    'BVAR',
+    'TRUE_VALUE',
+    'FALSE_VALUE',
+    'E',
+    'PI',
+    'INF',
+    'NAN_VALUE',
+])
+convert(GeneratorEquation, 'Type', [
+    'TRUE_CONSTANT',
+    'VARIABLE_BASED_CONSTANT',
+    'RATE',
+    'ALGEBRAIC',
+])
 convert(GeneratorProfile, 'Profile', [
     'C',
     'PYTHON',
+    'NUMPY',
+])
+convert(GeneratorProfile, 'Precision', [
+    'DOUBLE',
+    'SINGLE',
+    'MIXED',
 ])
 convert(Variable, 'InterfaceType', [
     'NONE',
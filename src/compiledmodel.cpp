@@ -0,0 +1,458 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "libcellml/compiledmodel.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#ifndef _WIN32
+#    include <dlfcn.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "libcellml/generator.h"
+#include "libcellml/generatorprofile.h"
+#include "libcellml/issue.h"
+
+#include "utilities.h"
+
+namespace libcellml {
+
+/**
+ * @brief The CompiledModel::CompiledModelImpl struct.
+ *
+ * The private implementation for the CompiledModel class.
+ */
+struct CompiledModel::CompiledModelImpl
+{
+    CompiledModel *mCompiledModel = nullptr;
+
+    std::string mCompiler = "cc";
+    std::string mCompilerFlags = "-O2";
+    std::string mCacheDirectory;
+
+    void *mHandle = nullptr;
+    bool mFromCache = false;
+    std::string mCacheKey;
+
+    size_t mStateCount = 0;
+    size_t mVariableCount = 0;
+
+    InitializeStatesAndConstantsFunction mInitializeStatesAndConstants = nullptr;
+    ComputeComputedConstantsFunction mComputeComputedConstants = nullptr;
+    ComputeRatesFunction mComputeRates = nullptr;
+    ComputeVariablesFunction mComputeVariables = nullptr;
+
+    CompiledModelImpl();
+
+    void addIssue(const std::string &description);
+
+    void unload();
+    bool load(const std::string &fileName);
+    bool build(const std::string &interfaceFileName,
+               const std::string &interfaceCode,
+               const std::string &implementationCode,
+               const std::string &fileName);
+};
+
+static std::string defaultCacheDirectory()
+{
+    const char *xdgCacheHome = std::getenv("XDG_CACHE_HOME");
+
+    if ((xdgCacheHome != nullptr) && (*xdgCacheHome != '\0')) {
+        return std::string(xdgCacheHome) + "/libcellml";
+    }
+
+    const char *home = std::getenv("HOME");
+
+    if ((home != nullptr) && (*home != '\0')) {
+        return std::string(home) + "/.cache/libcellml";
+    }
+
+    return "libcellml";
+}
+
+static std::string quotedPath(const std::string &path)
+{
+    // Quote the given path so that it can safely be used in a shell command.
+
+    std::string res = "'";
+
+    for (auto c : path) {
+        if (c == '\'') {
+            res += "'\\''";
+        } else {
+            res += c;
+        }
+    }
+
+    return res + "'";
+}
+
+static bool writeFile(const std::string &fileName, const std::string &contents)
+{
+    std::ofstream file(fileName, std::ios::binary);
+
+    file << contents;
+
+    return file.good();
+}
+
+static std::string fileContents(const std::string &fileName)
+{
+    std::ifstream file(fileName);
+    std::stringstream buffer;
+
+    buffer << file.rdbuf();
+
+    return buffer.str();
+}
+
+#ifndef _WIN32
+static bool makeDirectory(const std::string &directory)
+{
+    // Create the given directory, as well as any missing parent directory.
+
+    for (size_t i = 1; i <= directory.size(); ++i) {
+        if ((i == directory.size()) || (directory[i] == '/')) {
+            std::string path = directory.substr(0, i);
+            struct stat info;
+
+            if ((stat(path.c_str(), &info) != 0)
+                && (mkdir(path.c_str(), 0755) != 0)
+                && (stat(path.c_str(), &info) != 0)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+#endif
+
+CompiledModel::CompiledModelImpl::CompiledModelImpl()
+    : mCacheDirectory(defaultCacheDirectory())
+{
+}
+
+void CompiledModel::CompiledModelImpl::addIssue(const std::string &description)
+{
+    IssuePtr issue = Issue::create();
+
+    issue->setDescription(description);
+    issue->setCause(Issue::Cause::GENERATOR);
+
+    mCompiledModel->addIssue(issue);
+}
+
+void CompiledModel::CompiledModelImpl::unload()
+{
+#ifndef _WIN32
+    if (mHandle != nullptr) {
+        dlclose(mHandle);
+    }
+#endif
+
+    mHandle = nullptr;
+    mFromCache = false;
+    mCacheKey.clear();
+
+    mStateCount = 0;
+    mVariableCount = 0;
+
+    mInitializeStatesAndConstants = nullptr;
+    mComputeComputedConstants = nullptr;
+    mComputeRates = nullptr;
+    mComputeVariables = nullptr;
+}
+
+bool CompiledModel::CompiledModelImpl::load(const std::string &fileName)
+{
+#ifdef _WIN32
+    (void)fileName;
+
+    return false;
+#else
+    // Note: we never really unload a shared library since it may have started
+    //       some threads (e.g. OpenMP worker threads, if the generated code
+    //       has been compiled with OpenMP support) that would crash if their
+    //       code was to be unloaded.
+
+    mHandle = dlopen(fileName.c_str(), RTLD_NOW | RTLD_LOCAL | RTLD_NODELETE);
+
+    if (mHandle == nullptr) {
+        return false;
+    }
+
+    auto stateCount = static_cast<const size_t *>(dlsym(mHandle, "STATE_COUNT"));
+    auto variableCount = static_cast<const size_t *>(dlsym(mHandle, "VARIABLE_COUNT"));
+
+    mStateCount = (stateCount != nullptr) ? *stateCount : 0;
+    mVariableCount = (variableCount != nullptr) ? *variableCount : 0;
+
+    mInitializeStatesAndConstants = reinterpret_cast<InitializeStatesAndConstantsFunction>(dlsym(mHandle, "initializeStatesAndConstants"));
+    mComputeComputedConstants = reinterpret_cast<ComputeComputedConstantsFunction>(dlsym(mHandle, "computeComputedConstants"));
+    mComputeRates = reinterpret_cast<ComputeRatesFunction>(dlsym(mHandle, "computeRates"));
+    mComputeVariables = reinterpret_cast<ComputeVariablesFunction>(dlsym(mHandle, "computeVariables"));
+
+    return true;
+#endif
+}
+
+bool CompiledModel::CompiledModelImpl::build(const std::string &interfaceFileName,
+                                             const std::string &interfaceCode,
+                                             const std::string &implementationCode,
+                                             const std::string &fileName)
+{
+#ifdef _WIN32
+    (void)interfaceFileName;
+    (void)interfaceCode;
+    (void)implementationCode;
+    (void)fileName;
+
+    return false;
+#else
+    // Build our shared library in a directory of its own, so that concurrent
+    // builds of the same code don't interfere with one another, and then move
+    // it to the cache, something that is atomic.
+
+    std::string directoryTemplate = fileName + ".XXXXXX";
+    std::vector<char> directoryBuffer(directoryTemplate.begin(), directoryTemplate.end());
+
+    directoryBuffer.push_back('\0');
+
+    if (mkdtemp(directoryBuffer.data()) == nullptr) {
+        addIssue("A build directory could not be created in '" + mCacheDirectory + "'.");
+
+        return false;
+    }
+
+    std::string directory = directoryBuffer.data();
+    std::string interfaceFile = directory + "/" + interfaceFileName;
+    std::string implementationFile = directory + "/model.c";
+    std::string sharedLibraryFile = directory + "/model.so";
+    std::string logFile = directory + "/compiler.log";
+    bool res = true;
+
+    if ((!interfaceCode.empty() && !writeFile(interfaceFile, interfaceCode))
+        || !writeFile(implementationFile, implementationCode)) {
+        addIssue("The generated code could not be written to '" + directory + "'.");
+
+        res = false;
+    } else {
+        std::string command = mCompiler + " " + mCompilerFlags
+                              + " -shared -fPIC -o " + quotedPath(sharedLibraryFile)
+                              + " " + quotedPath(implementationFile) + " -lm > "
+                              + quotedPath(logFile) + " 2>&1";
+
+        if (std::system(command.c_str()) != 0) {
+            addIssue("The generated code could not be compiled using '" + mCompiler + " " + mCompilerFlags + "':\n" + fileContents(logFile));
+
+            res = false;
+        } else if (std::rename(sharedLibraryFile.c_str(), fileName.c_str()) != 0) {
+            addIssue("The compiled code could not be moved to '" + fileName + "'.");
+
+            res = false;
+        }
+    }
+
+    for (const auto &file : {interfaceFile, implementationFile, sharedLibraryFile, logFile}) {
+        std::remove(file.c_str());
+    }
+
+    rmdir(directory.c_str());
+
+    return res;
+#endif
+}
+
+CompiledModel::CompiledModel()
+    : mPimpl(new CompiledModelImpl())
+{
+    mPimpl->mCompiledModel = this;
+}
+
+CompiledModel::~CompiledModel()
+{
+    mPimpl->unload();
+
+    delete mPimpl;
+}
+
+CompiledModelPtr CompiledModel::create() noexcept
+{
+    return std::shared_ptr<CompiledModel> {new CompiledModel {}};
+}
+
+std::string CompiledModel::compiler() const
+{
+    return mPimpl->mCompiler;
+}
+
+void CompiledModel::setCompiler(const std::string &compiler)
+{
+    mPimpl->mCompiler = compiler;
+}
+
+std::string CompiledModel::compilerFlags() const
+{
+    return mPimpl->mCompilerFlags;
+}
+
+void CompiledModel::setCompilerFlags(const std::string &compilerFlags)
+{
+    mPimpl->mCompilerFlags = compilerFlags;
+}
+
+std::string CompiledModel::cacheDirectory() const
+{
+    return mPimpl->mCacheDirectory;
+}
+
+void CompiledModel::setCacheDirectory(const std::string &cacheDirectory)
+{
+    mPimpl->mCacheDirectory = cacheDirectory;
+}
+
+bool CompiledModel::compile(const GeneratorPtr &generator)
+{
+    removeAllIssues();
+
+    mPimpl->unload();
+
+#ifdef _WIN32
+    (void)generator;
+
+    mPimpl->addIssue("Compiling generated code is not supported on this platform.");
+
+    return false;
+#else
+    if ((generator == nullptr) || (generator->profile() == nullptr)
+        || (generator->profile()->profile() != GeneratorProfile::Profile::C)) {
+        mPimpl->addIssue("Only code generated using a C profile can be compiled.");
+
+        return false;
+    }
+
+    // The functions that we expose work with doubles, so the code must have
+    // been generated using double precision.
+
+    if (generator->profile()->precision() != GeneratorProfile::Precision::DOUBLE) {
+        mPimpl->addIssue("Only code generated using a double-precision C profile can be compiled.");
+
+        return false;
+    }
+
+    auto interfaceCode = generator->interfaceCode();
+    auto implementationCode = generator->implementationCode();
+
+    if (implementationCode.empty()) {
+        mPimpl->addIssue("The generator has no code to compile.");
+
+        return false;
+    }
+
+    // Determine our cache key and check whether our shared library is already
+    // in our cache.
+
+    auto interfaceFileName = generator->profile()->interfaceFileNameString();
+    auto cacheKey = sha1(mPimpl->mCompiler + "\n" + mPimpl->mCompilerFlags + "\n"
+                         + interfaceFileName + "\n" + interfaceCode + "\n" + implementationCode);
+    auto fileName = mPimpl->mCacheDirectory + "/" + cacheKey + ".so";
+
+    if (mPimpl->load(fileName)) {
+        mPimpl->mFromCache = true;
+        mPimpl->mCacheKey = cacheKey;
+
+        return true;
+    }
+
+    // Our shared library is either not in our cache or it cannot be loaded, so
+    // (re)build it.
+
+    if (!makeDirectory(mPimpl->mCacheDirectory)) {
+        mPimpl->addIssue("The cache directory '" + mPimpl->mCacheDirectory + "' could not be created.");
+
+        return false;
+    }
+
+    if (!mPimpl->build(interfaceFileName, interfaceCode, implementationCode, fileName)) {
+        return false;
+    }
+
+    if (!mPimpl->load(fileName)) {
+        mPimpl->addIssue("The compiled code could not be loaded: " + std::string(dlerror()));
+
+        return false;
+    }
+
+    mPimpl->mCacheKey = cacheKey;
+
+    return true;
+#endif
+}
+
+bool CompiledModel::isCompiled() const
+{
+    return mPimpl->mHandle != nullptr;
+}
+
+bool CompiledModel::isFromCache() const
+{
+    return mPimpl->mFromCache;
+}
+
+std::string CompiledModel::cacheKey() const
+{
+    return mPimpl->mCacheKey;
+}
+
+size_t CompiledModel::stateCount() const
+{
+    return mPimpl->mStateCount;
+}
+
+size_t CompiledModel::variableCount() const
+{
+    return mPimpl->mVariableCount;
+}
+
+CompiledModel::InitializeStatesAndConstantsFunction CompiledModel::initializeStatesAndConstants() const
+{
+    return mPimpl->mInitializeStatesAndConstants;
+}
+
+CompiledModel::ComputeComputedConstantsFunction CompiledModel::computeComputedConstants() const
+{
+    return mPimpl->mComputeComputedConstants;
+}
+
+CompiledModel::ComputeRatesFunction CompiledModel::computeRates() const
+{
+    return mPimpl->mComputeRates;
+}
+
+CompiledModel::ComputeVariablesFunction CompiledModel::computeVariables() const
+{
+    return mPimpl->mComputeVariables;
+}
+
+} // namespace libcellml
@@ -17,15 +17,27 @@ limitations under the License.
 #include "libcellml/generator.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <iomanip>
 #include <limits>
 #include <list>
+#include <map>
 #include <regex>
 #include <sstream>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "libcellml/component.h"
 #include "libcellml/generatorprofile.h"
 #include "libcellml/model.h"
+#include "libcellml/reset.h"
 #include "libcellml/units.h"
 #include "libcellml/validator.h"
 #include "libcellml/variable.h"
@@ -33,16 +45,15 @@ limitations under the License.
 #include "utilities.h"
 #include "xmldoc.h"
 
-#undef NAN
-
-#ifdef __linux__
-#    undef TRUE
-#    undef FALSE
-#endif
-
 namespace libcellml {
 
 static const size_t MAX_SIZE_T = std::numeric_limits<size_t>::max();
+static const size_t MINIMUM_CODE_CAPACITY = 16384;
+static const size_t CODE_CAPACITY_PER_ITEM = 256;
+static const size_t STREAMED_CODE_CAPACITY = 65536;
+static const size_t MINIMUM_COMPONENT_COUNT_PER_THREAD = 16;
+static const size_t MINIMUM_AST_ARENA_BLOCK_SIZE = 4096;
+static const size_t MAXIMUM_AST_ARENA_BLOCK_SIZE = 1048576;
 
 /**
  * @brief The GeneratorVariable::GeneratorVariableImpl struct.
@@ -54,18 +65,25 @@ struct GeneratorVariable::GeneratorVariableImpl
     VariablePtr mVariable;
     ComponentPtr mComponent;
     GeneratorVariable::Type mType = GeneratorVariable::Type::CONSTANT;
+    size_t mIndex = 0;
+    size_t mDefaultIndex = 0;
 
     void populate(const VariablePtr &variable, const ComponentPtr &component,
-                  GeneratorVariable::Type type);
+                  GeneratorVariable::Type type, size_t index,
+                  size_t defaultIndex);
 };
 
 void GeneratorVariable::GeneratorVariableImpl::populate(const VariablePtr &variable,
                                                         const ComponentPtr &component,
-                                                        GeneratorVariable::Type type)
+                                                        GeneratorVariable::Type type,
+                                                        size_t index,
+                                                        size_t defaultIndex)
 {
     mVariable = variable;
     mComponent = component;
     mType = type;
+    mIndex = index;
+    mDefaultIndex = defaultIndex;
 }
 
 GeneratorVariable::GeneratorVariable()
@@ -98,9 +116,109 @@ GeneratorVariable::Type GeneratorVariable::type() const
     return mPimpl->mType;
 }
 
-struct GeneratorEquation;
-using GeneratorEquationPtr = std::shared_ptr<GeneratorEquation>;
-using GeneratorEquationWeakPtr = std::weak_ptr<GeneratorEquation>;
+size_t GeneratorVariable::index() const
+{
+    return mPimpl->mIndex;
+}
+
+size_t GeneratorVariable::defaultIndex() const
+{
+    return mPimpl->mDefaultIndex;
+}
+
+/**
+ * @brief The GeneratorEquation::GeneratorEquationImpl struct.
+ *
+ * The private implementation for the GeneratorEquation class.
+ */
+struct GeneratorEquation::GeneratorEquationImpl
+{
+    GeneratorEquation::Type mType = GeneratorEquation::Type::ALGEBRAIC;
+    GeneratorAstPtr mAst;
+    GeneratorVariablePtr mVariable;
+    ComponentPtr mComponent;
+    std::vector<GeneratorEquationPtr> mDependencies;
+    bool mIsStateRateBased = false;
+
+    void populate(GeneratorEquation::Type type, const GeneratorAstPtr &ast,
+                  const GeneratorVariablePtr &variable,
+                  const ComponentPtr &component,
+                  const std::vector<GeneratorEquationPtr> &dependencies,
+                  bool isStateRateBased);
+};
+
+void GeneratorEquation::GeneratorEquationImpl::populate(GeneratorEquation::Type type,
+                                                        const GeneratorAstPtr &ast,
+                                                        const GeneratorVariablePtr &variable,
+                                                        const ComponentPtr &component,
+                                                        const std::vector<GeneratorEquationPtr> &dependencies,
+                                                        bool isStateRateBased)
+{
+    mType = type;
+    mAst = ast;
+    mVariable = variable;
+    mComponent = component;
+    mDependencies = dependencies;
+    mIsStateRateBased = isStateRateBased;
+}
+
+GeneratorEquation::GeneratorEquation()
+    : mPimpl(new GeneratorEquationImpl())
+{
+}
+
+GeneratorEquation::~GeneratorEquation()
+{
+    delete mPimpl;
+}
+
+GeneratorEquationPtr GeneratorEquation::create() noexcept
+{
+    return std::shared_ptr<GeneratorEquation> {new GeneratorEquation {}};
+}
+
+GeneratorEquation::Type GeneratorEquation::type() const
+{
+    return mPimpl->mType;
+}
+
+GeneratorAstPtr GeneratorEquation::ast() const
+{
+    return mPimpl->mAst;
+}
+
+GeneratorVariablePtr GeneratorEquation::variable() const
+{
+    return mPimpl->mVariable;
+}
+
+ComponentPtr GeneratorEquation::component() const
+{
+    return mPimpl->mComponent;
+}
+
+size_t GeneratorEquation::dependencyCount() const
+{
+    return mPimpl->mDependencies.size();
+}
+
+GeneratorEquationPtr GeneratorEquation::dependency(size_t index) const
+{
+    if (index >= mPimpl->mDependencies.size()) {
+        return {};
+    }
+
+    return mPimpl->mDependencies[index];
+}
+
+bool GeneratorEquation::isStateRateBased() const
+{
+    return mPimpl->mIsStateRateBased;
+}
+
+struct GeneratorInternalEquation;
+using GeneratorInternalEquationPtr = std::shared_ptr<GeneratorInternalEquation>;
+using GeneratorInternalEquationWeakPtr = std::weak_ptr<GeneratorInternalEquation>;
 
 struct GeneratorInternalVariable
 {
@@ -118,12 +236,13 @@ struct GeneratorInternalVariable
     };
 
     size_t mIndex = MAX_SIZE_T;
+    size_t mDefaultIndex = MAX_SIZE_T;
     Type mType = Type::UNKNOWN;
 
     VariablePtr mVariable;
     ComponentPtr mComponent;
 
-    GeneratorEquationWeakPtr mEquation;
+    GeneratorInternalEquationWeakPtr mEquation;
 
     explicit GeneratorInternalVariable(const VariablePtr &variable);
 
@@ -170,165 +289,375 @@ void GeneratorInternalVariable::makeState()
 
 struct GeneratorEquationAst;
 using GeneratorEquationAstPtr = std::shared_ptr<GeneratorEquationAst>;
-using GeneratorEquationAstWeakPtr = std::weak_ptr<GeneratorEquationAst>;
 
-struct GeneratorEquationAst
+/**
+ * @brief The GeneratorAstArena class.
+ *
+ * An arena from which the nodes of ASTs get allocated, using a simple pointer
+ * bump, and in which the values of those nodes get interned. Nodes are never
+ * freed individually: the memory of an arena is freed in bulk once none of its
+ * nodes are in use anymore, i.e. typically when the Generator gets reset. An
+ * arena is not thread-safe, so each thread that creates nodes uses its own
+ * arena.
+ */
+class GeneratorAstArena
 {
-    enum struct Type
-    {
-        // Assignment.
+public:
+    void *allocate(size_t size);
+    const std::string *value(const std::string &value);
 
-        ASSIGNMENT,
+private:
+    std::vector<std::unique_ptr<char[]>> mBlocks;
+    size_t mBlockSize = MINIMUM_AST_ARENA_BLOCK_SIZE;
+    char *mNext = nullptr;
+    char *mEnd = nullptr;
 
-        // Relational and logical operators.
+    std::unordered_set<std::string> mValues;
+};
 
-        EQ,
-        NEQ,
-        LT,
-        LEQ,
-        GT,
-        GEQ,
-        AND,
-        OR,
-        XOR,
-        NOT,
+using GeneratorAstArenaPtr = std::shared_ptr<GeneratorAstArena>;
 
-        // Arithmetic operators.
+void *GeneratorAstArena::allocate(size_t size)
+{
+    // Keep our allocations suitably aligned for any type and, if there is not
+    // enough space left in our current block, start a new one, which is
+    // bigger than the previous one (up to a point).
 
-        PLUS,
-        MINUS,
-        TIMES,
-        DIVIDE,
-        POWER,
-        ROOT,
-        ABS,
-        EXP,
-        LN,
-        LOG,
-        CEILING,
-        FLOOR,
-        MIN,
-        MAX,
-        REM,
+    static const size_t ALIGNMENT = alignof(std::max_align_t);
 
-        // Calculus elements.
+    size = (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
 
-        DIFF,
+    if (size > static_cast<size_t>(mEnd - mNext)) {
+        auto blockSize = std::max(size, mBlockSize);
 
-        // Trigonometric operators.
+        mBlocks.emplace_back(new char[blockSize]);
 
-        SIN,
-        COS,
-        TAN,
-        SEC,
-        CSC,
-        COT,
-        SINH,
-        COSH,
-        TANH,
-        SECH,
-        CSCH,
-        COTH,
-        ASIN,
-        ACOS,
-        ATAN,
-        ASEC,
-        ACSC,
-        ACOT,
-        ASINH,
-        ACOSH,
-        ATANH,
-        ASECH,
-        ACSCH,
-        ACOTH,
+        mNext = mBlocks.back().get();
+        mEnd = mNext + blockSize;
+        mBlockSize = std::min(2 * mBlockSize, MAXIMUM_AST_ARENA_BLOCK_SIZE);
+    }
 
-        // Piecewise statement.
+    auto res = mNext;
 
-        PIECEWISE,
-        PIECE,
-        OTHERWISE,
+    mNext += size;
 
-        // Token elements.
+    return res;
+}
 
-        CI,
-        CN,
+const std::string *GeneratorAstArena::value(const std::string &value)
+{
+    return &*mValues.insert(value).first;
+}
 
-        // Qualifier elements.
+/**
+ * @brief The GeneratorAstAllocator class.
+ *
+ * An allocator that allocates the nodes of ASTs, and their control block, from
+ * an arena, which it keeps alive.
+ */
+template<typename T>
+class GeneratorAstAllocator
+{
+public:
+    using value_type = T;
+
+    explicit GeneratorAstAllocator(const GeneratorAstArenaPtr &arena)
+        : mArena(arena)
+    {
+    }
 
-        DEGREE,
-        LOGBASE,
-        BVAR,
+    template<typename U>
+    GeneratorAstAllocator(const GeneratorAstAllocator<U> &allocator)
+        : mArena(allocator.arena())
+    {
+    }
 
-        // Constants.
+    const GeneratorAstArenaPtr &arena() const
+    {
+        return mArena;
+    }
 
-        TRUE,
-        FALSE,
-        E,
-        PI,
-        INF,
-        NAN
-    };
+    T *allocate(size_t count)
+    {
+        return static_cast<T *>(mArena->allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T * /* pointer */, size_t /* count */)
+    {
+        // Our arena gets freed in bulk.
+    }
+
+private:
+    GeneratorAstArenaPtr mArena;
+};
+
+template<typename T, typename U>
+bool operator==(const GeneratorAstAllocator<T> &allocator1, const GeneratorAstAllocator<U> &allocator2)
+{
+    return allocator1.arena() == allocator2.arena();
+}
+
+template<typename T, typename U>
+bool operator!=(const GeneratorAstAllocator<T> &allocator1, const GeneratorAstAllocator<U> &allocator2)
+{
+    return allocator1.arena() != allocator2.arena();
+}
+
+/**
+ * The arena from which the current thread allocates the nodes of ASTs, if any.
+ */
+static thread_local GeneratorAstArenaPtr currentAstArena = nullptr;
+
+/**
+ * @brief The GeneratorAstArenaScope class.
+ *
+ * Makes the given arena the one from which the current thread allocates the
+ * nodes of ASTs, for as long as it is in scope.
+ */
+class GeneratorAstArenaScope
+{
+public:
+    explicit GeneratorAstArenaScope(const GeneratorAstArenaPtr &arena)
+        : mPreviousArena(currentAstArena)
+    {
+        currentAstArena = arena;
+    }
+
+    ~GeneratorAstArenaScope()
+    {
+        currentAstArena = mPreviousArena;
+    }
+
+    GeneratorAstArenaScope(const GeneratorAstArenaScope &) = delete;
+    GeneratorAstArenaScope &operator=(const GeneratorAstArenaScope &) = delete;
+
+private:
+    GeneratorAstArenaPtr mPreviousArena;
+};
+
+struct GeneratorEquationAst
+{
+    using Type = GeneratorAst::Type;
 
     Type mType = Type::ASSIGNMENT;
 
-    std::string mValue;
+    const std::string *mValue; // Interned in the arena of the node.
     VariablePtr mVariable = nullptr;
 
-    GeneratorEquationAstWeakPtr mParent;
+    // Note: a node is owned by its parent, so it does not own its parent. The
+    //       children shared by a shallow copy of an AST keep their original
+    //       parent (see createAst()).
+
+    GeneratorEquationAst *mParent;
 
     GeneratorEquationAstPtr mLeft = nullptr;
     GeneratorEquationAstPtr mRight = nullptr;
 
-    explicit GeneratorEquationAst();
-    explicit GeneratorEquationAst(Type type,
-                                  const GeneratorEquationAstPtr &parent);
-    explicit GeneratorEquationAst(Type type, const std::string &value,
-                                  const GeneratorEquationAstPtr &parent);
-    explicit GeneratorEquationAst(Type type, const VariablePtr &variable,
-                                  const GeneratorEquationAstPtr &parent);
-    explicit GeneratorEquationAst(const GeneratorEquationAstPtr &ast,
-                                  const GeneratorEquationAstPtr &parent);
+    explicit GeneratorEquationAst(Type type, const std::string *value,
+                                  GeneratorEquationAst *parent);
 };
 
-GeneratorEquationAst::GeneratorEquationAst() = default;
+static const std::string NO_AST_VALUE;
 
-GeneratorEquationAst::GeneratorEquationAst(Type type,
-                                           const GeneratorEquationAstPtr &parent)
+GeneratorEquationAst::GeneratorEquationAst(Type type, const std::string *value,
+                                           GeneratorEquationAst *parent)
     : mType(type)
+    , mValue(value)
     , mParent(parent)
 {
 }
 
-GeneratorEquationAst::GeneratorEquationAst(Type type, const std::string &value,
-                                           const GeneratorEquationAstPtr &parent)
-    : mType(type)
-    , mValue(value)
-    , mParent(parent)
+static GeneratorEquationAstPtr allocateAst(GeneratorEquationAst::Type type, const std::string *value,
+                                           const GeneratorEquationAstPtr &parent, const GeneratorAstArenaPtr &arena)
 {
+    return std::allocate_shared<GeneratorEquationAst>(GeneratorAstAllocator<GeneratorEquationAst>(arena),
+                                                      type, value, parent.get());
 }
 
-GeneratorEquationAst::GeneratorEquationAst(Type type, const VariablePtr &variable,
-                                           const GeneratorEquationAstPtr &parent)
-    : mType(type)
-    , mVariable(variable)
-    , mParent(parent)
+static GeneratorAstArenaPtr astArena()
+{
+    // Use the current arena of our thread, if any, or the fallback arena of our
+    // thread otherwise.
+    // Note: the Generator always creates nodes within the scope of an arena,
+    //       so the fallback arena is only there to keep us safe should a node
+    //       ever be created outside of such a scope. A fallback arena lives as
+    //       long as its thread, but this beats creating a new arena (i.e. a
+    //       block of memory and a set of values) for every such node.
+
+    static thread_local GeneratorAstArenaPtr fallbackAstArena = std::make_shared<GeneratorAstArena>();
+
+    return (currentAstArena != nullptr) ? currentAstArena : fallbackAstArena;
+}
+
+static GeneratorEquationAstPtr createAst()
 {
+    return allocateAst(GeneratorEquationAst::Type::ASSIGNMENT, &NO_AST_VALUE, nullptr, astArena());
 }
 
-GeneratorEquationAst::GeneratorEquationAst(const GeneratorEquationAstPtr &ast,
-                                           const GeneratorEquationAstPtr &parent)
-    : mType(ast->mType)
-    , mVariable(ast->mVariable)
-    , mParent(parent)
-    , mLeft(ast->mLeft)
-    , mRight(ast->mRight)
+static GeneratorEquationAstPtr createAst(GeneratorEquationAst::Type type,
+                                         const GeneratorEquationAstPtr &parent)
+{
+    return allocateAst(type, &NO_AST_VALUE, parent, astArena());
+}
+
+static GeneratorEquationAstPtr createAst(GeneratorEquationAst::Type type, const std::string &value,
+                                         const GeneratorEquationAstPtr &parent)
+{
+    auto arena = astArena();
+
+    return allocateAst(type, arena->value(value), parent, arena);
+}
+
+static GeneratorEquationAstPtr createAst(GeneratorEquationAst::Type type, const VariablePtr &variable,
+                                         const GeneratorEquationAstPtr &parent)
+{
+    auto res = allocateAst(type, &NO_AST_VALUE, parent, astArena());
+
+    res->mVariable = variable;
+
+    return res;
+}
+
+static GeneratorEquationAstPtr createAst(const GeneratorEquationAstPtr &ast,
+                                         const GeneratorEquationAstPtr &parent)
+{
+    // Create a shallow copy of the given AST, i.e. one that shares its
+    // children.
+    // Note: the children still have the given AST as their parent, so the copy
+    //       must not outlive the given AST. It is therefore only meant to be
+    //       used temporarily, e.g. to generate some code.
+
+    auto res = createAst(ast->mType, ast->mVariable, parent);
+
+    res->mLeft = ast->mLeft;
+    res->mRight = ast->mRight;
+
+    return res;
+}
+
+using GeneratorApiVariables = std::map<VariablePtr, GeneratorVariablePtr>;
+using GeneratorApiVariablesPtr = std::shared_ptr<const GeneratorApiVariables>;
+
+/**
+ * @brief The GeneratorAst::GeneratorAstImpl struct.
+ *
+ * The private implementation for the GeneratorAst class. It is a view over a
+ * node of the AST of an equation, as analysed by the Generator, rather than a
+ * copy of it. The children of a node get wrapped on first access.
+ */
+struct GeneratorAst::GeneratorAstImpl
+{
+    GeneratorEquationAstPtr mAst = nullptr;
+    GeneratorApiVariablesPtr mApiVariables = nullptr;
+    std::weak_ptr<GeneratorAst> mSelf;
+    std::weak_ptr<GeneratorAst> mParent;
+    GeneratorAstPtr mLeft = nullptr;
+    GeneratorAstPtr mRight = nullptr;
+
+    static GeneratorAstPtr wrap(const GeneratorEquationAstPtr &ast,
+                                const GeneratorApiVariablesPtr &apiVariables,
+                                const GeneratorAstPtr &parent);
+
+    GeneratorAstPtr child(const GeneratorEquationAstPtr &ast, GeneratorAstPtr &child) const;
+};
+
+GeneratorAstPtr GeneratorAst::GeneratorAstImpl::wrap(const GeneratorEquationAstPtr &ast,
+                                                     const GeneratorApiVariablesPtr &apiVariables,
+                                                     const GeneratorAstPtr &parent)
+{
+    if (ast == nullptr) {
+        return nullptr;
+    }
+
+    auto res = GeneratorAst::create();
+
+    res->mPimpl->mAst = ast;
+    res->mPimpl->mApiVariables = apiVariables;
+    res->mPimpl->mSelf = res;
+    res->mPimpl->mParent = parent;
+
+    return res;
+}
+
+GeneratorAstPtr GeneratorAst::GeneratorAstImpl::child(const GeneratorEquationAstPtr &ast,
+                                                      GeneratorAstPtr &child) const
+{
+    if (child == nullptr) {
+        child = wrap(ast, mApiVariables, mSelf.lock());
+    }
+
+    return child;
+}
+
+GeneratorAst::GeneratorAst()
+    : mPimpl(new GeneratorAstImpl())
+{
+}
+
+GeneratorAst::~GeneratorAst()
+{
+    delete mPimpl;
+}
+
+GeneratorAstPtr GeneratorAst::create() noexcept
+{
+    return std::shared_ptr<GeneratorAst> {new GeneratorAst {}};
+}
+
+GeneratorAst::Type GeneratorAst::type() const
+{
+    return (mPimpl->mAst != nullptr) ? mPimpl->mAst->mType : GeneratorAst::Type::ASSIGNMENT;
+}
+
+std::string GeneratorAst::value() const
+{
+    return (mPimpl->mAst != nullptr) ? *mPimpl->mAst->mValue : "";
+}
+
+GeneratorVariablePtr GeneratorAst::variable() const
+{
+    if ((mPimpl->mAst == nullptr) || (mPimpl->mAst->mType != GeneratorAst::Type::CI)) {
+        return nullptr;
+    }
+
+    auto res = mPimpl->mApiVariables->find(mPimpl->mAst->mVariable);
+
+    return (res != mPimpl->mApiVariables->end()) ? res->second : nullptr;
+}
+
+GeneratorAstPtr GeneratorAst::parent() const
+{
+    return mPimpl->mParent.lock();
+}
+
+GeneratorAstPtr GeneratorAst::leftChild() const
+{
+    return (mPimpl->mAst != nullptr) ? mPimpl->child(mPimpl->mAst->mLeft, mPimpl->mLeft) : nullptr;
+}
+
+GeneratorAstPtr GeneratorAst::rightChild() const
 {
+    return (mPimpl->mAst != nullptr) ? mPimpl->child(mPimpl->mAst->mRight, mPimpl->mRight) : nullptr;
 }
 
+/**
+ * @brief The GeneratorVariableReference struct.
+ *
+ * A reference to a variable, as found in the MathML of an equation. It gets
+ * resolved to a generator variable once the MathML of all the components of a
+ * model has been processed.
+ */
+struct GeneratorVariableReference
+{
+    std::string mName;
+    VariablePtr mVariable; // nullptr if the variable is not defined.
+    bool mIsOdeVariable;
+};
+
 #ifdef SWIG
-struct GeneratorEquation
+struct GeneratorInternalEquation
 #else
-struct GeneratorEquation: public std::enable_shared_from_this<GeneratorEquation>
+struct GeneratorInternalEquation: public std::enable_shared_from_this<GeneratorInternalEquation>
 #endif
 {
     enum struct Type
@@ -340,15 +669,17 @@ struct GeneratorEquation: public std::enable_shared_from_this<GeneratorEquation>
         ALGEBRAIC
     };
 
+    size_t mIndex = MAX_SIZE_T;
     size_t mOrder = MAX_SIZE_T;
     Type mType = Type::UNKNOWN;
 
-    std::list<GeneratorEquationPtr> mDependencies;
+    std::list<GeneratorInternalEquationPtr> mDependencies;
 
     GeneratorEquationAstPtr mAst;
 
     std::list<GeneratorInternalVariablePtr> mVariables;
     std::list<GeneratorInternalVariablePtr> mOdeVariables;
+    std::vector<GeneratorVariableReference> mVariableReferences;
 
     GeneratorInternalVariablePtr mVariable = nullptr;
     ComponentPtr mComponent = nullptr;
@@ -358,7 +689,7 @@ struct GeneratorEquation: public std::enable_shared_from_this<GeneratorEquation>
 
     bool mIsStateRateBased = false;
 
-    explicit GeneratorEquation(const ComponentPtr &component);
+    explicit GeneratorInternalEquation(const ComponentPtr &component);
 
     void addVariable(const GeneratorInternalVariablePtr &variable);
     void addOdeVariable(const GeneratorInternalVariablePtr &odeVariable);
@@ -372,27 +703,27 @@ struct GeneratorEquation: public std::enable_shared_from_this<GeneratorEquation>
     bool check(size_t & equationOrder, size_t & stateIndex, size_t & variableIndex);
 };
 
-GeneratorEquation::GeneratorEquation(const ComponentPtr &component)
-    : mAst(std::make_shared<GeneratorEquationAst>())
+GeneratorInternalEquation::GeneratorInternalEquation(const ComponentPtr &component)
+    : mAst(createAst())
     , mComponent(component)
 {
 }
 
-void GeneratorEquation::addVariable(const GeneratorInternalVariablePtr &variable)
+void GeneratorInternalEquation::addVariable(const GeneratorInternalVariablePtr &variable)
 {
     if (std::find(mVariables.begin(), mVariables.end(), variable) == mVariables.end()) {
         mVariables.push_back(variable);
     }
 }
 
-void GeneratorEquation::addOdeVariable(const GeneratorInternalVariablePtr &odeVariable)
+void GeneratorInternalEquation::addOdeVariable(const GeneratorInternalVariablePtr &odeVariable)
 {
     if (std::find(mOdeVariables.begin(), mOdeVariables.end(), odeVariable) == mOdeVariables.end()) {
         mOdeVariables.push_back(odeVariable);
     }
 }
 
-bool GeneratorEquation::containsNonUnknownVariables(const std::list<GeneratorInternalVariablePtr> &variables)
+bool GeneratorInternalEquation::containsNonUnknownVariables(const std::list<GeneratorInternalVariablePtr> &variables)
 {
     return std::find_if(variables.begin(), variables.end(), [](const GeneratorInternalVariablePtr &variable) {
                return (variable->mType != GeneratorInternalVariable::Type::UNKNOWN);
@@ -400,7 +731,7 @@ bool GeneratorEquation::containsNonUnknownVariables(const std::list<GeneratorInt
            != std::end(variables);
 }
 
-bool GeneratorEquation::containsNonConstantVariables(const std::list<GeneratorInternalVariablePtr> &variables)
+bool GeneratorInternalEquation::containsNonConstantVariables(const std::list<GeneratorInternalVariablePtr> &variables)
 {
     return std::find_if(variables.begin(), variables.end(), [](const GeneratorInternalVariablePtr &variable) {
                return (variable->mType != GeneratorInternalVariable::Type::UNKNOWN)
@@ -411,7 +742,7 @@ bool GeneratorEquation::containsNonConstantVariables(const std::list<GeneratorIn
            != std::end(variables);
 }
 
-bool GeneratorEquation::knownVariable(const GeneratorInternalVariablePtr &variable)
+bool GeneratorInternalEquation::knownVariable(const GeneratorInternalVariablePtr &variable)
 {
     return (variable->mIndex != MAX_SIZE_T)
            || (variable->mType == GeneratorInternalVariable::Type::VARIABLE_OF_INTEGRATION)
@@ -421,14 +752,14 @@ bool GeneratorEquation::knownVariable(const GeneratorInternalVariablePtr &variab
            || (variable->mType == GeneratorInternalVariable::Type::COMPUTED_VARIABLE_BASED_CONSTANT);
 }
 
-bool GeneratorEquation::knownOdeVariable(const GeneratorInternalVariablePtr &odeVariable)
+bool GeneratorInternalEquation::knownOdeVariable(const GeneratorInternalVariablePtr &odeVariable)
 {
     return (odeVariable->mIndex != MAX_SIZE_T)
            || (odeVariable->mType == GeneratorInternalVariable::Type::VARIABLE_OF_INTEGRATION);
 }
 
-bool GeneratorEquation::check(size_t &equationOrder, size_t &stateIndex,
-                              size_t &variableIndex)
+bool GeneratorInternalEquation::check(size_t &equationOrder, size_t &stateIndex,
+                                      size_t &variableIndex)
 {
     // Nothing to check if the equation has already been given an order (i.e.
     // everything is fine) or if there is one known (ODE) variable left (i.e.
@@ -471,7 +802,7 @@ bool GeneratorEquation::check(size_t &equationOrder, size_t &stateIndex,
 
     for (const auto &variable : mVariables) {
         if (knownVariable(variable)) {
-            GeneratorEquationPtr equation = variable->mEquation.lock();
+            GeneratorInternalEquationPtr equation = variable->mEquation.lock();
 
             if (!mIsStateRateBased) {
                 mIsStateRateBased = (equation == nullptr) ?
@@ -539,41 +870,492 @@ bool GeneratorEquation::check(size_t &equationOrder, size_t &stateIndex,
     return relevantCheck;
 }
 
+struct GeneratorReset
+{
+    int mOrder = 0;
+
+    VariablePtr mVariable;
+    VariablePtr mTestVariable;
+
+    GeneratorEquationAstPtr mTestValue;
+    GeneratorEquationAstPtr mResetValue;
+};
+
+using GeneratorResetPtr = std::shared_ptr<GeneratorReset>;
+
 /**
- * @brief The Generator::GeneratorImpl struct.
+ * @brief The GeneratorAnalysis struct.
  *
- * The private implementation for the Generator class.
+ * The analysis of a model, i.e. its classified variables, scheduled equations
+ * and resets, as well as what our code generation needs to know about the
+ * model. It also keeps track of the components and variables of the analysed
+ * model, in a canonical order, so that it can be re-attached to any model with
+ * the same structure.
  */
-struct Generator::GeneratorImpl
+struct GeneratorAnalysis
 {
-    Generator *mGenerator = nullptr;
+    std::string mHash;
+
+    // Note: a cached analysis uses placeholders for the components and
+    //       variables of its model, so that it doesn't keep that model alive.
+    //       Those placeholders are keyed by the identity of the component or
+    //       variable that they stand for (see identityKey()), which is used to
+    //       map them to the components and variables of another instance of
+    //       that model.
+
+    std::map<std::string, ComponentPtr> mComponents;
+    std::map<std::string, VariablePtr> mVariables;
 
     Generator::ModelType mModelType = Generator::ModelType::UNKNOWN;
 
     std::list<GeneratorInternalVariablePtr> mInternalVariables;
-    std::list<GeneratorEquationPtr> mEquations;
+    std::list<GeneratorInternalEquationPtr> mEquations;
+    std::vector<GeneratorResetPtr> mResets;
 
     GeneratorVariablePtr mVoi = nullptr;
-    std::vector<GeneratorVariablePtr> mStates;
-    std::vector<GeneratorVariablePtr> mVariables;
 
-    GeneratorProfilePtr mProfile = libcellml::GeneratorProfile::create();
+    std::vector<bool> mNeeds;
+};
+
+using GeneratorAnalysisPtr = std::shared_ptr<GeneratorAnalysis>;
+
+/**
+ * @brief The GeneratorDerivative struct.
+ *
+ * The derivative of the equation of a variable with respect to a state (or a
+ * constant), as well as the functions that it needs, so that they can still be
+ * flagged as needed when reusing the derivative.
+ */
+struct GeneratorDerivative
+{
+    GeneratorEquationAstPtr mAst; // nullptr if the derivative is zero.
 
-    bool mNeedEq = false;
-    bool mNeedNeq = false;
     bool mNeedLt = false;
-    bool mNeedLeq = false;
-    bool mNeedGt = false;
-    bool mNeedGeq = false;
-    bool mNeedAnd = false;
-    bool mNeedOr = false;
-    bool mNeedXor = false;
-    bool mNeedNot = false;
+    bool mNeedPiecewise = false;
+};
 
-    bool mNeedMin = false;
-    bool mNeedMax = false;
+/**
+ * @brief The GeneratorInstanceKernel struct.
+ *
+ * A kernel that computes the equations of several instances of a component,
+ * i.e. the equations of its first instance, with the index of each state, rate
+ * and variable of that instance being offset by a stride for each subsequent
+ * instance. The kernel computes the equations of all its instances and is
+ * called before the equation at the given position in the method that it is
+ * part of.
+ */
+struct GeneratorInstanceKernel
+{
+    std::vector<GeneratorInternalEquationPtr> mEquations;
+    std::map<GeneratorInternalVariablePtr, size_t> mStrides;
 
-    bool mNeedSec = false;
+    std::vector<GeneratorInternalEquationPtr> mInstanceEquations;
+    size_t mInstanceCount = 0;
+    size_t mPosition = 0;
+};
+
+/**
+ * @brief The GeneratorEquationSet class.
+ *
+ * A set of equations (e.g. the equations that remain to be generated), which
+ * also keeps track of the equations that have been visited while generating
+ * code. Both are bitsets indexed by the index of an equation, so that checking,
+ * adding and removing an equation are done in constant time.
+ */
+class GeneratorEquationSet
+{
+public:
+    explicit GeneratorEquationSet(size_t equationCount)
+        : mEquations(equationCount, false)
+        , mVisitedEquations(equationCount, false)
+    {
+    }
+
+    void insert(const GeneratorInternalEquationPtr &equation)
+    {
+        if (equation->mIndex < mEquations.size()) {
+            mEquations[equation->mIndex] = true;
+        }
+    }
+
+    bool contains(const GeneratorInternalEquationPtr &equation) const
+    {
+        return (equation->mIndex < mEquations.size()) && mEquations[equation->mIndex];
+    }
+
+    bool erase(const GeneratorInternalEquationPtr &equation)
+    {
+        if (!contains(equation)) {
+            return false;
+        }
+
+        mEquations[equation->mIndex] = false;
+
+        return true;
+    }
+
+    bool visit(const GeneratorInternalEquationPtr &equation)
+    {
+        // Mark the given equation as visited and return whether it was not
+        // already visited. An equation that is not one of our equations is
+        // never considered as visited.
+
+        if (equation->mIndex >= mVisitedEquations.size()) {
+            return true;
+        }
+
+        if (mVisitedEquations[equation->mIndex]) {
+            return false;
+        }
+
+        mVisitedEquations[equation->mIndex] = true;
+
+        return true;
+    }
+
+private:
+    std::vector<bool> mEquations;
+    std::vector<bool> mVisitedEquations;
+};
+
+/**
+ * @brief The GeneratorCodeWriter class.
+ *
+ * A writer of generated code, which appends the code to a reserved buffer. If
+ * the writer targets a stream, then the buffer is written to that stream (and
+ * emptied) whenever it reaches its reserved capacity, as well as when the
+ * writer is flushed.
+ */
+class GeneratorCodeWriter
+{
+public:
+    explicit GeneratorCodeWriter(size_t capacity, std::ostream *stream = nullptr)
+        : mStream(stream)
+        , mCapacity(capacity)
+    {
+        mBuffer.reserve(capacity);
+    }
+
+    GeneratorCodeWriter &operator+=(const std::string &code)
+    {
+        mBuffer += code;
+        mEmpty = mEmpty && code.empty();
+
+        if (mBuffer.size() >= mCapacity) {
+            flush();
+        }
+
+        return *this;
+    }
+
+    bool empty() const
+    {
+        return mEmpty;
+    }
+
+    void flush()
+    {
+        if (mStream != nullptr) {
+            *mStream << mBuffer;
+
+            mBuffer.clear();
+        }
+    }
+
+    std::string code()
+    {
+        return std::move(mBuffer);
+    }
+
+private:
+    std::ostream *mStream;
+    size_t mCapacity;
+    std::string mBuffer;
+    bool mEmpty = true;
+};
+
+/**
+ * @brief The GeneratorMethodCodeWriter class.
+ *
+ * A writer of the code of a method, which writes the part of its method string
+ * that comes before its <CODE> placeholder to a code writer as soon as it is
+ * created, and its body to that code writer as it gets generated. The rest of
+ * its method string, preceded by the given empty method body if no body was
+ * written, gets written when the writer is closed. This is equivalent to
+ * expanding the method string with its whole body, but without ever keeping
+ * that body in memory. Like for a GeneratorTemplate, only the first occurrence
+ * of <CODE> gets replaced.
+ */
+class GeneratorMethodCodeWriter
+{
+public:
+    explicit GeneratorMethodCodeWriter(GeneratorCodeWriter &code,
+                                       const std::string &methodString,
+                                       const std::string &emptyMethodBody)
+        : mCode(code)
+        , mMethodString(methodString)
+        , mEmptyMethodBody(emptyMethodBody)
+        , mCodePosition(methodString.find(CODE_PLACEHOLDER))
+    {
+        mCode += mMethodString.substr(0, mCodePosition);
+    }
+
+    GeneratorMethodCodeWriter &operator+=(const std::string &code)
+    {
+        if (mCodePosition != std::string::npos) {
+            mCode += code;
+        }
+
+        mEmptyBody = mEmptyBody && code.empty();
+
+        return *this;
+    }
+
+    void close()
+    {
+        if (mCodePosition != std::string::npos) {
+            if (mEmptyBody) {
+                mCode += mEmptyMethodBody;
+            }
+
+            mCode += mMethodString.substr(mCodePosition + std::strlen(CODE_PLACEHOLDER));
+        }
+    }
+
+private:
+    static constexpr const char *CODE_PLACEHOLDER = "<CODE>";
+
+    GeneratorCodeWriter &mCode;
+    std::string mMethodString;
+    std::string mEmptyMethodBody;
+    size_t mCodePosition;
+    bool mEmptyBody = true;
+};
+
+/**
+ * @brief The GeneratorTemplate class.
+ *
+ * A profile string compiled into a sequence of literal and placeholder
+ * segments, i.e. literal 0, placeholder 0, literal 1, ..., literal N, so that
+ * it can be expanded in one pass. Only the first occurrence of a placeholder
+ * gets replaced.
+ */
+class GeneratorTemplate
+{
+public:
+    explicit GeneratorTemplate(const std::string &string,
+                               std::initializer_list<const char *> placeholders)
+    {
+        // Look for the first occurrence of each placeholder and sort them by
+        // position.
+
+        std::vector<std::pair<size_t, size_t>> positions;
+        size_t index = 0;
+
+        for (const auto &placeholder : placeholders) {
+            auto position = string.find(placeholder);
+
+            if (position != std::string::npos) {
+                positions.emplace_back(position, index);
+            }
+
+            ++index;
+        }
+
+        std::sort(positions.begin(), positions.end());
+
+        // Split the string into its literal segments, ignoring a placeholder
+        // that would overlap the previous one.
+
+        size_t start = 0;
+
+        for (const auto &position : positions) {
+            if (position.first < start) {
+                continue;
+            }
+
+            mLiterals.push_back(string.substr(start, position.first - start));
+            mPlaceholders.push_back(position.second);
+
+            start = position.first + std::strlen(*(placeholders.begin() + position.second));
+        }
+
+        mLiterals.push_back(string.substr(start));
+
+        for (const auto &literal : mLiterals) {
+            mLiteralsSize += literal.size();
+        }
+    }
+
+    template<typename... Values>
+    std::string expanded(const Values &...values) const
+    {
+        const std::string *placeholderValues[] = {&values...};
+        std::string res;
+        size_t size = mLiteralsSize;
+
+        for (auto placeholder : mPlaceholders) {
+            size += placeholderValues[placeholder]->size();
+        }
+
+        res.reserve(size);
+
+        expand(res, placeholderValues);
+
+        return res;
+    }
+
+    template<typename Code, typename... Values>
+    void expandInto(Code &code, const Values &...values) const
+    {
+        const std::string *placeholderValues[] = {&values...};
+
+        expand(code, placeholderValues);
+    }
+
+private:
+    std::vector<std::string> mLiterals;
+    std::vector<size_t> mPlaceholders;
+    size_t mLiteralsSize = 0;
+
+    template<typename Code>
+    void expand(Code &code, const std::string *const *placeholderValues) const
+    {
+        for (size_t i = 0; i < mPlaceholders.size(); ++i) {
+            code += mLiterals[i];
+            code += *placeholderValues[mPlaceholders[i]];
+        }
+
+        code += mLiterals.back();
+    }
+};
+
+/**
+ * @brief The Generator::GeneratorImpl struct.
+ *
+ * The private implementation for the Generator class.
+ */
+struct Generator::GeneratorImpl
+{
+    Generator *mGenerator = nullptr;
+
+    Generator::ModelType mModelType = Generator::ModelType::UNKNOWN;
+
+    std::list<GeneratorInternalVariablePtr> mInternalVariables;
+    std::map<VariablePtr, GeneratorInternalVariablePtr> mInternalVariableCache;
+    std::list<GeneratorInternalEquationPtr> mEquations;
+
+    GeneratorVariablePtr mVoi = nullptr;
+    std::vector<GeneratorVariablePtr> mStates;
+    std::vector<GeneratorVariablePtr> mVariables;
+    std::vector<GeneratorEquationPtr> mGeneratorEquations;
+
+    GeneratorProfilePtr mProfile = libcellml::GeneratorProfile::create();
+
+    enum class ProfileTemplate
+    {
+        COMMENT,
+        VARIABLE_INFO_ENTRY,
+        VARIABLE_INFO_WITH_TYPE_ENTRY,
+        PARALLEL_TASK,
+        PARALLEL_LEVEL,
+        BATCH_SWEEP_PARAMETER_INDEX,
+        INSTANCE_ARRAY_INDEX,
+        BATCH_ARRAY_INDEX,
+        PIECEWISE_IF,
+        PIECEWISE_ELSE,
+        BRANCHLESS_PIECEWISE_IF,
+        BRANCHLESS_PIECEWISE_ELSE,
+        LOOKUP_TABLE_VALUE,
+        LOOKUP_TABLE_ENTRY
+    };
+
+    std::weak_ptr<GeneratorProfile> mCachedProfile;
+    size_t mCachedProfileRevision = 0;
+    bool mModifiedProfile = false;
+    std::vector<GeneratorTemplate> mProfileTemplates;
+
+    std::vector<VariablePtr> mRequiredOutputs;
+    std::unordered_set<VariablePtr> mRequiredOutputSet;
+
+    std::map<std::pair<GeneratorInternalVariablePtr, GeneratorInternalVariablePtr>, GeneratorDerivative> mDerivatives;
+
+    std::vector<GeneratorEquationAstPtr> mJacobianEntries;
+    std::vector<size_t> mJacobianRowPointers;
+    std::vector<size_t> mJacobianColumnIndices;
+
+    std::vector<VariablePtr> mSensitivityParameters;
+    std::vector<GeneratorInternalVariablePtr> mSensitivityParameterVariables;
+    std::vector<VariablePtr> mSensitivities;
+    std::vector<GeneratorEquationAstPtr> mSensitivityRates;
+
+    std::vector<VariablePtr> mSweepParameters;
+    std::vector<GeneratorInternalVariablePtr> mSweepParameterVariables;
+
+    bool mGeneratingBatchCode = false;
+
+    std::vector<GeneratorResetPtr> mResets;
+    std::vector<VariablePtr> mEvents;
+    std::vector<VariablePtr> mResetValues;
+
+    VariablePtr mTimeStep = Variable::create();
+    VariablePtr mRushLarsenExponent = Variable::create();
+    std::vector<GeneratorEquationAstPtr> mRushLarsenSteps;
+
+    enum struct LookupTableDependency
+    {
+        CONSTANT,
+        ARGUMENT,
+        OTHER
+    };
+
+    bool mHasLookupTable = false;
+    VariablePtr mLookupTableVariable = nullptr;
+    double mLookupTableMinimum = 0.0;
+    double mLookupTableMaximum = 0.0;
+    double mLookupTableStep = 0.0;
+
+    GeneratorInternalVariablePtr mLookupTableState = nullptr;
+    size_t mLookupTableIntervalCount = 0;
+    std::vector<GeneratorEquationAstPtr> mLookupTableColumns;
+    std::vector<std::string> mLookupTableColumnCodes;
+    GeneratorInternalVariablePtr mLookupTableCandidatesState = nullptr;
+    std::unordered_map<const GeneratorEquationAst *, bool> mLookupTableCandidates;
+    bool mGeneratingExactCode = false;
+    bool mGeneratingLookupTableCode = false;
+
+    bool mHasSpecializedMethods = false;
+    std::map<GeneratorInternalVariablePtr, double> mSpecializedValues;
+    bool mGeneratingSpecializedCode = false;
+
+    size_t mMaximumStatementCount = 0;
+    size_t mParallelChunkSize = 0;
+    size_t mMinimumInstanceCount = 0;
+    size_t mMaximumThreadCount = 0;
+
+    std::map<GeneratorInternalVariablePtr, size_t> mInstanceStrides;
+
+    Generator::VariableOrdering mVariableOrdering = Generator::VariableOrdering::DEFAULT;
+
+    size_t mAnalysisCacheSize = 0;
+    std::list<GeneratorAnalysisPtr> mAnalysisCache;
+
+    bool mNeedEq = false;
+    bool mNeedNeq = false;
+    bool mNeedLt = false;
+    bool mNeedLeq = false;
+    bool mNeedGt = false;
+    bool mNeedGeq = false;
+    bool mNeedAnd = false;
+    bool mNeedOr = false;
+    bool mNeedXor = false;
+    bool mNeedNot = false;
+
+    bool mNeedMin = false;
+    bool mNeedMax = false;
+    bool mNeedPiecewise = false;
+
+    bool mNeedSec = false;
     bool mNeedCsc = false;
     bool mNeedCot = false;
     bool mNeedSech = false;
@@ -592,14 +1374,17 @@ struct Generator::GeneratorImpl
     XmlNodePtr mathmlChildNode(const XmlNodePtr &node, size_t index) const;
 
     GeneratorInternalVariablePtr generatorVariable(const VariablePtr &variable);
+    GeneratorInternalVariablePtr existingGeneratorVariable(const VariablePtr &variable);
 
     static bool compareVariablesByName(const GeneratorInternalVariablePtr &variable1,
                                        const GeneratorInternalVariablePtr &variable2);
     static bool compareVariablesByTypeAndIndex(const GeneratorInternalVariablePtr &variable1,
                                                const GeneratorInternalVariablePtr &variable2);
 
-    static bool compareEquationsByVariable(const GeneratorEquationPtr &equation1,
-                                           const GeneratorEquationPtr &equation2);
+    static bool compareResetsByOrder(const GeneratorResetPtr &reset1,
+                                     const GeneratorResetPtr &reset2);
+    static bool compareEquationsByVariable(const GeneratorInternalEquationPtr &equation1,
+                                           const GeneratorInternalEquationPtr &equation2);
 
     bool sameOrEquivalentVariable(const VariablePtr &variable1,
                                   const VariablePtr &variable2);
@@ -610,13 +1395,59 @@ struct Generator::GeneratorImpl
     void processNode(const XmlNodePtr &node, GeneratorEquationAstPtr &ast,
                      const GeneratorEquationAstPtr &astParent,
                      const ComponentPtr &component,
-                     const GeneratorEquationPtr &equation);
-    GeneratorEquationPtr processNode(const XmlNodePtr &node,
-                                     const ComponentPtr &component);
-    void processComponent(const ComponentPtr &component);
+                     const GeneratorInternalEquationPtr &equation);
+    GeneratorInternalEquationPtr processNode(const XmlNodePtr &node,
+                                             const ComponentPtr &component);
+    void updateNeeds(const GeneratorEquationAstPtr &ast);
+    void resolveEquation(const GeneratorInternalEquationPtr &equation);
+    GeneratorEquationAstPtr processResetMath(const std::string &math,
+                                             const ComponentPtr &component);
+    void processReset(const ResetPtr &reset, const ComponentPtr &component);
+    std::vector<GeneratorInternalEquationPtr> componentEquations(const ComponentPtr &component);
+    void processComponent(const ComponentPtr &component,
+                          const std::vector<GeneratorInternalEquationPtr> &equations);
+    void processComponents(const ModelPtr &model);
     void processEquationAst(const GeneratorEquationAstPtr &ast);
+    void analyseModel(const ModelPtr &model);
+
+    std::vector<bool *> needs();
+    void addComponents(const ComponentPtr &component,
+                       std::vector<ComponentPtr> &components) const;
+    std::string modelHash(const ModelPtr &model,
+                          std::vector<ComponentPtr> &components,
+                          std::vector<VariablePtr> &variables) const;
+    void remapAstVariables(const GeneratorEquationAstPtr &ast,
+                           const std::map<VariablePtr, VariablePtr> &variableMap) const;
+    void copyAnalysis(const GeneratorAnalysis &from, GeneratorAnalysis &to,
+                      const std::map<VariablePtr, VariablePtr> &variableMap,
+                      const std::map<ComponentPtr, ComponentPtr> &componentMap) const;
+    static std::string identityKey(const ComponentPtr &component);
+    static std::string identityKey(const VariablePtr &variable);
+    bool restoreCachedAnalysis(const std::string &hash,
+                               const std::vector<ComponentPtr> &components,
+                               const std::vector<VariablePtr> &variables);
+    void cacheAnalysis(const std::string &hash,
+                       const std::vector<ComponentPtr> &components,
+                       const std::vector<VariablePtr> &variables);
+
     void processModel(const ModelPtr &model);
 
+    void scheduleEquation(const GeneratorInternalEquationPtr &equation,
+                          std::vector<GeneratorInternalEquationPtr> &scheduledEquations);
+    void addVariablesByFirstUse(const GeneratorEquationAstPtr &ast,
+                                std::vector<GeneratorInternalVariablePtr> &variables);
+    void orderVariables();
+
+    void addScheduledEquation(const GeneratorInternalEquationPtr &equation,
+                              GeneratorEquationSet &remainingEquations,
+                              std::vector<GeneratorInternalEquationPtr> &scheduledEquations);
+    GeneratorVariablePtr apiVariable(const VariablePtr &variable,
+                                     const std::map<VariablePtr, GeneratorVariablePtr> &apiVariables);
+    void addApiVariables(const GeneratorEquationAstPtr &ast,
+                         const std::map<VariablePtr, GeneratorVariablePtr> &apiVariables,
+                         GeneratorApiVariables &astApiVariables);
+    const std::vector<GeneratorEquationPtr> &apiEquations();
+
     bool isRelationalOperator(const GeneratorEquationAstPtr &ast) const;
     bool isAndOperator(const GeneratorEquationAstPtr &ast) const;
     bool isOrOperator(const GeneratorEquationAstPtr &ast) const;
@@ -629,54 +1460,169 @@ struct Generator::GeneratorImpl
     bool isPowerOperator(const GeneratorEquationAstPtr &ast) const;
     bool isRootOperator(const GeneratorEquationAstPtr &ast) const;
     bool isPiecewiseStatement(const GeneratorEquationAstPtr &ast) const;
-
-    std::string replace(std::string string, const std::string &from,
-                        const std::string &to);
+    bool useBranchlessPiecewise() const;
+    bool useJacobian() const;
+
+    GeneratorEquationAstPtr copyAst(const GeneratorEquationAstPtr &ast,
+                                    const GeneratorEquationAstPtr &parent) const;
+    GeneratorEquationAstPtr newAst(GeneratorEquationAst::Type type,
+                                   const GeneratorEquationAstPtr &left,
+                                   const GeneratorEquationAstPtr &right = nullptr) const;
+    GeneratorEquationAstPtr newConstantAst(double value) const;
+
+    bool isConstantAst(const GeneratorEquationAstPtr &ast, double &value) const;
+    bool isConstantValueAst(const GeneratorEquationAstPtr &ast, double value) const;
+    bool isUnaryMinusAst(const GeneratorEquationAstPtr &ast) const;
+    GeneratorEquationAstPtr qualifierValueAst(const GeneratorEquationAstPtr &ast) const;
+    bool evaluateAst(const GeneratorEquationAstPtr &ast, double &value) const;
+
+    GeneratorEquationAstPtr simplifyAst(const GeneratorEquationAstPtr &ast) const;
+    GeneratorEquationAstPtr optimizeAst(const GeneratorEquationAstPtr &ast) const;
+    GeneratorEquationAstPtr optimizedEquationAst(const GeneratorInternalEquationPtr &equation) const;
+
+    GeneratorEquationAstPtr jacobianValueAst(const GeneratorEquationAstPtr &ast);
+    GeneratorEquationAstPtr plusAst(const GeneratorEquationAstPtr &left,
+                                    const GeneratorEquationAstPtr &right) const;
+    GeneratorEquationAstPtr minusAst(const GeneratorEquationAstPtr &left,
+                                     const GeneratorEquationAstPtr &right) const;
+    GeneratorEquationAstPtr timesAst(const GeneratorEquationAstPtr &left,
+                                     const GeneratorEquationAstPtr &right) const;
+    GeneratorEquationAstPtr divideAst(const GeneratorEquationAstPtr &left,
+                                      const GeneratorEquationAstPtr &right) const;
+    GeneratorEquationAstPtr zeroIfNullAst(const GeneratorEquationAstPtr &ast) const;
+    GeneratorEquationAstPtr piecewiseAst(const GeneratorEquationAstPtr &value,
+                                         const GeneratorEquationAstPtr &condition,
+                                         const GeneratorEquationAstPtr &otherwise) const;
+    GeneratorEquationAstPtr squareAst(const GeneratorEquationAstPtr &ast);
+    GeneratorEquationAstPtr differentiatePiecewiseAst(const GeneratorEquationAstPtr &ast,
+                                                      const GeneratorInternalVariablePtr &state,
+                                                      bool &nonZero);
+    GeneratorEquationAstPtr differentiateAst(const GeneratorEquationAstPtr &ast,
+                                             const GeneratorInternalVariablePtr &state);
+    GeneratorEquationAstPtr differentiateVariableAst(const GeneratorInternalVariablePtr &variable,
+                                                     const GeneratorInternalVariablePtr &state);
+    void collectAlgebraicVariables(const GeneratorEquationAstPtr &ast,
+                                   std::vector<GeneratorInternalVariablePtr> &algebraicVariables);
+    void computeJacobian();
+
+    std::vector<GeneratorInternalVariablePtr> constantVariables(const std::vector<VariablePtr> &variables);
+    void determineParameterVariables();
+    GeneratorEquationAstPtr sensitivityAst(size_t index);
+    void computeSensitivityRates();
+
+    GeneratorEquationAstPtr stateAst(const GeneratorInternalVariablePtr &state) const;
+    GeneratorEquationAstPtr rateAst(const GeneratorInternalVariablePtr &state) const;
+    GeneratorEquationAstPtr timeStepAst() const;
+    GeneratorEquationAstPtr rushLarsenExponentAst() const;
+    bool dependsOnState(const GeneratorEquationAstPtr &ast,
+                        const GeneratorInternalVariablePtr &state,
+                        std::vector<GeneratorInternalVariablePtr> &algebraicVariables);
+    GeneratorEquationAstPtr linearCoefficientAst(const GeneratorInternalVariablePtr &state);
+    void computeRushLarsenSteps();
+
+    LookupTableDependency lookupTableDependency(const GeneratorEquationAstPtr &ast,
+                                                const GeneratorInternalVariablePtr &state,
+                                                bool &expensive);
+    bool isLookupTableCandidate(const GeneratorEquationAstPtr &ast,
+                                const GeneratorInternalVariablePtr &state);
+    void collectLookupTableCandidates(const GeneratorEquationAstPtr &ast,
+                                      const GeneratorInternalVariablePtr &state,
+                                      std::vector<GeneratorEquationAstPtr> &candidates,
+                                      std::vector<std::string> &candidateCodes);
+    std::vector<GeneratorEquationAstPtr> lookupTableEquationAsts();
+    void computeLookupTable();
+
+    void updateProfileCache();
+    const GeneratorTemplate &profileTemplate(ProfileTemplate profileTemplate);
 
     void updateVariableInfoSizes(size_t &componentSize, size_t &nameSize,
                                  size_t &unitsSize,
                                  const GeneratorVariablePtr &variable);
 
-    bool modifiedProfile() const;
+    bool computeModifiedProfile() const;
+    bool modifiedProfile();
 
-    void addOriginCommentCode(std::string &code);
+    void addOriginCommentCode(GeneratorCodeWriter &code);
 
-    void addInterfaceHeaderCode(std::string &code);
-    void addImplementationHeaderCode(std::string &code);
+    void addInterfaceHeaderCode(GeneratorCodeWriter &code);
+    void addImplementationHeaderCode(GeneratorCodeWriter &code);
 
-    void addVersionAndLibcellmlVersionCode(std::string &code,
+    void addVersionAndLibcellmlVersionCode(GeneratorCodeWriter &code,
                                            bool interface = false);
 
-    void addStateAndVariableCountCode(std::string &code,
+    void addStateAndVariableCountCode(GeneratorCodeWriter &code,
                                       bool interface = false);
 
-    void addVariableTypeObjectCode(std::string &code);
+    void addVariableTypeObjectCode(GeneratorCodeWriter &code);
 
     std::string generateVariableInfoObjectCode(const std::string &objectString);
 
-    void addVariableInfoObjectCode(std::string &code);
-    void addVariableInfoWithTypeObjectCode(std::string &code);
+    void addVariableInfoObjectCode(GeneratorCodeWriter &code);
+    void addVariableInfoWithTypeObjectCode(GeneratorCodeWriter &code);
 
     std::string generateVariableInfoEntryCode(const std::string &name,
                                               const std::string &units,
                                               const std::string &component);
 
-    void addInterfaceVoiStateAndVariableInfoCode(std::string &code);
-    void addImplementationVoiInfoCode(std::string &code);
-    void addImplementationStateInfoCode(std::string &code);
-    void addImplementationVariableInfoCode(std::string &code);
+    void addInterfaceVoiStateAndVariableInfoCode(GeneratorCodeWriter &code);
+    void addImplementationVoiInfoCode(GeneratorCodeWriter &code);
+    void addImplementationStateInfoCode(GeneratorCodeWriter &code);
+    void addImplementationVariableInfoCode(GeneratorCodeWriter &code);
+
+    void addInterfaceJacobianSparsityCode(GeneratorCodeWriter &code);
+    void addImplementationJacobianSparsityCode(GeneratorCodeWriter &code);
 
-    void addArithmeticFunctionsCode(std::string &code);
-    void addTrigonometricFunctionsCode(std::string &code);
+    void addInterfaceSensitivityParameterCountCode(GeneratorCodeWriter &code);
+    void addImplementationSensitivityParameterCountCode(GeneratorCodeWriter &code);
+    void addInterfaceSweepParameterCountCode(GeneratorCodeWriter &code);
+    void addImplementationSweepParameterCountCode(GeneratorCodeWriter &code);
 
-    void addInterfaceCreateDeleteArrayMethodsCode(std::string &code);
-    void addImplementationCreateStatesArrayMethodCode(std::string &code);
-    void addImplementationCreateVariablesArrayMethodCode(std::string &code);
-    void addImplementationDeleteArrayMethodCode(std::string &code);
+    void addInterfaceResetCountCode(GeneratorCodeWriter &code);
+    void addImplementationResetCountCode(GeneratorCodeWriter &code);
+
+    void addArithmeticFunctionsCode(GeneratorCodeWriter &code);
+    void addTrigonometricFunctionsCode(GeneratorCodeWriter &code);
+
+    void addInterfaceCreateDeleteArrayMethodsCode(GeneratorCodeWriter &code);
+    void addImplementationCreateStatesArrayMethodCode(GeneratorCodeWriter &code);
+    void addImplementationCreateVariablesArrayMethodCode(GeneratorCodeWriter &code);
+    void addImplementationDeleteArrayMethodCode(GeneratorCodeWriter &code);
 
     std::string generateMethodBodyCode(const std::string &methodBody);
+    std::string generateEmptyMethodBodyCode();
+    bool isSplitMethod(const std::string &methodChunkString,
+                       const std::string &methodChunkCallString) const;
+    void addSplitMethodCode(GeneratorCodeWriter &code,
+                            const std::string &methodString,
+                            const std::string &methodChunkString,
+                            const std::string &methodChunkCallString,
+                            const std::string &methodBody);
+    void addEquationsMethodCode(GeneratorCodeWriter &code,
+                                const std::string &methodString,
+                                const std::string &methodChunkString,
+                                const std::string &methodChunkCallString,
+                                const std::vector<GeneratorInternalEquationPtr> &equations,
+                                const std::string &methodBodyEnd = "");
+    std::string generateIndentedCode(const std::string &code);
+    void addParallelMethodCode(GeneratorCodeWriter &code,
+                               const std::string &methodString,
+                               const std::string &methodChunkString,
+                               const std::string &methodChunkCallString,
+                               const std::vector<GeneratorInternalEquationPtr> &equations);
+    void addInstanceStructureCode(std::string &structure,
+                                  const GeneratorEquationAstPtr &ast,
+                                  std::vector<GeneratorInternalVariablePtr> &variables);
+    std::vector<GeneratorInstanceKernel> instanceKernels(const std::vector<GeneratorInternalEquationPtr> &equations);
+    void addInstancedMethodCode(GeneratorCodeWriter &code,
+                                const std::string &methodString,
+                                const std::string &methodChunkString,
+                                const std::string &methodChunkCallString,
+                                const std::string &methodKernelString,
+                                const std::string &methodKernelCallString,
+                                const std::vector<GeneratorInternalEquationPtr> &equations);
 
     std::string generateDoubleCode(const std::string &value);
+    std::string generateComputeCastCode(const GeneratorEquationAstPtr &ast) const;
     std::string generateVariableNameCode(const VariablePtr &variable,
                                          const GeneratorEquationAstPtr &ast = nullptr);
 
@@ -693,19 +1639,65 @@ struct Generator::GeneratorImpl
     std::string generateCode(const GeneratorEquationAstPtr &ast);
 
     std::string generateInitializationCode(const GeneratorInternalVariablePtr &variable);
-    std::string generateEquationCode(const GeneratorEquationPtr &equation,
-                                     std::vector<GeneratorEquationPtr> &remainingEquations,
-                                     bool onlyStateRateBasedEquations = false);
-
-    void addInterfaceComputeModelMethodsCode(std::string &code);
-    void addImplementationInitializeStatesAndConstantsMethodCode(std::string &code,
-                                                                 std::vector<GeneratorEquationPtr> &remainingEquations);
-    void addImplementationComputeComputedConstantsMethodCode(std::string &code,
-                                                             std::vector<GeneratorEquationPtr> &remainingEquations);
-    void addImplementationComputeRatesMethodCode(std::string &code,
-                                                 std::vector<GeneratorEquationPtr> &remainingEquations);
-    void addImplementationComputeVariablesMethodCode(std::string &code,
-                                                     std::vector<GeneratorEquationPtr> &remainingEquations);
+    bool hasSinglePrecisionCancellationRisk(const GeneratorEquationAstPtr &ast) const;
+    GeneratorEquationAstPtr statementAst(const GeneratorInternalEquationPtr &equation);
+    std::string generateStatementCode(const GeneratorInternalEquationPtr &equation);
+    void addEquations(std::vector<GeneratorInternalEquationPtr> &equations,
+                      const GeneratorInternalEquationPtr &equation,
+                      GeneratorEquationSet &remainingEquations,
+                      bool onlyStateRateBasedEquations = false);
+    void addEquationCode(std::string &code,
+                         const GeneratorInternalEquationPtr &equation,
+                         GeneratorEquationSet &remainingEquations);
+
+    void addInterfaceComputeModelMethodsCode(GeneratorCodeWriter &code);
+    void addImplementationInitializeStatesAndConstantsMethodCode(GeneratorCodeWriter &code,
+                                                                 GeneratorEquationSet &remainingEquations);
+    void addImplementationComputeComputedConstantsMethodCode(GeneratorCodeWriter &code,
+                                                             GeneratorEquationSet &remainingEquations);
+    void addImplementationComputeRatesMethodCode(GeneratorCodeWriter &code,
+                                                 GeneratorEquationSet &remainingEquations);
+    void checkRequiredOutput(const VariablePtr &variable);
+    void addRequiredEquation(const GeneratorInternalEquationPtr &equation,
+                             GeneratorEquationSet &requiredEquations);
+    GeneratorEquationSet requiredEquations();
+    std::vector<GeneratorInternalEquationPtr> computeVariablesEquations(const GeneratorEquationSet &remainingEquations);
+    void addImplementationComputeVariablesMethodCode(GeneratorCodeWriter &code,
+                                                     GeneratorEquationSet &remainingEquations);
+    void addJacobianEquationCode(std::string &code,
+                                 const GeneratorInternalEquationPtr &equation,
+                                 GeneratorEquationSet &remainingEquations);
+    std::string algebraicVariablesCode(const std::vector<GeneratorInternalVariablePtr> &algebraicVariables);
+    void addImplementationComputeJacobianMethodCode(GeneratorCodeWriter &code);
+    void addImplementationComputeRushLarsenStepMethodCode(GeneratorCodeWriter &code);
+    void addImplementationComputeSensitivityRatesMethodCode(GeneratorCodeWriter &code);
+    void addImplementationInitializeStatesAndConstantsBatchMethodCode(GeneratorCodeWriter &code);
+    void addImplementationComputeRatesBatchMethodCode(GeneratorCodeWriter &code);
+
+    GeneratorEquationAstPtr specializedAst(const GeneratorEquationAstPtr &ast);
+    GeneratorEquationAstPtr specializedEquationAst(const GeneratorInternalEquationPtr &equation);
+    void addSpecializedValue(const GeneratorInternalEquationPtr &equation,
+                             GeneratorEquationSet &remainingEquations);
+    void computeSpecializedValues();
+    void addImplementationComputeRatesSpecializedMethodCode(GeneratorCodeWriter &code);
+    void addImplementationComputeVariablesSpecializedMethodCode(GeneratorCodeWriter &code,
+                                                                const GeneratorEquationSet &remainingEquations);
+
+    GeneratorEquationAstPtr eventAst(size_t index);
+    GeneratorEquationAstPtr resetValueAst(size_t index);
+
+    bool hasResets() const;
+
+    void addImplementationComputeRootsMethodCode(GeneratorCodeWriter &code);
+    void addImplementationApplyResetsMethodCode(GeneratorCodeWriter &code);
+    std::string generateLookupTableDoubleCode(double value);
+    std::string generateLookupTableValueCode(const GeneratorEquationAstPtr &ast);
+    void addImplementationLookupTableCode(GeneratorCodeWriter &code);
+
+    size_t codeCapacity() const;
+
+    void interfaceCode(GeneratorCodeWriter &code);
+    void implementationCode(GeneratorCodeWriter &code);
 };
 
 bool Generator::GeneratorImpl::hasValidModel() const
@@ -755,10 +1747,20 @@ XmlNodePtr Generator::GeneratorImpl::mathmlChildNode(const XmlNodePtr &node, siz
 GeneratorInternalVariablePtr Generator::GeneratorImpl::generatorVariable(const VariablePtr &variable)
 {
     // Find and return, if there is one, the generator variable associated with
-    // the given variable.
+    // the given variable. We cache the result of our search since it is
+    // expensive to check whether two variables are equivalent and since we
+    // look for the same variables over and over again.
+
+    auto cachedInternalVariable = mInternalVariableCache.find(variable);
+
+    if (cachedInternalVariable != mInternalVariableCache.end()) {
+        return cachedInternalVariable->second;
+    }
 
     for (const auto &internalVariable : mInternalVariables) {
         if (sameOrEquivalentVariable(variable, internalVariable->mVariable)) {
+            mInternalVariableCache[variable] = internalVariable;
+
             return internalVariable;
         }
     }
@@ -769,6 +1771,7 @@ GeneratorInternalVariablePtr Generator::GeneratorImpl::generatorVariable(const V
     GeneratorInternalVariablePtr internalVariable = std::make_shared<GeneratorInternalVariable>(variable);
 
     mInternalVariables.push_back(internalVariable);
+    mInternalVariableCache[variable] = internalVariable;
 
     return internalVariable;
 }
@@ -796,7 +1799,7 @@ GeneratorVariablePtr Generator::GeneratorImpl::variableFirstOccurrence(const Var
         if (sameOrEquivalentVariable(variable, testVariable)) {
             voi = GeneratorVariable::create();
 
-            voi->mPimpl->populate(testVariable, component, GeneratorVariable::Type::VARIABLE_OF_INTEGRATION);
+            voi->mPimpl->populate(testVariable, component, GeneratorVariable::Type::VARIABLE_OF_INTEGRATION, 0, 0);
         }
     }
 
@@ -811,7 +1814,7 @@ void Generator::GeneratorImpl::processNode(const XmlNodePtr &node,
                                            GeneratorEquationAstPtr &ast,
                                            const GeneratorEquationAstPtr &astParent,
                                            const ComponentPtr &component,
-                                           const GeneratorEquationPtr &equation)
+                                           const GeneratorInternalEquationPtr &equation)
 {
     // Basic content elements.
 
@@ -857,14 +1860,14 @@ void Generator::GeneratorImpl::processNode(const XmlNodePtr &node,
                 processNode(mathmlChildNode(node, 0), tempAst, nullptr, component, equation);
                 processNode(mathmlChildNode(node, i), tempAst->mLeft, tempAst, component, equation);
 
-                astRight->mParent = tempAst;
+                astRight->mParent = tempAst.get();
 
                 tempAst->mRight = astRight;
                 astRight = tempAst;
             }
 
             if (astRight != nullptr) {
-                astRight->mParent = ast;
+                astRight->mParent = ast.get();
             }
 
             ast->mRight = astRight;
@@ -881,170 +1884,122 @@ void Generator::GeneratorImpl::processNode(const XmlNodePtr &node,
         // GeneratorEquationAst::Type::ASSIGNMENT type.
 
         if (!node->parent()->parent()->isMathmlElement("math")) {
-            ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::EQ, astParent);
-
-            mNeedEq = true;
+            ast = createAst(GeneratorEquationAst::Type::EQ, astParent);
         }
     } else if (node->isMathmlElement("neq")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::NEQ, astParent);
-
-        mNeedNeq = true;
+        ast = createAst(GeneratorEquationAst::Type::NEQ, astParent);
     } else if (node->isMathmlElement("lt")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::LT, astParent);
-
-        mNeedLt = true;
+        ast = createAst(GeneratorEquationAst::Type::LT, astParent);
     } else if (node->isMathmlElement("leq")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::LEQ, astParent);
-
-        mNeedLeq = true;
+        ast = createAst(GeneratorEquationAst::Type::LEQ, astParent);
     } else if (node->isMathmlElement("gt")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::GT, astParent);
-
-        mNeedGt = true;
+        ast = createAst(GeneratorEquationAst::Type::GT, astParent);
     } else if (node->isMathmlElement("geq")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::GEQ, astParent);
-
-        mNeedGeq = true;
+        ast = createAst(GeneratorEquationAst::Type::GEQ, astParent);
     } else if (node->isMathmlElement("and")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::AND, astParent);
-
-        mNeedAnd = true;
+        ast = createAst(GeneratorEquationAst::Type::AND, astParent);
     } else if (node->isMathmlElement("or")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::OR, astParent);
-
-        mNeedOr = true;
+        ast = createAst(GeneratorEquationAst::Type::OR, astParent);
     } else if (node->isMathmlElement("xor")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::XOR, astParent);
-
-        mNeedXor = true;
+        ast = createAst(GeneratorEquationAst::Type::XOR, astParent);
     } else if (node->isMathmlElement("not")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::NOT, astParent);
-
-        mNeedNot = true;
+        ast = createAst(GeneratorEquationAst::Type::NOT, astParent);
 
         // Arithmetic operators.
 
     } else if (node->isMathmlElement("plus")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::PLUS, astParent);
+        ast = createAst(GeneratorEquationAst::Type::PLUS, astParent);
     } else if (node->isMathmlElement("minus")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::MINUS, astParent);
+        ast = createAst(GeneratorEquationAst::Type::MINUS, astParent);
     } else if (node->isMathmlElement("times")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::TIMES, astParent);
+        ast = createAst(GeneratorEquationAst::Type::TIMES, astParent);
     } else if (node->isMathmlElement("divide")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::DIVIDE, astParent);
+        ast = createAst(GeneratorEquationAst::Type::DIVIDE, astParent);
     } else if (node->isMathmlElement("power")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::POWER, astParent);
+        ast = createAst(GeneratorEquationAst::Type::POWER, astParent);
     } else if (node->isMathmlElement("root")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ROOT, astParent);
+        ast = createAst(GeneratorEquationAst::Type::ROOT, astParent);
     } else if (node->isMathmlElement("abs")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ABS, astParent);
+        ast = createAst(GeneratorEquationAst::Type::ABS, astParent);
     } else if (node->isMathmlElement("exp")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::EXP, astParent);
+        ast = createAst(GeneratorEquationAst::Type::EXP, astParent);
     } else if (node->isMathmlElement("ln")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::LN, astParent);
+        ast = createAst(GeneratorEquationAst::Type::LN, astParent);
     } else if (node->isMathmlElement("log")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::LOG, astParent);
+        ast = createAst(GeneratorEquationAst::Type::LOG, astParent);
     } else if (node->isMathmlElement("ceiling")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::CEILING, astParent);
+        ast = createAst(GeneratorEquationAst::Type::CEILING, astParent);
     } else if (node->isMathmlElement("floor")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::FLOOR, astParent);
+        ast = createAst(GeneratorEquationAst::Type::FLOOR, astParent);
     } else if (node->isMathmlElement("min")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::MIN, astParent);
-
-        mNeedMin = true;
+        ast = createAst(GeneratorEquationAst::Type::MIN, astParent);
     } else if (node->isMathmlElement("max")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::MAX, astParent);
-
-        mNeedMax = true;
+        ast = createAst(GeneratorEquationAst::Type::MAX, astParent);
     } else if (node->isMathmlElement("rem")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::REM, astParent);
+        ast = createAst(GeneratorEquationAst::Type::REM, astParent);
 
         // Calculus elements.
 
     } else if (node->isMathmlElement("diff")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::DIFF, astParent);
+        ast = createAst(GeneratorEquationAst::Type::DIFF, astParent);
 
         // Trigonometric operators.
 
     } else if (node->isMathmlElement("sin")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::SIN, astParent);
+        ast = createAst(GeneratorEquationAst::Type::SIN, astParent);
     } else if (node->isMathmlElement("cos")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::COS, astParent);
+        ast = createAst(GeneratorEquationAst::Type::COS, astParent);
     } else if (node->isMathmlElement("tan")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::TAN, astParent);
+        ast = createAst(GeneratorEquationAst::Type::TAN, astParent);
     } else if (node->isMathmlElement("sec")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::SEC, astParent);
-
-        mNeedSec = true;
+        ast = createAst(GeneratorEquationAst::Type::SEC, astParent);
     } else if (node->isMathmlElement("csc")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::CSC, astParent);
-
-        mNeedCsc = true;
+        ast = createAst(GeneratorEquationAst::Type::CSC, astParent);
     } else if (node->isMathmlElement("cot")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::COT, astParent);
-
-        mNeedCot = true;
+        ast = createAst(GeneratorEquationAst::Type::COT, astParent);
     } else if (node->isMathmlElement("sinh")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::SINH, astParent);
+        ast = createAst(GeneratorEquationAst::Type::SINH, astParent);
     } else if (node->isMathmlElement("cosh")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::COSH, astParent);
+        ast = createAst(GeneratorEquationAst::Type::COSH, astParent);
     } else if (node->isMathmlElement("tanh")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::TANH, astParent);
+        ast = createAst(GeneratorEquationAst::Type::TANH, astParent);
     } else if (node->isMathmlElement("sech")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::SECH, astParent);
-
-        mNeedSech = true;
+        ast = createAst(GeneratorEquationAst::Type::SECH, astParent);
     } else if (node->isMathmlElement("csch")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::CSCH, astParent);
-
-        mNeedCsch = true;
+        ast = createAst(GeneratorEquationAst::Type::CSCH, astParent);
     } else if (node->isMathmlElement("coth")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::COTH, astParent);
-
-        mNeedCoth = true;
+        ast = createAst(GeneratorEquationAst::Type::COTH, astParent);
     } else if (node->isMathmlElement("arcsin")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ASIN, astParent);
+        ast = createAst(GeneratorEquationAst::Type::ASIN, astParent);
     } else if (node->isMathmlElement("arccos")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ACOS, astParent);
+        ast = createAst(GeneratorEquationAst::Type::ACOS, astParent);
     } else if (node->isMathmlElement("arctan")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ATAN, astParent);
+        ast = createAst(GeneratorEquationAst::Type::ATAN, astParent);
     } else if (node->isMathmlElement("arcsec")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ASEC, astParent);
-
-        mNeedAsec = true;
+        ast = createAst(GeneratorEquationAst::Type::ASEC, astParent);
     } else if (node->isMathmlElement("arccsc")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ACSC, astParent);
-
-        mNeedAcsc = true;
+        ast = createAst(GeneratorEquationAst::Type::ACSC, astParent);
     } else if (node->isMathmlElement("arccot")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ACOT, astParent);
-
-        mNeedAcot = true;
+        ast = createAst(GeneratorEquationAst::Type::ACOT, astParent);
     } else if (node->isMathmlElement("arcsinh")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ASINH, astParent);
+        ast = createAst(GeneratorEquationAst::Type::ASINH, astParent);
     } else if (node->isMathmlElement("arccosh")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ACOSH, astParent);
+        ast = createAst(GeneratorEquationAst::Type::ACOSH, astParent);
     } else if (node->isMathmlElement("arctanh")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ATANH, astParent);
+        ast = createAst(GeneratorEquationAst::Type::ATANH, astParent);
     } else if (node->isMathmlElement("arcsech")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ASECH, astParent);
-
-        mNeedAsech = true;
+        ast = createAst(GeneratorEquationAst::Type::ASECH, astParent);
     } else if (node->isMathmlElement("arccsch")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ACSCH, astParent);
-
-        mNeedAcsch = true;
+        ast = createAst(GeneratorEquationAst::Type::ACSCH, astParent);
     } else if (node->isMathmlElement("arccoth")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::ACOTH, astParent);
-
-        mNeedAcoth = true;
+        ast = createAst(GeneratorEquationAst::Type::ACOTH, astParent);
 
         // Piecewise statement.
 
     } else if (node->isMathmlElement("piecewise")) {
         size_t childCount = mathmlChildCount(node);
 
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::PIECEWISE, astParent);
+        ast = createAst(GeneratorEquationAst::Type::PIECEWISE, astParent);
 
         processNode(mathmlChildNode(node, 0), ast->mLeft, ast, component, equation);
 
@@ -1055,27 +2010,27 @@ void Generator::GeneratorImpl::processNode(const XmlNodePtr &node,
             processNode(mathmlChildNode(node, childCount - 1), astRight, nullptr, component, equation);
 
             for (size_t i = childCount - 2; i > 0; --i) {
-                tempAst = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::PIECEWISE, astParent);
+                tempAst = createAst(GeneratorEquationAst::Type::PIECEWISE, astParent);
 
                 processNode(mathmlChildNode(node, i), tempAst->mLeft, tempAst, component, equation);
 
-                astRight->mParent = tempAst;
+                astRight->mParent = tempAst.get();
 
                 tempAst->mRight = astRight;
                 astRight = tempAst;
             }
 
-            astRight->mParent = ast;
+            astRight->mParent = ast.get();
 
             ast->mRight = astRight;
         }
     } else if (node->isMathmlElement("piece")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::PIECE, astParent);
+        ast = createAst(GeneratorEquationAst::Type::PIECE, astParent);
 
         processNode(mathmlChildNode(node, 0), ast->mLeft, ast, component, equation);
         processNode(mathmlChildNode(node, 1), ast->mRight, ast, component, equation);
     } else if (node->isMathmlElement("otherwise")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::OTHERWISE, astParent);
+        ast = createAst(GeneratorEquationAst::Type::OTHERWISE, astParent);
 
         processNode(mathmlChildNode(node, 0), ast->mLeft, ast, component, equation);
 
@@ -1086,50 +2041,45 @@ void Generator::GeneratorImpl::processNode(const XmlNodePtr &node,
         VariablePtr variable = component->variable(variableName);
 
         if (variable != nullptr) {
-            ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::CI, variable, astParent);
+            ast = createAst(GeneratorEquationAst::Type::CI, variable, astParent);
 
             // Have our equation track the (ODE) variable (by ODE variable, we
-            // mean a variable that is used in a "diff" element).
+            // mean a variable that is used in a "diff" element), once it has
+            // been resolved.
 
             if (node->parent()->firstChild()->isMathmlElement("diff")) {
-                equation->addOdeVariable(generatorVariable(variable));
+                equation->mVariableReferences.push_back({variableName, variable, true});
             } else if (!(node->parent()->isMathmlElement("bvar")
                          && node->parent()->parent()->firstChild()->isMathmlElement("diff"))) {
-                equation->addVariable(generatorVariable(variable));
+                equation->mVariableReferences.push_back({variableName, variable, false});
             }
         } else {
-            std::string modelName = entityName(owningModel(component));
-            IssuePtr issue = Issue::create();
-
-            issue->setDescription("Variable '" + variableName
-                                  + "' in component '" + component->name()
-                                  + "' of model '" + modelName
-                                  + "' is referenced in an equation, but it is not defined anywhere.");
-            issue->setCause(Issue::Cause::GENERATOR);
+            // Keep track of the undefined variable so that an issue can be
+            // reported when resolving the variables of our equation.
 
-            mGenerator->addIssue(issue);
+            equation->mVariableReferences.push_back({variableName, nullptr, false});
         }
     } else if (node->isMathmlElement("cn")) {
         if (mathmlChildCount(node) == 1) {
             // We are dealing with an e-notation based CN value.
 
-            ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::CN, node->firstChild()->convertToString() + "e" + node->firstChild()->next()->next()->convertToString(), astParent);
+            ast = createAst(GeneratorEquationAst::Type::CN, node->firstChild()->convertToString() + "e" + node->firstChild()->next()->next()->convertToString(), astParent);
         } else {
-            ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::CN, node->firstChild()->convertToString(), astParent);
+            ast = createAst(GeneratorEquationAst::Type::CN, node->firstChild()->convertToString(), astParent);
         }
 
         // Qualifier elements.
 
     } else if (node->isMathmlElement("degree")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::DEGREE, astParent);
+        ast = createAst(GeneratorEquationAst::Type::DEGREE, astParent);
 
         processNode(mathmlChildNode(node, 0), ast->mLeft, ast, component, equation);
     } else if (node->isMathmlElement("logbase")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::LOGBASE, astParent);
+        ast = createAst(GeneratorEquationAst::Type::LOGBASE, astParent);
 
         processNode(mathmlChildNode(node, 0), ast->mLeft, ast, component, equation);
     } else if (node->isMathmlElement("bvar")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::BVAR, astParent);
+        ast = createAst(GeneratorEquationAst::Type::BVAR, astParent);
 
         processNode(mathmlChildNode(node, 0), ast->mLeft, ast, component, equation);
 
@@ -1142,63 +2092,200 @@ void Generator::GeneratorImpl::processNode(const XmlNodePtr &node,
         // Constants.
 
     } else if (node->isMathmlElement("true")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::TRUE, astParent);
+        ast = createAst(GeneratorEquationAst::Type::TRUE_VALUE, astParent);
     } else if (node->isMathmlElement("false")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::FALSE, astParent);
+        ast = createAst(GeneratorEquationAst::Type::FALSE_VALUE, astParent);
     } else if (node->isMathmlElement("exponentiale")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::E, astParent);
+        ast = createAst(GeneratorEquationAst::Type::E, astParent);
     } else if (node->isMathmlElement("pi")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::PI, astParent);
+        ast = createAst(GeneratorEquationAst::Type::PI, astParent);
     } else if (node->isMathmlElement("infinity")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::INF, astParent);
+        ast = createAst(GeneratorEquationAst::Type::INF, astParent);
     } else if (node->isMathmlElement("notanumber")) {
-        ast = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::NAN, astParent);
+        ast = createAst(GeneratorEquationAst::Type::NAN_VALUE, astParent);
     }
 }
 
-GeneratorEquationPtr Generator::GeneratorImpl::processNode(const XmlNodePtr &node,
-                                                           const ComponentPtr &component)
+GeneratorInternalEquationPtr Generator::GeneratorImpl::processNode(const XmlNodePtr &node,
+                                                                   const ComponentPtr &component)
 {
-    // Create and keep track of the equation associated with the given node.
-
-    GeneratorEquationPtr equation = std::make_shared<GeneratorEquation>(component);
-
-    mEquations.push_back(equation);
+    // Create the equation associated with the given node, process the node
+    // and return the equation.
 
-    // Actually process the node and return its corresponding equation.
+    GeneratorInternalEquationPtr equation = std::make_shared<GeneratorInternalEquation>(component);
 
-    processNode(node, equation->mAst, equation->mAst->mParent.lock(), component, equation);
+    processNode(node, equation->mAst, nullptr, component, equation);
 
     return equation;
 }
 
-void Generator::GeneratorImpl::processComponent(const ComponentPtr &component)
+void Generator::GeneratorImpl::updateNeeds(const GeneratorEquationAstPtr &ast)
 {
-    // Retrieve the math string associated with the given component and process
-    // it, one equation at a time.
+    // Keep track of the functions that our code needs for the given AST. The
+    // AST types are listed in the same order as the flags returned by needs().
+
+    static const std::vector<GeneratorEquationAst::Type> NEEDED_TYPES = {
+        GeneratorEquationAst::Type::EQ, GeneratorEquationAst::Type::NEQ,
+        GeneratorEquationAst::Type::LT, GeneratorEquationAst::Type::LEQ,
+        GeneratorEquationAst::Type::GT, GeneratorEquationAst::Type::GEQ,
+        GeneratorEquationAst::Type::AND, GeneratorEquationAst::Type::OR,
+        GeneratorEquationAst::Type::XOR, GeneratorEquationAst::Type::NOT,
+        GeneratorEquationAst::Type::MIN, GeneratorEquationAst::Type::MAX,
+        GeneratorEquationAst::Type::PIECEWISE,
+        GeneratorEquationAst::Type::SEC, GeneratorEquationAst::Type::CSC,
+        GeneratorEquationAst::Type::COT, GeneratorEquationAst::Type::SECH,
+        GeneratorEquationAst::Type::CSCH, GeneratorEquationAst::Type::COTH,
+        GeneratorEquationAst::Type::ASEC, GeneratorEquationAst::Type::ACSC,
+        GeneratorEquationAst::Type::ACOT, GeneratorEquationAst::Type::ASECH,
+        GeneratorEquationAst::Type::ACSCH, GeneratorEquationAst::Type::ACOTH};
+
+    auto needs = this->needs();
+    std::vector<GeneratorEquationAstPtr> asts = {ast};
+
+    while (!asts.empty()) {
+        auto currentAst = asts.back();
+
+        asts.pop_back();
+
+        auto neededType = std::find(NEEDED_TYPES.begin(), NEEDED_TYPES.end(), currentAst->mType);
+
+        if (neededType != NEEDED_TYPES.end()) {
+            *needs[static_cast<size_t>(neededType - NEEDED_TYPES.begin())] = true;
+        }
 
-    XmlDocPtr xmlDoc = std::make_shared<XmlDoc>();
-    std::string math = component->math();
+        for (const auto &child : {currentAst->mLeft, currentAst->mRight}) {
+            if (child != nullptr) {
+                asts.push_back(child);
+            }
+        }
+    }
+}
 
-    if (!math.empty()) {
-        xmlDoc->parseMathML(math, false);
+void Generator::GeneratorImpl::resolveEquation(const GeneratorInternalEquationPtr &equation)
+{
+    // Resolve the variables referenced by the given equation, reporting those
+    // that are not defined, and keep track of the functions that its AST needs.
 
-        XmlNodePtr mathNode = xmlDoc->rootNode();
+    for (const auto &variableReference : equation->mVariableReferences) {
+        if (variableReference.mVariable == nullptr) {
+            std::string modelName = entityName(owningModel(equation->mComponent));
+            IssuePtr issue = Issue::create();
 
-        for (XmlNodePtr node = mathNode->firstChild(); node != nullptr; node = node->next()) {
-            if (node->isMathmlElement()) {
-                processNode(node, component);
-            }
+            issue->setDescription("Variable '" + variableReference.mName
+                                  + "' in component '" + equation->mComponent->name()
+                                  + "' of model '" + modelName
+                                  + "' is referenced in an equation, but it is not defined anywhere.");
+            issue->setCause(Issue::Cause::GENERATOR);
+
+            mGenerator->addIssue(issue);
+        } else if (variableReference.mIsOdeVariable) {
+            equation->addOdeVariable(generatorVariable(variableReference.mVariable));
+        } else {
+            equation->addVariable(generatorVariable(variableReference.mVariable));
         }
     }
 
-    // Go through the given component's variables and make sure that everything
-    // makes sense.
+    equation->mVariableReferences.clear();
 
-    for (size_t i = 0; i < component->variableCount(); ++i) {
-        // Retrieve the variable's corresponding generator variable.
+    updateNeeds(equation->mAst);
+}
 
-        VariablePtr variable = component->variable(i);
+GeneratorEquationAstPtr Generator::GeneratorImpl::processResetMath(const std::string &math,
+                                                                   const ComponentPtr &component)
+{
+    // The math of a test value or of a reset value consists of a single
+    // expression, which we process as if it was part of an equation, albeit an
+    // equation that we don't keep track of.
+
+    XmlDocPtr xmlDoc = std::make_shared<XmlDoc>();
+
+    xmlDoc->parseMathML(math, false);
+
+    XmlNodePtr mathNode = xmlDoc->rootNode();
+
+    if (mathNode != nullptr) {
+        for (XmlNodePtr node = mathNode->firstChild(); node != nullptr; node = node->next()) {
+            if (node->isMathmlElement()) {
+                GeneratorInternalEquationPtr equation = processNode(node, component);
+
+                resolveEquation(equation);
+
+                return equation->mAst;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+void Generator::GeneratorImpl::processReset(const ResetPtr &reset, const ComponentPtr &component)
+{
+    // Keep track of the given reset, but only if it is complete.
+
+    if ((reset->variable() == nullptr)
+        || (reset->testVariable() == nullptr)) {
+        return;
+    }
+
+    GeneratorResetPtr generatorReset = std::make_shared<GeneratorReset>();
+
+    generatorReset->mOrder = reset->order();
+    generatorReset->mVariable = reset->variable();
+    generatorReset->mTestVariable = reset->testVariable();
+    generatorReset->mTestValue = processResetMath(reset->testValue(), component);
+    generatorReset->mResetValue = processResetMath(reset->resetValue(), component);
+
+    if ((generatorReset->mTestValue != nullptr)
+        && (generatorReset->mResetValue != nullptr)) {
+        mResets.push_back(generatorReset);
+    }
+}
+
+std::vector<GeneratorInternalEquationPtr> Generator::GeneratorImpl::componentEquations(const ComponentPtr &component)
+{
+    // Retrieve the math string associated with the given component and process
+    // it, one equation at a time. This only relies on the given component, so
+    // it can be done for several components at once.
+
+    std::vector<GeneratorInternalEquationPtr> res;
+    std::string math = component->math();
+
+    if (!math.empty()) {
+        XmlDocPtr xmlDoc = std::make_shared<XmlDoc>();
+
+        xmlDoc->parseMathML(math, false);
+
+        XmlNodePtr mathNode = xmlDoc->rootNode();
+
+        for (XmlNodePtr node = mathNode->firstChild(); node != nullptr; node = node->next()) {
+            if (node->isMathmlElement()) {
+                res.push_back(processNode(node, component));
+            }
+        }
+    }
+
+    return res;
+}
+
+void Generator::GeneratorImpl::processComponent(const ComponentPtr &component,
+                                                const std::vector<GeneratorInternalEquationPtr> &equations)
+{
+    // Keep track of the given equations of the given component, resolving the
+    // variables that they reference.
+
+    for (const auto &equation : equations) {
+        mEquations.push_back(equation);
+
+        resolveEquation(equation);
+    }
+
+    // Go through the given component's variables and make sure that everything
+    // makes sense.
+
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        // Retrieve the variable's corresponding generator variable.
+
+        VariablePtr variable = component->variable(i);
         GeneratorInternalVariablePtr generatorVariable = Generator::GeneratorImpl::generatorVariable(variable);
 
         // Replace the variable held by `generatorVariable`, in case the
@@ -1230,10 +2317,63 @@ void Generator::GeneratorImpl::processComponent(const ComponentPtr &component)
         }
     }
 
-    // Do the same for the components encapsulated by the given component.
+    // Process the given component's resets.
 
-    for (size_t i = 0; i < component->componentCount(); ++i) {
-        processComponent(component->component(i));
+    for (size_t i = 0; i < component->resetCount(); ++i) {
+        processReset(component->reset(i), component);
+    }
+}
+
+void Generator::GeneratorImpl::processComponents(const ModelPtr &model)
+{
+    // Retrieve the equations of all the components of the given model, using
+    // several threads for a large model since the math of a component can be
+    // processed independently of that of the other components. The components
+    // are then processed one at a time and in order, so that the result is the
+    // same as if everything had been done sequentially.
+
+    std::vector<ComponentPtr> components;
+
+    for (size_t i = 0; i < model->componentCount(); ++i) {
+        addComponents(model->component(i), components);
+    }
+
+    std::vector<std::vector<GeneratorInternalEquationPtr>> equations(components.size());
+    std::atomic<size_t> nextComponentIndex(0);
+    auto processNextComponents = [&]() {
+        // Each thread allocates the ASTs of its equations from its own arena.
+
+        GeneratorAstArenaScope astArenaScope(std::make_shared<GeneratorAstArena>());
+
+        for (size_t i = nextComponentIndex++; i < components.size(); i = nextComponentIndex++) {
+            equations[i] = componentEquations(components[i]);
+        }
+    };
+    std::vector<std::thread> threads;
+    size_t threadCount = std::min((mMaximumThreadCount == 0) ?
+                                      static_cast<size_t>(std::thread::hardware_concurrency()) :
+                                      mMaximumThreadCount,
+                                  components.size() / MINIMUM_COMPONENT_COUNT_PER_THREAD);
+
+    for (size_t i = 1; i < threadCount; ++i) {
+        try {
+            threads.emplace_back(processNextComponents);
+        } catch (const std::system_error &) {
+            // We cannot create any more threads, so just make do with the
+            // ones that we have got.
+
+            break;
+        }
+    }
+
+    processNextComponents();
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < components.size(); ++i) {
+        processComponent(components[i], equations[i]);
     }
 }
 
@@ -1242,9 +2382,9 @@ void Generator::GeneratorImpl::processEquationAst(const GeneratorEquationAstPtr
     // Look for the definition of a variable of integration and make sure that
     // we don't have more than one of it and that it's not initialised.
 
-    GeneratorEquationAstPtr astParent = ast->mParent.lock();
-    GeneratorEquationAstPtr astGrandParent = (astParent != nullptr) ? astParent->mParent.lock() : nullptr;
-    GeneratorEquationAstPtr astGreatGrandParent = (astGrandParent != nullptr) ? astGrandParent->mParent.lock() : nullptr;
+    auto astParent = ast->mParent;
+    auto astGrandParent = (astParent != nullptr) ? astParent->mParent : nullptr;
+    auto astGreatGrandParent = (astGrandParent != nullptr) ? astGrandParent->mParent : nullptr;
 
     if ((ast->mType == GeneratorEquationAst::Type::CI)
         && (astParent != nullptr) && (astParent->mType == GeneratorEquationAst::Type::BVAR)
@@ -1319,7 +2459,7 @@ void Generator::GeneratorImpl::processEquationAst(const GeneratorEquationAstPtr
         && (astGrandParent != nullptr) && (astGrandParent->mType == GeneratorEquationAst::Type::BVAR)
         && (astGreatGrandParent != nullptr) && (astGreatGrandParent->mType == GeneratorEquationAst::Type::DIFF)) {
         double value;
-        if (!convertToDouble(ast->mValue, value) || !areEqual(value, 1.0)) {
+        if (!convertToDouble(*ast->mValue, value) || !areEqual(value, 1.0)) {
             VariablePtr variable = astGreatGrandParent->mRight->mVariable;
             ComponentPtr component = std::dynamic_pointer_cast<Component>(variable->parent());
             ModelPtr model = owningModel(component);
@@ -1383,13 +2523,19 @@ bool Generator::GeneratorImpl::compareVariablesByTypeAndIndex(const GeneratorInt
     return variable1->mType < variable2->mType;
 }
 
-bool Generator::GeneratorImpl::compareEquationsByVariable(const GeneratorEquationPtr &equation1,
-                                                          const GeneratorEquationPtr &equation2)
+bool Generator::GeneratorImpl::compareResetsByOrder(const GeneratorResetPtr &reset1,
+                                                    const GeneratorResetPtr &reset2)
+{
+    return reset1->mOrder < reset2->mOrder;
+}
+
+bool Generator::GeneratorImpl::compareEquationsByVariable(const GeneratorInternalEquationPtr &equation1,
+                                                          const GeneratorInternalEquationPtr &equation2)
 {
     return compareVariablesByTypeAndIndex(equation1->mVariable, equation2->mVariable);
 }
 
-void Generator::GeneratorImpl::processModel(const ModelPtr &model)
+void Generator::GeneratorImpl::analyseModel(const ModelPtr &model)
 {
     // Reset a few things in case we were to process the model more than once.
     // Note: one would normally process the model only once, so we shouldn't
@@ -1398,14 +2544,18 @@ void Generator::GeneratorImpl::processModel(const ModelPtr &model)
     mModelType = Generator::ModelType::UNKNOWN;
 
     mInternalVariables.clear();
+    mInternalVariableCache.clear();
     mEquations.clear();
+    mResets.clear();
 
     mVoi = nullptr;
     mStates.clear();
     mVariables.clear();
+    mGeneratorEquations.clear();
 
     mNeedMin = false;
     mNeedMax = false;
+    mNeedPiecewise = false;
 
     mNeedSec = false;
     mNeedCsc = false;
@@ -1422,12 +2572,15 @@ void Generator::GeneratorImpl::processModel(const ModelPtr &model)
 
     mGenerator->removeAllIssues();
 
-    // Recursively process the model's components, so that we end up with an AST
-    // for each of the model's equations.
+    // Process the model's components, so that we end up with an AST for each of
+    // the model's equations.
 
-    for (size_t i = 0; i < model->componentCount(); ++i) {
-        processComponent(model->component(i));
-    }
+    processComponents(model);
+
+    // Order our resets, so that the ones with a lower order take precedence
+    // over the ones with a higher order when applying them.
+
+    std::stable_sort(mResets.begin(), mResets.end(), compareResetsByOrder);
 
     // Process our different equations' AST to determine the type of our
     // variables.
@@ -1516,6 +2669,33 @@ void Generator::GeneratorImpl::processModel(const ModelPtr &model)
         }
     }
 
+    // Make sure that our resets only reset states. An algebraic variable would
+    // be overwritten by the next call to the method to compute the variables
+    // while a constant would never be recomputed.
+
+    if (mGenerator->issueCount() == 0) {
+        for (const auto &reset : mResets) {
+            auto internalVariable = existingGeneratorVariable(reset->mVariable);
+
+            if ((internalVariable == nullptr)
+                || (internalVariable->mType != GeneratorInternalVariable::Type::STATE)) {
+                IssuePtr issue = Issue::create();
+                VariablePtr realVariable = reset->mVariable;
+                ComponentPtr realComponent = std::dynamic_pointer_cast<Component>(realVariable->parent());
+                ModelPtr realModel = owningModel(realComponent);
+
+                issue->setDescription("Variable '" + realVariable->name()
+                                      + "' in component '" + realComponent->name()
+                                      + "' of model '" + realModel->name() + "' is reset, but it is not a state.");
+                issue->setCause(Issue::Cause::GENERATOR);
+
+                mGenerator->addIssue(issue);
+
+                mModelType = Generator::ModelType::INVALID;
+            }
+        }
+    }
+
     // Determine the type of our model, if it hasn't already been categorised as
     // being invalid.
 
@@ -1553,1044 +2733,4484 @@ void Generator::GeneratorImpl::processModel(const ModelPtr &model)
         mInternalVariables.sort(compareVariablesByTypeAndIndex);
         mEquations.sort(compareEquationsByVariable);
 
-        for (const auto &internalVariable : mInternalVariables) {
-            GeneratorVariable::Type type;
-
-            if (internalVariable->mType == GeneratorInternalVariable::Type::STATE) {
-                type = GeneratorVariable::Type::STATE;
-            } else if (internalVariable->mType == GeneratorInternalVariable::Type::CONSTANT) {
-                type = GeneratorVariable::Type::CONSTANT;
-            } else if ((internalVariable->mType == GeneratorInternalVariable::Type::COMPUTED_TRUE_CONSTANT)
-                       || (internalVariable->mType == GeneratorInternalVariable::Type::COMPUTED_VARIABLE_BASED_CONSTANT)) {
-                type = GeneratorVariable::Type::COMPUTED_CONSTANT;
-            } else if (internalVariable->mType == GeneratorInternalVariable::Type::ALGEBRAIC) {
-                type = GeneratorVariable::Type::ALGEBRAIC;
-            } else {
-                // This is the variable of integration, so skip it.
-
-                continue;
-            }
-
-            GeneratorVariablePtr stateOrVariable = GeneratorVariable::create();
+        size_t equationIndex = 0;
 
-            stateOrVariable->mPimpl->populate(internalVariable->mVariable,
-                                              internalVariable->mComponent,
-                                              type);
+        for (const auto &equation : mEquations) {
+            equation->mIndex = equationIndex++;
+        }
 
-            if (type == GeneratorVariable::Type::STATE) {
-                mStates.push_back(stateOrVariable);
-            } else {
-                mVariables.push_back(stateOrVariable);
-            }
+        for (const auto &internalVariable : mInternalVariables) {
+            internalVariable->mDefaultIndex = internalVariable->mIndex;
         }
+
+        orderVariables();
     }
 }
 
-bool Generator::GeneratorImpl::isRelationalOperator(const GeneratorEquationAstPtr &ast) const
+std::vector<bool *> Generator::GeneratorImpl::needs()
 {
-    return ((ast->mType == GeneratorEquationAst::Type::EQ)
-            && mProfile->hasEqOperator())
-           || ((ast->mType == GeneratorEquationAst::Type::NEQ)
-               && mProfile->hasNeqOperator())
-           || ((ast->mType == GeneratorEquationAst::Type::LT)
-               && mProfile->hasLtOperator())
-           || ((ast->mType == GeneratorEquationAst::Type::LEQ)
-               && mProfile->hasLeqOperator())
-           || ((ast->mType == GeneratorEquationAst::Type::GT)
-               && mProfile->hasGtOperator())
-           || ((ast->mType == GeneratorEquationAst::Type::GEQ)
-               && mProfile->hasGeqOperator());
+    // Return the flags that our analysis sets to tell which functions our code
+    // needs.
+
+    return {&mNeedEq, &mNeedNeq, &mNeedLt, &mNeedLeq, &mNeedGt, &mNeedGeq,
+            &mNeedAnd, &mNeedOr, &mNeedXor, &mNeedNot,
+            &mNeedMin, &mNeedMax, &mNeedPiecewise,
+            &mNeedSec, &mNeedCsc, &mNeedCot, &mNeedSech, &mNeedCsch, &mNeedCoth,
+            &mNeedAsec, &mNeedAcsc, &mNeedAcot, &mNeedAsech, &mNeedAcsch, &mNeedAcoth};
 }
 
-bool Generator::GeneratorImpl::isAndOperator(const GeneratorEquationAstPtr &ast) const
+void Generator::GeneratorImpl::addComponents(const ComponentPtr &component,
+                                             std::vector<ComponentPtr> &components) const
 {
-    return (ast->mType == GeneratorEquationAst::Type::AND)
-           && mProfile->hasAndOperator();
-}
+    // Add the given component and, recursively, its encapsulated components.
 
-bool Generator::GeneratorImpl::isOrOperator(const GeneratorEquationAstPtr &ast) const
-{
-    return (ast->mType == GeneratorEquationAst::Type::OR)
-           && mProfile->hasOrOperator();
-}
+    components.push_back(component);
 
-bool Generator::GeneratorImpl::isXorOperator(const GeneratorEquationAstPtr &ast) const
-{
-    return (ast->mType == GeneratorEquationAst::Type::XOR)
-           && mProfile->hasXorOperator();
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        addComponents(component->component(i), components);
+    }
 }
 
-bool Generator::GeneratorImpl::isLogicalOperator(const GeneratorEquationAstPtr &ast) const
+std::string Generator::GeneratorImpl::modelHash(const ModelPtr &model,
+                                                std::vector<ComponentPtr> &components,
+                                                std::vector<VariablePtr> &variables) const
 {
-    // Note: GeneratorEquationAst::Type::NOT is a unary logical operator, hence
-    //       we don't include it here since this method is only used to
-    //       determine whether parentheses should be added around some code.
+    // Retrieve the components and variables of the given model, in the order
+    // in which we analyse them, and compute a hash of the structure of the
+    // model, i.e. of everything that is relevant to its analysis.
 
-    return isAndOperator(ast) || isOrOperator(ast) || isXorOperator(ast);
-}
+    for (size_t i = 0; i < model->componentCount(); ++i) {
+        addComponents(model->component(i), components);
+    }
 
-bool Generator::GeneratorImpl::isPlusOperator(const GeneratorEquationAstPtr &ast) const
-{
-    return ast->mType == GeneratorEquationAst::Type::PLUS;
-}
+    std::map<VariablePtr, size_t> variableIndices;
 
-bool Generator::GeneratorImpl::isMinusOperator(const GeneratorEquationAstPtr &ast) const
-{
-    return ast->mType == GeneratorEquationAst::Type::MINUS;
-}
+    for (const auto &component : components) {
+        for (size_t i = 0; i < component->variableCount(); ++i) {
+            variableIndices[component->variable(i)] = variables.size();
 
-bool Generator::GeneratorImpl::isTimesOperator(const GeneratorEquationAstPtr &ast) const
-{
-    return ast->mType == GeneratorEquationAst::Type::TIMES;
-}
+            variables.push_back(component->variable(i));
+        }
+    }
 
-bool Generator::GeneratorImpl::isDivideOperator(const GeneratorEquationAstPtr &ast) const
-{
-    return ast->mType == GeneratorEquationAst::Type::DIVIDE;
-}
+    auto variableReference = [&variableIndices](const VariablePtr &variable) {
+        if (variable == nullptr) {
+            return std::string("-");
+        }
 
-bool Generator::GeneratorImpl::isPowerOperator(const GeneratorEquationAstPtr &ast) const
-{
-    return (ast->mType == GeneratorEquationAst::Type::POWER)
-           && mProfile->hasPowerOperator();
-}
+        auto variableIndex = variableIndices.find(variable);
 
-bool Generator::GeneratorImpl::isRootOperator(const GeneratorEquationAstPtr &ast) const
-{
-    return (ast->mType == GeneratorEquationAst::Type::ROOT)
-           && mProfile->hasPowerOperator();
-}
+        return (variableIndex != variableIndices.end()) ?
+                   std::to_string(variableIndex->second) :
+                   "?" + variable->name();
+    };
 
-bool Generator::GeneratorImpl::isPiecewiseStatement(const GeneratorEquationAstPtr &ast) const
-{
-    return (ast->mType == GeneratorEquationAst::Type::PIECEWISE)
-           && mProfile->hasConditionalOperator();
-}
+    std::string structure = model->name() + "\n";
 
-std::string Generator::GeneratorImpl::replace(std::string string,
-                                              const std::string &from,
-                                              const std::string &to)
-{
-    auto index = string.find(from);
+    for (const auto &component : components) {
+        structure += "component " + component->name()
+                     + " " + std::to_string(component->componentCount())
+                     + " " + std::to_string(component->variableCount())
+                     + " " + std::to_string(component->resetCount()) + "\n"
+                     + component->math() + "\n";
+
+        for (size_t i = 0; i < component->variableCount(); ++i) {
+            auto variable = component->variable(i);
+
+            structure += "variable " + variable->name()
+                         + " " + ((variable->units() != nullptr) ? variable->units()->name() : "")
+                         + " " + variable->initialValue()
+                         + " " + variable->interfaceType();
 
-    return (index == std::string::npos) ?
-               string :
-               string.replace(index, from.length(), to);
+            for (size_t j = 0; j < variable->equivalentVariableCount(); ++j) {
+                structure += " " + variableReference(variable->equivalentVariable(j));
+            }
+
+            structure += "\n";
+        }
+
+        for (size_t i = 0; i < component->resetCount(); ++i) {
+            auto reset = component->reset(i);
+
+            structure += "reset " + std::to_string(reset->order())
+                         + " " + variableReference(reset->variable())
+                         + " " + variableReference(reset->testVariable()) + "\n"
+                         + reset->testValue() + "\n"
+                         + reset->resetValue() + "\n";
+        }
+    }
+
+    return sha1(structure);
 }
 
-void Generator::GeneratorImpl::updateVariableInfoSizes(size_t &componentSize,
-                                                       size_t &nameSize,
-                                                       size_t &unitsSize,
-                                                       const GeneratorVariablePtr &variable)
+void Generator::GeneratorImpl::remapAstVariables(const GeneratorEquationAstPtr &ast,
+                                                 const std::map<VariablePtr, VariablePtr> &variableMap) const
 {
-    auto variableComponentSize = variable->component()->name().length() + 1;
-    auto variableNameSize = variable->variable()->name().length() + 1;
-    auto variableUnitsSize = variable->variable()->units()->name().length() + 1;
-    // Note: +1 to account for the end of string termination.
+    // Make the given AST use the variables to which its variables are mapped.
 
-    componentSize = (componentSize > variableComponentSize) ? componentSize : variableComponentSize;
-    nameSize = (nameSize > variableNameSize) ? nameSize : variableNameSize;
-    unitsSize = (unitsSize > variableUnitsSize) ? unitsSize : variableUnitsSize;
+    if (ast == nullptr) {
+        return;
+    }
+
+    if (ast->mVariable != nullptr) {
+        auto variable = variableMap.find(ast->mVariable);
+
+        if (variable != variableMap.end()) {
+            ast->mVariable = variable->second;
+        }
+    }
+
+    remapAstVariables(ast->mLeft, variableMap);
+    remapAstVariables(ast->mRight, variableMap);
 }
 
-bool Generator::GeneratorImpl::modifiedProfile() const
+void Generator::GeneratorImpl::copyAnalysis(const GeneratorAnalysis &from, GeneratorAnalysis &to,
+                                            const std::map<VariablePtr, VariablePtr> &variableMap,
+                                            const std::map<ComponentPtr, ComponentPtr> &componentMap) const
 {
-    // Whether the profile requires an interface to be generated.
+    // Make a deep copy of the given analysis, so that it can be used (and
+    // modified) independently of the original, and this using the variables
+    // and components to which the original ones are mapped, if any.
 
-    const std::string trueValue = "true";
-    const std::string falseValue = "false";
+    auto mappedVariable = [&variableMap](const VariablePtr &variable) {
+        auto res = variableMap.find(variable);
 
-    std::string profileContents = mProfile->hasInterface() ?
-                                      trueValue :
-                                      falseValue;
+        return (res != variableMap.end()) ? res->second : variable;
+    };
+    auto mappedComponent = [&componentMap](const ComponentPtr &component) {
+        auto res = componentMap.find(component);
 
-    // Assignment.
+        return (res != componentMap.end()) ? res->second : component;
+    };
 
-    profileContents += mProfile->assignmentString();
+    std::map<GeneratorInternalVariablePtr, GeneratorInternalVariablePtr> internalVariableMap;
+    std::map<GeneratorInternalEquationPtr, GeneratorInternalEquationPtr> equationMap;
 
-    // Relational and logical operators.
+    to.mModelType = from.mModelType;
 
-    profileContents += mProfile->eqString()
-                       + mProfile->neqString()
-                       + mProfile->ltString()
-                       + mProfile->leqString()
-                       + mProfile->gtString()
-                       + mProfile->geqString()
-                       + mProfile->andString()
-                       + mProfile->orString()
-                       + mProfile->xorString()
-                       + mProfile->notString();
+    for (const auto &internalVariable : from.mInternalVariables) {
+        auto internalVariableCopy = std::make_shared<GeneratorInternalVariable>(*internalVariable);
 
-    profileContents += (mProfile->hasEqOperator() ?
-                            trueValue :
-                            falseValue)
-                       + (mProfile->hasNeqOperator() ?
-                              trueValue :
-                              falseValue)
-                       + (mProfile->hasLtOperator() ?
-                              trueValue :
-                              falseValue)
-                       + (mProfile->hasLeqOperator() ?
-                              trueValue :
-                              falseValue)
-                       + (mProfile->hasGtOperator() ?
-                              trueValue :
-                              falseValue)
-                       + (mProfile->hasGeqOperator() ?
-                              trueValue :
-                              falseValue)
-                       + (mProfile->hasAndOperator() ?
-                              trueValue :
-                              falseValue)
-                       + (mProfile->hasOrOperator() ?
-                              trueValue :
-                              falseValue)
-                       + (mProfile->hasXorOperator() ?
-                              trueValue :
-                              falseValue)
-                       + (mProfile->hasNotOperator() ?
-                              trueValue :
-                              falseValue);
+        internalVariableCopy->mVariable = mappedVariable(internalVariable->mVariable);
+        internalVariableCopy->mComponent = mappedComponent(internalVariable->mComponent);
 
-    // Arithmetic operators.
+        internalVariableMap[internalVariable] = internalVariableCopy;
 
-    profileContents += mProfile->plusString()
-                       + mProfile->minusString()
-                       + mProfile->timesString()
-                       + mProfile->divideString()
-                       + mProfile->powerString()
-                       + mProfile->squareRootString()
-                       + mProfile->squareString()
-                       + mProfile->absoluteValueString()
-                       + mProfile->exponentialString()
-                       + mProfile->napierianLogarithmString()
-                       + mProfile->commonLogarithmString()
-                       + mProfile->ceilingString()
-                       + mProfile->floorString()
-                       + mProfile->minString()
-                       + mProfile->maxString()
-                       + mProfile->remString();
+        to.mInternalVariables.push_back(internalVariableCopy);
+    }
 
-    profileContents += mProfile->hasPowerOperator() ?
-                           trueValue :
-                           falseValue;
+    auto mappedInternalVariable = [&internalVariableMap](const GeneratorInternalVariablePtr &internalVariable) {
+        auto res = internalVariableMap.find(internalVariable);
 
-    // Trigonometric operators.
+        return (res != internalVariableMap.end()) ? res->second : internalVariable;
+    };
 
-    profileContents += mProfile->sinString()
-                       + mProfile->cosString()
-                       + mProfile->tanString()
-                       + mProfile->secString()
-                       + mProfile->cscString()
-                       + mProfile->cotString()
-                       + mProfile->sinhString()
-                       + mProfile->coshString()
-                       + mProfile->tanhString()
-                       + mProfile->sechString()
-                       + mProfile->cschString()
-                       + mProfile->cothString()
-                       + mProfile->asinString()
-                       + mProfile->acosString()
-                       + mProfile->atanString()
-                       + mProfile->asecString()
-                       + mProfile->acscString()
-                       + mProfile->acotString()
-                       + mProfile->asinhString()
-                       + mProfile->acoshString()
-                       + mProfile->atanhString()
-                       + mProfile->asechString()
-                       + mProfile->acschString()
-                       + mProfile->acothString();
+    for (const auto &equation : from.mEquations) {
+        auto equationCopy = std::make_shared<GeneratorInternalEquation>(*equation);
 
-    // Piecewise statement.
+        equationMap[equation] = equationCopy;
 
-    profileContents += mProfile->conditionalOperatorIfString()
-                       + mProfile->conditionalOperatorElseString()
-                       + mProfile->piecewiseIfString()
-                       + mProfile->piecewiseElseString();
+        to.mEquations.push_back(equationCopy);
+    }
 
-    profileContents += mProfile->hasConditionalOperator() ?
-                           trueValue :
-                           falseValue;
+    for (const auto &equationCopy : to.mEquations) {
+        for (auto &dependency : equationCopy->mDependencies) {
+            dependency = equationMap[dependency];
+        }
 
-    // Constants.
+        for (auto &internalVariable : equationCopy->mVariables) {
+            internalVariable = mappedInternalVariable(internalVariable);
+        }
 
-    profileContents += mProfile->trueString()
-                       + mProfile->falseString()
-                       + mProfile->eString()
-                       + mProfile->piString()
-                       + mProfile->infString()
-                       + mProfile->nanString();
+        for (auto &odeVariable : equationCopy->mOdeVariables) {
+            odeVariable = mappedInternalVariable(odeVariable);
+        }
 
-    // Arithmetic functions.
+        equationCopy->mVariable = mappedInternalVariable(equationCopy->mVariable);
+        equationCopy->mComponent = mappedComponent(equationCopy->mComponent);
+        equationCopy->mAst = copyAst(equationCopy->mAst, nullptr);
 
-    profileContents += mProfile->eqFunctionString()
-                       + mProfile->neqFunctionString()
-                       + mProfile->ltFunctionString()
-                       + mProfile->leqFunctionString()
-                       + mProfile->gtFunctionString()
-                       + mProfile->geqFunctionString()
-                       + mProfile->andFunctionString()
-                       + mProfile->orFunctionString()
-                       + mProfile->xorFunctionString()
-                       + mProfile->notFunctionString()
-                       + mProfile->minFunctionString()
-                       + mProfile->maxFunctionString();
+        remapAstVariables(equationCopy->mAst, variableMap);
+    }
 
-    // Trigonometric functions.
+    for (const auto &internalVariable : to.mInternalVariables) {
+        auto equation = internalVariable->mEquation.lock();
 
-    profileContents += mProfile->secFunctionString()
-                       + mProfile->cscFunctionString()
-                       + mProfile->cotFunctionString()
-                       + mProfile->sechFunctionString()
-                       + mProfile->cschFunctionString()
-                       + mProfile->cothFunctionString()
-                       + mProfile->asecFunctionString()
-                       + mProfile->acscFunctionString()
-                       + mProfile->acotFunctionString()
-                       + mProfile->asechFunctionString()
-                       + mProfile->acschFunctionString()
-                       + mProfile->acothFunctionString();
+        if (equation != nullptr) {
+            internalVariable->mEquation = equationMap[equation];
+        }
+    }
 
-    // Miscellaneous.
+    for (const auto &reset : from.mResets) {
+        auto resetCopy = std::make_shared<GeneratorReset>(*reset);
 
-    profileContents += mProfile->commentString()
-                       + mProfile->originCommentString();
+        resetCopy->mVariable = mappedVariable(reset->mVariable);
+        resetCopy->mTestVariable = mappedVariable(reset->mTestVariable);
+        resetCopy->mTestValue = copyAst(reset->mTestValue, nullptr);
+        resetCopy->mResetValue = copyAst(reset->mResetValue, nullptr);
 
-    profileContents += mProfile->interfaceFileNameString();
+        remapAstVariables(resetCopy->mTestValue, variableMap);
+        remapAstVariables(resetCopy->mResetValue, variableMap);
 
-    profileContents += mProfile->interfaceHeaderString()
-                       + mProfile->implementationHeaderString();
+        to.mResets.push_back(resetCopy);
+    }
 
-    profileContents += mProfile->interfaceVersionString()
-                       + mProfile->implementationVersionString();
+    if (from.mVoi != nullptr) {
+        to.mVoi = GeneratorVariable::create();
 
-    profileContents += mProfile->interfaceLibcellmlVersionString()
-                       + mProfile->implementationLibcellmlVersionString();
+        to.mVoi->mPimpl->populate(mappedVariable(from.mVoi->variable()),
+                                  mappedComponent(from.mVoi->component()),
+                                  GeneratorVariable::Type::VARIABLE_OF_INTEGRATION, 0, 0);
+    }
 
-    profileContents += mProfile->interfaceStateCountString()
-                       + mProfile->implementationStateCountString();
+    to.mNeeds = from.mNeeds;
+}
 
-    profileContents += mProfile->interfaceVariableCountString()
-                       + mProfile->implementationVariableCountString();
+std::string Generator::GeneratorImpl::identityKey(const ComponentPtr &component)
+{
+    // Return the identity of the given component, i.e. its name, which is
+    // unique within a valid model.
 
-    profileContents += mProfile->variableTypeObjectString();
+    return component->name();
+}
 
-    profileContents += mProfile->constantVariableTypeString()
-                       + mProfile->computedConstantVariableTypeString()
-                       + mProfile->algebraicVariableTypeString();
+std::string Generator::GeneratorImpl::identityKey(const VariablePtr &variable)
+{
+    // Return the identity of the given variable, i.e. its name and the name of
+    // its component, which are unique within a valid model.
 
-    profileContents += mProfile->variableInfoObjectString()
-                       + mProfile->variableInfoWithTypeObjectString();
+    return identityKey(std::dynamic_pointer_cast<Component>(variable->parent())) + "." + variable->name();
+}
 
-    profileContents += mProfile->interfaceVoiInfoString()
-                       + mProfile->implementationVoiInfoString();
+bool Generator::GeneratorImpl::restoreCachedAnalysis(const std::string &hash,
+                                                     const std::vector<ComponentPtr> &components,
+                                                     const std::vector<VariablePtr> &variables)
+{
+    // Look for a cached analysis with the given hash and, if there is one,
+    // re-attach a copy of it to the model with the given components and
+    // variables, mapping the placeholders of the cached analysis to them using
+    // their identity.
 
-    profileContents += mProfile->interfaceStateInfoString()
-                       + mProfile->implementationStateInfoString();
+    auto cachedAnalysis = std::find_if(mAnalysisCache.begin(), mAnalysisCache.end(), [&hash](const GeneratorAnalysisPtr &analysis) {
+        return analysis->mHash == hash;
+    });
 
-    profileContents += mProfile->interfaceVariableInfoString()
-                       + mProfile->implementationVariableInfoString();
+    if (cachedAnalysis == mAnalysisCache.end()) {
+        return false;
+    }
 
-    profileContents += mProfile->variableInfoEntryString()
-                       + mProfile->variableInfoWithTypeEntryString();
+    auto analysis = *cachedAnalysis;
+    std::map<VariablePtr, VariablePtr> variableMap;
+    std::map<ComponentPtr, ComponentPtr> componentMap;
 
-    profileContents += mProfile->voiString();
+    for (const auto &variable : variables) {
+        auto placeholder = analysis->mVariables.find(identityKey(variable));
 
-    profileContents += mProfile->statesArrayString()
-                       + mProfile->ratesArrayString()
-                       + mProfile->variablesArrayString();
+        if (placeholder != analysis->mVariables.end()) {
+            variableMap[placeholder->second] = variable;
+        }
+    }
 
-    profileContents += mProfile->interfaceCreateStatesArrayMethodString()
-                       + mProfile->implementationCreateStatesArrayMethodString();
+    for (const auto &component : components) {
+        auto placeholder = analysis->mComponents.find(identityKey(component));
 
-    profileContents += mProfile->interfaceCreateVariablesArrayMethodString()
-                       + mProfile->implementationCreateVariablesArrayMethodString();
+        if (placeholder != analysis->mComponents.end()) {
+            componentMap[placeholder->second] = component;
+        }
+    }
 
-    profileContents += mProfile->interfaceDeleteArrayMethodString()
-                       + mProfile->implementationDeleteArrayMethodString();
+    // Our model has the same structure as the one of the cached analysis, so
+    // all the placeholders should have been mapped, but we can only use the
+    // cached analysis if that is really the case.
 
-    profileContents += mProfile->interfaceInitializeStatesAndConstantsMethodString()
-                       + mProfile->implementationInitializeStatesAndConstantsMethodString();
+    if ((variableMap.size() != analysis->mVariables.size())
+        || (componentMap.size() != analysis->mComponents.size())) {
+        return false;
+    }
 
-    profileContents += mProfile->interfaceComputeComputedConstantsMethodString()
-                       + mProfile->implementationComputeComputedConstantsMethodString();
+    mAnalysisCache.erase(cachedAnalysis);
+    mAnalysisCache.push_front(analysis);
 
-    profileContents += mProfile->interfaceComputeRatesMethodString()
-                       + mProfile->implementationComputeRatesMethodString();
+    GeneratorAnalysis restoredAnalysis;
 
-    profileContents += mProfile->interfaceComputeVariablesMethodString()
-                       + mProfile->implementationComputeVariablesMethodString();
+    copyAnalysis(*analysis, restoredAnalysis, variableMap, componentMap);
 
-    profileContents += mProfile->emptyMethodString();
+    mModelType = restoredAnalysis.mModelType;
 
-    profileContents += mProfile->indentString();
+    mInternalVariables = restoredAnalysis.mInternalVariables;
+    mInternalVariableCache.clear();
+    mEquations = restoredAnalysis.mEquations;
+    mResets = restoredAnalysis.mResets;
 
-    profileContents += mProfile->openArrayInitializerString()
-                       + mProfile->closeArrayInitializerString();
+    mVoi = restoredAnalysis.mVoi;
 
-    profileContents += mProfile->openArrayString()
-                       + mProfile->closeArrayString();
+    auto needs = GeneratorImpl::needs();
 
-    profileContents += mProfile->arrayElementSeparatorString();
+    for (size_t i = 0; i < needs.size(); ++i) {
+        *needs[i] = restoredAnalysis.mNeeds[i];
+    }
 
-    profileContents += mProfile->stringDelimiterString();
+    mGenerator->removeAllIssues();
 
-    profileContents += mProfile->commandSeparatorString();
+    orderVariables();
 
-    // Compute and check the hash of our profile contents.
+    return true;
+}
 
-    bool res = false;
-    std::string profileContentsSha1 = sha1(profileContents);
+void Generator::GeneratorImpl::cacheAnalysis(const std::string &hash,
+                                             const std::vector<ComponentPtr> &components,
+                                             const std::vector<VariablePtr> &variables)
+{
+    // Cache a copy of our current analysis that uses placeholders for the given
+    // components and variables, removing the least recently used analysis from
+    // our cache if it is full. The copy is allocated from its own arena, so
+    // that it doesn't keep the arena of our current analysis alive.
 
-    switch (mProfile->profile()) {
-    case GeneratorProfile::Profile::C:
-        res = profileContentsSha1 != "e2aa9af2767ab84b217cf996c491c485ae876563";
+    auto analysis = std::make_shared<GeneratorAnalysis>();
+    std::map<VariablePtr, VariablePtr> variableMap;
+    std::map<ComponentPtr, ComponentPtr> componentMap;
 
-        break;
-    case GeneratorProfile::Profile::PYTHON:
-        res = profileContentsSha1 != "1abb41ecb908526b51c2ac8c44bc9542942a9652";
+    for (const auto &variable : variables) {
+        auto placeholder = Variable::create(variable->name());
 
-        break;
+        analysis->mVariables[identityKey(variable)] = placeholder;
+        variableMap[variable] = placeholder;
     }
 
-    return res;
-}
+    for (const auto &component : components) {
+        auto placeholder = Component::create(component->name());
 
-void Generator::GeneratorImpl::addOriginCommentCode(std::string &code)
-{
-    if (!mProfile->commentString().empty()
-        && !mProfile->originCommentString().empty()) {
-        std::string profileInformation = modifiedProfile() ?
-                                             "a modified " :
-                                             "the ";
+        analysis->mComponents[identityKey(component)] = placeholder;
+        componentMap[component] = placeholder;
+    }
 
-        switch (mProfile->profile()) {
-        case GeneratorProfile::Profile::C:
-            profileInformation += "C";
+    // We can only cache our analysis if our components and variables can all
+    // be identified.
 
-            break;
-        case GeneratorProfile::Profile::PYTHON:
-            profileInformation += "Python";
+    if ((analysis->mVariables.size() != variables.size())
+        || (analysis->mComponents.size() != components.size())) {
+        return;
+    }
 
-            break;
-        }
+    GeneratorAnalysis currentAnalysis;
 
-        profileInformation += " profile of";
+    currentAnalysis.mModelType = mModelType;
+    currentAnalysis.mInternalVariables = mInternalVariables;
+    currentAnalysis.mEquations = mEquations;
+    currentAnalysis.mResets = mResets;
+    currentAnalysis.mVoi = mVoi;
+
+    for (const auto &need : needs()) {
+        currentAnalysis.mNeeds.push_back(*need);
+    }
+
+    GeneratorAstArenaScope astArenaScope(std::make_shared<GeneratorAstArena>());
 
-        std::string commentCode = replace(replace(mProfile->originCommentString(),
-                                                  "<PROFILE_INFORMATION>", profileInformation),
-                                          "<LIBCELLML_VERSION>", versionString());
+    copyAnalysis(currentAnalysis, *analysis, variableMap, componentMap);
 
-        code += replace(mProfile->commentString(),
-                        "<CODE>", commentCode);
+    analysis->mHash = hash;
+
+    mAnalysisCache.push_front(analysis);
+
+    while (mAnalysisCache.size() > mAnalysisCacheSize) {
+        mAnalysisCache.pop_back();
     }
 }
 
-void Generator::GeneratorImpl::addInterfaceHeaderCode(std::string &code)
+void Generator::GeneratorImpl::processModel(const ModelPtr &model)
 {
-    if (!mProfile->interfaceHeaderString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
+    // Allocate the ASTs of our equations from a new arena, which will get
+    // freed once we get reset.
+
+    GeneratorAstArenaScope astArenaScope(std::make_shared<GeneratorAstArena>());
+
+    // Analyse the given model, unless we have a cached analysis for a model
+    // with the same structure, in which case we use it instead.
+
+    if (mAnalysisCacheSize == 0) {
+        analyseModel(model);
+    } else {
+        std::vector<ComponentPtr> components;
+        std::vector<VariablePtr> variables;
+        auto hash = modelHash(model, components, variables);
+
+        if (!restoreCachedAnalysis(hash, components, variables)) {
+            analyseModel(model);
+
+            if (hasValidModel() && (mGenerator->issueCount() == 0)) {
+                cacheAnalysis(hash, components, variables);
+            }
         }
+    }
 
-        code += mProfile->interfaceHeaderString();
+    // Check the required outputs that were added before our model got
+    // processed.
+
+    if (hasValidModel()) {
+        for (const auto &requiredOutput : mRequiredOutputs) {
+            checkRequiredOutput(requiredOutput);
+        }
     }
 }
 
-void Generator::GeneratorImpl::addImplementationHeaderCode(std::string &code)
+void Generator::GeneratorImpl::scheduleEquation(const GeneratorInternalEquationPtr &equation,
+                                                std::vector<GeneratorInternalEquationPtr> &scheduledEquations)
 {
-    if (!mProfile->implementationHeaderString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
+    // Schedule the given equation, after the equations on which it depends, in
+    // the same way as addEquations() does, skipping the equations that
+    // compute constants since they are not computed alongside it.
+
+    for (const auto &dependency : equation->mDependencies) {
+        if ((dependency->mType == GeneratorInternalEquation::Type::RATE)
+            || (dependency->mType == GeneratorInternalEquation::Type::ALGEBRAIC)) {
+            scheduleEquation(dependency, scheduledEquations);
         }
+    }
 
-        code += replace(mProfile->implementationHeaderString(),
-                        "<INTERFACE_FILE_NAME>", mProfile->interfaceFileNameString());
+    if (std::find(scheduledEquations.begin(), scheduledEquations.end(), equation) == scheduledEquations.end()) {
+        scheduledEquations.push_back(equation);
     }
 }
 
-void Generator::GeneratorImpl::addVersionAndLibcellmlVersionCode(std::string &code,
-                                                                 bool interface)
+void Generator::GeneratorImpl::addVariablesByFirstUse(const GeneratorEquationAstPtr &ast,
+                                                      std::vector<GeneratorInternalVariablePtr> &variables)
 {
-    std::string versionAndLibcellmlCode;
+    // Add the states and variables used in the given AST, in the order in which
+    // they are used.
 
-    if ((interface && !mProfile->interfaceVersionString().empty())
-        || (!interface && !mProfile->implementationVersionString().empty())) {
-        if (interface) {
-            versionAndLibcellmlCode += mProfile->interfaceVersionString();
-        } else {
-            if (modifiedProfile()) {
-                std::regex regEx("([0-9]+\\.[0-9]+\\.[0-9]+)");
+    if (ast == nullptr) {
+        return;
+    }
 
-                versionAndLibcellmlCode += std::regex_replace(mProfile->implementationVersionString(), regEx, "$1.post0");
-            } else {
-                versionAndLibcellmlCode += mProfile->implementationVersionString();
-            }
+    if (ast->mType == GeneratorEquationAst::Type::CI) {
+        GeneratorInternalVariablePtr internalVariable = generatorVariable(ast->mVariable);
+
+        if ((internalVariable->mType != GeneratorInternalVariable::Type::VARIABLE_OF_INTEGRATION)
+            && (std::find(variables.begin(), variables.end(), internalVariable) == variables.end())) {
+            variables.push_back(internalVariable);
         }
     }
 
-    if ((interface && !mProfile->interfaceLibcellmlVersionString().empty())
-        || (!interface && !mProfile->implementationLibcellmlVersionString().empty())) {
-        versionAndLibcellmlCode += interface ?
-                                       mProfile->interfaceLibcellmlVersionString() :
-                                       replace(mProfile->implementationLibcellmlVersionString(),
-                                               "<LIBCELLML_VERSION>", versionString());
-    }
-
-    if (!versionAndLibcellmlCode.empty()) {
-        code += "\n";
-    }
-
-    code += versionAndLibcellmlCode;
+    addVariablesByFirstUse(ast->mLeft, variables);
+    addVariablesByFirstUse(ast->mRight, variables);
 }
 
-void Generator::GeneratorImpl::addStateAndVariableCountCode(std::string &code,
-                                                            bool interface)
+void Generator::GeneratorImpl::orderVariables()
 {
-    std::string stateAndVariableCountCode;
+    // Determine the order in which our states and variables are to be stored,
+    // starting from their default order.
 
-    if ((interface && !mProfile->interfaceStateCountString().empty())
-        || (!interface && !mProfile->implementationStateCountString().empty())) {
-        stateAndVariableCountCode += interface ?
-                                         mProfile->interfaceStateCountString() :
-                                         replace(mProfile->implementationStateCountString(),
-                                                 "<STATE_COUNT>", std::to_string(mStates.size()));
-    }
+    std::vector<GeneratorInternalVariablePtr> orderedVariables;
 
-    if ((interface && !mProfile->interfaceVariableCountString().empty())
-        || (!interface && !mProfile->implementationVariableCountString().empty())) {
-        stateAndVariableCountCode += interface ?
-                                         mProfile->interfaceVariableCountString() :
-                                         replace(mProfile->implementationVariableCountString(),
-                                                 "<VARIABLE_COUNT>", std::to_string(mVariables.size()));
-    }
+    if (mVariableOrdering != Generator::VariableOrdering::DEFAULT) {
+        // Order our states and variables by first use in our method to compute
+        // the rates or, for an algebraic model, to compute the variables.
 
-    if (!stateAndVariableCountCode.empty()) {
-        code += "\n";
-    }
+        std::vector<GeneratorInternalEquationPtr> scheduledEquations;
 
-    code += stateAndVariableCountCode;
-}
+        for (const auto &equation : mEquations) {
+            if (equation->mType == GeneratorInternalEquation::Type::RATE) {
+                scheduleEquation(equation, scheduledEquations);
+            }
+        }
 
-void Generator::GeneratorImpl::addVariableTypeObjectCode(std::string &code)
-{
-    if (!mProfile->variableTypeObjectString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
+        if (scheduledEquations.empty()) {
+            for (const auto &equation : mEquations) {
+                if (equation->mType == GeneratorInternalEquation::Type::ALGEBRAIC) {
+                    scheduleEquation(equation, scheduledEquations);
+                }
+            }
         }
 
-        code += mProfile->variableTypeObjectString();
-    }
-}
+        for (const auto &equation : scheduledEquations) {
+            addVariablesByFirstUse(equation->mAst, orderedVariables);
+        }
 
-std::string Generator::GeneratorImpl::generateVariableInfoObjectCode(const std::string &objectString)
-{
-    size_t componentSize = 0;
-    size_t nameSize = 0;
-    size_t unitsSize = 0;
+        // Group our states and variables by component, should we have been
+        // asked to do so, with our components ordered by first use.
 
-    if (mVoi != nullptr) {
-        updateVariableInfoSizes(componentSize, nameSize, unitsSize, mVoi);
-    }
+        if (mVariableOrdering == Generator::VariableOrdering::FIRST_USE_BY_COMPONENT) {
+            std::vector<ComponentPtr> components;
 
-    for (const auto &state : mStates) {
-        updateVariableInfoSizes(componentSize, nameSize, unitsSize, state);
-    }
+            for (const auto &orderedVariable : orderedVariables) {
+                if (std::find(components.begin(), components.end(), orderedVariable->mComponent) == components.end()) {
+                    components.push_back(orderedVariable->mComponent);
+                }
+            }
 
-    for (const auto &variable : mVariables) {
-        updateVariableInfoSizes(componentSize, nameSize, unitsSize, variable);
+            std::stable_sort(orderedVariables.begin(), orderedVariables.end(), [&components](const GeneratorInternalVariablePtr &variable1, const GeneratorInternalVariablePtr &variable2) {
+                return std::find(components.begin(), components.end(), variable1->mComponent)
+                       < std::find(components.begin(), components.end(), variable2->mComponent);
+            });
+        }
     }
 
-    return replace(replace(replace(objectString,
-                                   "<COMPONENT_SIZE>", std::to_string(componentSize)),
-                           "<NAME_SIZE>", std::to_string(nameSize)),
-                   "<UNITS_SIZE>", std::to_string(unitsSize));
-}
+    // Our states and variables that are not used come last, in their default
+    // order.
 
-void Generator::GeneratorImpl::addVariableInfoObjectCode(std::string &code)
-{
-    if (!mProfile->variableInfoObjectString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
+    for (const auto &internalVariable : mInternalVariables) {
+        if ((internalVariable->mType != GeneratorInternalVariable::Type::VARIABLE_OF_INTEGRATION)
+            && (std::find(orderedVariables.begin(), orderedVariables.end(), internalVariable) == orderedVariables.end())) {
+            orderedVariables.push_back(internalVariable);
         }
-
-        code += generateVariableInfoObjectCode(mProfile->variableInfoObjectString());
     }
-}
 
-void Generator::GeneratorImpl::addVariableInfoWithTypeObjectCode(std::string &code)
-{
-    if (!mProfile->variableInfoWithTypeObjectString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
+    // Assign the index of our states and variables, and make them available
+    // through our API. Our equations will need to be made available again
+    // since they refer to our states and variables.
+
+    mStates.clear();
+    mVariables.clear();
+    mGeneratorEquations.clear();
+
+    for (const auto &internalVariable : orderedVariables) {
+        GeneratorVariable::Type type;
+
+        if (internalVariable->mType == GeneratorInternalVariable::Type::STATE) {
+            type = GeneratorVariable::Type::STATE;
+        } else if (internalVariable->mType == GeneratorInternalVariable::Type::CONSTANT) {
+            type = GeneratorVariable::Type::CONSTANT;
+        } else if ((internalVariable->mType == GeneratorInternalVariable::Type::COMPUTED_TRUE_CONSTANT)
+                   || (internalVariable->mType == GeneratorInternalVariable::Type::COMPUTED_VARIABLE_BASED_CONSTANT)) {
+            type = GeneratorVariable::Type::COMPUTED_CONSTANT;
+        } else {
+            type = GeneratorVariable::Type::ALGEBRAIC;
         }
 
-        code += generateVariableInfoObjectCode(mProfile->variableInfoWithTypeObjectString());
-    }
-}
+        GeneratorVariablePtr stateOrVariable = GeneratorVariable::create();
 
-std::string Generator::GeneratorImpl::generateVariableInfoEntryCode(const std::string &name,
-                                                                    const std::string &units,
-                                                                    const std::string &component)
-{
-    return replace(replace(replace(mProfile->variableInfoEntryString(),
-                                   "<NAME>", name),
-                           "<UNITS>", units),
-                   "<COMPONENT>", component);
-}
+        if (mVariableOrdering == Generator::VariableOrdering::DEFAULT) {
+            internalVariable->mIndex = internalVariable->mDefaultIndex;
+        } else {
+            internalVariable->mIndex = (type == GeneratorVariable::Type::STATE) ?
+                                           mStates.size() :
+                                           mVariables.size();
+        }
 
-void Generator::GeneratorImpl::addInterfaceVoiStateAndVariableInfoCode(std::string &code)
-{
-    std::string interfaceVoiStateAndVariableInfoCode;
+        stateOrVariable->mPimpl->populate(internalVariable->mVariable,
+                                          internalVariable->mComponent,
+                                          type, internalVariable->mIndex,
+                                          internalVariable->mDefaultIndex);
 
-    if (!mProfile->interfaceVoiInfoString().empty()) {
-        interfaceVoiStateAndVariableInfoCode += mProfile->interfaceVoiInfoString();
+        if (type == GeneratorVariable::Type::STATE) {
+            mStates.push_back(stateOrVariable);
+        } else {
+            mVariables.push_back(stateOrVariable);
+        }
     }
+}
 
-    if (!mProfile->interfaceStateInfoString().empty()) {
-        interfaceVoiStateAndVariableInfoCode += mProfile->interfaceStateInfoString();
-    }
+void Generator::GeneratorImpl::addScheduledEquation(const GeneratorInternalEquationPtr &equation,
+                                                    GeneratorEquationSet &remainingEquations,
+                                                    std::vector<GeneratorInternalEquationPtr> &scheduledEquations)
+{
+    // Schedule the given equation, if it hasn't already been scheduled, after
+    // the equations on which it depends.
 
-    if (!mProfile->interfaceVariableInfoString().empty()) {
-        interfaceVoiStateAndVariableInfoCode += mProfile->interfaceVariableInfoString();
+    if (!remainingEquations.erase(equation)) {
+        return;
     }
 
-    if (!interfaceVoiStateAndVariableInfoCode.empty()) {
-        code += "\n";
+    for (const auto &dependency : equation->mDependencies) {
+        addScheduledEquation(dependency, remainingEquations, scheduledEquations);
     }
 
-    code += interfaceVoiStateAndVariableInfoCode;
+    scheduledEquations.push_back(equation);
 }
 
-void Generator::GeneratorImpl::addImplementationVoiInfoCode(std::string &code)
+GeneratorVariablePtr Generator::GeneratorImpl::apiVariable(const VariablePtr &variable,
+                                                           const std::map<VariablePtr, GeneratorVariablePtr> &apiVariables)
 {
-    if (!mProfile->implementationVoiInfoString().empty()
-        && !mProfile->variableInfoEntryString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    // Return the state or variable, as made available through our API, that
+    // corresponds to the given variable.
 
-        std::string name = (mVoi != nullptr) ? mVoi->variable()->name() : "";
-        std::string units = (mVoi != nullptr) ? mVoi->variable()->units()->name() : "";
-        std::string component = (mVoi != nullptr) ? mVoi->component()->name() : "";
+    auto internalVariable = generatorVariable(variable);
 
-        code += replace(mProfile->implementationVoiInfoString(),
-                        "<CODE>", generateVariableInfoEntryCode(name, units, component));
+    if (internalVariable->mType == GeneratorInternalVariable::Type::VARIABLE_OF_INTEGRATION) {
+        return mVoi;
     }
-}
-
-void Generator::GeneratorImpl::addImplementationStateInfoCode(std::string &code)
-{
-    if (!mProfile->implementationStateInfoString().empty()
-        && !mProfile->variableInfoEntryString().empty()
-        && !mProfile->arrayElementSeparatorString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
-
-        std::string infoElementsCode;
-
-        for (const auto &state : mStates) {
-            if (!infoElementsCode.empty()) {
-                infoElementsCode += mProfile->arrayElementSeparatorString() + "\n";
-            }
-
-            infoElementsCode += mProfile->indentString()
-                                + generateVariableInfoEntryCode(state->variable()->name(),
-                                                                state->variable()->units()->name(),
-                                                                state->component()->name());
-        }
 
-        if (!infoElementsCode.empty()) {
-            infoElementsCode += "\n";
-        }
+    auto res = apiVariables.find(internalVariable->mVariable);
 
-        code += replace(mProfile->implementationStateInfoString(),
-                        "<CODE>", infoElementsCode);
-    }
+    return (res != apiVariables.end()) ? res->second : nullptr;
 }
 
-void Generator::GeneratorImpl::addImplementationVariableInfoCode(std::string &code)
+void Generator::GeneratorImpl::addApiVariables(const GeneratorEquationAstPtr &ast,
+                                              const std::map<VariablePtr, GeneratorVariablePtr> &apiVariables,
+                                              GeneratorApiVariables &astApiVariables)
 {
-    if (!mProfile->implementationVariableInfoString().empty()
-        && !mProfile->variableInfoWithTypeEntryString().empty()
-        && !mProfile->arrayElementSeparatorString().empty()
-        && !mProfile->constantVariableTypeString().empty()
-        && !mProfile->computedConstantVariableTypeString().empty()
-        && !mProfile->algebraicVariableTypeString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
-
-        std::string infoElementsCode;
-
-        for (const auto &variable : mVariables) {
-            if (!infoElementsCode.empty()) {
-                infoElementsCode += mProfile->arrayElementSeparatorString() + "\n";
-            }
-
-            std::string variableType;
-
-            if (variable->type() == GeneratorVariable::Type::CONSTANT) {
-                variableType = mProfile->constantVariableTypeString();
-            } else if (variable->type() == GeneratorVariable::Type::COMPUTED_CONSTANT) {
-                variableType = mProfile->computedConstantVariableTypeString();
-            } else if (variable->type() == GeneratorVariable::Type::ALGEBRAIC) {
-                variableType = mProfile->algebraicVariableTypeString();
-            }
-
-            infoElementsCode += mProfile->indentString()
-                                + replace(replace(replace(replace(mProfile->variableInfoWithTypeEntryString(),
-                                                                  "<NAME>", variable->variable()->name()),
-                                                          "<UNITS>", variable->variable()->units()->name()),
-                                                  "<COMPONENT>", variable->component()->name()),
-                                          "<TYPE>", variableType);
-        }
+    // Map the variables used in the given AST to the states or variables, as
+    // made available through our API, to which they correspond.
 
-        if (!infoElementsCode.empty()) {
-            infoElementsCode += "\n";
-        }
+    if (ast == nullptr) {
+        return;
+    }
 
-        code += replace(mProfile->implementationVariableInfoString(),
-                        "<CODE>", infoElementsCode);
+    if ((ast->mType == GeneratorEquationAst::Type::CI)
+        && (astApiVariables.find(ast->mVariable) == astApiVariables.end())) {
+        astApiVariables[ast->mVariable] = apiVariable(ast->mVariable, apiVariables);
     }
+
+    addApiVariables(ast->mLeft, apiVariables, astApiVariables);
+    addApiVariables(ast->mRight, apiVariables, astApiVariables);
 }
 
-void Generator::GeneratorImpl::addArithmeticFunctionsCode(std::string &code)
+const std::vector<GeneratorEquationPtr> &Generator::GeneratorImpl::apiEquations()
 {
-    if (mNeedEq && !mProfile->hasEqOperator()
-        && !mProfile->eqFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    // Make our equations available through our API, if we haven't already
+    // done so. Our equations are scheduled in the same way as in our generated
+    // code, i.e. an equation always comes after the equations on which it
+    // depends.
 
-        code += mProfile->eqFunctionString();
+    if (!mGeneratorEquations.empty() || mEquations.empty()) {
+        return mGeneratorEquations;
     }
 
-    if (mNeedNeq && !mProfile->hasNeqOperator()
-        && !mProfile->neqFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    std::map<VariablePtr, GeneratorVariablePtr> apiVariables;
 
-        code += mProfile->neqFunctionString();
+    for (const auto &state : mStates) {
+        apiVariables[state->variable()] = state;
     }
 
-    if (mNeedLt && !mProfile->hasLtOperator()
-        && !mProfile->ltFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
-
-        code += mProfile->ltFunctionString();
+    for (const auto &variable : mVariables) {
+        apiVariables[variable->variable()] = variable;
     }
 
-    if (mNeedLeq && !mProfile->hasLeqOperator()
-        && !mProfile->leqFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    GeneratorEquationSet remainingEquations(mEquations.size());
+    std::vector<GeneratorInternalEquationPtr> scheduledEquations;
 
-        code += mProfile->leqFunctionString();
+    for (const auto &equation : mEquations) {
+        remainingEquations.insert(equation);
     }
 
-    if (mNeedGt && !mProfile->hasGtOperator()
-        && !mProfile->gtFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
-
-        code += mProfile->gtFunctionString();
+    for (const auto &equation : mEquations) {
+        addScheduledEquation(equation, remainingEquations, scheduledEquations);
     }
 
-    if (mNeedGeq && !mProfile->hasGeqOperator()
-        && !mProfile->geqFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
-
-        code += mProfile->geqFunctionString();
-    }
+    // Our equations only wrap our ASTs, which means that the variables used in
+    // our ASTs need to be mapped to their API counterpart now, i.e. while we
+    // can still tell which variables are equivalent.
 
-    if (mNeedAnd && !mProfile->hasAndOperator()
-        && !mProfile->andFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    GeneratorApiVariables astApiVariables;
 
-        code += mProfile->andFunctionString();
+    for (const auto &equation : scheduledEquations) {
+        addApiVariables(equation->mAst, apiVariables, astApiVariables);
     }
 
-    if (mNeedOr && !mProfile->hasOrOperator()
-        && !mProfile->orFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    auto sharedAstApiVariables = std::make_shared<const GeneratorApiVariables>(std::move(astApiVariables));
+    std::map<GeneratorInternalEquationPtr, GeneratorEquationPtr> apiEquations;
 
-        code += mProfile->orFunctionString();
-    }
+    for (const auto &equation : scheduledEquations) {
+        auto apiEquation = GeneratorEquation::create();
 
-    if (mNeedXor && !mProfile->hasXorOperator()
-        && !mProfile->xorFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+        apiEquations[equation] = apiEquation;
 
-        code += mProfile->xorFunctionString();
+        mGeneratorEquations.push_back(apiEquation);
     }
 
-    if (mNeedNot && !mProfile->hasNotOperator()
-        && !mProfile->notFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
-
-        code += mProfile->notFunctionString();
-    }
+    for (const auto &equation : scheduledEquations) {
+        GeneratorEquation::Type type;
 
-    if (mNeedMin
-        && !mProfile->minFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
+        if (equation->mType == GeneratorInternalEquation::Type::TRUE_CONSTANT) {
+            type = GeneratorEquation::Type::TRUE_CONSTANT;
+        } else if (equation->mType == GeneratorInternalEquation::Type::VARIABLE_BASED_CONSTANT) {
+            type = GeneratorEquation::Type::VARIABLE_BASED_CONSTANT;
+        } else if (equation->mType == GeneratorInternalEquation::Type::RATE) {
+            type = GeneratorEquation::Type::RATE;
+        } else {
+            type = GeneratorEquation::Type::ALGEBRAIC;
         }
 
-        code += mProfile->minFunctionString();
-    }
+        std::vector<GeneratorEquationPtr> dependencies;
 
-    if (mNeedMax
-        && !mProfile->maxFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
+        for (const auto &dependency : equation->mDependencies) {
+            dependencies.push_back(apiEquations[dependency]);
         }
 
-        code += mProfile->maxFunctionString();
+        apiEquations[equation]->mPimpl->populate(type,
+                                                 GeneratorAst::GeneratorAstImpl::wrap(equation->mAst,
+                                                                                      sharedAstApiVariables,
+                                                                                      nullptr),
+                                                 (equation->mVariable != nullptr) ?
+                                                     apiVariable(equation->mVariable->mVariable, apiVariables) :
+                                                     nullptr,
+                                                 equation->mComponent, dependencies,
+                                                 equation->mIsStateRateBased);
     }
+
+    return mGeneratorEquations;
 }
 
-void Generator::GeneratorImpl::addTrigonometricFunctionsCode(std::string &code)
+bool Generator::GeneratorImpl::isRelationalOperator(const GeneratorEquationAstPtr &ast) const
 {
-    if (mNeedSec
-        && !mProfile->secFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    return ((ast->mType == GeneratorEquationAst::Type::EQ)
+            && mProfile->hasEqOperator())
+           || ((ast->mType == GeneratorEquationAst::Type::NEQ)
+               && mProfile->hasNeqOperator())
+           || ((ast->mType == GeneratorEquationAst::Type::LT)
+               && mProfile->hasLtOperator())
+           || ((ast->mType == GeneratorEquationAst::Type::LEQ)
+               && mProfile->hasLeqOperator())
+           || ((ast->mType == GeneratorEquationAst::Type::GT)
+               && mProfile->hasGtOperator())
+           || ((ast->mType == GeneratorEquationAst::Type::GEQ)
+               && mProfile->hasGeqOperator());
+}
 
-        code += mProfile->secFunctionString();
-    }
+bool Generator::GeneratorImpl::isAndOperator(const GeneratorEquationAstPtr &ast) const
+{
+    return (ast->mType == GeneratorEquationAst::Type::AND)
+           && mProfile->hasAndOperator();
+}
 
-    if (mNeedCsc
-        && !mProfile->cscFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+bool Generator::GeneratorImpl::isOrOperator(const GeneratorEquationAstPtr &ast) const
+{
+    return (ast->mType == GeneratorEquationAst::Type::OR)
+           && mProfile->hasOrOperator();
+}
 
-        code += mProfile->cscFunctionString();
-    }
+bool Generator::GeneratorImpl::isXorOperator(const GeneratorEquationAstPtr &ast) const
+{
+    return (ast->mType == GeneratorEquationAst::Type::XOR)
+           && mProfile->hasXorOperator();
+}
 
-    if (mNeedCot
-        && !mProfile->cotFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+bool Generator::GeneratorImpl::isLogicalOperator(const GeneratorEquationAstPtr &ast) const
+{
+    // Note: GeneratorEquationAst::Type::NOT is a unary logical operator, hence
+    //       we don't include it here since this method is only used to
+    //       determine whether parentheses should be added around some code.
 
-        code += mProfile->cotFunctionString();
-    }
+    return isAndOperator(ast) || isOrOperator(ast) || isXorOperator(ast);
+}
 
-    if (mNeedSech
-        && !mProfile->sechFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+bool Generator::GeneratorImpl::isPlusOperator(const GeneratorEquationAstPtr &ast) const
+{
+    return ast->mType == GeneratorEquationAst::Type::PLUS;
+}
 
-        code += mProfile->sechFunctionString();
-    }
+bool Generator::GeneratorImpl::isMinusOperator(const GeneratorEquationAstPtr &ast) const
+{
+    return ast->mType == GeneratorEquationAst::Type::MINUS;
+}
 
-    if (mNeedCsch
-        && !mProfile->cschFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+bool Generator::GeneratorImpl::isTimesOperator(const GeneratorEquationAstPtr &ast) const
+{
+    return ast->mType == GeneratorEquationAst::Type::TIMES;
+}
 
-        code += mProfile->cschFunctionString();
-    }
+bool Generator::GeneratorImpl::isDivideOperator(const GeneratorEquationAstPtr &ast) const
+{
+    return ast->mType == GeneratorEquationAst::Type::DIVIDE;
+}
 
-    if (mNeedCoth
-        && !mProfile->cothFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+bool Generator::GeneratorImpl::isPowerOperator(const GeneratorEquationAstPtr &ast) const
+{
+    return (ast->mType == GeneratorEquationAst::Type::POWER)
+           && mProfile->hasPowerOperator();
+}
 
-        code += mProfile->cothFunctionString();
-    }
+bool Generator::GeneratorImpl::isRootOperator(const GeneratorEquationAstPtr &ast) const
+{
+    return (ast->mType == GeneratorEquationAst::Type::ROOT)
+           && mProfile->hasPowerOperator();
+}
 
-    if (mNeedAsec
-        && !mProfile->asecFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+bool Generator::GeneratorImpl::isPiecewiseStatement(const GeneratorEquationAstPtr &ast) const
+{
+    return (ast->mType == GeneratorEquationAst::Type::PIECEWISE)
+           && mProfile->hasConditionalOperator()
+           && !useBranchlessPiecewise();
+}
 
-        code += mProfile->asecFunctionString();
-    }
+bool Generator::GeneratorImpl::useBranchlessPiecewise() const
+{
+    return mProfile->hasBranchlessPiecewise()
+           && !mProfile->branchlessPiecewiseIfString().empty()
+           && !mProfile->branchlessPiecewiseElseString().empty();
+}
 
-    if (mNeedAcsc
-        && !mProfile->acscFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+bool Generator::GeneratorImpl::useJacobian() const
+{
+    // The Jacobian of the rates with respect to the states only makes sense
+    // for an ODE model.
 
-        code += mProfile->acscFunctionString();
-    }
+    return mProfile->hasJacobian()
+           && (mModelType == Generator::ModelType::ODE);
+}
 
-    if (mNeedAcot
-        && !mProfile->acotFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+static std::string convertToShortestString(double value)
+{
+    // Return the shortest string that, once converted back to a double, gives
+    // us the given value.
 
-        code += mProfile->acotFunctionString();
-    }
+    std::string res;
 
-    if (mNeedAsech
-        && !mProfile->asechFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    for (int precision = std::numeric_limits<double>::digits10;
+         precision <= std::numeric_limits<double>::max_digits10; ++precision) {
+        std::ostringstream strs;
+        double checkValue;
 
-        code += mProfile->asechFunctionString();
-    }
+        strs << std::setprecision(precision) << value;
 
-    if (mNeedAcsch
-        && !mProfile->acschFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+        res = strs.str();
 
-        code += mProfile->acschFunctionString();
+        if (convertToDouble(res, checkValue) && (checkValue == value)) {
+            break;
+        }
     }
 
-    if (mNeedAcoth
-        && !mProfile->acothFunctionString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    return res;
+}
 
-        code += mProfile->acothFunctionString();
+GeneratorEquationAstPtr Generator::GeneratorImpl::copyAst(const GeneratorEquationAstPtr &ast,
+                                                          const GeneratorEquationAstPtr &parent) const
+{
+    // Make a deep copy of the given AST.
+
+    if (ast == nullptr) {
+        return nullptr;
     }
+
+    GeneratorEquationAstPtr res = createAst(ast->mType, *ast->mValue, parent);
+
+    res->mVariable = ast->mVariable;
+    res->mLeft = copyAst(ast->mLeft, res);
+    res->mRight = copyAst(ast->mRight, res);
+
+    return res;
 }
 
-void Generator::GeneratorImpl::addInterfaceCreateDeleteArrayMethodsCode(std::string &code)
+GeneratorEquationAstPtr Generator::GeneratorImpl::newAst(GeneratorEquationAst::Type type,
+                                                         const GeneratorEquationAstPtr &left,
+                                                         const GeneratorEquationAstPtr &right) const
 {
-    std::string interfaceCreateDeleteArraysCode;
+    // Create a new AST with the given children, making sure that they now
+    // consider the new AST as their parent.
 
-    if (!mProfile->interfaceCreateStatesArrayMethodString().empty()) {
-        interfaceCreateDeleteArraysCode += mProfile->interfaceCreateStatesArrayMethodString();
-    }
+    GeneratorEquationAstPtr res = createAst(type, nullptr);
 
-    if (!mProfile->interfaceCreateVariablesArrayMethodString().empty()) {
-        interfaceCreateDeleteArraysCode += mProfile->interfaceCreateVariablesArrayMethodString();
-    }
+    res->mLeft = left;
+    res->mRight = right;
 
-    if (!mProfile->interfaceDeleteArrayMethodString().empty()) {
-        interfaceCreateDeleteArraysCode += mProfile->interfaceDeleteArrayMethodString();
+    if (left != nullptr) {
+        left->mParent = res.get();
     }
 
-    if (!interfaceCreateDeleteArraysCode.empty()) {
-        code += "\n";
+    if (right != nullptr) {
+        right->mParent = res.get();
     }
 
-    code += interfaceCreateDeleteArraysCode;
+    return res;
 }
 
-void Generator::GeneratorImpl::addImplementationCreateStatesArrayMethodCode(std::string &code)
+GeneratorEquationAstPtr Generator::GeneratorImpl::newConstantAst(double value) const
 {
-    if (!mProfile->implementationCreateStatesArrayMethodString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    // Create an AST for the given value. A negative value is represented using
+    // a unary minus operator, so that it can safely be used as the right
+    // operand of any operator.
 
-        code += mProfile->implementationCreateStatesArrayMethodString();
-    }
+    GeneratorEquationAstPtr res = createAst(GeneratorEquationAst::Type::CN,
+                                            convertToShortestString(std::fabs(value)),
+                                            nullptr);
+
+    return std::signbit(value) ?
+               newAst(GeneratorEquationAst::Type::MINUS, res) :
+               res;
 }
 
-void Generator::GeneratorImpl::addImplementationCreateVariablesArrayMethodCode(std::string &code)
+bool Generator::GeneratorImpl::isConstantAst(const GeneratorEquationAstPtr &ast,
+                                             double &value) const
 {
-    if (!mProfile->implementationCreateVariablesArrayMethodString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
+    // Check whether the given AST is a constant and, if so, retrieve its value.
+
+    switch (ast->mType) {
+    case GeneratorEquationAst::Type::CN:
+        return convertToDouble(*ast->mValue, value);
+    case GeneratorEquationAst::Type::TRUE_VALUE:
+        value = 1.0;
+
+        return true;
+    case GeneratorEquationAst::Type::FALSE_VALUE:
+        value = 0.0;
+
+        return true;
+    case GeneratorEquationAst::Type::E:
+        value = std::exp(1.0);
+
+        return true;
+    case GeneratorEquationAst::Type::PI:
+        value = std::acos(-1.0);
+
+        return true;
+    case GeneratorEquationAst::Type::MINUS:
+        if (isUnaryMinusAst(ast)
+            && (ast->mLeft->mType == GeneratorEquationAst::Type::CN)
+            && convertToDouble(*ast->mLeft->mValue, value)) {
+            value = -value;
+
+            return true;
         }
 
-        code += mProfile->implementationCreateVariablesArrayMethodString();
+        return false;
+    default:
+        return false;
     }
 }
 
-void Generator::GeneratorImpl::addImplementationDeleteArrayMethodCode(std::string &code)
+bool Generator::GeneratorImpl::isConstantValueAst(const GeneratorEquationAstPtr &ast,
+                                                  double value) const
 {
-    if (!mProfile->implementationDeleteArrayMethodString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    // Check whether the given AST is the given constant.
 
-        code += mProfile->implementationDeleteArrayMethodString();
-    }
+    double astValue;
+
+    return isConstantAst(ast, astValue) && (astValue == value);
 }
 
-std::string Generator::GeneratorImpl::generateMethodBodyCode(const std::string &methodBody)
+bool Generator::GeneratorImpl::isUnaryMinusAst(const GeneratorEquationAstPtr &ast) const
 {
-    return methodBody.empty() ?
-               mProfile->emptyMethodString().empty() ?
-               "" :
-               mProfile->indentString() + mProfile->emptyMethodString() :
-               methodBody;
+    return (ast->mType == GeneratorEquationAst::Type::MINUS)
+           && (ast->mRight == nullptr);
 }
 
-std::string Generator::GeneratorImpl::generateDoubleCode(const std::string &value)
+GeneratorEquationAstPtr Generator::GeneratorImpl::qualifierValueAst(const GeneratorEquationAstPtr &ast) const
 {
-    if (value.find('.') != std::string::npos) {
-        return value;
-    }
+    // Return the value of the given qualifier, i.e. the degree of a root or the
+    // base of a logarithm, which may or may not be wrapped in a qualifier
+    // element.
+
+    return ((ast->mType == GeneratorEquationAst::Type::DEGREE)
+            || (ast->mType == GeneratorEquationAst::Type::LOGBASE)) ?
+               ast->mLeft :
+               ast;
+}
 
-    size_t ePos = value.find('e');
+bool Generator::GeneratorImpl::evaluateAst(const GeneratorEquationAstPtr &ast,
+                                           double &value) const
+{
+    // Evaluate the given AST, if all of its operands are constants.
+
+    double left;
+    double right = 0.0;
+    GeneratorEquationAstPtr leftAst = ast->mLeft;
+    GeneratorEquationAstPtr rightAst = ast->mRight;
+
+    if ((ast->mType == GeneratorEquationAst::Type::ROOT)
+        || (ast->mType == GeneratorEquationAst::Type::LOG)) {
+        // The degree/base of a root/logarithm is, if present, its left child
+        // while its argument is its right child, so swap them to get the same
+        // layout as for other operators.
+
+        if (rightAst != nullptr) {
+            leftAst = ast->mRight;
+            rightAst = qualifierValueAst(ast->mLeft);
+        }
+    }
 
-    if (ePos == std::string::npos) {
-        return value + ".0";
+    if ((leftAst == nullptr) || !isConstantAst(leftAst, left)
+        || ((rightAst != nullptr) && !isConstantAst(rightAst, right))) {
+        return false;
     }
 
-    return value.substr(0, ePos) + ".0" + value.substr(ePos);
-}
+    bool unary = rightAst == nullptr;
 
-std::string Generator::GeneratorImpl::generateVariableNameCode(const VariablePtr &variable, const GeneratorEquationAstPtr &ast)
-{
-    GeneratorInternalVariablePtr generatorVariable = Generator::GeneratorImpl::generatorVariable(variable);
+    switch (ast->mType) {
+        // Relational and logical operators.
 
-    if (generatorVariable->mType == GeneratorInternalVariable::Type::VARIABLE_OF_INTEGRATION) {
-        return mProfile->voiString();
-    }
+    case GeneratorEquationAst::Type::EQ:
+        value = left == right;
 
-    std::string arrayName;
+        break;
+    case GeneratorEquationAst::Type::NEQ:
+        value = left != right;
 
-    if (generatorVariable->mType == GeneratorInternalVariable::Type::STATE) {
-        arrayName = ((ast != nullptr) && (ast->mParent.lock()->mType == GeneratorEquationAst::Type::DIFF)) ?
-                        mProfile->ratesArrayString() :
-                        mProfile->statesArrayString();
-    } else {
-        arrayName = mProfile->variablesArrayString();
-    }
+        break;
+    case GeneratorEquationAst::Type::LT:
+        value = left < right;
 
-    std::ostringstream index;
+        break;
+    case GeneratorEquationAst::Type::LEQ:
+        value = left <= right;
 
-    index << generatorVariable->mIndex;
+        break;
+    case GeneratorEquationAst::Type::GT:
+        value = left > right;
 
-    return arrayName + mProfile->openArrayString() + index.str() + mProfile->closeArrayString();
-}
+        break;
+    case GeneratorEquationAst::Type::GEQ:
+        value = left >= right;
 
-std::string Generator::GeneratorImpl::generateOperatorCode(const std::string &op,
-                                                           const GeneratorEquationAstPtr &ast)
-{
-    // Generate the code for the left and right branches of the given AST.
+        break;
+    case GeneratorEquationAst::Type::AND:
+        value = (left != 0.0) && (right != 0.0);
 
-    std::string left = generateCode(ast->mLeft);
-    std::string right = generateCode(ast->mRight);
+        break;
+    case GeneratorEquationAst::Type::OR:
+        value = (left != 0.0) || (right != 0.0);
+
+        break;
+    case GeneratorEquationAst::Type::XOR:
+        value = (left != 0.0) != (right != 0.0);
+
+        break;
+    case GeneratorEquationAst::Type::NOT:
+        value = left == 0.0;
+
+        break;
+
+        // Arithmetic operators.
+
+    case GeneratorEquationAst::Type::PLUS:
+        value = unary ? left : left + right;
+
+        break;
+    case GeneratorEquationAst::Type::MINUS:
+        value = unary ? -left : left - right;
+
+        break;
+    case GeneratorEquationAst::Type::TIMES:
+        value = left * right;
+
+        break;
+    case GeneratorEquationAst::Type::DIVIDE:
+        value = left / right;
+
+        break;
+    case GeneratorEquationAst::Type::POWER:
+        value = std::pow(left, right);
+
+        break;
+    case GeneratorEquationAst::Type::ROOT:
+        value = unary ? std::sqrt(left) : std::pow(left, 1.0 / right);
+
+        break;
+    case GeneratorEquationAst::Type::ABS:
+        value = std::fabs(left);
+
+        break;
+    case GeneratorEquationAst::Type::EXP:
+        value = std::exp(left);
+
+        break;
+    case GeneratorEquationAst::Type::LN:
+        value = std::log(left);
+
+        break;
+    case GeneratorEquationAst::Type::LOG:
+        value = unary ? std::log10(left) : std::log(left) / std::log(right);
+
+        break;
+    case GeneratorEquationAst::Type::CEILING:
+        value = std::ceil(left);
+
+        break;
+    case GeneratorEquationAst::Type::FLOOR:
+        value = std::floor(left);
+
+        break;
+    case GeneratorEquationAst::Type::MIN:
+        value = (left < right) ? left : right;
+
+        break;
+    case GeneratorEquationAst::Type::MAX:
+        value = (left > right) ? left : right;
+
+        break;
+    case GeneratorEquationAst::Type::REM:
+        value = std::fmod(left, right);
+
+        break;
+
+        // Trigonometric operators.
+
+    case GeneratorEquationAst::Type::SIN:
+        value = std::sin(left);
+
+        break;
+    case GeneratorEquationAst::Type::COS:
+        value = std::cos(left);
+
+        break;
+    case GeneratorEquationAst::Type::TAN:
+        value = std::tan(left);
+
+        break;
+    case GeneratorEquationAst::Type::SEC:
+        value = 1.0 / std::cos(left);
+
+        break;
+    case GeneratorEquationAst::Type::CSC:
+        value = 1.0 / std::sin(left);
+
+        break;
+    case GeneratorEquationAst::Type::COT:
+        value = 1.0 / std::tan(left);
+
+        break;
+    case GeneratorEquationAst::Type::SINH:
+        value = std::sinh(left);
+
+        break;
+    case GeneratorEquationAst::Type::COSH:
+        value = std::cosh(left);
+
+        break;
+    case GeneratorEquationAst::Type::TANH:
+        value = std::tanh(left);
+
+        break;
+    case GeneratorEquationAst::Type::SECH:
+        value = 1.0 / std::cosh(left);
+
+        break;
+    case GeneratorEquationAst::Type::CSCH:
+        value = 1.0 / std::sinh(left);
+
+        break;
+    case GeneratorEquationAst::Type::COTH:
+        value = 1.0 / std::tanh(left);
+
+        break;
+    case GeneratorEquationAst::Type::ASIN:
+        value = std::asin(left);
+
+        break;
+    case GeneratorEquationAst::Type::ACOS:
+        value = std::acos(left);
+
+        break;
+    case GeneratorEquationAst::Type::ATAN:
+        value = std::atan(left);
+
+        break;
+    case GeneratorEquationAst::Type::ASEC:
+        value = std::acos(1.0 / left);
+
+        break;
+    case GeneratorEquationAst::Type::ACSC:
+        value = std::asin(1.0 / left);
+
+        break;
+    case GeneratorEquationAst::Type::ACOT:
+        value = std::atan(1.0 / left);
+
+        break;
+    case GeneratorEquationAst::Type::ASINH:
+        value = std::asinh(left);
+
+        break;
+    case GeneratorEquationAst::Type::ACOSH:
+        value = std::acosh(left);
+
+        break;
+    case GeneratorEquationAst::Type::ATANH:
+        value = std::atanh(left);
+
+        break;
+    case GeneratorEquationAst::Type::ASECH:
+        value = std::acosh(1.0 / left);
+
+        break;
+    case GeneratorEquationAst::Type::ACSCH:
+        value = std::asinh(1.0 / left);
+
+        break;
+    case GeneratorEquationAst::Type::ACOTH:
+        value = std::atanh(1.0 / left);
+
+        break;
+    default:
+        return false;
+    }
+
+    // Only fold finite values since there is no portable way to express
+    // infinite or NaN values as numbers.
+
+    return std::isfinite(value);
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::simplifyAst(const GeneratorEquationAstPtr &ast) const
+{
+    // Simplify the given AST, knowing that its children have already been
+    // optimised. Whenever we can simplify the given AST, we try to simplify
+    // the resulting AST, since it may now be simplified further.
+
+    double value;
+
+    if (evaluateAst(ast, value)) {
+        if ((ast->mType >= GeneratorEquationAst::Type::EQ)
+            && (ast->mType <= GeneratorEquationAst::Type::NOT)) {
+            return createAst((value != 0.0) ?
+                                 GeneratorEquationAst::Type::TRUE_VALUE :
+                                 GeneratorEquationAst::Type::FALSE_VALUE,
+                             nullptr);
+        }
+
+        return newConstantAst(value);
+    }
+
+    switch (ast->mType) {
+    case GeneratorEquationAst::Type::PLUS:
+        if (ast->mRight == nullptr) {
+            // +a ==> a
+
+            return ast->mLeft;
+        }
+
+        if (isConstantValueAst(ast->mRight, 0.0)) {
+            // a+0 ==> a
+
+            return ast->mLeft;
+        }
+
+        if (isConstantValueAst(ast->mLeft, 0.0)) {
+            // 0+a ==> a
+
+            return ast->mRight;
+        }
+
+        if (isUnaryMinusAst(ast->mRight)) {
+            // a+(-b) ==> a-b
+
+            return simplifyAst(newAst(GeneratorEquationAst::Type::MINUS, ast->mLeft, ast->mRight->mLeft));
+        }
+
+        if (isUnaryMinusAst(ast->mLeft)) {
+            // (-a)+b ==> b-a
+
+            return simplifyAst(newAst(GeneratorEquationAst::Type::MINUS, ast->mRight, ast->mLeft->mLeft));
+        }
+
+        break;
+    case GeneratorEquationAst::Type::MINUS:
+        if (ast->mRight == nullptr) {
+            if (isUnaryMinusAst(ast->mLeft)) {
+                // -(-a) ==> a
+
+                return ast->mLeft->mLeft;
+            }
+
+            if (ast->mLeft->mType == GeneratorEquationAst::Type::MINUS) {
+                // -(a-b) ==> b-a
+
+                return simplifyAst(newAst(GeneratorEquationAst::Type::MINUS, ast->mLeft->mRight, ast->mLeft->mLeft));
+            }
+
+            break;
+        }
+
+        if (isConstantValueAst(ast->mRight, 0.0)) {
+            // a-0 ==> a
+
+            return ast->mLeft;
+        }
+
+        if (isConstantValueAst(ast->mLeft, 0.0)) {
+            // 0-a ==> -a
+
+            return simplifyAst(newAst(GeneratorEquationAst::Type::MINUS, ast->mRight));
+        }
+
+        if (isUnaryMinusAst(ast->mRight)) {
+            // a-(-b) ==> a+b
+
+            return simplifyAst(newAst(GeneratorEquationAst::Type::PLUS, ast->mLeft, ast->mRight->mLeft));
+        }
+
+        break;
+    case GeneratorEquationAst::Type::TIMES:
+    case GeneratorEquationAst::Type::DIVIDE:
+        if (isConstantValueAst(ast->mRight, 1.0)) {
+            // a*1 ==> a
+            // a/1 ==> a
+
+            return ast->mLeft;
+        }
+
+        if ((ast->mType == GeneratorEquationAst::Type::TIMES)
+            && isConstantValueAst(ast->mLeft, 1.0)) {
+            // 1*a ==> a
+
+            return ast->mRight;
+        }
+
+        if (isUnaryMinusAst(ast->mLeft) && isUnaryMinusAst(ast->mRight)) {
+            // (-a)*(-b) ==> a*b
+            // (-a)/(-b) ==> a/b
+
+            return simplifyAst(newAst(ast->mType, ast->mLeft->mLeft, ast->mRight->mLeft));
+        }
+
+        break;
+    case GeneratorEquationAst::Type::POWER:
+        if (isConstantAst(ast->mRight, value)) {
+            if (value == 1.0) {
+                // a^1 ==> a
+
+                return ast->mLeft;
+            }
+
+            if (value == 0.0) {
+                // a^0 ==> 1
+
+                return newConstantAst(1.0);
+            }
+
+            // Replace a^n with a*a*...*a, and a^-n with 1/(a*a*...*a), if n is
+            // a small integer and a a variable (so that we don't duplicate the
+            // computation of a sub-expression).
+
+            static const double MAX_POWER_EXPONENT = 4.0;
+
+            double exponent = std::fabs(value);
+
+            if ((ast->mLeft->mType == GeneratorEquationAst::Type::CI)
+                && (exponent <= MAX_POWER_EXPONENT)
+                && (std::floor(exponent) == exponent)) {
+                GeneratorEquationAstPtr res = ast->mLeft;
+
+                for (int i = 1; i < int(exponent); ++i) {
+                    res = newAst(GeneratorEquationAst::Type::TIMES, res, copyAst(ast->mLeft, nullptr));
+                }
+
+                return (value < 0.0) ?
+                           newAst(GeneratorEquationAst::Type::DIVIDE, newConstantAst(1.0), res) :
+                           res;
+            }
+        }
+
+        break;
+    case GeneratorEquationAst::Type::ROOT:
+        if ((ast->mRight != nullptr) && isConstantAst(qualifierValueAst(ast->mLeft), value)) {
+            // root(a, n) ==> a^(1/n), which means that root(a, 2) will
+            // eventually be generated as sqrt(a).
+
+            return simplifyAst(newAst(GeneratorEquationAst::Type::POWER, ast->mRight, newConstantAst(1.0 / value)));
+        }
+
+        break;
+    case GeneratorEquationAst::Type::PIECEWISE:
+        if ((ast->mLeft->mType == GeneratorEquationAst::Type::PIECE)
+            && isConstantAst(ast->mLeft->mRight, value)) {
+            // Our first piece has a constant condition, so either it's the
+            // value of our piecewise statement or it can be discarded.
+
+            if (value != 0.0) {
+                return ast->mLeft->mLeft;
+            }
+
+            if (ast->mRight == nullptr) {
+                return createAst(GeneratorEquationAst::Type::NAN_VALUE, nullptr);
+            }
+
+            if (ast->mRight->mType == GeneratorEquationAst::Type::PIECE) {
+                return simplifyAst(newAst(GeneratorEquationAst::Type::PIECEWISE, ast->mRight));
+            }
+
+            if (ast->mRight->mType == GeneratorEquationAst::Type::OTHERWISE) {
+                return ast->mRight->mLeft;
+            }
+
+            return ast->mRight;
+        }
+
+        break;
+    default:
+        break;
+    }
+
+    return ast;
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::optimizeAst(const GeneratorEquationAstPtr &ast) const
+{
+    // Optimise the children of the given AST before trying to simplify the
+    // given AST itself.
+
+    if (ast->mLeft != nullptr) {
+        ast->mLeft = optimizeAst(ast->mLeft);
+        ast->mLeft->mParent = ast.get();
+    }
+
+    if (ast->mRight != nullptr) {
+        ast->mRight = optimizeAst(ast->mRight);
+        ast->mRight->mParent = ast.get();
+    }
+
+    return simplifyAst(ast);
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::optimizedEquationAst(const GeneratorInternalEquationPtr &equation) const
+{
+    // Return an optimised copy of the AST of the given equation. Only the
+    // right hand side of the equation gets optimised since its left hand side
+    // is the variable (or rate) that is computed by the equation.
+
+    GeneratorEquationAstPtr res = copyAst(equation->mAst, nullptr);
+
+    res->mRight = optimizeAst(res->mRight);
+    res->mRight->mParent = res.get();
+
+    return res;
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::jacobianValueAst(const GeneratorEquationAstPtr &ast)
+{
+    // Make a deep copy of the given AST, replacing any rate with the right hand
+    // side of its rate equation since rates are not available when computing
+    // the Jacobian.
+
+    if (ast->mType == GeneratorEquationAst::Type::DIFF) {
+        return jacobianValueAst(generatorVariable(ast->mRight->mVariable)->mEquation.lock()->mAst->mRight);
+    }
+
+    GeneratorEquationAstPtr res = createAst(ast->mType, *ast->mValue, nullptr);
+
+    res->mVariable = ast->mVariable;
+
+    if (ast->mLeft != nullptr) {
+        res->mLeft = jacobianValueAst(ast->mLeft);
+        res->mLeft->mParent = res.get();
+    }
+
+    if (ast->mRight != nullptr) {
+        res->mRight = jacobianValueAst(ast->mRight);
+        res->mRight->mParent = res.get();
+    }
+
+    return res;
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::plusAst(const GeneratorEquationAstPtr &left,
+                                                          const GeneratorEquationAstPtr &right) const
+{
+    // Create an AST for the sum of the given ASTs, with a null AST standing for
+    // zero.
+
+    if (left == nullptr) {
+        return right;
+    }
+
+    if (right == nullptr) {
+        return left;
+    }
+
+    if (isUnaryMinusAst(right)) {
+        return minusAst(left, right->mLeft);
+    }
+
+    if (isUnaryMinusAst(left)) {
+        return minusAst(right, left->mLeft);
+    }
+
+    return newAst(GeneratorEquationAst::Type::PLUS, left, right);
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::minusAst(const GeneratorEquationAstPtr &left,
+                                                           const GeneratorEquationAstPtr &right) const
+{
+    // Create an AST for the difference of the given ASTs or, if there is no
+    // right AST, for the negation of the left AST, with a null AST standing for
+    // zero.
+
+    if (right == nullptr) {
+        return left;
+    }
+
+    if (left == nullptr) {
+        return isUnaryMinusAst(right) ?
+                   right->mLeft :
+                   newAst(GeneratorEquationAst::Type::MINUS, right);
+    }
+
+    if (isUnaryMinusAst(right)) {
+        return plusAst(left, right->mLeft);
+    }
+
+    if (isUnaryMinusAst(left)) {
+        return minusAst(nullptr, plusAst(left->mLeft, right));
+    }
+
+    return newAst(GeneratorEquationAst::Type::MINUS, left, right);
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::timesAst(const GeneratorEquationAstPtr &left,
+                                                           const GeneratorEquationAstPtr &right) const
+{
+    // Create an AST for the product of the given ASTs, with a null AST standing
+    // for zero.
+
+    if ((left == nullptr) || (right == nullptr)) {
+        return nullptr;
+    }
+
+    if (isConstantValueAst(left, 1.0)) {
+        return right;
+    }
+
+    if (isConstantValueAst(right, 1.0)) {
+        return left;
+    }
+
+    if (isUnaryMinusAst(left)) {
+        return minusAst(nullptr, timesAst(left->mLeft, right));
+    }
+
+    if (isUnaryMinusAst(right)) {
+        return minusAst(nullptr, timesAst(left, right->mLeft));
+    }
+
+    if ((right->mType == GeneratorEquationAst::Type::DIVIDE)
+        && isConstantValueAst(right->mLeft, 1.0)) {
+        return divideAst(left, right->mRight);
+    }
+
+    return newAst(GeneratorEquationAst::Type::TIMES, left, right);
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::divideAst(const GeneratorEquationAstPtr &left,
+                                                            const GeneratorEquationAstPtr &right) const
+{
+    // Create an AST for the quotient of the given ASTs, with a null (left) AST
+    // standing for zero.
+
+    if (left == nullptr) {
+        return nullptr;
+    }
+
+    if (isConstantValueAst(right, 1.0)) {
+        return left;
+    }
+
+    if (isUnaryMinusAst(left)) {
+        return minusAst(nullptr, divideAst(left->mLeft, right));
+    }
+
+    if (isUnaryMinusAst(right)) {
+        return minusAst(nullptr, divideAst(left, right->mLeft));
+    }
+
+    return newAst(GeneratorEquationAst::Type::DIVIDE, left, right);
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::zeroIfNullAst(const GeneratorEquationAstPtr &ast) const
+{
+    return (ast == nullptr) ? newConstantAst(0.0) : ast;
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::piecewiseAst(const GeneratorEquationAstPtr &value,
+                                                               const GeneratorEquationAstPtr &condition,
+                                                               const GeneratorEquationAstPtr &otherwise) const
+{
+    return newAst(GeneratorEquationAst::Type::PIECEWISE,
+                  newAst(GeneratorEquationAst::Type::PIECE, zeroIfNullAst(value), condition),
+                  newAst(GeneratorEquationAst::Type::OTHERWISE, zeroIfNullAst(otherwise)));
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::squareAst(const GeneratorEquationAstPtr &ast)
+{
+    return newAst(GeneratorEquationAst::Type::TIMES, jacobianValueAst(ast), jacobianValueAst(ast));
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::differentiatePiecewiseAst(const GeneratorEquationAstPtr &ast,
+                                                                            const GeneratorInternalVariablePtr &state,
+                                                                            bool &nonZero)
+{
+    // Differentiate the value of each piece of the given piecewise statement,
+    // keeping track of whether at least one of them is non-zero.
+
+    if (ast->mType == GeneratorEquationAst::Type::PIECEWISE) {
+        return newAst(GeneratorEquationAst::Type::PIECEWISE,
+                      differentiatePiecewiseAst(ast->mLeft, state, nonZero),
+                      (ast->mRight != nullptr) ?
+                          differentiatePiecewiseAst(ast->mRight, state, nonZero) :
+                          nullptr);
+    }
+
+    GeneratorEquationAstPtr value = differentiateAst(ast->mLeft, state);
+
+    nonZero = nonZero || (value != nullptr);
+
+    return newAst(ast->mType, zeroIfNullAst(value),
+                  (ast->mType == GeneratorEquationAst::Type::PIECE) ?
+                      jacobianValueAst(ast->mRight) :
+                      nullptr);
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::differentiateAst(const GeneratorEquationAstPtr &ast,
+                                                                   const GeneratorInternalVariablePtr &state)
+{
+    // Symbolically differentiate the given AST with respect to the given state
+    // (or constant). A null AST is returned if the derivative is (structurally)
+    // zero.
+
+    switch (ast->mType) {
+        // Arithmetic operators.
+
+    case GeneratorEquationAst::Type::PLUS:
+        return plusAst(differentiateAst(ast->mLeft, state),
+                       (ast->mRight != nullptr) ?
+                           differentiateAst(ast->mRight, state) :
+                           nullptr);
+    case GeneratorEquationAst::Type::MINUS:
+        if (ast->mRight == nullptr) {
+            return minusAst(nullptr, differentiateAst(ast->mLeft, state));
+        }
+
+        return minusAst(differentiateAst(ast->mLeft, state),
+                        differentiateAst(ast->mRight, state));
+    case GeneratorEquationAst::Type::TIMES:
+        return plusAst(timesAst(differentiateAst(ast->mLeft, state), jacobianValueAst(ast->mRight)),
+                       timesAst(jacobianValueAst(ast->mLeft), differentiateAst(ast->mRight, state)));
+    case GeneratorEquationAst::Type::DIVIDE:
+        return minusAst(divideAst(differentiateAst(ast->mLeft, state), jacobianValueAst(ast->mRight)),
+                        divideAst(timesAst(jacobianValueAst(ast->mLeft), differentiateAst(ast->mRight, state)),
+                                  squareAst(ast->mRight)));
+    case GeneratorEquationAst::Type::POWER: {
+        GeneratorEquationAstPtr baseDerivative = differentiateAst(ast->mLeft, state);
+        GeneratorEquationAstPtr exponentDerivative = differentiateAst(ast->mRight, state);
+
+        if (exponentDerivative == nullptr) {
+            // d(a^b) = b*a^(b-1)*da
+
+            double exponent;
+
+            if (isConstantAst(ast->mRight, exponent)) {
+                return timesAst(timesAst(newConstantAst(exponent),
+                                         (exponent == 2.0) ?
+                                             jacobianValueAst(ast->mLeft) :
+                                             newAst(GeneratorEquationAst::Type::POWER, jacobianValueAst(ast->mLeft),
+                                                    newConstantAst(exponent - 1.0))),
+                                baseDerivative);
+            }
+
+            return timesAst(timesAst(jacobianValueAst(ast->mRight),
+                                     newAst(GeneratorEquationAst::Type::POWER, jacobianValueAst(ast->mLeft),
+                                            newAst(GeneratorEquationAst::Type::MINUS, jacobianValueAst(ast->mRight),
+                                                   newConstantAst(1.0)))),
+                            baseDerivative);
+        }
+
+        // d(a^b) = a^b*(db*ln(a)+b*da/a)
+
+        return timesAst(jacobianValueAst(ast),
+                        plusAst(timesAst(exponentDerivative,
+                                         newAst(GeneratorEquationAst::Type::LN, jacobianValueAst(ast->mLeft))),
+                                divideAst(timesAst(jacobianValueAst(ast->mRight), baseDerivative),
+                                          jacobianValueAst(ast->mLeft))));
+    }
+    case GeneratorEquationAst::Type::ROOT: {
+        if (ast->mRight == nullptr) {
+            // d(sqrt(a)) = da/(2*sqrt(a))
+
+            return divideAst(differentiateAst(ast->mLeft, state),
+                             newAst(GeneratorEquationAst::Type::TIMES, newConstantAst(2.0), jacobianValueAst(ast)));
+        }
+
+        GeneratorEquationAstPtr degree = qualifierValueAst(ast->mLeft);
+
+        if (differentiateAst(degree, state) == nullptr) {
+            // d(a^(1/n)) = da*a^(1/n)/(n*a)
+
+            return divideAst(timesAst(differentiateAst(ast->mRight, state), jacobianValueAst(ast)),
+                             newAst(GeneratorEquationAst::Type::TIMES, jacobianValueAst(degree),
+                                    jacobianValueAst(ast->mRight)));
+        }
+
+        GeneratorEquationAstPtr power = newAst(GeneratorEquationAst::Type::POWER, copyAst(ast->mRight, nullptr),
+                                               newAst(GeneratorEquationAst::Type::DIVIDE, newConstantAst(1.0),
+                                                      copyAst(degree, nullptr)));
+
+        return differentiateAst(power, state);
+    }
+    case GeneratorEquationAst::Type::ABS: {
+        GeneratorEquationAstPtr derivative = differentiateAst(ast->mLeft, state);
+
+        if (derivative == nullptr) {
+            return nullptr;
+        }
+
+        mNeedLt = true;
+        mNeedPiecewise = true;
+
+        return piecewiseAst(minusAst(nullptr, derivative),
+                            newAst(GeneratorEquationAst::Type::LT, jacobianValueAst(ast->mLeft), newConstantAst(0.0)),
+                            differentiateAst(ast->mLeft, state));
+    }
+    case GeneratorEquationAst::Type::EXP:
+        return timesAst(jacobianValueAst(ast), differentiateAst(ast->mLeft, state));
+    case GeneratorEquationAst::Type::LN:
+        return divideAst(differentiateAst(ast->mLeft, state), jacobianValueAst(ast->mLeft));
+    case GeneratorEquationAst::Type::LOG: {
+        // log(a, b) = ln(a)/ln(b), with b = 10 by default.
+
+        GeneratorEquationAstPtr argument = (ast->mRight != nullptr) ? ast->mRight : ast->mLeft;
+        GeneratorEquationAstPtr base = (ast->mRight != nullptr) ?
+                                           copyAst(qualifierValueAst(ast->mLeft), nullptr) :
+                                           newConstantAst(10.0);
+
+        return differentiateAst(newAst(GeneratorEquationAst::Type::DIVIDE,
+                                       newAst(GeneratorEquationAst::Type::LN, copyAst(argument, nullptr)),
+                                       newAst(GeneratorEquationAst::Type::LN, base)),
+                                state);
+    }
+    case GeneratorEquationAst::Type::MIN:
+    case GeneratorEquationAst::Type::MAX: {
+        GeneratorEquationAstPtr leftDerivative = differentiateAst(ast->mLeft, state);
+        GeneratorEquationAstPtr rightDerivative = differentiateAst(ast->mRight, state);
+
+        if ((leftDerivative == nullptr) && (rightDerivative == nullptr)) {
+            return nullptr;
+        }
+
+        mNeedLt = true;
+        mNeedPiecewise = true;
+
+        return piecewiseAst(leftDerivative,
+                            (ast->mType == GeneratorEquationAst::Type::MIN) ?
+                                newAst(GeneratorEquationAst::Type::LT, jacobianValueAst(ast->mLeft), jacobianValueAst(ast->mRight)) :
+                                newAst(GeneratorEquationAst::Type::LT, jacobianValueAst(ast->mRight), jacobianValueAst(ast->mLeft)),
+                            rightDerivative);
+    }
+    case GeneratorEquationAst::Type::REM:
+        // rem(a, b) = a-b*floor(a/b)
+
+        return minusAst(differentiateAst(ast->mLeft, state),
+                        timesAst(differentiateAst(ast->mRight, state),
+                                 newAst(GeneratorEquationAst::Type::FLOOR,
+                                        newAst(GeneratorEquationAst::Type::DIVIDE, jacobianValueAst(ast->mLeft),
+                                               jacobianValueAst(ast->mRight)))));
+
+        // Calculus elements.
+
+    case GeneratorEquationAst::Type::DIFF:
+        return differentiateVariableAst(generatorVariable(ast->mRight->mVariable), state);
+
+        // Trigonometric operators.
+
+    case GeneratorEquationAst::Type::SIN:
+        return timesAst(newAst(GeneratorEquationAst::Type::COS, jacobianValueAst(ast->mLeft)),
+                        differentiateAst(ast->mLeft, state));
+    case GeneratorEquationAst::Type::COS:
+        return minusAst(nullptr,
+                        timesAst(newAst(GeneratorEquationAst::Type::SIN, jacobianValueAst(ast->mLeft)),
+                                 differentiateAst(ast->mLeft, state)));
+    case GeneratorEquationAst::Type::TAN:
+        return divideAst(differentiateAst(ast->mLeft, state),
+                         newAst(GeneratorEquationAst::Type::TIMES,
+                                newAst(GeneratorEquationAst::Type::COS, jacobianValueAst(ast->mLeft)),
+                                newAst(GeneratorEquationAst::Type::COS, jacobianValueAst(ast->mLeft))));
+    case GeneratorEquationAst::Type::SEC:
+    case GeneratorEquationAst::Type::CSC:
+    case GeneratorEquationAst::Type::SECH:
+    case GeneratorEquationAst::Type::CSCH: {
+        // d(1/f(a)) = -f'(a)*da/f(a)^2, with f = cos, sin, cosh or sinh.
+
+        auto function = (ast->mType == GeneratorEquationAst::Type::SEC) ?
+                            GeneratorEquationAst::Type::COS :
+                            (ast->mType == GeneratorEquationAst::Type::CSC) ?
+                            GeneratorEquationAst::Type::SIN :
+                            (ast->mType == GeneratorEquationAst::Type::SECH) ?
+                            GeneratorEquationAst::Type::COSH :
+                            GeneratorEquationAst::Type::SINH;
+        auto functionDerivative = (ast->mType == GeneratorEquationAst::Type::SEC) ?
+                                      GeneratorEquationAst::Type::SIN :
+                                      (ast->mType == GeneratorEquationAst::Type::CSC) ?
+                                      GeneratorEquationAst::Type::COS :
+                                      (ast->mType == GeneratorEquationAst::Type::SECH) ?
+                                      GeneratorEquationAst::Type::SINH :
+                                      GeneratorEquationAst::Type::COSH;
+        GeneratorEquationAstPtr res = divideAst(timesAst(newAst(functionDerivative, jacobianValueAst(ast->mLeft)),
+                                                         differentiateAst(ast->mLeft, state)),
+                                                newAst(GeneratorEquationAst::Type::TIMES,
+                                                       newAst(function, jacobianValueAst(ast->mLeft)),
+                                                       newAst(function, jacobianValueAst(ast->mLeft))));
+
+        return (ast->mType == GeneratorEquationAst::Type::SEC) ?
+                   res :
+                   minusAst(nullptr, res);
+    }
+    case GeneratorEquationAst::Type::COT:
+    case GeneratorEquationAst::Type::COTH: {
+        auto function = (ast->mType == GeneratorEquationAst::Type::COT) ?
+                            GeneratorEquationAst::Type::SIN :
+                            GeneratorEquationAst::Type::SINH;
+
+        return minusAst(nullptr,
+                        divideAst(differentiateAst(ast->mLeft, state),
+                                  newAst(GeneratorEquationAst::Type::TIMES,
+                                         newAst(function, jacobianValueAst(ast->mLeft)),
+                                         newAst(function, jacobianValueAst(ast->mLeft)))));
+    }
+    case GeneratorEquationAst::Type::SINH:
+        return timesAst(newAst(GeneratorEquationAst::Type::COSH, jacobianValueAst(ast->mLeft)),
+                        differentiateAst(ast->mLeft, state));
+    case GeneratorEquationAst::Type::COSH:
+        return timesAst(newAst(GeneratorEquationAst::Type::SINH, jacobianValueAst(ast->mLeft)),
+                        differentiateAst(ast->mLeft, state));
+    case GeneratorEquationAst::Type::TANH:
+        return divideAst(differentiateAst(ast->mLeft, state),
+                         newAst(GeneratorEquationAst::Type::TIMES,
+                                newAst(GeneratorEquationAst::Type::COSH, jacobianValueAst(ast->mLeft)),
+                                newAst(GeneratorEquationAst::Type::COSH, jacobianValueAst(ast->mLeft))));
+    case GeneratorEquationAst::Type::ASIN:
+    case GeneratorEquationAst::Type::ACOS: {
+        // d(asin(a)) = -d(acos(a)) = da/sqrt(1-a^2)
+
+        GeneratorEquationAstPtr res = divideAst(differentiateAst(ast->mLeft, state),
+                                                newAst(GeneratorEquationAst::Type::ROOT,
+                                                       newAst(GeneratorEquationAst::Type::MINUS, newConstantAst(1.0),
+                                                              squareAst(ast->mLeft))));
+
+        return (ast->mType == GeneratorEquationAst::Type::ASIN) ?
+                   res :
+                   minusAst(nullptr, res);
+    }
+    case GeneratorEquationAst::Type::ATAN:
+    case GeneratorEquationAst::Type::ACOT: {
+        // d(atan(a)) = -d(acot(a)) = da/(1+a^2)
+
+        GeneratorEquationAstPtr res = divideAst(differentiateAst(ast->mLeft, state),
+                                                newAst(GeneratorEquationAst::Type::PLUS, newConstantAst(1.0),
+                                                       squareAst(ast->mLeft)));
+
+        return (ast->mType == GeneratorEquationAst::Type::ATAN) ?
+                   res :
+                   minusAst(nullptr, res);
+    }
+    case GeneratorEquationAst::Type::ASEC:
+    case GeneratorEquationAst::Type::ACSC: {
+        // d(asec(a)) = -d(acsc(a)) = da/(|a|*sqrt(a^2-1))
+
+        GeneratorEquationAstPtr res = divideAst(differentiateAst(ast->mLeft, state),
+                                                newAst(GeneratorEquationAst::Type::TIMES,
+                                                       newAst(GeneratorEquationAst::Type::ABS, jacobianValueAst(ast->mLeft)),
+                                                       newAst(GeneratorEquationAst::Type::ROOT,
+                                                              newAst(GeneratorEquationAst::Type::MINUS, squareAst(ast->mLeft),
+                                                                     newConstantAst(1.0)))));
+
+        return (ast->mType == GeneratorEquationAst::Type::ASEC) ?
+                   res :
+                   minusAst(nullptr, res);
+    }
+    case GeneratorEquationAst::Type::ASINH:
+    case GeneratorEquationAst::Type::ACOSH:
+        // d(asinh(a)) = da/sqrt(a^2+1) and d(acosh(a)) = da/sqrt(a^2-1)
+
+        return divideAst(differentiateAst(ast->mLeft, state),
+                         newAst(GeneratorEquationAst::Type::ROOT,
+                                newAst((ast->mType == GeneratorEquationAst::Type::ASINH) ?
+                                           GeneratorEquationAst::Type::PLUS :
+                                           GeneratorEquationAst::Type::MINUS,
+                                       squareAst(ast->mLeft), newConstantAst(1.0))));
+    case GeneratorEquationAst::Type::ATANH:
+    case GeneratorEquationAst::Type::ACOTH:
+        // d(atanh(a)) = d(acoth(a)) = da/(1-a^2)
+
+        return divideAst(differentiateAst(ast->mLeft, state),
+                         newAst(GeneratorEquationAst::Type::MINUS, newConstantAst(1.0),
+                                squareAst(ast->mLeft)));
+    case GeneratorEquationAst::Type::ASECH:
+        // d(asech(a)) = -da/(a*sqrt(1-a^2))
+
+        return minusAst(nullptr,
+                        divideAst(differentiateAst(ast->mLeft, state),
+                                  newAst(GeneratorEquationAst::Type::TIMES, jacobianValueAst(ast->mLeft),
+                                         newAst(GeneratorEquationAst::Type::ROOT,
+                                                newAst(GeneratorEquationAst::Type::MINUS, newConstantAst(1.0),
+                                                       squareAst(ast->mLeft))))));
+    case GeneratorEquationAst::Type::ACSCH:
+        // d(acsch(a)) = -da/(|a|*sqrt(1+a^2))
+
+        return minusAst(nullptr,
+                        divideAst(differentiateAst(ast->mLeft, state),
+                                  newAst(GeneratorEquationAst::Type::TIMES,
+                                         newAst(GeneratorEquationAst::Type::ABS, jacobianValueAst(ast->mLeft)),
+                                         newAst(GeneratorEquationAst::Type::ROOT,
+                                                newAst(GeneratorEquationAst::Type::PLUS, newConstantAst(1.0),
+                                                       squareAst(ast->mLeft))))));
+
+        // Piecewise statement.
+
+    case GeneratorEquationAst::Type::PIECEWISE: {
+        bool nonZero = false;
+        GeneratorEquationAstPtr res = differentiatePiecewiseAst(ast, state, nonZero);
+
+        return nonZero ? res : nullptr;
+    }
+
+        // Token elements.
+
+    case GeneratorEquationAst::Type::CI: {
+        GeneratorInternalVariablePtr variable = generatorVariable(ast->mVariable);
+
+        if (variable == state) {
+            return newConstantAst(1.0);
+        }
+
+        // Note: we may be differentiating with respect to a constant (when
+        //       computing sensitivities), in which case computed constants
+        //       may also depend on it.
+
+        if ((variable->mType == GeneratorInternalVariable::Type::ALGEBRAIC)
+            || (variable->mType == GeneratorInternalVariable::Type::COMPUTED_TRUE_CONSTANT)
+            || (variable->mType == GeneratorInternalVariable::Type::COMPUTED_VARIABLE_BASED_CONSTANT)) {
+            return differentiateVariableAst(variable, state);
+        }
+
+        return nullptr;
+    }
+    default:
+        // Relational and logical operators, as well as rounding functions, are
+        // piecewise constant while constants and qualifiers are, well,
+        // constant.
+
+        return nullptr;
+    }
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::differentiateVariableAst(const GeneratorInternalVariablePtr &variable,
+                                                                           const GeneratorInternalVariablePtr &state)
+{
+    // Differentiate the equation of the given variable (or of the rate of the
+    // given state) with respect to the given state (or constant). A variable
+    // is typically used by several equations, so we memoise its derivative
+    // since differentiating it over and over again would be exponential in the
+    // length of shared chains of dependencies. We return a copy of it since
+    // the optimisation of an AST and the generation of its code rely on each
+    // node of the AST having its own parent.
+
+    auto key = std::make_pair(variable, state);
+    auto derivative = mDerivatives.find(key);
+
+    if (derivative == mDerivatives.end()) {
+        bool needLt = mNeedLt;
+        bool needPiecewise = mNeedPiecewise;
+        GeneratorDerivative newDerivative;
+
+        mNeedLt = false;
+        mNeedPiecewise = false;
+
+        newDerivative.mAst = differentiateAst(variable->mEquation.lock()->mAst->mRight, state);
+        newDerivative.mNeedLt = mNeedLt;
+        newDerivative.mNeedPiecewise = mNeedPiecewise;
+
+        mNeedLt = needLt;
+        mNeedPiecewise = needPiecewise;
+
+        derivative = mDerivatives.emplace(key, newDerivative).first;
+    }
+
+    mNeedLt = mNeedLt || derivative->second.mNeedLt;
+    mNeedPiecewise = mNeedPiecewise || derivative->second.mNeedPiecewise;
+
+    return copyAst(derivative->second.mAst, nullptr);
+}
+
+void Generator::GeneratorImpl::collectAlgebraicVariables(const GeneratorEquationAstPtr &ast,
+                                                         std::vector<GeneratorInternalVariablePtr> &algebraicVariables)
+{
+    // Collect the algebraic variables used in the given AST, skipping any
+    // sensitivity since it is not a variable of our model.
+
+    if ((ast->mType == GeneratorEquationAst::Type::CI)
+        && (std::find(mSensitivities.begin(), mSensitivities.end(), ast->mVariable) == mSensitivities.end())) {
+        GeneratorInternalVariablePtr variable = generatorVariable(ast->mVariable);
+
+        if ((variable->mType == GeneratorInternalVariable::Type::ALGEBRAIC)
+            && (std::find(algebraicVariables.begin(), algebraicVariables.end(), variable) == algebraicVariables.end())) {
+            algebraicVariables.push_back(variable);
+        }
+    }
+
+    if (ast->mLeft != nullptr) {
+        collectAlgebraicVariables(ast->mLeft, algebraicVariables);
+    }
+
+    if (ast->mRight != nullptr) {
+        collectAlgebraicVariables(ast->mRight, algebraicVariables);
+    }
+}
+
+void Generator::GeneratorImpl::computeJacobian()
+{
+    // Compute the non-zero entries of the Jacobian of our rates with respect to
+    // our states, as well as its sparsity pattern, in compressed sparse row
+    // format.
+
+    mJacobianEntries.clear();
+    mJacobianRowPointers.clear();
+    mJacobianColumnIndices.clear();
+
+    std::vector<GeneratorInternalVariablePtr> states(mStates.size());
+
+    for (const auto &internalVariable : mInternalVariables) {
+        if (internalVariable->mType == GeneratorInternalVariable::Type::STATE) {
+            states[internalVariable->mIndex] = internalVariable;
+        }
+    }
+
+    mJacobianRowPointers.push_back(0);
+
+    for (const auto &rowState : states) {
+        GeneratorEquationAstPtr rate = rowState->mEquation.lock()->mAst->mRight;
+
+        for (const auto &columnState : states) {
+            GeneratorEquationAstPtr entry = differentiateAst(rate, columnState);
+
+            if ((entry != nullptr) && mProfile->hasCodeOptimization()) {
+                entry = optimizeAst(entry);
+            }
+
+            if ((entry != nullptr) && !isConstantValueAst(entry, 0.0)) {
+                // Keep track of our entry as the right hand side of an
+                // assignment since the code generation relies on an AST having
+                // a parent.
+
+                mJacobianEntries.push_back(newAst(GeneratorEquationAst::Type::ASSIGNMENT, nullptr, entry));
+                mJacobianColumnIndices.push_back(columnState->mIndex);
+            }
+        }
+
+        mJacobianRowPointers.push_back(mJacobianEntries.size());
+    }
+}
+
+std::vector<GeneratorInternalVariablePtr> Generator::GeneratorImpl::constantVariables(const std::vector<VariablePtr> &variables)
+{
+    // Return the internal variables of the given variables, ignoring any
+    // variable that is not a constant of our model or that has already been
+    // accounted for.
+
+    std::vector<GeneratorInternalVariablePtr> res;
+
+    for (const auto &variable : variables) {
+        for (const auto &internalVariable : mInternalVariables) {
+            if ((internalVariable->mType == GeneratorInternalVariable::Type::CONSTANT)
+                && sameOrEquivalentVariable(variable, internalVariable->mVariable)
+                && (std::find(res.begin(), res.end(), internalVariable) == res.end())) {
+                res.push_back(internalVariable);
+
+                break;
+            }
+        }
+    }
+
+    return res;
+}
+
+void Generator::GeneratorImpl::determineParameterVariables()
+{
+    // Determine the internal variables of our sensitivity and sweep
+    // parameters, both of which only make sense for an ODE model.
+
+    mSensitivityParameterVariables.clear();
+    mSweepParameterVariables.clear();
+
+    if (mModelType != Generator::ModelType::ODE) {
+        return;
+    }
+
+    mSensitivityParameterVariables = constantVariables(mSensitivityParameters);
+    mSweepParameterVariables = constantVariables(mSweepParameters);
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::sensitivityAst(size_t index)
+{
+    // Return an AST for the sensitivity at the given index in the sensitivities
+    // array. Each sensitivity is represented by a dummy variable, which we
+    // recognise when generating the code for a variable name.
+
+    while (mSensitivities.size() <= index) {
+        mSensitivities.push_back(Variable::create());
+    }
+
+    return createAst(GeneratorEquationAst::Type::CI, mSensitivities[index], nullptr);
+}
+
+void Generator::GeneratorImpl::computeSensitivityRates()
+{
+    // Compute the rates of the forward sensitivities of our states with respect
+    // to our sensitivity parameters, i.e. dS/dt = J.S+df/dp, where J is the
+    // Jacobian of our rates with respect to our states, S the sensitivities of
+    // our states and df/dp the derivatives of our rates with respect to our
+    // sensitivity parameters.
+
+    mSensitivityRates.clear();
+
+    std::vector<GeneratorInternalVariablePtr> states(mStates.size());
+
+    for (const auto &internalVariable : mInternalVariables) {
+        if (internalVariable->mType == GeneratorInternalVariable::Type::STATE) {
+            states[internalVariable->mIndex] = internalVariable;
+        }
+    }
+
+    for (size_t k = 0; k < mSensitivityParameterVariables.size(); ++k) {
+        for (const auto &rowState : states) {
+            GeneratorEquationAstPtr rate = rowState->mEquation.lock()->mAst->mRight;
+            GeneratorEquationAstPtr sensitivityRate;
+
+            for (const auto &columnState : states) {
+                GeneratorEquationAstPtr jacobianEntry = differentiateAst(rate, columnState);
+
+                if ((jacobianEntry != nullptr) && mProfile->hasCodeOptimization()) {
+                    jacobianEntry = optimizeAst(jacobianEntry);
+                }
+
+                if ((jacobianEntry != nullptr) && !isConstantValueAst(jacobianEntry, 0.0)) {
+                    sensitivityRate = plusAst(sensitivityRate,
+                                              timesAst(jacobianEntry, sensitivityAst(k * states.size() + columnState->mIndex)));
+                }
+            }
+
+            sensitivityRate = plusAst(sensitivityRate, differentiateAst(rate, mSensitivityParameterVariables[k]));
+
+            if ((sensitivityRate != nullptr) && mProfile->hasCodeOptimization()) {
+                sensitivityRate = optimizeAst(sensitivityRate);
+            }
+
+            // Keep track of our sensitivity rate as the right hand side of an
+            // assignment since the code generation relies on an AST having a
+            // parent.
+
+            mSensitivityRates.push_back(newAst(GeneratorEquationAst::Type::ASSIGNMENT, nullptr, zeroIfNullAst(sensitivityRate)));
+        }
+    }
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::stateAst(const GeneratorInternalVariablePtr &state) const
+{
+    return createAst(GeneratorEquationAst::Type::CI, state->mVariable, nullptr);
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::rateAst(const GeneratorInternalVariablePtr &state) const
+{
+    return newAst(GeneratorEquationAst::Type::DIFF, nullptr, stateAst(state));
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::timeStepAst() const
+{
+    return createAst(GeneratorEquationAst::Type::CI, mTimeStep, nullptr);
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::rushLarsenExponentAst() const
+{
+    return createAst(GeneratorEquationAst::Type::CI, mRushLarsenExponent, nullptr);
+}
+
+bool Generator::GeneratorImpl::dependsOnState(const GeneratorEquationAstPtr &ast,
+                                              const GeneratorInternalVariablePtr &state,
+                                              std::vector<GeneratorInternalVariablePtr> &algebraicVariables)
+{
+    // Determine whether the given AST depends on the given state, either
+    // directly or through the algebraic variables and rates that it uses.
+
+    if (ast->mType == GeneratorEquationAst::Type::DIFF) {
+        return dependsOnState(generatorVariable(ast->mRight->mVariable)->mEquation.lock()->mAst->mRight,
+                              state, algebraicVariables);
+    }
+
+    if ((ast->mType == GeneratorEquationAst::Type::CI) && (ast->mVariable != mTimeStep)) {
+        GeneratorInternalVariablePtr variable = generatorVariable(ast->mVariable);
+
+        if (variable == state) {
+            return true;
+        }
+
+        if ((variable->mType == GeneratorInternalVariable::Type::ALGEBRAIC)
+            && (std::find(algebraicVariables.begin(), algebraicVariables.end(), variable) == algebraicVariables.end())) {
+            algebraicVariables.push_back(variable);
+
+            if (dependsOnState(variable->mEquation.lock()->mAst->mRight, state, algebraicVariables)) {
+                return true;
+            }
+        }
+    }
+
+    return ((ast->mLeft != nullptr) && dependsOnState(ast->mLeft, state, algebraicVariables))
+           || ((ast->mRight != nullptr) && dependsOnState(ast->mRight, state, algebraicVariables));
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::linearCoefficientAst(const GeneratorInternalVariablePtr &state)
+{
+    // Return the coefficient b of the rate equation of the given state if that
+    // equation is linear in the state, i.e. if it is of the form
+    // dy/dt = a+b*y with a and b independent of y, and nullptr otherwise.
+
+    bool needLt = mNeedLt;
+    bool needPiecewise = mNeedPiecewise;
+    GeneratorEquationAstPtr res = differentiateVariableAst(state, state);
+
+    if ((res != nullptr) && mProfile->hasCodeOptimization()) {
+        res = optimizeAst(res);
+    }
+
+    std::vector<GeneratorInternalVariablePtr> algebraicVariables;
+
+    if ((res == nullptr) || isConstantValueAst(res, 0.0)
+        || dependsOnState(res, state, algebraicVariables)) {
+        // The coefficient is not needed, so neither are the functions that it
+        // may have required.
+
+        mNeedLt = needLt;
+        mNeedPiecewise = needPiecewise;
+
+        return nullptr;
+    }
+
+    return res;
+}
+
+void Generator::GeneratorImpl::computeRushLarsenSteps()
+{
+    // Compute the assignments needed for a Rush-Larsen step. The rate of a
+    // state whose rate equation is linear in it, i.e. dy/dt = a+b*y, is first
+    // replaced with the effective rate (dy/dt)*(exp(b*dt)-1)/(b*dt), so that
+    // the state gets updated exactly, assuming that a and b remain constant
+    // over the time step. The exponent b*dt is computed once, in a local
+    // variable. All our states are then updated using forward Euler.
+    // Note: all the effective rates are computed before updating any state
+    //       since b may depend on other states.
+    // Note: (exp(b*dt)-1)/(b*dt) tends to 1 as b*dt tends to 0, but it is NaN
+    //       when b*dt is 0 (e.g. when dt is 0) and it suffers from
+    //       cancellation when b*dt is very small, so we keep the rate as is
+    //       when |b*dt| is below the square root (or so) of the machine epsilon
+    //       of our compute type.
+
+    mRushLarsenSteps.clear();
+
+    double threshold = (mProfile->precision() == GeneratorProfile::Precision::SINGLE) ? 1.0e-3 : 1.0e-8;
+
+    std::vector<GeneratorInternalVariablePtr> states(mStates.size());
+
+    for (const auto &internalVariable : mInternalVariables) {
+        if (internalVariable->mType == GeneratorInternalVariable::Type::STATE) {
+            states[internalVariable->mIndex] = internalVariable;
+        }
+    }
+
+    for (const auto &state : states) {
+        GeneratorEquationAstPtr coefficient = linearCoefficientAst(state);
+
+        if (coefficient != nullptr) {
+            mNeedLt = true;
+            mNeedPiecewise = true;
+
+            mRushLarsenSteps.push_back(newAst(GeneratorEquationAst::Type::ASSIGNMENT,
+                                              rushLarsenExponentAst(),
+                                              timesAst(coefficient, timeStepAst())));
+            mRushLarsenSteps.push_back(newAst(GeneratorEquationAst::Type::ASSIGNMENT,
+                                              rateAst(state),
+                                              piecewiseAst(rateAst(state),
+                                                           newAst(GeneratorEquationAst::Type::LT,
+                                                                  newAst(GeneratorEquationAst::Type::ABS,
+                                                                         rushLarsenExponentAst()),
+                                                                  newConstantAst(threshold)),
+                                                           divideAst(timesAst(rateAst(state),
+                                                                              minusAst(newAst(GeneratorEquationAst::Type::EXP,
+                                                                                              rushLarsenExponentAst()),
+                                                                                       newConstantAst(1.0))),
+                                                                     rushLarsenExponentAst()))));
+        }
+    }
+
+    for (const auto &state : states) {
+        mRushLarsenSteps.push_back(newAst(GeneratorEquationAst::Type::ASSIGNMENT,
+                                          stateAst(state),
+                                          plusAst(stateAst(state),
+                                                  timesAst(timeStepAst(), rateAst(state)))));
+    }
+}
+
+Generator::GeneratorImpl::LookupTableDependency Generator::GeneratorImpl::lookupTableDependency(const GeneratorEquationAstPtr &ast,
+                                                                                                 const GeneratorInternalVariablePtr &state,
+                                                                                                 bool &expensive)
+{
+    // Determine whether the given AST depends only on true constants, on the
+    // given state (and true constants), or on other things, as well as whether
+    // it involves an expensive function. Along the way, keep track of whether
+    // the given AST and its children are worth tabulating.
+    // Note: our lookup table is shared by all the callers of the generated
+    //       code, so it must not depend on anything that a caller can set,
+    //       i.e. on constants or computed constants that are based on
+    //       variables.
+
+    auto res = LookupTableDependency::CONSTANT;
+    bool candidate = true;
+
+    expensive = false;
+
+    switch (ast->mType) {
+    case GeneratorEquationAst::Type::CI: {
+        GeneratorInternalVariablePtr variable = generatorVariable(ast->mVariable);
+
+        if (variable == state) {
+            res = LookupTableDependency::ARGUMENT;
+        } else if (variable->mType != GeneratorInternalVariable::Type::COMPUTED_TRUE_CONSTANT) {
+            res = LookupTableDependency::OTHER;
+        }
+
+        candidate = false;
+
+        break;
+    }
+    case GeneratorEquationAst::Type::DIFF:
+        res = LookupTableDependency::OTHER;
+        candidate = false;
+
+        break;
+    case GeneratorEquationAst::Type::ASSIGNMENT:
+    case GeneratorEquationAst::Type::EQ:
+    case GeneratorEquationAst::Type::NEQ:
+    case GeneratorEquationAst::Type::LT:
+    case GeneratorEquationAst::Type::LEQ:
+    case GeneratorEquationAst::Type::GT:
+    case GeneratorEquationAst::Type::GEQ:
+    case GeneratorEquationAst::Type::AND:
+    case GeneratorEquationAst::Type::OR:
+    case GeneratorEquationAst::Type::XOR:
+    case GeneratorEquationAst::Type::NOT:
+    case GeneratorEquationAst::Type::PIECE:
+    case GeneratorEquationAst::Type::OTHERWISE:
+    case GeneratorEquationAst::Type::CN:
+    case GeneratorEquationAst::Type::DEGREE:
+    case GeneratorEquationAst::Type::LOGBASE:
+    case GeneratorEquationAst::Type::BVAR:
+        // Not an arithmetic expression, so not worth tabulating on its own.
+
+        candidate = false;
+
+        break;
+    case GeneratorEquationAst::Type::POWER:
+    case GeneratorEquationAst::Type::ROOT:
+    case GeneratorEquationAst::Type::EXP:
+    case GeneratorEquationAst::Type::LN:
+    case GeneratorEquationAst::Type::LOG:
+    case GeneratorEquationAst::Type::SIN:
+    case GeneratorEquationAst::Type::COS:
+    case GeneratorEquationAst::Type::TAN:
+    case GeneratorEquationAst::Type::SEC:
+    case GeneratorEquationAst::Type::CSC:
+    case GeneratorEquationAst::Type::COT:
+    case GeneratorEquationAst::Type::SINH:
+    case GeneratorEquationAst::Type::COSH:
+    case GeneratorEquationAst::Type::TANH:
+    case GeneratorEquationAst::Type::SECH:
+    case GeneratorEquationAst::Type::CSCH:
+    case GeneratorEquationAst::Type::COTH:
+    case GeneratorEquationAst::Type::ASIN:
+    case GeneratorEquationAst::Type::ACOS:
+    case GeneratorEquationAst::Type::ATAN:
+    case GeneratorEquationAst::Type::ASEC:
+    case GeneratorEquationAst::Type::ACSC:
+    case GeneratorEquationAst::Type::ACOT:
+    case GeneratorEquationAst::Type::ASINH:
+    case GeneratorEquationAst::Type::ACOSH:
+    case GeneratorEquationAst::Type::ATANH:
+    case GeneratorEquationAst::Type::ASECH:
+    case GeneratorEquationAst::Type::ACSCH:
+    case GeneratorEquationAst::Type::ACOTH:
+        expensive = true;
+
+        break;
+    default:
+        break;
+    }
+
+    if ((ast->mType != GeneratorEquationAst::Type::CI)
+        && (ast->mType != GeneratorEquationAst::Type::DIFF)) {
+        for (const auto &child : {ast->mLeft, ast->mRight}) {
+            if (child != nullptr) {
+                bool childExpensive = false;
+                auto dependency = lookupTableDependency(child, state, childExpensive);
+
+                expensive = expensive || childExpensive;
+
+                if (dependency == LookupTableDependency::OTHER) {
+                    res = LookupTableDependency::OTHER;
+                } else if ((dependency == LookupTableDependency::ARGUMENT)
+                           && (res == LookupTableDependency::CONSTANT)) {
+                    res = LookupTableDependency::ARGUMENT;
+                }
+            }
+        }
+    }
+
+    mLookupTableCandidates[ast.get()] = candidate && (res == LookupTableDependency::ARGUMENT) && expensive;
+
+    return res;
+}
+
+bool Generator::GeneratorImpl::isLookupTableCandidate(const GeneratorEquationAstPtr &ast,
+                                                      const GeneratorInternalVariablePtr &state)
+{
+    // Determine whether the given AST is worth tabulating, i.e. whether it is
+    // an arithmetic expression that involves an expensive function and depends
+    // only on the given state and true constants. The first time that we come
+    // across an AST, we classify it and all of its children, so that we don't
+    // have to walk it again for each of its children.
+
+    if (state != mLookupTableCandidatesState) {
+        mLookupTableCandidatesState = state;
+        mLookupTableCandidates.clear();
+    }
+
+    auto iter = mLookupTableCandidates.find(ast.get());
+
+    if (iter != mLookupTableCandidates.end()) {
+        return iter->second;
+    }
+
+    bool expensive = false;
+
+    lookupTableDependency(ast, state, expensive);
+
+    return mLookupTableCandidates[ast.get()];
+}
+
+void Generator::GeneratorImpl::collectLookupTableCandidates(const GeneratorEquationAstPtr &ast,
+                                                            const GeneratorInternalVariablePtr &state,
+                                                            std::vector<GeneratorEquationAstPtr> &candidates,
+                                                            std::vector<std::string> &candidateCodes)
+{
+    // Collect the largest subexpressions of the given AST that are worth
+    // tabulating, skipping those that we have already collected.
+
+    if (isLookupTableCandidate(ast, state)) {
+        mGeneratingExactCode = true;
+
+        std::string code = generateCode(ast);
+
+        mGeneratingExactCode = false;
+
+        if (std::find(candidateCodes.begin(), candidateCodes.end(), code) == candidateCodes.end()) {
+            candidates.push_back(ast);
+            candidateCodes.push_back(code);
+        }
+
+        return;
+    }
+
+    if (ast->mLeft != nullptr) {
+        collectLookupTableCandidates(ast->mLeft, state, candidates, candidateCodes);
+    }
+
+    if (ast->mRight != nullptr) {
+        collectLookupTableCandidates(ast->mRight, state, candidates, candidateCodes);
+    }
+}
+
+std::vector<GeneratorEquationAstPtr> Generator::GeneratorImpl::lookupTableEquationAsts()
+{
+    // Return the ASTs, as they will be used to generate code, of the equations
+    // that get computed repeatedly, i.e. our rate and algebraic equations.
+
+    std::vector<GeneratorEquationAstPtr> res;
+
+    for (const auto &equation : mEquations) {
+        if ((equation->mType == GeneratorInternalEquation::Type::RATE)
+            || (equation->mType == GeneratorInternalEquation::Type::ALGEBRAIC)) {
+            res.push_back(mProfile->hasCodeOptimization() ?
+                              optimizedEquationAst(equation) :
+                              equation->mAst);
+        }
+    }
+
+    return res;
+}
+
+void Generator::GeneratorImpl::computeLookupTable()
+{
+    // Determine the state to use as the argument of our lookup table, if
+    // needed, and the subexpressions to tabulate.
+
+    mLookupTableState = nullptr;
+    mLookupTableIntervalCount = 0;
+    mLookupTableColumns.clear();
+    mLookupTableColumnCodes.clear();
+    mLookupTableCandidatesState = nullptr;
+    mLookupTableCandidates.clear();
+
+    if (!mHasLookupTable || (mModelType != Generator::ModelType::ODE)
+        || mProfile->implementationLookupTableString().empty()
+        || mProfile->implementationComputeLookupTableMethodString().empty()) {
+        return;
+    }
+
+    auto equationAsts = lookupTableEquationAsts();
+
+    for (const auto &internalVariable : mInternalVariables) {
+        if (internalVariable->mType == GeneratorInternalVariable::Type::STATE) {
+            if (mLookupTableVariable != nullptr) {
+                if (sameOrEquivalentVariable(mLookupTableVariable, internalVariable->mVariable)) {
+                    mLookupTableState = internalVariable;
+
+                    for (const auto &equationAst : equationAsts) {
+                        collectLookupTableCandidates(equationAst, internalVariable, mLookupTableColumns, mLookupTableColumnCodes);
+                    }
+
+                    break;
+                }
+            } else {
+                // Keep the state on which most subexpressions depend.
+
+                std::vector<GeneratorEquationAstPtr> columns;
+                std::vector<std::string> columnCodes;
+
+                for (const auto &equationAst : equationAsts) {
+                    collectLookupTableCandidates(equationAst, internalVariable, columns, columnCodes);
+                }
+
+                if (columns.size() > mLookupTableColumns.size()) {
+                    mLookupTableState = internalVariable;
+                    mLookupTableColumns = columns;
+                    mLookupTableColumnCodes = columnCodes;
+                }
+            }
+        }
+    }
+
+    if (mLookupTableColumns.empty()) {
+        mLookupTableState = nullptr;
+
+        return;
+    }
+
+    // Determine the number of intervals needed to cover the range of our lookup
+    // table, allowing for some rounding errors.
+
+    double intervalCount = (mLookupTableMaximum - mLookupTableMinimum) / mLookupTableStep;
+
+    mLookupTableIntervalCount = static_cast<size_t>(std::ceil(intervalCount * (1.0 - 1.0e-9)));
+
+    // Checking whether a value is within the range of our lookup table may
+    // require some additional functions.
+
+    mNeedLt = true;
+    mNeedGeq = true;
+    mNeedAnd = true;
+}
+
+void Generator::GeneratorImpl::updateProfileCache()
+{
+    // Check whether our profile has been modified since we last cached things
+    // about it, in which case we determine (again) whether it is a modified
+    // official profile and compile (again) the profile strings that we expand
+    // the most. Note: the templates must be compiled in the same order as the
+    // ProfileTemplate values. We keep a weak reference to the profile rather
+    // than its address since a new profile could otherwise be mistaken for an
+    // old one that was allocated at the same address and had the same
+    // revision.
+
+    if ((mCachedProfile.lock() == mProfile) && (mProfile->revision() == mCachedProfileRevision)) {
+        return;
+    }
+
+    mCachedProfile = mProfile;
+    mCachedProfileRevision = mProfile->revision();
+    mModifiedProfile = computeModifiedProfile();
+
+    mProfileTemplates.clear();
+
+    mProfileTemplates.emplace_back(mProfile->commentString(),
+                                   std::initializer_list<const char *> {"<CODE>"});
+    mProfileTemplates.emplace_back(mProfile->variableInfoEntryString(),
+                                   std::initializer_list<const char *> {"<NAME>", "<UNITS>", "<COMPONENT>"});
+    mProfileTemplates.emplace_back(mProfile->variableInfoWithTypeEntryString(),
+                                   std::initializer_list<const char *> {"<NAME>", "<UNITS>", "<COMPONENT>", "<TYPE>"});
+    mProfileTemplates.emplace_back(mProfile->parallelTaskString(),
+                                   std::initializer_list<const char *> {"<CODE>"});
+    mProfileTemplates.emplace_back(mProfile->parallelLevelString(),
+                                   std::initializer_list<const char *> {"<CODE>"});
+    mProfileTemplates.emplace_back(mProfile->batchSweepParameterIndexString(),
+                                   std::initializer_list<const char *> {"<INDEX>"});
+    mProfileTemplates.emplace_back(mProfile->instanceArrayIndexString(),
+                                   std::initializer_list<const char *> {"<INDEX>", "<STRIDE>"});
+    mProfileTemplates.emplace_back(mProfile->batchArrayIndexString(),
+                                   std::initializer_list<const char *> {"<INDEX>"});
+    mProfileTemplates.emplace_back(mProfile->hasConditionalOperator() ?
+                                       mProfile->conditionalOperatorIfString() :
+                                       mProfile->piecewiseIfString(),
+                                   std::initializer_list<const char *> {"<CONDITION>", "<IF_STATEMENT>"});
+    mProfileTemplates.emplace_back(mProfile->hasConditionalOperator() ?
+                                       mProfile->conditionalOperatorElseString() :
+                                       mProfile->piecewiseElseString(),
+                                   std::initializer_list<const char *> {"<ELSE_STATEMENT>"});
+    mProfileTemplates.emplace_back(mProfile->branchlessPiecewiseIfString(),
+                                   std::initializer_list<const char *> {"<CONDITION>", "<IF_STATEMENT>"});
+    mProfileTemplates.emplace_back(mProfile->branchlessPiecewiseElseString(),
+                                   std::initializer_list<const char *> {"<ELSE_STATEMENT>"});
+    mProfileTemplates.emplace_back(mProfile->lookupTableValueString(),
+                                   std::initializer_list<const char *> {"<COLUMN>", "<VALUE>"});
+    mProfileTemplates.emplace_back(mProfile->lookupTableEntryString(),
+                                   std::initializer_list<const char *> {"<COLUMN>"});
+}
+
+const GeneratorTemplate &Generator::GeneratorImpl::profileTemplate(ProfileTemplate profileTemplate)
+{
+    updateProfileCache();
+
+    return mProfileTemplates[static_cast<size_t>(profileTemplate)];
+}
+
+void Generator::GeneratorImpl::updateVariableInfoSizes(size_t &componentSize,
+                                                       size_t &nameSize,
+                                                       size_t &unitsSize,
+                                                       const GeneratorVariablePtr &variable)
+{
+    auto variableComponentSize = variable->component()->name().length() + 1;
+    auto variableNameSize = variable->variable()->name().length() + 1;
+    auto variableUnitsSize = variable->variable()->units()->name().length() + 1;
+    // Note: +1 to account for the end of string termination.
+
+    componentSize = (componentSize > variableComponentSize) ? componentSize : variableComponentSize;
+    nameSize = (nameSize > variableNameSize) ? nameSize : variableNameSize;
+    unitsSize = (unitsSize > variableUnitsSize) ? unitsSize : variableUnitsSize;
+}
+
+bool Generator::GeneratorImpl::computeModifiedProfile() const
+{
+    // Whether the profile requires an interface to be generated.
+
+    const std::string trueValue = "true";
+    const std::string falseValue = "false";
+
+    std::string profileContents = mProfile->hasInterface() ?
+                                      trueValue :
+                                      falseValue;
+
+    // Whether the profile requires the generated code to be optimised.
+
+    profileContents += mProfile->hasCodeOptimization() ?
+                           trueValue :
+                           falseValue;
+
+    // Whether the profile requires the Jacobian to be generated.
+
+    profileContents += mProfile->hasJacobian() ?
+                           trueValue :
+                           falseValue;
+
+    // Whether the profile requires a Rush-Larsen step to be generated.
+
+    profileContents += mProfile->hasRushLarsen() ?
+                           trueValue :
+                           falseValue;
+
+    // Whether the profile requires piecewise statements to be branchless.
+
+    profileContents += mProfile->hasBranchlessPiecewise() ?
+                           trueValue :
+                           falseValue;
+
+    // Assignment.
+
+    profileContents += mProfile->assignmentString();
+
+    // Relational and logical operators.
+
+    profileContents += mProfile->eqString()
+                       + mProfile->neqString()
+                       + mProfile->ltString()
+                       + mProfile->leqString()
+                       + mProfile->gtString()
+                       + mProfile->geqString()
+                       + mProfile->andString()
+                       + mProfile->orString()
+                       + mProfile->xorString()
+                       + mProfile->notString();
+
+    profileContents += (mProfile->hasEqOperator() ?
+                            trueValue :
+                            falseValue)
+                       + (mProfile->hasNeqOperator() ?
+                              trueValue :
+                              falseValue)
+                       + (mProfile->hasLtOperator() ?
+                              trueValue :
+                              falseValue)
+                       + (mProfile->hasLeqOperator() ?
+                              trueValue :
+                              falseValue)
+                       + (mProfile->hasGtOperator() ?
+                              trueValue :
+                              falseValue)
+                       + (mProfile->hasGeqOperator() ?
+                              trueValue :
+                              falseValue)
+                       + (mProfile->hasAndOperator() ?
+                              trueValue :
+                              falseValue)
+                       + (mProfile->hasOrOperator() ?
+                              trueValue :
+                              falseValue)
+                       + (mProfile->hasXorOperator() ?
+                              trueValue :
+                              falseValue)
+                       + (mProfile->hasNotOperator() ?
+                              trueValue :
+                              falseValue);
+
+    // Arithmetic operators.
+
+    profileContents += mProfile->plusString()
+                       + mProfile->minusString()
+                       + mProfile->timesString()
+                       + mProfile->divideString()
+                       + mProfile->powerString()
+                       + mProfile->squareRootString()
+                       + mProfile->squareString()
+                       + mProfile->absoluteValueString()
+                       + mProfile->exponentialString()
+                       + mProfile->napierianLogarithmString()
+                       + mProfile->commonLogarithmString()
+                       + mProfile->ceilingString()
+                       + mProfile->floorString()
+                       + mProfile->minString()
+                       + mProfile->maxString()
+                       + mProfile->remString();
+
+    profileContents += mProfile->hasPowerOperator() ?
+                           trueValue :
+                           falseValue;
+
+    // Trigonometric operators.
+
+    profileContents += mProfile->sinString()
+                       + mProfile->cosString()
+                       + mProfile->tanString()
+                       + mProfile->secString()
+                       + mProfile->cscString()
+                       + mProfile->cotString()
+                       + mProfile->sinhString()
+                       + mProfile->coshString()
+                       + mProfile->tanhString()
+                       + mProfile->sechString()
+                       + mProfile->cschString()
+                       + mProfile->cothString()
+                       + mProfile->asinString()
+                       + mProfile->acosString()
+                       + mProfile->atanString()
+                       + mProfile->asecString()
+                       + mProfile->acscString()
+                       + mProfile->acotString()
+                       + mProfile->asinhString()
+                       + mProfile->acoshString()
+                       + mProfile->atanhString()
+                       + mProfile->asechString()
+                       + mProfile->acschString()
+                       + mProfile->acothString();
+
+    // Piecewise statement.
+
+    profileContents += mProfile->conditionalOperatorIfString()
+                       + mProfile->conditionalOperatorElseString()
+                       + mProfile->branchlessPiecewiseIfString()
+                       + mProfile->branchlessPiecewiseElseString()
+                       + mProfile->piecewiseIfString()
+                       + mProfile->piecewiseElseString();
+
+    profileContents += mProfile->hasConditionalOperator() ?
+                           trueValue :
+                           falseValue;
+
+    // Constants.
+
+    profileContents += mProfile->trueString()
+                       + mProfile->falseString()
+                       + mProfile->eString()
+                       + mProfile->piString()
+                       + mProfile->infString()
+                       + mProfile->nanString();
+
+    profileContents += mProfile->floatingPointLiteralSuffixString();
+
+    // Arithmetic functions.
+
+    profileContents += mProfile->eqFunctionString()
+                       + mProfile->neqFunctionString()
+                       + mProfile->ltFunctionString()
+                       + mProfile->leqFunctionString()
+                       + mProfile->gtFunctionString()
+                       + mProfile->geqFunctionString()
+                       + mProfile->andFunctionString()
+                       + mProfile->orFunctionString()
+                       + mProfile->xorFunctionString()
+                       + mProfile->notFunctionString()
+                       + mProfile->minFunctionString()
+                       + mProfile->maxFunctionString()
+                       + mProfile->blendFunctionString();
+
+    // Trigonometric functions.
+
+    profileContents += mProfile->secFunctionString()
+                       + mProfile->cscFunctionString()
+                       + mProfile->cotFunctionString()
+                       + mProfile->sechFunctionString()
+                       + mProfile->cschFunctionString()
+                       + mProfile->cothFunctionString()
+                       + mProfile->asecFunctionString()
+                       + mProfile->acscFunctionString()
+                       + mProfile->acotFunctionString()
+                       + mProfile->asechFunctionString()
+                       + mProfile->acschFunctionString()
+                       + mProfile->acothFunctionString();
+
+    // Miscellaneous.
+
+    profileContents += mProfile->commentString()
+                       + mProfile->originCommentString();
+
+    // Note: the interface file name is not part of our profile contents since
+    //       it only names the file to which the interface code gets saved, so
+    //       saving some code under another name doesn't make for a modified
+    //       profile.
+
+    profileContents += mProfile->interfaceHeaderString()
+                       + mProfile->implementationHeaderString();
+
+    profileContents += mProfile->interfaceVersionString()
+                       + mProfile->implementationVersionString();
+
+    profileContents += mProfile->interfaceLibcellmlVersionString()
+                       + mProfile->implementationLibcellmlVersionString();
+
+    profileContents += mProfile->interfaceStateCountString()
+                       + mProfile->implementationStateCountString();
+
+    profileContents += mProfile->interfaceVariableCountString()
+                       + mProfile->implementationVariableCountString();
+
+    profileContents += mProfile->variableTypeObjectString();
+
+    profileContents += mProfile->constantVariableTypeString()
+                       + mProfile->computedConstantVariableTypeString()
+                       + mProfile->algebraicVariableTypeString();
+
+    profileContents += mProfile->variableInfoObjectString()
+                       + mProfile->variableInfoWithTypeObjectString();
+
+    profileContents += mProfile->interfaceVoiInfoString()
+                       + mProfile->implementationVoiInfoString();
+
+    profileContents += mProfile->interfaceStateInfoString()
+                       + mProfile->implementationStateInfoString();
+
+    profileContents += mProfile->interfaceVariableInfoString()
+                       + mProfile->implementationVariableInfoString();
+
+    profileContents += mProfile->interfaceJacobianSparsityString()
+                       + mProfile->implementationJacobianSparsityString();
+
+    profileContents += mProfile->emptyJacobianColumnIndicesString();
+
+    profileContents += mProfile->interfaceSensitivityParameterCountString()
+                       + mProfile->implementationSensitivityParameterCountString();
+
+    profileContents += mProfile->interfaceSweepParameterCountString()
+                       + mProfile->implementationSweepParameterCountString();
+
+    profileContents += mProfile->interfaceResetCountString()
+                       + mProfile->implementationResetCountString();
+
+    profileContents += mProfile->variableInfoEntryString()
+                       + mProfile->variableInfoWithTypeEntryString();
+
+    profileContents += mProfile->voiString();
+
+    profileContents += mProfile->timeStepString();
+
+    profileContents += mProfile->statesArrayString()
+                       + mProfile->ratesArrayString()
+                       + mProfile->variablesArrayString();
+
+    profileContents += mProfile->jacobianArrayString();
+
+    profileContents += mProfile->sensitivitiesArrayString()
+                       + mProfile->sensitivityRatesArrayString();
+
+    profileContents += mProfile->sweepParametersArrayString()
+                       + mProfile->batchArrayIndexString()
+                       + mProfile->batchSweepParameterIndexString();
+
+    profileContents += mProfile->instanceArrayIndexString();
+
+    profileContents += mProfile->rootsArrayString()
+                       + mProfile->eventsArrayString()
+                       + mProfile->resetValuesArrayString();
+
+    profileContents += mProfile->interfaceCreateStatesArrayMethodString()
+                       + mProfile->implementationCreateStatesArrayMethodString();
+
+    profileContents += mProfile->interfaceCreateVariablesArrayMethodString()
+                       + mProfile->implementationCreateVariablesArrayMethodString();
+
+    profileContents += mProfile->interfaceDeleteArrayMethodString()
+                       + mProfile->implementationDeleteArrayMethodString();
+
+    profileContents += mProfile->interfaceInitializeStatesAndConstantsMethodString()
+                       + mProfile->implementationInitializeStatesAndConstantsMethodString();
+
+    profileContents += mProfile->interfaceComputeComputedConstantsMethodString()
+                       + mProfile->implementationComputeComputedConstantsMethodString();
+
+    profileContents += mProfile->implementationComputeComputedConstantsMethodChunkString()
+                       + mProfile->computeComputedConstantsMethodChunkCallString();
+
+    profileContents += mProfile->interfaceComputeRatesMethodString()
+                       + mProfile->implementationComputeRatesMethodString();
+
+    profileContents += mProfile->implementationComputeRatesMethodChunkString()
+                       + mProfile->computeRatesMethodChunkCallString();
+
+    profileContents += mProfile->implementationComputeRatesMethodKernelString()
+                       + mProfile->computeRatesMethodKernelCallString();
+
+    profileContents += mProfile->interfaceComputeVariablesMethodString()
+                       + mProfile->implementationComputeVariablesMethodString();
+
+    profileContents += mProfile->implementationComputeVariablesMethodChunkString()
+                       + mProfile->computeVariablesMethodChunkCallString();
+
+    profileContents += mProfile->implementationComputeVariablesMethodKernelString()
+                       + mProfile->computeVariablesMethodKernelCallString();
+
+    profileContents += mProfile->parallelRegionString()
+                       + mProfile->parallelLevelString()
+                       + mProfile->parallelTaskString();
+
+    profileContents += mProfile->interfaceComputeJacobianMethodString()
+                       + mProfile->implementationComputeJacobianMethodString();
+
+    profileContents += mProfile->interfaceComputeRushLarsenStepMethodString()
+                       + mProfile->implementationComputeRushLarsenStepMethodString();
+
+    profileContents += mProfile->rushLarsenExponentString()
+                       + mProfile->implementationRushLarsenExponentString();
+
+    profileContents += mProfile->interfaceComputeSensitivityRatesMethodString()
+                       + mProfile->implementationComputeSensitivityRatesMethodString();
+
+    profileContents += mProfile->interfaceInitializeStatesAndConstantsBatchMethodString()
+                       + mProfile->implementationInitializeStatesAndConstantsBatchMethodString()
+                       + mProfile->interfaceComputeRatesBatchMethodString()
+                       + mProfile->implementationComputeRatesBatchMethodString();
+
+    profileContents += mProfile->interfaceComputeRatesSpecializedMethodString()
+                       + mProfile->implementationComputeRatesSpecializedMethodString()
+                       + mProfile->interfaceComputeVariablesSpecializedMethodString()
+                       + mProfile->implementationComputeVariablesSpecializedMethodString();
+
+    profileContents += mProfile->interfaceComputeRootsMethodString()
+                       + mProfile->implementationComputeRootsMethodString()
+                       + mProfile->interfaceApplyResetsMethodString()
+                       + mProfile->implementationApplyResetsMethodString();
+
+    profileContents += mProfile->lookupTableArgumentString()
+                       + mProfile->implementationLookupTableString()
+                       + mProfile->implementationComputeLookupTableMethodString()
+                       + mProfile->computeLookupTableCallString()
+                       + mProfile->lookupTableEntryString()
+                       + mProfile->lookupTableValueString();
+
+    profileContents += mProfile->emptyMethodString();
+
+    profileContents += mProfile->indentString();
+
+    profileContents += mProfile->openArrayInitializerString()
+                       + mProfile->closeArrayInitializerString();
+
+    profileContents += mProfile->openArrayString()
+                       + mProfile->closeArrayString();
+
+    profileContents += mProfile->computeCastString();
+
+    profileContents += mProfile->arrayElementSeparatorString();
+
+    profileContents += mProfile->stringDelimiterString();
+
+    profileContents += mProfile->commandSeparatorString();
+
+    // Compute and check the hash of our profile contents.
+
+    bool res = false;
+    std::string profileContentsSha1 = sha1(profileContents);
+
+    switch (mProfile->profile()) {
+    case GeneratorProfile::Profile::C:
+        switch (mProfile->precision()) {
+        case GeneratorProfile::Precision::DOUBLE:
+            res = profileContentsSha1 != "50c8bfdf78fbf49403c8b56a2e2fc328152ec2f8";
+
+            break;
+        case GeneratorProfile::Precision::SINGLE:
+            res = profileContentsSha1 != "c2086e7796892a4addd7fc3fd89e1ddb3e59b021";
+
+            break;
+        case GeneratorProfile::Precision::MIXED:
+            res = profileContentsSha1 != "0a71593bc8a3a15f28502f699ace845195363f0f";
+
+            break;
+        }
+
+        break;
+    case GeneratorProfile::Profile::PYTHON:
+        res = profileContentsSha1 != "4b96d77b3701fffd0fc2edec443fe78360b87f7f";
+
+        break;
+    case GeneratorProfile::Profile::NUMPY:
+        res = profileContentsSha1 != "81ded3d1010c2474fa98611ce34137580e49b2cc";
+
+        break;
+    }
+
+    return res;
+}
+
+bool Generator::GeneratorImpl::modifiedProfile()
+{
+    updateProfileCache();
+
+    return mModifiedProfile;
+}
+
+void Generator::GeneratorImpl::addOriginCommentCode(GeneratorCodeWriter &code)
+{
+    if (!mProfile->commentString().empty()
+        && !mProfile->originCommentString().empty()) {
+        std::string profileInformation = modifiedProfile() ?
+                                             "a modified " :
+                                             "the ";
+
+        switch (mProfile->profile()) {
+        case GeneratorProfile::Profile::C:
+            if (mProfile->precision() == GeneratorProfile::Precision::SINGLE) {
+                profileInformation += "single-precision ";
+            } else if (mProfile->precision() == GeneratorProfile::Precision::MIXED) {
+                profileInformation += "mixed-precision ";
+            }
+
+            profileInformation += "C";
+
+            break;
+        case GeneratorProfile::Profile::PYTHON:
+            profileInformation += "Python";
+
+            break;
+        case GeneratorProfile::Profile::NUMPY:
+            profileInformation += "NumPy";
+
+            break;
+        }
+
+        profileInformation += " profile of";
+
+        auto commentCode = GeneratorTemplate(mProfile->originCommentString(),
+                                             {"<PROFILE_INFORMATION>", "<LIBCELLML_VERSION>"})
+                               .expanded(profileInformation, versionString());
+
+        profileTemplate(ProfileTemplate::COMMENT).expandInto(code, commentCode);
+    }
+}
+
+void Generator::GeneratorImpl::addInterfaceHeaderCode(GeneratorCodeWriter &code)
+{
+    if (!mProfile->interfaceHeaderString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->interfaceHeaderString();
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationHeaderCode(GeneratorCodeWriter &code)
+{
+    if (!mProfile->implementationHeaderString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        GeneratorTemplate(mProfile->implementationHeaderString(),
+                          {"<INTERFACE_FILE_NAME>"})
+            .expandInto(code, mProfile->interfaceFileNameString());
+    }
+}
+
+void Generator::GeneratorImpl::addVersionAndLibcellmlVersionCode(GeneratorCodeWriter &code,
+                                                                 bool interface)
+{
+    std::string versionAndLibcellmlCode;
+
+    if ((interface && !mProfile->interfaceVersionString().empty())
+        || (!interface && !mProfile->implementationVersionString().empty())) {
+        if (interface) {
+            versionAndLibcellmlCode += mProfile->interfaceVersionString();
+        } else {
+            if (modifiedProfile()) {
+                std::regex regEx("([0-9]+\\.[0-9]+\\.[0-9]+)");
+
+                versionAndLibcellmlCode += std::regex_replace(mProfile->implementationVersionString(), regEx, "$1.post0");
+            } else {
+                versionAndLibcellmlCode += mProfile->implementationVersionString();
+            }
+        }
+    }
+
+    if ((interface && !mProfile->interfaceLibcellmlVersionString().empty())
+        || (!interface && !mProfile->implementationLibcellmlVersionString().empty())) {
+        versionAndLibcellmlCode += interface ?
+                                       mProfile->interfaceLibcellmlVersionString() :
+                                       GeneratorTemplate(mProfile->implementationLibcellmlVersionString(),
+                                                         {"<LIBCELLML_VERSION>"})
+                                           .expanded(versionString());
+    }
+
+    if (!versionAndLibcellmlCode.empty()) {
+        code += "\n";
+    }
+
+    code += versionAndLibcellmlCode;
+}
+
+void Generator::GeneratorImpl::addStateAndVariableCountCode(GeneratorCodeWriter &code,
+                                                            bool interface)
+{
+    std::string stateAndVariableCountCode;
+
+    if ((interface && !mProfile->interfaceStateCountString().empty())
+        || (!interface && !mProfile->implementationStateCountString().empty())) {
+        stateAndVariableCountCode += interface ?
+                                         mProfile->interfaceStateCountString() :
+                                         GeneratorTemplate(mProfile->implementationStateCountString(),
+                                                           {"<STATE_COUNT>"})
+                                             .expanded(std::to_string(mStates.size()));
+    }
+
+    if ((interface && !mProfile->interfaceVariableCountString().empty())
+        || (!interface && !mProfile->implementationVariableCountString().empty())) {
+        stateAndVariableCountCode += interface ?
+                                         mProfile->interfaceVariableCountString() :
+                                         GeneratorTemplate(mProfile->implementationVariableCountString(),
+                                                           {"<VARIABLE_COUNT>"})
+                                             .expanded(std::to_string(mVariables.size()));
+    }
+
+    if (!stateAndVariableCountCode.empty()) {
+        code += "\n";
+    }
+
+    code += stateAndVariableCountCode;
+}
+
+void Generator::GeneratorImpl::addVariableTypeObjectCode(GeneratorCodeWriter &code)
+{
+    if (!mProfile->variableTypeObjectString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->variableTypeObjectString();
+    }
+}
+
+std::string Generator::GeneratorImpl::generateVariableInfoObjectCode(const std::string &objectString)
+{
+    size_t componentSize = 0;
+    size_t nameSize = 0;
+    size_t unitsSize = 0;
+
+    if (mVoi != nullptr) {
+        updateVariableInfoSizes(componentSize, nameSize, unitsSize, mVoi);
+    }
+
+    for (const auto &state : mStates) {
+        updateVariableInfoSizes(componentSize, nameSize, unitsSize, state);
+    }
+
+    for (const auto &variable : mVariables) {
+        updateVariableInfoSizes(componentSize, nameSize, unitsSize, variable);
+    }
+
+    return GeneratorTemplate(objectString,
+                             {"<COMPONENT_SIZE>", "<NAME_SIZE>", "<UNITS_SIZE>"})
+        .expanded(std::to_string(componentSize), std::to_string(nameSize), std::to_string(unitsSize));
+}
+
+void Generator::GeneratorImpl::addVariableInfoObjectCode(GeneratorCodeWriter &code)
+{
+    if (!mProfile->variableInfoObjectString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += generateVariableInfoObjectCode(mProfile->variableInfoObjectString());
+    }
+}
+
+void Generator::GeneratorImpl::addVariableInfoWithTypeObjectCode(GeneratorCodeWriter &code)
+{
+    if (!mProfile->variableInfoWithTypeObjectString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += generateVariableInfoObjectCode(mProfile->variableInfoWithTypeObjectString());
+    }
+}
+
+std::string Generator::GeneratorImpl::generateVariableInfoEntryCode(const std::string &name,
+                                                                    const std::string &units,
+                                                                    const std::string &component)
+{
+    return profileTemplate(ProfileTemplate::VARIABLE_INFO_ENTRY).expanded(name, units, component);
+}
+
+void Generator::GeneratorImpl::addInterfaceVoiStateAndVariableInfoCode(GeneratorCodeWriter &code)
+{
+    std::string interfaceVoiStateAndVariableInfoCode;
+
+    if (!mProfile->interfaceVoiInfoString().empty()) {
+        interfaceVoiStateAndVariableInfoCode += mProfile->interfaceVoiInfoString();
+    }
+
+    if (!mProfile->interfaceStateInfoString().empty()) {
+        interfaceVoiStateAndVariableInfoCode += mProfile->interfaceStateInfoString();
+    }
+
+    if (!mProfile->interfaceVariableInfoString().empty()) {
+        interfaceVoiStateAndVariableInfoCode += mProfile->interfaceVariableInfoString();
+    }
+
+    if (!interfaceVoiStateAndVariableInfoCode.empty()) {
+        code += "\n";
+    }
+
+    code += interfaceVoiStateAndVariableInfoCode;
+}
+
+void Generator::GeneratorImpl::addImplementationVoiInfoCode(GeneratorCodeWriter &code)
+{
+    if (!mProfile->implementationVoiInfoString().empty()
+        && !mProfile->variableInfoEntryString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        std::string name = (mVoi != nullptr) ? mVoi->variable()->name() : "";
+        std::string units = (mVoi != nullptr) ? mVoi->variable()->units()->name() : "";
+        std::string component = (mVoi != nullptr) ? mVoi->component()->name() : "";
+
+        GeneratorTemplate(mProfile->implementationVoiInfoString(),
+                          {"<CODE>"})
+            .expandInto(code, generateVariableInfoEntryCode(name, units, component));
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationStateInfoCode(GeneratorCodeWriter &code)
+{
+    if (!mProfile->implementationStateInfoString().empty()
+        && !mProfile->variableInfoEntryString().empty()
+        && !mProfile->arrayElementSeparatorString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        std::string infoElementsCode;
+
+        for (const auto &state : mStates) {
+            if (!infoElementsCode.empty()) {
+                infoElementsCode += mProfile->arrayElementSeparatorString() + "\n";
+            }
+
+            infoElementsCode += mProfile->indentString()
+                                + generateVariableInfoEntryCode(state->variable()->name(),
+                                                                state->variable()->units()->name(),
+                                                                state->component()->name());
+        }
+
+        if (!infoElementsCode.empty()) {
+            infoElementsCode += "\n";
+        }
+
+        GeneratorTemplate(mProfile->implementationStateInfoString(),
+                          {"<CODE>"})
+            .expandInto(code, infoElementsCode);
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationVariableInfoCode(GeneratorCodeWriter &code)
+{
+    if (!mProfile->implementationVariableInfoString().empty()
+        && !mProfile->variableInfoWithTypeEntryString().empty()
+        && !mProfile->arrayElementSeparatorString().empty()
+        && !mProfile->constantVariableTypeString().empty()
+        && !mProfile->computedConstantVariableTypeString().empty()
+        && !mProfile->algebraicVariableTypeString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        std::string infoElementsCode;
+
+        for (const auto &variable : mVariables) {
+            if (!infoElementsCode.empty()) {
+                infoElementsCode += mProfile->arrayElementSeparatorString() + "\n";
+            }
+
+            std::string variableType;
+
+            if (variable->type() == GeneratorVariable::Type::CONSTANT) {
+                variableType = mProfile->constantVariableTypeString();
+            } else if (variable->type() == GeneratorVariable::Type::COMPUTED_CONSTANT) {
+                variableType = mProfile->computedConstantVariableTypeString();
+            } else if (variable->type() == GeneratorVariable::Type::ALGEBRAIC) {
+                variableType = mProfile->algebraicVariableTypeString();
+            }
+
+            infoElementsCode += mProfile->indentString()
+                                + profileTemplate(ProfileTemplate::VARIABLE_INFO_WITH_TYPE_ENTRY)
+                                      .expanded(variable->variable()->name(),
+                                                variable->variable()->units()->name(),
+                                                variable->component()->name(),
+                                                variableType);
+        }
+
+        if (!infoElementsCode.empty()) {
+            infoElementsCode += "\n";
+        }
+
+        GeneratorTemplate(mProfile->implementationVariableInfoString(),
+                          {"<CODE>"})
+            .expandInto(code, infoElementsCode);
+    }
+}
+
+void Generator::GeneratorImpl::addInterfaceJacobianSparsityCode(GeneratorCodeWriter &code)
+{
+    if (useJacobian()
+        && !mProfile->interfaceJacobianSparsityString().empty()) {
+        code += "\n" + mProfile->interfaceJacobianSparsityString();
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationJacobianSparsityCode(GeneratorCodeWriter &code)
+{
+    if (useJacobian()
+        && !mProfile->implementationJacobianSparsityString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        std::string rowPointersCode;
+        std::string columnIndicesCode;
+
+        for (const auto &rowPointer : mJacobianRowPointers) {
+            if (!rowPointersCode.empty()) {
+                rowPointersCode += mProfile->arrayElementSeparatorString() + " ";
+            }
+
+            rowPointersCode += std::to_string(rowPointer);
+        }
+
+        for (const auto &columnIndex : mJacobianColumnIndices) {
+            if (!columnIndicesCode.empty()) {
+                columnIndicesCode += mProfile->arrayElementSeparatorString() + " ";
+            }
+
+            columnIndicesCode += std::to_string(columnIndex);
+        }
+
+        if (columnIndicesCode.empty()) {
+            columnIndicesCode = mProfile->emptyJacobianColumnIndicesString();
+        }
+
+        GeneratorTemplate(mProfile->implementationJacobianSparsityString(),
+                          {"<NON_ZERO_COUNT>", "<ROW_POINTERS>", "<COLUMN_INDICES>"})
+            .expandInto(code, std::to_string(mJacobianEntries.size()), rowPointersCode, columnIndicesCode);
+    }
+}
+
+void Generator::GeneratorImpl::addInterfaceSensitivityParameterCountCode(GeneratorCodeWriter &code)
+{
+    if (!mSensitivityParameterVariables.empty()
+        && !mProfile->interfaceSensitivityParameterCountString().empty()) {
+        code += "\n" + mProfile->interfaceSensitivityParameterCountString();
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationSensitivityParameterCountCode(GeneratorCodeWriter &code)
+{
+    if (!mSensitivityParameterVariables.empty()
+        && !mProfile->implementationSensitivityParameterCountString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        GeneratorTemplate(mProfile->implementationSensitivityParameterCountString(),
+                          {"<SENSITIVITY_PARAMETER_COUNT>"})
+            .expandInto(code, std::to_string(mSensitivityParameterVariables.size()));
+    }
+}
+
+void Generator::GeneratorImpl::addInterfaceSweepParameterCountCode(GeneratorCodeWriter &code)
+{
+    if (!mSweepParameterVariables.empty()
+        && !mProfile->interfaceSweepParameterCountString().empty()) {
+        code += "\n" + mProfile->interfaceSweepParameterCountString();
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationSweepParameterCountCode(GeneratorCodeWriter &code)
+{
+    if (!mSweepParameterVariables.empty()
+        && !mProfile->implementationSweepParameterCountString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        GeneratorTemplate(mProfile->implementationSweepParameterCountString(),
+                          {"<SWEEP_PARAMETER_COUNT>"})
+            .expandInto(code, std::to_string(mSweepParameterVariables.size()));
+    }
+}
+
+void Generator::GeneratorImpl::addInterfaceResetCountCode(GeneratorCodeWriter &code)
+{
+    if (hasResets()
+        && !mProfile->interfaceResetCountString().empty()) {
+        code += "\n" + mProfile->interfaceResetCountString();
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationResetCountCode(GeneratorCodeWriter &code)
+{
+    if (hasResets()
+        && !mProfile->implementationResetCountString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        GeneratorTemplate(mProfile->implementationResetCountString(),
+                          {"<RESET_COUNT>"})
+            .expandInto(code, std::to_string(mResets.size()));
+    }
+}
+
+void Generator::GeneratorImpl::addArithmeticFunctionsCode(GeneratorCodeWriter &code)
+{
+    if (mNeedEq && !mProfile->hasEqOperator()
+        && !mProfile->eqFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->eqFunctionString();
+    }
+
+    if (mNeedNeq && !mProfile->hasNeqOperator()
+        && !mProfile->neqFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->neqFunctionString();
+    }
+
+    if (mNeedLt && !mProfile->hasLtOperator()
+        && !mProfile->ltFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->ltFunctionString();
+    }
+
+    if (mNeedLeq && !mProfile->hasLeqOperator()
+        && !mProfile->leqFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->leqFunctionString();
+    }
+
+    if (mNeedGt && !mProfile->hasGtOperator()
+        && !mProfile->gtFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->gtFunctionString();
+    }
+
+    if (mNeedGeq && !mProfile->hasGeqOperator()
+        && !mProfile->geqFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->geqFunctionString();
+    }
+
+    if (mNeedAnd && !mProfile->hasAndOperator()
+        && !mProfile->andFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->andFunctionString();
+    }
+
+    if (mNeedOr && !mProfile->hasOrOperator()
+        && !mProfile->orFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->orFunctionString();
+    }
+
+    if (mNeedXor && !mProfile->hasXorOperator()
+        && !mProfile->xorFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->xorFunctionString();
+    }
+
+    if (mNeedNot && !mProfile->hasNotOperator()
+        && !mProfile->notFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->notFunctionString();
+    }
+
+    if (mNeedMin
+        && !mProfile->minFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->minFunctionString();
+    }
+
+    if (mNeedMax
+        && !mProfile->maxFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->maxFunctionString();
+    }
+
+    if ((mNeedPiecewise || hasResets())
+        && useBranchlessPiecewise()
+        && !mProfile->blendFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->blendFunctionString();
+    }
+}
+
+void Generator::GeneratorImpl::addTrigonometricFunctionsCode(GeneratorCodeWriter &code)
+{
+    if (mNeedSec
+        && !mProfile->secFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->secFunctionString();
+    }
+
+    if (mNeedCsc
+        && !mProfile->cscFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->cscFunctionString();
+    }
+
+    if (mNeedCot
+        && !mProfile->cotFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->cotFunctionString();
+    }
+
+    if (mNeedSech
+        && !mProfile->sechFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->sechFunctionString();
+    }
+
+    if (mNeedCsch
+        && !mProfile->cschFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->cschFunctionString();
+    }
+
+    if (mNeedCoth
+        && !mProfile->cothFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->cothFunctionString();
+    }
+
+    if (mNeedAsec
+        && !mProfile->asecFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->asecFunctionString();
+    }
+
+    if (mNeedAcsc
+        && !mProfile->acscFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->acscFunctionString();
+    }
+
+    if (mNeedAcot
+        && !mProfile->acotFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->acotFunctionString();
+    }
+
+    if (mNeedAsech
+        && !mProfile->asechFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->asechFunctionString();
+    }
+
+    if (mNeedAcsch
+        && !mProfile->acschFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->acschFunctionString();
+    }
+
+    if (mNeedAcoth
+        && !mProfile->acothFunctionString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->acothFunctionString();
+    }
+}
+
+void Generator::GeneratorImpl::addInterfaceCreateDeleteArrayMethodsCode(GeneratorCodeWriter &code)
+{
+    std::string interfaceCreateDeleteArraysCode;
+
+    if (!mProfile->interfaceCreateStatesArrayMethodString().empty()) {
+        interfaceCreateDeleteArraysCode += mProfile->interfaceCreateStatesArrayMethodString();
+    }
+
+    if (!mProfile->interfaceCreateVariablesArrayMethodString().empty()) {
+        interfaceCreateDeleteArraysCode += mProfile->interfaceCreateVariablesArrayMethodString();
+    }
+
+    if (!mProfile->interfaceDeleteArrayMethodString().empty()) {
+        interfaceCreateDeleteArraysCode += mProfile->interfaceDeleteArrayMethodString();
+    }
+
+    if (!interfaceCreateDeleteArraysCode.empty()) {
+        code += "\n";
+    }
+
+    code += interfaceCreateDeleteArraysCode;
+}
+
+void Generator::GeneratorImpl::addImplementationCreateStatesArrayMethodCode(GeneratorCodeWriter &code)
+{
+    if (!mProfile->implementationCreateStatesArrayMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->implementationCreateStatesArrayMethodString();
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationCreateVariablesArrayMethodCode(GeneratorCodeWriter &code)
+{
+    if (!mProfile->implementationCreateVariablesArrayMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->implementationCreateVariablesArrayMethodString();
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationDeleteArrayMethodCode(GeneratorCodeWriter &code)
+{
+    if (!mProfile->implementationDeleteArrayMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += mProfile->implementationDeleteArrayMethodString();
+    }
+}
+
+std::string Generator::GeneratorImpl::generateMethodBodyCode(const std::string &methodBody)
+{
+    return methodBody.empty() ?
+               generateEmptyMethodBodyCode() :
+               methodBody;
+}
+
+std::string Generator::GeneratorImpl::generateEmptyMethodBodyCode()
+{
+    return mProfile->emptyMethodString().empty() ?
+               "" :
+               mProfile->indentString() + mProfile->emptyMethodString();
+}
+
+bool Generator::GeneratorImpl::isSplitMethod(const std::string &methodChunkString,
+                                             const std::string &methodChunkCallString) const
+{
+    // Return whether a method may have to be split into chunks, in which case
+    // we need its whole body to count its statements.
+
+    return (mMaximumStatementCount != 0)
+           && !methodChunkString.empty() && !methodChunkCallString.empty();
+}
+
+void Generator::GeneratorImpl::addSplitMethodCode(GeneratorCodeWriter &code,
+                                                  const std::string &methodString,
+                                                  const std::string &methodChunkString,
+                                                  const std::string &methodChunkCallString,
+                                                  const std::string &methodBody)
+{
+    // Add the code for a method with the given body, splitting it into chunks
+    // of at most mMaximumStatementCount statements, if needed, with the method
+    // itself calling those chunks in sequence.
+
+    std::vector<std::string> statements;
+
+    if (isSplitMethod(methodChunkString, methodChunkCallString)) {
+        size_t start = 0;
+        size_t end;
+
+        while ((end = methodBody.find('\n', start)) != std::string::npos) {
+            statements.push_back(methodBody.substr(start, end - start + 1));
+
+            start = end + 1;
+        }
+    }
+
+    if (statements.size() <= mMaximumStatementCount) {
+        GeneratorTemplate(methodString, {"<CODE>"}).expandInto(code, generateMethodBodyCode(methodBody));
+
+        return;
+    }
+
+    std::string chunkCallsCode;
+    GeneratorTemplate methodChunkTemplate(methodChunkString, {"<INDEX>", "<CODE>"});
+    GeneratorTemplate methodChunkCallTemplate(methodChunkCallString, {"<INDEX>"});
+
+    for (size_t i = 0, chunkIndex = 0; i < statements.size(); i += mMaximumStatementCount, ++chunkIndex) {
+        std::string chunkBody;
+
+        for (size_t j = i; (j < i + mMaximumStatementCount) && (j < statements.size()); ++j) {
+            chunkBody += statements[j];
+        }
+
+        methodChunkTemplate.expandInto(code, std::to_string(chunkIndex), chunkBody);
+
+        code += "\n";
+        chunkCallsCode += mProfile->indentString()
+                          + methodChunkCallTemplate.expanded(std::to_string(chunkIndex))
+                          + mProfile->commandSeparatorString() + "\n";
+    }
+
+    GeneratorTemplate(methodString, {"<CODE>"}).expandInto(code, chunkCallsCode);
+}
+
+void Generator::GeneratorImpl::addEquationsMethodCode(GeneratorCodeWriter &code,
+                                                      const std::string &methodString,
+                                                      const std::string &methodChunkString,
+                                                      const std::string &methodChunkCallString,
+                                                      const std::vector<GeneratorInternalEquationPtr> &equations,
+                                                      const std::string &methodBodyEnd)
+{
+    // Add the code for a method that computes the given equations, followed by
+    // the given code. Unless the method may have to be split into chunks, the
+    // code for each equation is written as soon as it is generated, so that the
+    // body of the method is never kept in memory as a whole.
+
+    if (isSplitMethod(methodChunkString, methodChunkCallString)) {
+        std::string methodBody;
+
+        for (const auto &equation : equations) {
+            methodBody += generateStatementCode(equation);
+        }
+
+        addSplitMethodCode(code, methodString, methodChunkString, methodChunkCallString,
+                           methodBody + methodBodyEnd);
+
+        return;
+    }
+
+    GeneratorMethodCodeWriter methodCode(code, methodString, generateEmptyMethodBodyCode());
+
+    for (const auto &equation : equations) {
+        methodCode += generateStatementCode(equation);
+    }
+
+    methodCode += methodBodyEnd;
+
+    methodCode.close();
+}
+
+std::string Generator::GeneratorImpl::generateIndentedCode(const std::string &code)
+{
+    // Indent each (non-empty) line of the given code.
+
+    std::string res;
+    size_t start = 0;
+    size_t end;
+
+    while ((end = code.find('\n', start)) != std::string::npos) {
+        if (end != start) {
+            res += mProfile->indentString();
+        }
+
+        res += code.substr(start, end - start + 1);
+
+        start = end + 1;
+    }
+
+    return res;
+}
+
+void Generator::GeneratorImpl::addParallelMethodCode(GeneratorCodeWriter &code,
+                                                     const std::string &methodString,
+                                                     const std::string &methodChunkString,
+                                                     const std::string &methodChunkCallString,
+                                                     const std::vector<GeneratorInternalEquationPtr> &equations)
+{
+    // Add the code for a method that computes the given equations, using a
+    // parallel region, if requested and possible, or (split) sequential code
+    // otherwise.
+
+    if ((mParallelChunkSize == 0) || equations.empty()
+        || mProfile->parallelRegionString().empty()
+        || mProfile->parallelLevelString().empty()
+        || mProfile->parallelTaskString().empty()) {
+        addEquationsMethodCode(code, methodString, methodChunkString, methodChunkCallString, equations);
+
+        return;
+    }
+
+    // Determine the level of each equation, i.e. one more than the highest
+    // level of the equations that it depends on, be it directly or through a
+    // rate. Equations of the same level are independent of one another and can
+    // therefore be computed in parallel.
+
+    std::map<GeneratorInternalEquationPtr, size_t> levels;
+    std::map<GeneratorInternalVariablePtr, GeneratorInternalEquationPtr> rateEquations;
+    std::vector<std::vector<GeneratorInternalEquationPtr>> levelEquations;
+
+    for (const auto &equation : equations) {
+        size_t level = 0;
+
+        for (const auto &dependency : equation->mDependencies) {
+            auto dependencyLevel = levels.find(dependency);
+
+            if (dependencyLevel != levels.end()) {
+                level = std::max(level, dependencyLevel->second + 1);
+            }
+        }
+
+        std::vector<GeneratorEquationAstPtr> asts = {equation->mAst};
+
+        while (!asts.empty()) {
+            auto ast = asts.back();
+
+            asts.pop_back();
+
+            if (ast->mType == GeneratorEquationAst::Type::DIFF) {
+                auto rateEquation = rateEquations.find(generatorVariable(ast->mRight->mVariable));
+
+                if ((rateEquation != rateEquations.end()) && (rateEquation->second != equation)) {
+                    level = std::max(level, levels[rateEquation->second] + 1);
+                }
+            }
+
+            for (const auto &child : {ast->mLeft, ast->mRight}) {
+                if (child != nullptr) {
+                    asts.push_back(child);
+                }
+            }
+        }
+
+        levels[equation] = level;
+
+        if (equation->mType == GeneratorInternalEquation::Type::RATE) {
+            rateEquations[equation->mVariable] = equation;
+        }
+
+        if (level >= levelEquations.size()) {
+            levelEquations.resize(level + 1);
+        }
+
+        levelEquations[level].push_back(equation);
+    }
+
+    // Generate the code for each level, with the equations of a level being
+    // split into tasks of at most mParallelChunkSize equations.
+
+    std::string levelsCode;
+
+    for (const auto &levelEquation : levelEquations) {
+        std::string tasksCode;
+
+        for (size_t i = 0; i < levelEquation.size(); i += mParallelChunkSize) {
+            std::string taskCode;
+
+            for (size_t j = i; (j < i + mParallelChunkSize) && (j < levelEquation.size()); ++j) {
+                taskCode += generateStatementCode(levelEquation[j]);
+            }
+
+            profileTemplate(ProfileTemplate::PARALLEL_TASK).expandInto(tasksCode, taskCode);
+        }
+
+        profileTemplate(ProfileTemplate::PARALLEL_LEVEL).expandInto(levelsCode, generateIndentedCode(tasksCode));
+    }
+
+    GeneratorTemplate(methodString, {"<CODE>"})
+        .expandInto(code, generateIndentedCode(GeneratorTemplate(mProfile->parallelRegionString(), {"<CODE>"})
+                                                   .expanded(generateIndentedCode(levelsCode))));
+}
+
+void Generator::GeneratorImpl::addInstanceStructureCode(std::string &structure,
+                                                        const GeneratorEquationAstPtr &ast,
+                                                        std::vector<GeneratorInternalVariablePtr> &variables)
+{
+    // Add the structure of the given AST to the given structure, with each
+    // variable being replaced with its slot, i.e. its position in the given
+    // list of variables, and the array in which it lives.
+
+    if (ast == nullptr) {
+        structure += "-";
+
+        return;
+    }
+
+    structure += "(" + std::to_string(static_cast<int>(ast->mType));
+
+    if (ast->mType == GeneratorEquationAst::Type::CN) {
+        structure += ":" + *ast->mValue;
+    } else if (ast->mType == GeneratorEquationAst::Type::CI) {
+        auto variable = generatorVariable(ast->mVariable);
+
+        if (variable->mType == GeneratorInternalVariable::Type::VARIABLE_OF_INTEGRATION) {
+            structure += ":t";
+        } else {
+            auto slot = std::find(variables.begin(), variables.end(), variable);
+
+            if (slot == variables.end()) {
+                slot = variables.insert(slot, variable);
+            }
+
+            if (variable->mType != GeneratorInternalVariable::Type::STATE) {
+                structure += ":v";
+            } else if (ast->mParent->mType == GeneratorEquationAst::Type::DIFF) {
+                structure += ":r";
+            } else {
+                structure += ":s";
+            }
+
+            structure += std::to_string(slot - variables.begin());
+        }
+    }
+
+    addInstanceStructureCode(structure, ast->mLeft, variables);
+    addInstanceStructureCode(structure, ast->mRight, variables);
+
+    structure += ")";
+}
+
+std::vector<GeneratorInstanceKernel> Generator::GeneratorImpl::instanceKernels(const std::vector<GeneratorInternalEquationPtr> &equations)
+{
+    // Group the given equations by component, keeping their order, and
+    // determine the structure of each group, i.e. of its equations, so that we
+    // can find the instances of a component.
+
+    struct Instance
+    {
+        std::vector<GeneratorInternalEquationPtr> mEquations;
+        std::vector<GeneratorInternalVariablePtr> mVariables;
+        std::string mStructure;
+    };
+
+    std::vector<Instance> instances;
+    std::map<ComponentPtr, size_t> componentInstances;
+    std::map<GeneratorInternalEquationPtr, size_t> positions;
+    std::map<GeneratorInternalVariablePtr, GeneratorInternalEquationPtr> rateEquations;
+
+    for (size_t i = 0; i < equations.size(); ++i) {
+        auto equation = equations[i];
+        auto componentInstance = componentInstances.emplace(equation->mComponent, instances.size());
+
+        if (componentInstance.second) {
+            instances.emplace_back();
+        }
+
+        instances[componentInstance.first->second].mEquations.push_back(equation);
+
+        positions[equation] = i;
+
+        if (equation->mType == GeneratorInternalEquation::Type::RATE) {
+            rateEquations[equation->mVariable] = equation;
+        }
+    }
+
+    for (auto &instance : instances) {
+        for (const auto &equation : instance.mEquations) {
+            addInstanceStructureCode(instance.mStructure, statementAst(equation), instance.mVariables);
+
+            instance.mStructure += ";";
+        }
+    }
+
+    // Determine the equations on which each equation depends, be it directly
+    // or through a rate, and that are computed by the method.
+
+    std::vector<std::vector<size_t>> dependencies(equations.size());
+
+    for (size_t i = 0; i < equations.size(); ++i) {
+        for (const auto &dependency : equations[i]->mDependencies) {
+            auto position = positions.find(dependency);
+
+            if (position != positions.end()) {
+                dependencies[i].push_back(position->second);
+            }
+        }
+
+        std::vector<GeneratorEquationAstPtr> asts = {equations[i]->mAst->mRight};
+
+        while (!asts.empty()) {
+            auto ast = asts.back();
+
+            asts.pop_back();
+
+            if (ast->mType == GeneratorEquationAst::Type::DIFF) {
+                auto rateEquation = rateEquations.find(generatorVariable(ast->mRight->mVariable));
+
+                if (rateEquation != rateEquations.end()) {
+                    dependencies[i].push_back(positions[rateEquation->second]);
+                }
+            }
+
+            for (const auto &child : {ast->mLeft, ast->mRight}) {
+                if (child != nullptr) {
+                    asts.push_back(child);
+                }
+            }
+        }
+    }
+
+    // Group the instances with the same structure, in order of first
+    // appearance.
+
+    std::vector<std::vector<size_t>> structureInstances;
+    std::map<std::string, size_t> structures;
+
+    for (size_t i = 0; i < instances.size(); ++i) {
+        auto structure = structures.emplace(instances[i].mStructure, structureInstances.size());
+
+        if (structure.second) {
+            structureInstances.emplace_back();
+        }
+
+        structureInstances[structure.first->second].push_back(i);
+    }
+
+    // Look for runs of consecutive instances of a component whose states,
+    // rates and variables are at evenly spaced indices. A run that is long
+    // enough becomes a kernel as long as its instances are independent of one
+    // another and it can be computed at a single position in the method, i.e.
+    // after all the equations on which it depends and before all the equations
+    // that depend on it, none of which may be part of another kernel.
+
+    std::vector<GeneratorInstanceKernel> res;
+    std::vector<bool> kernelEquations(equations.size(), false);
+    size_t minimumInstanceCount = std::max(mMinimumInstanceCount, size_t(2));
+
+    for (const auto &sameInstances : structureInstances) {
+        size_t first = 0;
+
+        while (first + minimumInstanceCount <= sameInstances.size()) {
+            const auto &firstVariables = instances[sameInstances[first]].mVariables;
+            const auto &secondVariables = instances[sameInstances[first + 1]].mVariables;
+            std::vector<size_t> strides;
+
+            for (size_t i = 0; i < firstVariables.size(); ++i) {
+                if (secondVariables[i]->mIndex < firstVariables[i]->mIndex) {
+                    break;
+                }
+
+                strides.push_back(secondVariables[i]->mIndex - firstVariables[i]->mIndex);
+            }
+
+            size_t last = first + 1;
+
+            if (strides.size() == firstVariables.size()) {
+                for (; last < sameInstances.size(); ++last) {
+                    const auto &variables = instances[sameInstances[last]].mVariables;
+                    size_t i = 0;
+
+                    while ((i < variables.size())
+                           && (variables[i]->mIndex == firstVariables[i]->mIndex + (last - first) * strides[i])) {
+                        ++i;
+                    }
+
+                    if (i != variables.size()) {
+                        break;
+                    }
+                }
+            }
+
+            if (last - first >= minimumInstanceCount) {
+                std::vector<size_t> runInstances(equations.size(), MAX_SIZE_T);
+                size_t position = 0;
+                size_t firstDependentPosition = equations.size();
+                bool valid = true;
+
+                for (size_t i = first; i < last; ++i) {
+                    for (const auto &equation : instances[sameInstances[i]].mEquations) {
+                        runInstances[positions[equation]] = i;
+                    }
+                }
+
+                for (size_t i = 0; valid && (i < equations.size()); ++i) {
+                    for (auto dependency : dependencies[i]) {
+                        if ((runInstances[i] != MAX_SIZE_T) && (runInstances[dependency] != MAX_SIZE_T)) {
+                            valid = runInstances[i] == runInstances[dependency];
+                        } else if (runInstances[i] != MAX_SIZE_T) {
+                            valid = !kernelEquations[dependency];
+                            position = std::max(position, dependency + 1);
+                        } else if (runInstances[dependency] != MAX_SIZE_T) {
+                            valid = !kernelEquations[i];
+                            firstDependentPosition = std::min(firstDependentPosition, i);
+                        }
+
+                        if (!valid) {
+                            break;
+                        }
+                    }
+                }
+
+                if (valid && (position <= firstDependentPosition)) {
+                    GeneratorInstanceKernel kernel;
+
+                    kernel.mEquations = instances[sameInstances[first]].mEquations;
+                    kernel.mInstanceCount = last - first;
+                    kernel.mPosition = position;
+
+                    for (size_t i = 0; i < firstVariables.size(); ++i) {
+                        if (strides[i] != 0) {
+                            kernel.mStrides[firstVariables[i]] = strides[i];
+                        }
+                    }
+
+                    for (size_t i = 0; i < equations.size(); ++i) {
+                        if (runInstances[i] != MAX_SIZE_T) {
+                            kernel.mInstanceEquations.push_back(equations[i]);
+
+                            kernelEquations[i] = true;
+                        }
+                    }
+
+                    res.push_back(kernel);
+
+                    first = last;
+
+                    continue;
+                }
+            }
+
+            first = std::max(first + 1, last - 1);
+        }
+    }
+
+    return res;
+}
+
+void Generator::GeneratorImpl::addInstancedMethodCode(GeneratorCodeWriter &code,
+                                                      const std::string &methodString,
+                                                      const std::string &methodChunkString,
+                                                      const std::string &methodChunkCallString,
+                                                      const std::string &methodKernelString,
+                                                      const std::string &methodKernelCallString,
+                                                      const std::vector<GeneratorInternalEquationPtr> &equations)
+{
+    // Add the code for a method that computes the given equations, using
+    // instance kernels, if requested and possible, or (parallel or split) code
+    // otherwise.
+
+    std::vector<GeneratorInstanceKernel> kernels;
+
+    if ((mMinimumInstanceCount != 0) && (mParallelChunkSize == 0) && mLookupTableColumns.empty()
+        && !methodKernelString.empty() && !methodKernelCallString.empty()
+        && !mProfile->instanceArrayIndexString().empty()) {
+        kernels = instanceKernels(equations);
+    }
+
+    if (kernels.empty()) {
+        addParallelMethodCode(code, methodString, methodChunkString, methodChunkCallString, equations);
+
+        return;
+    }
+
+    // Add the code for each kernel, as well as the body of the method, which
+    // calls each kernel at its position, instead of computing the equations of
+    // the instances of the kernel.
+
+    std::vector<std::vector<size_t>> positionKernels(equations.size() + 1);
+    GeneratorTemplate methodKernelTemplate(methodKernelString, {"<INDEX>", "<INSTANCE_COUNT>", "<CODE>"});
+    GeneratorTemplate methodKernelCallTemplate(methodKernelCallString, {"<INDEX>"});
+    GeneratorEquationSet kernelEquations(mEquations.size());
+
+    for (size_t i = 0; i < kernels.size(); ++i) {
+        const auto &kernel = kernels[i];
+        std::string kernelBody;
+
+        mInstanceStrides = kernel.mStrides;
+
+        for (const auto &equation : kernel.mEquations) {
+            kernelBody += generateIndentedCode(generateStatementCode(equation));
+        }
+
+        mInstanceStrides.clear();
+
+        methodKernelTemplate.expandInto(code, std::to_string(i), std::to_string(kernel.mInstanceCount), kernelBody);
+
+        code += "\n";
+
+        positionKernels[kernel.mPosition].push_back(i);
+    }
+
+    for (const auto &kernel : kernels) {
+        for (const auto &equation : kernel.mInstanceEquations) {
+            kernelEquations.insert(equation);
+        }
+    }
+
+    std::string instancedMethodBody;
+
+    for (size_t i = 0; i <= equations.size(); ++i) {
+        for (auto kernelIndex : positionKernels[i]) {
+            instancedMethodBody += mProfile->indentString()
+                                   + methodKernelCallTemplate.expanded(std::to_string(kernelIndex))
+                                   + mProfile->commandSeparatorString() + "\n";
+        }
+
+        if ((i < equations.size()) && !kernelEquations.contains(equations[i])) {
+            instancedMethodBody += generateStatementCode(equations[i]);
+        }
+    }
+
+    addSplitMethodCode(code, methodString, methodChunkString, methodChunkCallString, instancedMethodBody);
+}
+
+std::string Generator::GeneratorImpl::generateDoubleCode(const std::string &value)
+{
+    auto suffix = mProfile->floatingPointLiteralSuffixString();
+
+    if (value.find('.') != std::string::npos) {
+        return value + suffix;
+    }
+
+    size_t ePos = value.find('e');
+
+    if (ePos == std::string::npos) {
+        return value + ".0" + suffix;
+    }
+
+    return value.substr(0, ePos) + ".0" + value.substr(ePos) + suffix;
+}
+
+std::string Generator::GeneratorImpl::generateComputeCastCode(const GeneratorEquationAstPtr &ast) const
+{
+    // Cast the element of an array that is read by the given AST to the type
+    // used for computations, unless it is assigned (or its rate is assigned).
+
+    if (ast == nullptr) {
+        return {};
+    }
+
+    auto child = ast.get();
+    auto parent = ast->mParent;
+
+    if ((parent != nullptr) && (parent->mType == GeneratorEquationAst::Type::DIFF)) {
+        child = parent;
+        parent = parent->mParent;
+    }
+
+    if ((parent != nullptr)
+        && (parent->mType == GeneratorEquationAst::Type::ASSIGNMENT)
+        && (parent->mLeft.get() == child)) {
+        return {};
+    }
+
+    return mProfile->computeCastString();
+}
+
+std::string Generator::GeneratorImpl::generateVariableNameCode(const VariablePtr &variable, const GeneratorEquationAstPtr &ast)
+{
+    if (variable == mTimeStep) {
+        return mProfile->timeStepString();
+    }
+
+    if (variable == mRushLarsenExponent) {
+        return mProfile->rushLarsenExponentString();
+    }
+
+    auto sensitivity = std::find(mSensitivities.begin(), mSensitivities.end(), variable);
+
+    if (sensitivity != mSensitivities.end()) {
+        return generateComputeCastCode(ast)
+               + mProfile->sensitivitiesArrayString() + mProfile->openArrayString()
+               + std::to_string(sensitivity - mSensitivities.begin()) + mProfile->closeArrayString();
+    }
+
+    auto event = std::find(mEvents.begin(), mEvents.end(), variable);
+
+    if (event != mEvents.end()) {
+        return mProfile->eventsArrayString() + mProfile->openArrayString()
+               + std::to_string(event - mEvents.begin()) + mProfile->closeArrayString();
+    }
+
+    auto resetValue = std::find(mResetValues.begin(), mResetValues.end(), variable);
+
+    if (resetValue != mResetValues.end()) {
+        return mProfile->resetValuesArrayString() + mProfile->openArrayString()
+               + std::to_string(resetValue - mResetValues.begin()) + mProfile->closeArrayString();
+    }
+
+    GeneratorInternalVariablePtr generatorVariable = Generator::GeneratorImpl::generatorVariable(variable);
+
+    if (mGeneratingLookupTableCode && (generatorVariable == mLookupTableState)) {
+        return mProfile->lookupTableArgumentString();
+    }
+
+    if (mGeneratingLookupTableCode
+        && (generatorVariable->mType == GeneratorInternalVariable::Type::COMPUTED_TRUE_CONSTANT)) {
+        // Our lookup table is computed only once, without access to our
+        // variables, so use the definition of a true constant rather than its
+        // value in our variables array.
+
+        auto definition = generatorVariable->mEquation.lock()->mAst->mRight;
+        auto code = generateCode(definition);
+
+        return ((definition->mType == GeneratorEquationAst::Type::CN) && (code.front() != '-')) ?
+                   code :
+                   "(" + code + ")";
+    }
+
+    if (generatorVariable->mType == GeneratorInternalVariable::Type::VARIABLE_OF_INTEGRATION) {
+        return mProfile->voiString();
+    }
+
+    if (mGeneratingBatchCode && (generatorVariable->mType == GeneratorInternalVariable::Type::CONSTANT)) {
+        // A sweep parameter is read from the parameters of the current
+        // instance while any other constant gets baked in.
+
+        auto sweepParameter = std::find(mSweepParameterVariables.begin(), mSweepParameterVariables.end(), generatorVariable);
+
+        if (sweepParameter != mSweepParameterVariables.end()) {
+            return generateComputeCastCode(ast)
+                   + mProfile->sweepParametersArrayString() + mProfile->openArrayString()
+                   + profileTemplate(ProfileTemplate::BATCH_SWEEP_PARAMETER_INDEX)
+                         .expanded(std::to_string(sweepParameter - mSweepParameterVariables.begin()))
+                   + mProfile->closeArrayString();
+        }
+
+        std::string value = generateDoubleCode(generatorVariable->mVariable->initialValue());
+
+        return (value[0] == '-') ? "(" + value + ")" : value;
+    }
+
+    std::string arrayName;
+
+    if (generatorVariable->mType == GeneratorInternalVariable::Type::STATE) {
+        arrayName = ((ast != nullptr) && (ast->mParent->mType == GeneratorEquationAst::Type::DIFF)) ?
+                        mProfile->ratesArrayString() :
+                        mProfile->statesArrayString();
+    } else {
+        arrayName = mProfile->variablesArrayString();
+    }
+
+    std::ostringstream index;
+
+    index << generatorVariable->mIndex;
+
+    auto instanceStride = mInstanceStrides.find(generatorVariable);
+
+    if (instanceStride != mInstanceStrides.end()) {
+        return generateComputeCastCode(ast)
+               + arrayName + mProfile->openArrayString()
+               + profileTemplate(ProfileTemplate::INSTANCE_ARRAY_INDEX)
+                     .expanded(index.str(), std::to_string(instanceStride->second))
+               + mProfile->closeArrayString();
+    }
+
+    if (mGeneratingBatchCode) {
+        return generateComputeCastCode(ast)
+               + arrayName + mProfile->openArrayString()
+               + profileTemplate(ProfileTemplate::BATCH_ARRAY_INDEX).expanded(index.str())
+               + mProfile->closeArrayString();
+    }
+
+    return generateComputeCastCode(ast)
+           + arrayName + mProfile->openArrayString() + index.str() + mProfile->closeArrayString();
+}
+
+std::string Generator::GeneratorImpl::generateOperatorCode(const std::string &op,
+                                                           const GeneratorEquationAstPtr &ast)
+{
+    // Generate the code for the left and right branches of the given AST.
+
+    std::string left = generateCode(ast->mLeft);
+    std::string right = generateCode(ast->mRight);
 
     // Determine whether parentheses should be added around the left and/or
     // right piece of code, and this based on the precedence of the operators
@@ -2608,871 +7228,2296 @@ std::string Generator::GeneratorImpl::generateOperatorCode(const std::string &op
     // 10. OR (logical)                                          [Left to right]
     // 11. PIECEWISE (as an operator)                            [Right to left]
 
-    if (isPlusOperator(ast)) {
-        if (isRelationalOperator(ast->mLeft)
-            || isLogicalOperator(ast->mLeft)
-            || isPiecewiseStatement(ast->mLeft)) {
-            left = "(" + left + ")";
+    if (isPlusOperator(ast)) {
+        if (isRelationalOperator(ast->mLeft)
+            || isLogicalOperator(ast->mLeft)
+            || isPiecewiseStatement(ast->mLeft)) {
+            left = "(" + left + ")";
+        }
+
+        if (isRelationalOperator(ast->mRight)
+            || isLogicalOperator(ast->mRight)
+            || isPiecewiseStatement(ast->mRight)) {
+            right = "(" + right + ")";
+        }
+    } else if (isMinusOperator(ast)) {
+        if (isRelationalOperator(ast->mLeft)
+            || isLogicalOperator(ast->mLeft)
+            || isPiecewiseStatement(ast->mLeft)) {
+            left = "(" + left + ")";
+        }
+
+        if (isRelationalOperator(ast->mRight)
+            || isLogicalOperator(ast->mRight)
+            || isMinusOperator(ast->mRight)
+            || isPiecewiseStatement(ast->mRight)) {
+            right = "(" + right + ")";
+        } else if (isPlusOperator(ast->mRight)) {
+            if (ast->mRight->mRight != nullptr) {
+                right = "(" + right + ")";
+            }
+        } else if (right.compare(0, mProfile->minusString().length(), mProfile->minusString()) == 0) {
+            // The right code starts with a unary minus (e.g. -a*b), so make
+            // sure that it doesn't get combined with our minus operator.
+
+            right = "(" + right + ")";
+        }
+    } else if (isTimesOperator(ast)) {
+        if (isRelationalOperator(ast->mLeft)
+            || isLogicalOperator(ast->mLeft)
+            || isPiecewiseStatement(ast->mLeft)) {
+            left = "(" + left + ")";
+        } else if (isPlusOperator(ast->mLeft)
+                   || isMinusOperator(ast->mLeft)) {
+            if (ast->mLeft->mRight != nullptr) {
+                left = "(" + left + ")";
+            }
+        }
+
+        if (isRelationalOperator(ast->mRight)
+            || isLogicalOperator(ast->mRight)
+            || isPiecewiseStatement(ast->mRight)) {
+            right = "(" + right + ")";
+        } else if (isPlusOperator(ast->mRight)
+                   || isMinusOperator(ast->mRight)) {
+            if (ast->mRight->mRight != nullptr) {
+                right = "(" + right + ")";
+            }
+        }
+    } else if (isDivideOperator(ast)) {
+        if (isRelationalOperator(ast->mLeft)
+            || isLogicalOperator(ast->mLeft)
+            || isPiecewiseStatement(ast->mLeft)) {
+            left = "(" + left + ")";
+        } else if (isPlusOperator(ast->mLeft)
+                   || isMinusOperator(ast->mLeft)) {
+            if (ast->mLeft->mRight != nullptr) {
+                left = "(" + left + ")";
+            }
+        }
+
+        if (isRelationalOperator(ast->mRight)
+            || isLogicalOperator(ast->mRight)
+            || isTimesOperator(ast->mRight)
+            || isDivideOperator(ast->mRight)
+            || isPiecewiseStatement(ast->mRight)) {
+            right = "(" + right + ")";
+        } else if (isPlusOperator(ast->mRight)
+                   || isMinusOperator(ast->mRight)) {
+            if (ast->mRight->mRight != nullptr) {
+                right = "(" + right + ")";
+            } else if (isMinusOperator(ast->mRight)
+                       && (isTimesOperator(ast->mRight->mLeft)
+                           || isDivideOperator(ast->mRight->mLeft))) {
+                // The right code is a unary minus of a product or quotient
+                // (e.g. -a/b), so make sure that it doesn't get combined with
+                // our divide operator.
+
+                right = "(" + right + ")";
+            }
+        }
+    } else if (isAndOperator(ast)) {
+        // Note: according to the precedence rules above, we only need to add
+        //       parentheses around OR and PIECEWISE. However, it looks
+        //       better/clearer to have some around some other operators
+        //       (agreed, this is somewhat subjective).
+
+        if (isRelationalOperator(ast->mLeft)
+            || isOrOperator(ast->mLeft)
+            || isXorOperator(ast->mLeft)
+            || isPiecewiseStatement(ast->mLeft)) {
+            left = "(" + left + ")";
+        } else if (isPlusOperator(ast->mLeft)
+                   || isMinusOperator(ast->mLeft)) {
+            if (ast->mLeft->mRight != nullptr) {
+                left = "(" + left + ")";
+            }
+        } else if (isPowerOperator(ast->mLeft)) {
+            left = "(" + left + ")";
+        } else if (isRootOperator(ast->mLeft)) {
+            left = "(" + left + ")";
+        }
+
+        if (isRelationalOperator(ast->mRight)
+            || isOrOperator(ast->mRight)
+            || isXorOperator(ast->mRight)
+            || isPiecewiseStatement(ast->mRight)) {
+            right = "(" + right + ")";
+        } else if (isPlusOperator(ast->mRight)
+                   || isMinusOperator(ast->mRight)) {
+            if (ast->mRight->mRight != nullptr) {
+                right = "(" + right + ")";
+            }
+        } else if (isPowerOperator(ast->mRight)) {
+            right = "(" + right + ")";
+        } else if (isRootOperator(ast->mRight)) {
+            right = "(" + right + ")";
+        }
+    } else if (isOrOperator(ast)) {
+        // Note: according to the precedence rules above, we only need to add
+        //       parentheses around PIECEWISE. However, it looks better/clearer
+        //       to have some around some other operators (agreed, this is
+        //       somewhat subjective).
+
+        if (isRelationalOperator(ast->mLeft)
+            || isAndOperator(ast->mLeft)
+            || isXorOperator(ast->mLeft)
+            || isPiecewiseStatement(ast->mLeft)) {
+            left = "(" + left + ")";
+        } else if (isPlusOperator(ast->mLeft)
+                   || isMinusOperator(ast->mLeft)) {
+            if (ast->mLeft->mRight != nullptr) {
+                left = "(" + left + ")";
+            }
+        } else if (isPowerOperator(ast->mLeft)) {
+            left = "(" + left + ")";
+        } else if (isRootOperator(ast->mLeft)) {
+            left = "(" + left + ")";
+        }
+
+        if (isRelationalOperator(ast->mRight)
+            || isAndOperator(ast->mRight)
+            || isXorOperator(ast->mRight)
+            || isPiecewiseStatement(ast->mRight)) {
+            right = "(" + right + ")";
+        } else if (isPlusOperator(ast->mRight)
+                   || isMinusOperator(ast->mRight)) {
+            if (ast->mRight->mRight != nullptr) {
+                right = "(" + right + ")";
+            }
+        } else if (isPowerOperator(ast->mRight)) {
+            right = "(" + right + ")";
+        } else if (isRootOperator(ast->mRight)) {
+            right = "(" + right + ")";
+        }
+    } else if (isXorOperator(ast)) {
+        // Note: according to the precedence rules above, we only need to add
+        //       parentheses around AND, OR and PIECEWISE. However, it looks
+        //       better/clearer to have some around some other operators
+        //       (agreed, this is somewhat subjective).
+
+        if (isRelationalOperator(ast->mLeft)
+            || isAndOperator(ast->mLeft)
+            || isOrOperator(ast->mLeft)
+            || isPiecewiseStatement(ast->mLeft)) {
+            left = "(" + left + ")";
+        } else if (isPlusOperator(ast->mLeft)
+                   || isMinusOperator(ast->mLeft)) {
+            if (ast->mLeft->mRight != nullptr) {
+                left = "(" + left + ")";
+            }
+        } else if (isPowerOperator(ast->mLeft)) {
+            left = "(" + left + ")";
+        } else if (isRootOperator(ast->mLeft)) {
+            left = "(" + left + ")";
+        }
+
+        if (isRelationalOperator(ast->mRight)
+            || isAndOperator(ast->mRight)
+            || isOrOperator(ast->mRight)
+            || isPiecewiseStatement(ast->mRight)) {
+            right = "(" + right + ")";
+        } else if (isPlusOperator(ast->mRight)
+                   || isMinusOperator(ast->mRight)) {
+            if (ast->mRight->mRight != nullptr) {
+                right = "(" + right + ")";
+            }
+        } else if (isPowerOperator(ast->mRight)) {
+            right = "(" + right + ")";
+        } else if (isRootOperator(ast->mRight)) {
+            right = "(" + right + ")";
+        }
+    } else if (isPowerOperator(ast)) {
+        if (isRelationalOperator(ast->mLeft)
+            || isLogicalOperator(ast->mLeft)
+            || isMinusOperator(ast->mLeft)
+            || isTimesOperator(ast->mLeft)
+            || isDivideOperator(ast->mLeft)
+            || isPiecewiseStatement(ast->mLeft)) {
+            left = "(" + left + ")";
+        } else if (isPlusOperator(ast->mLeft)) {
+            if (ast->mLeft->mRight != nullptr) {
+                left = "(" + left + ")";
+            }
+        }
+
+        if (isRelationalOperator(ast->mRight)
+            || isLogicalOperator(ast->mRight)
+            || isMinusOperator(ast->mLeft)
+            || isTimesOperator(ast->mRight)
+            || isDivideOperator(ast->mRight)
+            || isPowerOperator(ast->mRight)
+            || isRootOperator(ast->mRight)
+            || isPiecewiseStatement(ast->mRight)) {
+            right = "(" + right + ")";
+        } else if (isPlusOperator(ast->mRight)) {
+            if (ast->mRight->mRight != nullptr) {
+                right = "(" + right + ")";
+            }
+        }
+    } else if (isRootOperator(ast)) {
+        if (isRelationalOperator(ast->mRight)
+            || isLogicalOperator(ast->mRight)
+            || isMinusOperator(ast->mRight)
+            || isTimesOperator(ast->mRight)
+            || isDivideOperator(ast->mRight)
+            || isPiecewiseStatement(ast->mRight)) {
+            right = "(" + right + ")";
+        } else if (isPlusOperator(ast->mRight)) {
+            if (ast->mRight->mRight != nullptr) {
+                right = "(" + right + ")";
+            }
+        }
+
+        if (isRelationalOperator(ast->mLeft)
+            || isLogicalOperator(ast->mLeft)
+            || isMinusOperator(ast->mLeft)
+            || isTimesOperator(ast->mLeft)
+            || isDivideOperator(ast->mLeft)
+            || isPowerOperator(ast->mLeft)
+            || isRootOperator(ast->mLeft)
+            || isPiecewiseStatement(ast->mLeft)) {
+            left = "(" + left + ")";
+        } else if (isPlusOperator(ast->mLeft)) {
+            if (ast->mLeft->mRight != nullptr) {
+                left = "(" + left + ")";
+            }
+        }
+
+        return right + op + "(1.0/" + left + ")";
+    }
+
+    return left + op + right;
+}
+
+std::string Generator::GeneratorImpl::generateMinusUnaryCode(const GeneratorEquationAstPtr &ast)
+{
+    // Generate the code for the left branch of the given AST.
+
+    std::string left = generateCode(ast->mLeft);
+
+    // Determine whether parentheses should be added around the left code.
+
+    if (isRelationalOperator(ast->mLeft)
+        || isLogicalOperator(ast->mLeft)
+        || isPlusOperator(ast->mLeft)
+        || isMinusOperator(ast->mLeft)
+        || isPiecewiseStatement(ast->mLeft)) {
+        left = "(" + left + ")";
+    }
+
+    return mProfile->minusString() + left;
+}
+
+std::string Generator::GeneratorImpl::generateOneParameterFunctionCode(const std::string &function,
+                                                                       const GeneratorEquationAstPtr &ast)
+{
+    return function + "(" + generateCode(ast->mLeft) + ")";
+}
+
+std::string Generator::GeneratorImpl::generateTwoParameterFunctionCode(const std::string &function,
+                                                                       const GeneratorEquationAstPtr &ast)
+{
+    return function + "(" + generateCode(ast->mLeft) + ", " + generateCode(ast->mRight) + ")";
+}
+
+std::string Generator::GeneratorImpl::generatePiecewiseIfCode(const std::string &condition,
+                                                              const std::string &value)
+{
+    auto piecewiseTemplate = useBranchlessPiecewise() ?
+                                 ProfileTemplate::BRANCHLESS_PIECEWISE_IF :
+                                 ProfileTemplate::PIECEWISE_IF;
+
+    return profileTemplate(piecewiseTemplate).expanded(condition, value);
+}
+
+std::string Generator::GeneratorImpl::generatePiecewiseElseCode(const std::string &value)
+{
+    auto piecewiseTemplate = useBranchlessPiecewise() ?
+                                 ProfileTemplate::BRANCHLESS_PIECEWISE_ELSE :
+                                 ProfileTemplate::PIECEWISE_ELSE;
+
+    return profileTemplate(piecewiseTemplate).expanded(value);
+}
+
+std::string Generator::GeneratorImpl::generateCode(const GeneratorEquationAstPtr &ast)
+{
+    // Generate the code for the given AST, unless it can be retrieved from our
+    // lookup table.
+
+    if (!mLookupTableColumns.empty() && !mGeneratingExactCode && !mGeneratingLookupTableCode
+        && isLookupTableCandidate(ast, mLookupTableState)) {
+        return generateLookupTableValueCode(ast);
+    }
+
+    std::string code;
+
+    switch (ast->mType) {
+        // Assignment.
+
+    case GeneratorEquationAst::Type::ASSIGNMENT:
+        code = generateOperatorCode(mProfile->assignmentString(), ast);
+
+        break;
+
+        // Relational and logical operators.
+
+    case GeneratorEquationAst::Type::EQ:
+        if (mProfile->hasEqOperator()) {
+            code = generateOperatorCode(mProfile->eqString(), ast);
+        } else {
+            code = generateTwoParameterFunctionCode(mProfile->eqString(), ast);
+        }
+
+        break;
+    case GeneratorEquationAst::Type::NEQ:
+        if (mProfile->hasNeqOperator()) {
+            code = generateOperatorCode(mProfile->neqString(), ast);
+        } else {
+            code = generateTwoParameterFunctionCode(mProfile->neqString(), ast);
+        }
+
+        break;
+    case GeneratorEquationAst::Type::LT:
+        if (mProfile->hasLtOperator()) {
+            code = generateOperatorCode(mProfile->ltString(), ast);
+        } else {
+            code = generateTwoParameterFunctionCode(mProfile->ltString(), ast);
+        }
+
+        break;
+    case GeneratorEquationAst::Type::LEQ:
+        if (mProfile->hasLeqOperator()) {
+            code = generateOperatorCode(mProfile->leqString(), ast);
+        } else {
+            code = generateTwoParameterFunctionCode(mProfile->leqString(), ast);
+        }
+
+        break;
+    case GeneratorEquationAst::Type::GT:
+        if (mProfile->hasGtOperator()) {
+            code = generateOperatorCode(mProfile->gtString(), ast);
+        } else {
+            code = generateTwoParameterFunctionCode(mProfile->gtString(), ast);
+        }
+
+        break;
+    case GeneratorEquationAst::Type::GEQ:
+        if (mProfile->hasGeqOperator()) {
+            code = generateOperatorCode(mProfile->geqString(), ast);
+        } else {
+            code = generateTwoParameterFunctionCode(mProfile->geqString(), ast);
+        }
+
+        break;
+    case GeneratorEquationAst::Type::AND:
+        if (mProfile->hasAndOperator()) {
+            code = generateOperatorCode(mProfile->andString(), ast);
+        } else {
+            code = generateTwoParameterFunctionCode(mProfile->andString(), ast);
+        }
+
+        break;
+    case GeneratorEquationAst::Type::OR:
+        if (mProfile->hasOrOperator()) {
+            code = generateOperatorCode(mProfile->orString(), ast);
+        } else {
+            code = generateTwoParameterFunctionCode(mProfile->orString(), ast);
+        }
+
+        break;
+    case GeneratorEquationAst::Type::XOR:
+        if (mProfile->hasXorOperator()) {
+            code = generateOperatorCode(mProfile->xorString(), ast);
+        } else {
+            code = generateTwoParameterFunctionCode(mProfile->xorString(), ast);
+        }
+
+        break;
+    case GeneratorEquationAst::Type::NOT:
+        if (mProfile->hasNotOperator()) {
+            code = mProfile->notString() + generateCode(ast->mLeft);
+        } else {
+            code = generateOneParameterFunctionCode(mProfile->notString(), ast);
+        }
+
+        break;
+
+        // Arithmetic operators.
+
+    case GeneratorEquationAst::Type::PLUS:
+        if (ast->mRight != nullptr) {
+            code = generateOperatorCode(mProfile->plusString(), ast);
+        } else {
+            code = generateCode(ast->mLeft);
+        }
+
+        break;
+    case GeneratorEquationAst::Type::MINUS:
+        if (ast->mRight != nullptr) {
+            code = generateOperatorCode(mProfile->minusString(), ast);
+        } else {
+            code = generateMinusUnaryCode(ast);
+        }
+
+        break;
+    case GeneratorEquationAst::Type::TIMES:
+        code = generateOperatorCode(mProfile->timesString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::DIVIDE:
+        code = generateOperatorCode(mProfile->divideString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::POWER: {
+        std::string stringValue = generateCode(ast->mRight);
+        double doubleValue;
+        bool validConversion = convertToDouble(stringValue, doubleValue);
+
+        if (validConversion && areEqual(doubleValue, 0.5)) {
+            code = generateOneParameterFunctionCode(mProfile->squareRootString(), ast);
+        } else if (validConversion && areEqual(doubleValue, 2.0)
+                   && !mProfile->squareString().empty()) {
+            code = generateOneParameterFunctionCode(mProfile->squareString(), ast);
+        } else {
+            code = mProfile->hasPowerOperator() ?
+                       generateOperatorCode(mProfile->powerString(), ast) :
+                       mProfile->powerString() + "(" + generateCode(ast->mLeft) + ", " + stringValue + ")";
+        }
+
+        break;
+    }
+    case GeneratorEquationAst::Type::ROOT:
+        if (ast->mRight != nullptr) {
+            double doubleValue;
+
+            if (convertToDouble(generateCode(ast->mLeft), doubleValue)
+                && areEqual(doubleValue, 2.0)) {
+                code = mProfile->squareRootString() + "(" + generateCode(ast->mRight) + ")";
+            } else {
+                GeneratorEquationAstPtr rootValueAst = createAst(GeneratorEquationAst::Type::DIVIDE, ast);
+
+                rootValueAst->mLeft = createAst(GeneratorEquationAst::Type::CN, "1.0", rootValueAst);
+                rootValueAst->mRight = createAst(ast->mLeft, rootValueAst);
+
+                code = mProfile->hasPowerOperator() ?
+                           generateOperatorCode(mProfile->powerString(), ast) :
+                           mProfile->powerString() + "(" + generateCode(ast->mRight) + ", " + generateOperatorCode(mProfile->divideString(), rootValueAst) + ")";
+            }
+        } else {
+            code = generateOneParameterFunctionCode(mProfile->squareRootString(), ast);
+        }
+
+        break;
+    case GeneratorEquationAst::Type::ABS:
+        code = generateOneParameterFunctionCode(mProfile->absoluteValueString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::EXP:
+        code = generateOneParameterFunctionCode(mProfile->exponentialString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::LN:
+        code = generateOneParameterFunctionCode(mProfile->napierianLogarithmString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::LOG:
+        if (ast->mRight != nullptr) {
+            std::string stringValue = generateCode(ast->mLeft);
+            double doubleValue;
+
+            if (convertToDouble(stringValue, doubleValue)
+                && areEqual(doubleValue, 10.0)) {
+                code = mProfile->commonLogarithmString() + "(" + generateCode(ast->mRight) + ")";
+            } else {
+                code = mProfile->napierianLogarithmString() + "(" + generateCode(ast->mRight) + ")/" + mProfile->napierianLogarithmString() + "(" + stringValue + ")";
+            }
+        } else {
+            code = generateOneParameterFunctionCode(mProfile->commonLogarithmString(), ast);
+        }
+
+        break;
+    case GeneratorEquationAst::Type::CEILING:
+        code = generateOneParameterFunctionCode(mProfile->ceilingString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::FLOOR:
+        code = generateOneParameterFunctionCode(mProfile->floorString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::MIN:
+        code = generateTwoParameterFunctionCode(mProfile->minString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::MAX:
+        code = generateTwoParameterFunctionCode(mProfile->maxString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::REM:
+        code = generateTwoParameterFunctionCode(mProfile->remString(), ast);
+
+        break;
+
+        // Calculus elements.
+
+    case GeneratorEquationAst::Type::DIFF:
+        code = generateCode(ast->mRight);
+
+        break;
+
+        // Trigonometric operators.
+
+    case GeneratorEquationAst::Type::SIN:
+        code = generateOneParameterFunctionCode(mProfile->sinString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::COS:
+        code = generateOneParameterFunctionCode(mProfile->cosString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::TAN:
+        code = generateOneParameterFunctionCode(mProfile->tanString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::SEC:
+        code = generateOneParameterFunctionCode(mProfile->secString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::CSC:
+        code = generateOneParameterFunctionCode(mProfile->cscString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::COT:
+        code = generateOneParameterFunctionCode(mProfile->cotString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::SINH:
+        code = generateOneParameterFunctionCode(mProfile->sinhString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::COSH:
+        code = generateOneParameterFunctionCode(mProfile->coshString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::TANH:
+        code = generateOneParameterFunctionCode(mProfile->tanhString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::SECH:
+        code = generateOneParameterFunctionCode(mProfile->sechString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::CSCH:
+        code = generateOneParameterFunctionCode(mProfile->cschString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::COTH:
+        code = generateOneParameterFunctionCode(mProfile->cothString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::ASIN:
+        code = generateOneParameterFunctionCode(mProfile->asinString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::ACOS:
+        code = generateOneParameterFunctionCode(mProfile->acosString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::ATAN:
+        code = generateOneParameterFunctionCode(mProfile->atanString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::ASEC:
+        code = generateOneParameterFunctionCode(mProfile->asecString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::ACSC:
+        code = generateOneParameterFunctionCode(mProfile->acscString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::ACOT:
+        code = generateOneParameterFunctionCode(mProfile->acotString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::ASINH:
+        code = generateOneParameterFunctionCode(mProfile->asinhString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::ACOSH:
+        code = generateOneParameterFunctionCode(mProfile->acoshString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::ATANH:
+        code = generateOneParameterFunctionCode(mProfile->atanhString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::ASECH:
+        code = generateOneParameterFunctionCode(mProfile->asechString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::ACSCH:
+        code = generateOneParameterFunctionCode(mProfile->acschString(), ast);
+
+        break;
+    case GeneratorEquationAst::Type::ACOTH:
+        code = generateOneParameterFunctionCode(mProfile->acothString(), ast);
+
+        break;
+
+        // Piecewise statement.
+
+    case GeneratorEquationAst::Type::PIECEWISE:
+        if (ast->mRight != nullptr) {
+            if (ast->mRight->mType == GeneratorEquationAst::Type::PIECE) {
+                code = generateCode(ast->mLeft) + generatePiecewiseElseCode(generateCode(ast->mRight) + generatePiecewiseElseCode(mProfile->nanString()));
+            } else {
+                code = generateCode(ast->mLeft) + generatePiecewiseElseCode(generateCode(ast->mRight));
+            }
+        } else {
+            code = generateCode(ast->mLeft) + generatePiecewiseElseCode(mProfile->nanString());
+        }
+
+        break;
+    case GeneratorEquationAst::Type::PIECE:
+        code = generatePiecewiseIfCode(generateCode(ast->mRight), generateCode(ast->mLeft));
+
+        break;
+    case GeneratorEquationAst::Type::OTHERWISE:
+        code = generateCode(ast->mLeft);
+
+        break;
+
+        // Token elements.
+
+    case GeneratorEquationAst::Type::CI:
+        code = generateVariableNameCode(ast->mVariable, ast);
+
+        break;
+    case GeneratorEquationAst::Type::CN:
+        code = generateDoubleCode(*ast->mValue);
+
+        break;
+
+        // Qualifier elements.
+
+    case GeneratorEquationAst::Type::DEGREE:
+    case GeneratorEquationAst::Type::LOGBASE:
+    case GeneratorEquationAst::Type::BVAR:
+        code = generateCode(ast->mLeft);
+
+        break;
+
+        // Constants.
+
+    case GeneratorEquationAst::Type::TRUE_VALUE:
+        code = mProfile->trueString();
+
+        break;
+    case GeneratorEquationAst::Type::FALSE_VALUE:
+        code = mProfile->falseString();
+
+        break;
+    case GeneratorEquationAst::Type::E:
+        code = mProfile->eString();
+
+        break;
+    case GeneratorEquationAst::Type::PI:
+        code = mProfile->piString();
+
+        break;
+    case GeneratorEquationAst::Type::INF:
+        code = mProfile->infString();
+
+        break;
+    case GeneratorEquationAst::Type::NAN_VALUE:
+        code = mProfile->nanString();
+
+        break;
+    }
+
+    return code;
+}
+
+std::string Generator::GeneratorImpl::generateInitializationCode(const GeneratorInternalVariablePtr &variable)
+{
+    return mProfile->indentString() + generateVariableNameCode(variable->mVariable) + " = " + generateDoubleCode(variable->mVariable->initialValue()) + mProfile->commandSeparatorString() + "\n";
+}
+
+bool Generator::GeneratorImpl::hasSinglePrecisionCancellationRisk(const GeneratorEquationAstPtr &ast) const
+{
+    // Check whether the given AST subtracts an exponential from another
+    // exponential or from one (or one from an exponential), something that may
+    // result in a catastrophic cancellation in single precision.
+
+    if (ast == nullptr) {
+        return false;
+    }
+
+    if ((ast->mType == GeneratorEquationAst::Type::MINUS)
+        && (ast->mRight != nullptr)) {
+        auto isLeftExp = ast->mLeft->mType == GeneratorEquationAst::Type::EXP;
+        auto isRightExp = ast->mRight->mType == GeneratorEquationAst::Type::EXP;
+
+        if ((isLeftExp && (isRightExp || isConstantValueAst(ast->mRight, 1.0)))
+            || (isRightExp && isConstantValueAst(ast->mLeft, 1.0))) {
+            return true;
+        }
+    }
+
+    return hasSinglePrecisionCancellationRisk(ast->mLeft)
+           || hasSinglePrecisionCancellationRisk(ast->mRight);
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::statementAst(const GeneratorInternalEquationPtr &equation)
+{
+    if (mGeneratingSpecializedCode) {
+        return specializedEquationAst(equation);
+    }
+
+    return mProfile->hasCodeOptimization() ?
+               optimizedEquationAst(equation) :
+               equation->mAst;
+}
+
+std::string Generator::GeneratorImpl::generateStatementCode(const GeneratorInternalEquationPtr &equation)
+{
+    auto ast = statementAst(equation);
+    std::string res = mProfile->indentString() + generateCode(ast) + mProfile->commandSeparatorString();
+
+    // Flag a statement that is numerically risky in single precision using a
+    // trailing comment, so that the statement still takes only one line.
+
+    if ((mProfile->profile() == GeneratorProfile::Profile::C)
+        && (mProfile->precision() == GeneratorProfile::Precision::SINGLE)
+        && !mProfile->commentString().empty()
+        && hasSinglePrecisionCancellationRisk(ast)) {
+        return res + " " + profileTemplate(ProfileTemplate::COMMENT).expanded(std::string("Possible loss of accuracy in single precision due to the subtraction of an exponential."));
+    }
+
+    return res + "\n";
+}
+
+void Generator::GeneratorImpl::addEquations(std::vector<GeneratorInternalEquationPtr> &equations,
+                                            const GeneratorInternalEquationPtr &equation,
+                                            GeneratorEquationSet &remainingEquations,
+                                            bool onlyStateRateBasedEquations)
+{
+    // Add the given equation to the given equations, after the equations on
+    // which it depends. There is no need to revisit an equation since the
+    // equations on which it depends will already have been dealt with.
+
+    if (!remainingEquations.visit(equation)) {
+        return;
+    }
+
+    for (const auto &dependency : equation->mDependencies) {
+        if (!onlyStateRateBasedEquations
+            || ((dependency->mType == GeneratorInternalEquation::Type::ALGEBRAIC)
+                && dependency->mIsStateRateBased)) {
+            addEquations(equations, dependency, remainingEquations, onlyStateRateBasedEquations);
+        }
+    }
+
+    if (remainingEquations.erase(equation)) {
+        equations.push_back(equation);
+    }
+}
+
+void Generator::GeneratorImpl::addEquationCode(std::string &code,
+                                               const GeneratorInternalEquationPtr &equation,
+                                               GeneratorEquationSet &remainingEquations)
+{
+    // Add the code for the given equation, after the code for the equations on
+    // which it depends.
+
+    std::vector<GeneratorInternalEquationPtr> equations;
+
+    addEquations(equations, equation, remainingEquations);
+
+    for (const auto &dependencyOrEquation : equations) {
+        code += generateStatementCode(dependencyOrEquation);
+    }
+}
+
+void Generator::GeneratorImpl::addInterfaceComputeModelMethodsCode(GeneratorCodeWriter &code)
+{
+    std::string interfaceComputeModelMethodsCode;
+
+    if (!mProfile->interfaceInitializeStatesAndConstantsMethodString().empty()) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceInitializeStatesAndConstantsMethodString();
+    }
+
+    if (!mProfile->interfaceComputeComputedConstantsMethodString().empty()) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceComputeComputedConstantsMethodString();
+    }
+
+    if (!mProfile->interfaceComputeRatesMethodString().empty()) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceComputeRatesMethodString();
+    }
+
+    if (!mProfile->interfaceComputeVariablesMethodString().empty()) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceComputeVariablesMethodString();
+    }
+
+    if (useJacobian()
+        && !mProfile->interfaceComputeJacobianMethodString().empty()) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceComputeJacobianMethodString();
+    }
+
+    if (mProfile->hasRushLarsen() && (mModelType == Generator::ModelType::ODE)
+        && !mProfile->interfaceComputeRushLarsenStepMethodString().empty()) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceComputeRushLarsenStepMethodString();
+    }
+
+    if (!mSensitivityParameterVariables.empty()
+        && !mProfile->interfaceComputeSensitivityRatesMethodString().empty()) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceComputeSensitivityRatesMethodString();
+    }
+
+    if (!mSweepParameterVariables.empty()) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceInitializeStatesAndConstantsBatchMethodString()
+                                            + mProfile->interfaceComputeRatesBatchMethodString();
+    }
+
+    if (mHasSpecializedMethods) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceComputeRatesSpecializedMethodString()
+                                            + mProfile->interfaceComputeVariablesSpecializedMethodString();
+    }
+
+    if (hasResets()) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceComputeRootsMethodString()
+                                            + mProfile->interfaceApplyResetsMethodString();
+    }
+
+    if (!interfaceComputeModelMethodsCode.empty()) {
+        code += "\n";
+    }
+
+    code += interfaceComputeModelMethodsCode;
+}
+
+void Generator::GeneratorImpl::addImplementationInitializeStatesAndConstantsMethodCode(GeneratorCodeWriter &code,
+                                                                                       GeneratorEquationSet &remainingEquations)
+{
+    if (!mProfile->implementationInitializeStatesAndConstantsMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        GeneratorMethodCodeWriter methodCode(code, mProfile->implementationInitializeStatesAndConstantsMethodString(),
+                                             generateEmptyMethodBodyCode());
+
+        for (const auto &internalVariable : mInternalVariables) {
+            if ((internalVariable->mType == GeneratorInternalVariable::Type::STATE)
+                || (internalVariable->mType == GeneratorInternalVariable::Type::CONSTANT)) {
+                methodCode += generateInitializationCode(internalVariable);
+            }
+        }
+
+        std::vector<GeneratorInternalEquationPtr> equations;
+
+        for (const auto &equation : mEquations) {
+            if (equation->mType == GeneratorInternalEquation::Type::TRUE_CONSTANT) {
+                addEquations(equations, equation, remainingEquations);
+            }
+        }
+
+        for (const auto &equation : equations) {
+            methodCode += generateStatementCode(equation);
+        }
+
+        methodCode.close();
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationComputeComputedConstantsMethodCode(GeneratorCodeWriter &code,
+                                                                                   GeneratorEquationSet &remainingEquations)
+{
+    if (!mProfile->implementationComputeComputedConstantsMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        std::vector<GeneratorInternalEquationPtr> equations;
+
+        for (const auto &equation : mEquations) {
+            if (equation->mType == GeneratorInternalEquation::Type::VARIABLE_BASED_CONSTANT) {
+                addEquations(equations, equation, remainingEquations);
+            }
+        }
+
+        // Compute our lookup table, if any. It only depends on true constants,
+        // so it only gets computed the first time that we get here.
+
+        std::string methodBodyEnd;
+
+        if (!mLookupTableColumns.empty()) {
+            methodBodyEnd = mProfile->indentString() + mProfile->computeLookupTableCallString()
+                            + mProfile->commandSeparatorString() + "\n";
+        }
+
+        addEquationsMethodCode(code,
+                               mProfile->implementationComputeComputedConstantsMethodString(),
+                               mProfile->implementationComputeComputedConstantsMethodChunkString(),
+                               mProfile->computeComputedConstantsMethodChunkCallString(),
+                               equations, methodBodyEnd);
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationComputeRatesMethodCode(GeneratorCodeWriter &code,
+                                                                       GeneratorEquationSet &remainingEquations)
+{
+    if (!mProfile->implementationComputeRatesMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        std::vector<GeneratorInternalEquationPtr> equations;
+
+        for (const auto &equation : mEquations) {
+            if (equation->mType == GeneratorInternalEquation::Type::RATE) {
+                addEquations(equations, equation, remainingEquations);
+            }
+        }
+
+        addInstancedMethodCode(code,
+                               mProfile->implementationComputeRatesMethodString(),
+                               mProfile->implementationComputeRatesMethodChunkString(),
+                               mProfile->computeRatesMethodChunkCallString(),
+                               mProfile->implementationComputeRatesMethodKernelString(),
+                               mProfile->computeRatesMethodKernelCallString(),
+                               equations);
+    }
+}
+
+GeneratorInternalVariablePtr Generator::GeneratorImpl::existingGeneratorVariable(const VariablePtr &variable)
+{
+    // Find and return, if there is one, the generator variable associated with
+    // the given variable. Unlike generatorVariable(), we don't create a
+    // generator variable if there is none since our model has already been
+    // analysed.
+
+    auto cachedInternalVariable = mInternalVariableCache.find(variable);
+
+    if (cachedInternalVariable != mInternalVariableCache.end()) {
+        return cachedInternalVariable->second;
+    }
+
+    for (const auto &internalVariable : mInternalVariables) {
+        if (sameOrEquivalentVariable(variable, internalVariable->mVariable)) {
+            mInternalVariableCache[variable] = internalVariable;
+
+            return internalVariable;
+        }
+    }
+
+    return nullptr;
+}
+
+void Generator::GeneratorImpl::checkRequiredOutput(const VariablePtr &variable)
+{
+    // Make sure that the given required output is computed by the method to
+    // compute the variables, i.e. that it is an algebraic variable of our
+    // model.
+
+    auto internalVariable = existingGeneratorVariable(variable);
+    std::string issueType;
+
+    if (internalVariable == nullptr) {
+        issueType = "is not in the model";
+    } else {
+        switch (internalVariable->mType) {
+        case GeneratorInternalVariable::Type::VARIABLE_OF_INTEGRATION:
+            issueType = "is the variable of integration";
+
+            break;
+        case GeneratorInternalVariable::Type::STATE:
+            issueType = "is a state";
+
+            break;
+        case GeneratorInternalVariable::Type::CONSTANT:
+        case GeneratorInternalVariable::Type::COMPUTED_TRUE_CONSTANT:
+        case GeneratorInternalVariable::Type::COMPUTED_VARIABLE_BASED_CONSTANT:
+            issueType = "is a constant";
+
+            break;
+        default: // GeneratorInternalVariable::Type::ALGEBRAIC.
+            break;
+        }
+    }
+
+    if (!issueType.empty()) {
+        IssuePtr issue = Issue::create();
+        ComponentPtr component = std::dynamic_pointer_cast<Component>(variable->parent());
+
+        issue->setDescription("Required output '" + variable->name() + "'"
+                              + ((component != nullptr) ?
+                                     " in component '" + component->name()
+                                         + "' of model '" + entityName(owningModel(component)) + "'" :
+                                     "")
+                              + " " + issueType + " and is therefore not computed by the method to compute the variables.");
+        issue->setCause(Issue::Cause::GENERATOR);
+
+        mGenerator->addIssue(issue);
+    }
+}
+
+void Generator::GeneratorImpl::addRequiredEquation(const GeneratorInternalEquationPtr &equation,
+                                                   GeneratorEquationSet &requiredEquations)
+{
+    if (requiredEquations.contains(equation)) {
+        return;
+    }
+
+    requiredEquations.insert(equation);
+
+    for (const auto &dependency : equation->mDependencies) {
+        addRequiredEquation(dependency, requiredEquations);
+    }
+}
+
+GeneratorEquationSet Generator::GeneratorImpl::requiredEquations()
+{
+    // Retrieve the equations that compute our required outputs, as well as all
+    // the equations on which they (indirectly) depend.
+
+    std::unordered_set<GeneratorInternalVariablePtr> requiredOutputVariables;
+
+    for (const auto &requiredOutput : mRequiredOutputs) {
+        auto internalVariable = existingGeneratorVariable(requiredOutput);
+
+        if (internalVariable != nullptr) {
+            requiredOutputVariables.insert(internalVariable);
+        }
+    }
+
+    GeneratorEquationSet res(mEquations.size());
+
+    for (const auto &equation : mEquations) {
+        if ((equation->mVariable != nullptr)
+            && (requiredOutputVariables.find(equation->mVariable) != requiredOutputVariables.end())) {
+            addRequiredEquation(equation, res);
+        }
+    }
+
+    return res;
+}
+
+std::vector<GeneratorInternalEquationPtr> Generator::GeneratorImpl::computeVariablesEquations(const GeneratorEquationSet &remainingEquations)
+{
+    GeneratorEquationSet newRemainingEquations(mEquations.size());
+
+    for (const auto &equation : mEquations) {
+        newRemainingEquations.insert(equation);
+    }
+
+    // If we have some required outputs, then only compute them and the
+    // variables on which they depend.
+
+    auto equations = mRequiredOutputs.empty() ?
+                         newRemainingEquations :
+                         requiredEquations();
+
+    std::vector<GeneratorInternalEquationPtr> res;
+
+    for (const auto &equation : mEquations) {
+        if (equations.contains(equation)
+            && (remainingEquations.contains(equation)
+                || ((equation->mType == GeneratorInternalEquation::Type::ALGEBRAIC)
+                    && equation->mIsStateRateBased))) {
+            addEquations(res, equation, newRemainingEquations, true);
+        }
+    }
+
+    return res;
+}
+
+void Generator::GeneratorImpl::addImplementationComputeVariablesMethodCode(GeneratorCodeWriter &code,
+                                                                           GeneratorEquationSet &remainingEquations)
+{
+    if (!mProfile->implementationComputeVariablesMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        addInstancedMethodCode(code,
+                               mProfile->implementationComputeVariablesMethodString(),
+                               mProfile->implementationComputeVariablesMethodChunkString(),
+                               mProfile->computeVariablesMethodChunkCallString(),
+                               mProfile->implementationComputeVariablesMethodKernelString(),
+                               mProfile->computeVariablesMethodKernelCallString(),
+                               computeVariablesEquations(remainingEquations));
+    }
+}
+
+void Generator::GeneratorImpl::addJacobianEquationCode(std::string &code,
+                                                       const GeneratorInternalEquationPtr &equation,
+                                                       GeneratorEquationSet &remainingEquations)
+{
+    // Add the code for the given equation, and the equations on which it
+    // depends, making sure that no rates are used.
+
+    if (!remainingEquations.visit(equation)) {
+        return;
+    }
+
+    for (const auto &dependency : equation->mDependencies) {
+        addJacobianEquationCode(code, dependency, remainingEquations);
+    }
+
+    if (remainingEquations.erase(equation)) {
+        GeneratorEquationAstPtr ast = jacobianValueAst(equation->mAst);
+
+        if (mProfile->hasCodeOptimization()) {
+            ast->mRight = optimizeAst(ast->mRight);
+            ast->mRight->mParent = ast.get();
+        }
+
+        code += mProfile->indentString() + generateCode(ast)
+                + mProfile->commandSeparatorString() + "\n";
+    }
+}
+
+std::string Generator::GeneratorImpl::algebraicVariablesCode(const std::vector<GeneratorInternalVariablePtr> &algebraicVariables)
+{
+    // Return the code to compute the given algebraic variables, and the
+    // algebraic variables on which they depend, and this in the order in which
+    // they would normally be computed and without using any rate.
+
+    GeneratorEquationSet remainingEquations(mEquations.size());
+
+    for (const auto &equation : mEquations) {
+        if (equation->mType == GeneratorInternalEquation::Type::ALGEBRAIC) {
+            remainingEquations.insert(equation);
+        }
+    }
+
+    std::string res;
+
+    for (const auto &equation : mEquations) {
+        if ((equation->mType == GeneratorInternalEquation::Type::ALGEBRAIC)
+            && (std::find(algebraicVariables.begin(), algebraicVariables.end(), equation->mVariable) != algebraicVariables.end())) {
+            addJacobianEquationCode(res, equation, remainingEquations);
+        }
+    }
+
+    return res;
+}
+
+void Generator::GeneratorImpl::addImplementationComputeJacobianMethodCode(GeneratorCodeWriter &code)
+{
+    if (useJacobian()
+        && !mProfile->implementationComputeJacobianMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        // Compute the algebraic variables needed by the non-zero entries of
+        // our Jacobian, and this in the order in which they would normally be
+        // computed.
+
+        std::vector<GeneratorInternalVariablePtr> algebraicVariables;
+
+        for (const auto &entry : mJacobianEntries) {
+            collectAlgebraicVariables(entry, algebraicVariables);
         }
 
-        if (isRelationalOperator(ast->mRight)
-            || isLogicalOperator(ast->mRight)
-            || isPiecewiseStatement(ast->mRight)) {
-            right = "(" + right + ")";
+        std::string methodBody = algebraicVariablesCode(algebraicVariables);
+
+        // Compute the non-zero entries of our Jacobian.
+
+        for (size_t i = 0; i < mJacobianEntries.size(); ++i) {
+            methodBody += mProfile->indentString()
+                          + mProfile->jacobianArrayString() + mProfile->openArrayString() + std::to_string(i) + mProfile->closeArrayString()
+                          + mProfile->assignmentString() + generateCode(mJacobianEntries[i]->mRight)
+                          + mProfile->commandSeparatorString() + "\n";
         }
-    } else if (isMinusOperator(ast)) {
-        if (isRelationalOperator(ast->mLeft)
-            || isLogicalOperator(ast->mLeft)
-            || isPiecewiseStatement(ast->mLeft)) {
-            left = "(" + left + ")";
+
+        GeneratorTemplate(mProfile->implementationComputeJacobianMethodString(),
+                          {"<CODE>"})
+            .expandInto(code, generateMethodBodyCode(methodBody));
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationComputeRushLarsenStepMethodCode(GeneratorCodeWriter &code)
+{
+    if (mProfile->hasRushLarsen() && (mModelType == Generator::ModelType::ODE)
+        && !mProfile->implementationComputeRushLarsenStepMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
         }
 
-        if (isRelationalOperator(ast->mRight)
-            || isLogicalOperator(ast->mRight)
-            || isMinusOperator(ast->mRight)
-            || isPiecewiseStatement(ast->mRight)) {
-            right = "(" + right + ")";
-        } else if (isPlusOperator(ast->mRight)) {
-            if (ast->mRight->mRight != nullptr) {
-                right = "(" + right + ")";
+        // Compute our rates (and any variables on which they depend), and this
+        // in a local array, before updating our states.
+
+        GeneratorEquationSet remainingEquations(mEquations.size());
+
+        for (const auto &equation : mEquations) {
+            if ((equation->mType == GeneratorInternalEquation::Type::RATE)
+                || (equation->mType == GeneratorInternalEquation::Type::ALGEBRAIC)) {
+                remainingEquations.insert(equation);
             }
         }
-    } else if (isTimesOperator(ast)) {
-        if (isRelationalOperator(ast->mLeft)
-            || isLogicalOperator(ast->mLeft)
-            || isPiecewiseStatement(ast->mLeft)) {
-            left = "(" + left + ")";
-        } else if (isPlusOperator(ast->mLeft)
-                   || isMinusOperator(ast->mLeft)) {
-            if (ast->mLeft->mRight != nullptr) {
-                left = "(" + left + ")";
+
+        std::string methodBody;
+
+        for (const auto &equation : mEquations) {
+            if (equation->mType == GeneratorInternalEquation::Type::RATE) {
+                addEquationCode(methodBody, equation, remainingEquations);
             }
         }
 
-        if (isRelationalOperator(ast->mRight)
-            || isLogicalOperator(ast->mRight)
-            || isPiecewiseStatement(ast->mRight)) {
-            right = "(" + right + ")";
-        } else if (isPlusOperator(ast->mRight)
-                   || isMinusOperator(ast->mRight)) {
-            if (ast->mRight->mRight != nullptr) {
-                right = "(" + right + ")";
-            }
+        methodBody += "\n";
+
+        // Declare our exponent, if at least one of our states is updated using
+        // the Rush-Larsen method, i.e. if we have more steps than states.
+
+        if (mRushLarsenSteps.size() > mStates.size()) {
+            methodBody += mProfile->implementationRushLarsenExponentString();
         }
-    } else if (isDivideOperator(ast)) {
-        if (isRelationalOperator(ast->mLeft)
-            || isLogicalOperator(ast->mLeft)
-            || isPiecewiseStatement(ast->mLeft)) {
-            left = "(" + left + ")";
-        } else if (isPlusOperator(ast->mLeft)
-                   || isMinusOperator(ast->mLeft)) {
-            if (ast->mLeft->mRight != nullptr) {
-                left = "(" + left + ")";
+
+        for (const auto &rushLarsenStep : mRushLarsenSteps) {
+            methodBody += mProfile->indentString() + generateCode(rushLarsenStep)
+                          + mProfile->commandSeparatorString() + "\n";
+        }
+
+        GeneratorTemplate(mProfile->implementationComputeRushLarsenStepMethodString(),
+                          {"<STATE_COUNT>", "<CODE>"})
+            .expandInto(code, std::to_string(mStates.size()), generateMethodBodyCode(methodBody));
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationComputeSensitivityRatesMethodCode(GeneratorCodeWriter &code)
+{
+    if (!mSensitivityParameterVariables.empty()
+        && !mProfile->implementationComputeSensitivityRatesMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        // Compute the algebraic variables needed by our sensitivity rates, and
+        // this in the order in which they would normally be computed.
+
+        std::vector<GeneratorInternalVariablePtr> algebraicVariables;
+
+        for (const auto &sensitivityRate : mSensitivityRates) {
+            collectAlgebraicVariables(sensitivityRate, algebraicVariables);
+        }
+
+        GeneratorEquationSet remainingEquations(mEquations.size());
+
+        for (const auto &equation : mEquations) {
+            if (equation->mType == GeneratorInternalEquation::Type::ALGEBRAIC) {
+                remainingEquations.insert(equation);
             }
         }
 
-        if (isRelationalOperator(ast->mRight)
-            || isLogicalOperator(ast->mRight)
-            || isTimesOperator(ast->mRight)
-            || isDivideOperator(ast->mRight)
-            || isPiecewiseStatement(ast->mRight)) {
-            right = "(" + right + ")";
-        } else if (isPlusOperator(ast->mRight)
-                   || isMinusOperator(ast->mRight)) {
-            if (ast->mRight->mRight != nullptr) {
-                right = "(" + right + ")";
+        std::string methodBody;
+
+        for (const auto &equation : mEquations) {
+            if ((equation->mType == GeneratorInternalEquation::Type::ALGEBRAIC)
+                && (std::find(algebraicVariables.begin(), algebraicVariables.end(), equation->mVariable) != algebraicVariables.end())) {
+                addJacobianEquationCode(methodBody, equation, remainingEquations);
             }
         }
-    } else if (isAndOperator(ast)) {
-        // Note: according to the precedence rules above, we only need to add
-        //       parentheses around OR and PIECEWISE. However, it looks
-        //       better/clearer to have some around some other operators
-        //       (agreed, this is somewhat subjective).
 
-        if (isRelationalOperator(ast->mLeft)
-            || isOrOperator(ast->mLeft)
-            || isXorOperator(ast->mLeft)
-            || isPiecewiseStatement(ast->mLeft)) {
-            left = "(" + left + ")";
-        } else if (isPlusOperator(ast->mLeft)
-                   || isMinusOperator(ast->mLeft)) {
-            if (ast->mLeft->mRight != nullptr) {
-                left = "(" + left + ")";
+        // Compute our sensitivity rates.
+
+        for (size_t i = 0; i < mSensitivityRates.size(); ++i) {
+            methodBody += mProfile->indentString()
+                          + mProfile->sensitivityRatesArrayString() + mProfile->openArrayString() + std::to_string(i) + mProfile->closeArrayString()
+                          + mProfile->assignmentString() + generateCode(mSensitivityRates[i]->mRight)
+                          + mProfile->commandSeparatorString() + "\n";
+        }
+
+        GeneratorTemplate(mProfile->implementationComputeSensitivityRatesMethodString(),
+                          {"<CODE>"})
+            .expandInto(code, generateMethodBodyCode(methodBody));
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationInitializeStatesAndConstantsBatchMethodCode(GeneratorCodeWriter &code)
+{
+    if (!mSweepParameterVariables.empty()
+        && !mProfile->implementationInitializeStatesAndConstantsBatchMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        // Initialise our states and compute our computed constants for the
+        // current instance. There is no need to initialise our constants since
+        // they are either sweep parameters or baked in. Also, we don't want to
+        // use our lookup table, if any, since it depends on our constants.
+
+        mGeneratingBatchCode = true;
+        mGeneratingExactCode = true;
+
+        std::string methodBody;
+
+        for (const auto &internalVariable : mInternalVariables) {
+            if (internalVariable->mType == GeneratorInternalVariable::Type::STATE) {
+                methodBody += generateInitializationCode(internalVariable);
             }
-        } else if (isPowerOperator(ast->mLeft)) {
-            left = "(" + left + ")";
-        } else if (isRootOperator(ast->mLeft)) {
-            left = "(" + left + ")";
         }
 
-        if (isRelationalOperator(ast->mRight)
-            || isOrOperator(ast->mRight)
-            || isXorOperator(ast->mRight)
-            || isPiecewiseStatement(ast->mRight)) {
-            right = "(" + right + ")";
-        } else if (isPlusOperator(ast->mRight)
-                   || isMinusOperator(ast->mRight)) {
-            if (ast->mRight->mRight != nullptr) {
-                right = "(" + right + ")";
+        GeneratorEquationSet remainingEquations(mEquations.size());
+
+        for (const auto &equation : mEquations) {
+            if ((equation->mType == GeneratorInternalEquation::Type::TRUE_CONSTANT)
+                || (equation->mType == GeneratorInternalEquation::Type::VARIABLE_BASED_CONSTANT)) {
+                remainingEquations.insert(equation);
             }
-        } else if (isPowerOperator(ast->mRight)) {
-            right = "(" + right + ")";
-        } else if (isRootOperator(ast->mRight)) {
-            right = "(" + right + ")";
         }
-    } else if (isOrOperator(ast)) {
-        // Note: according to the precedence rules above, we only need to add
-        //       parentheses around PIECEWISE. However, it looks better/clearer
-        //       to have some around some other operators (agreed, this is
-        //       somewhat subjective).
 
-        if (isRelationalOperator(ast->mLeft)
-            || isAndOperator(ast->mLeft)
-            || isXorOperator(ast->mLeft)
-            || isPiecewiseStatement(ast->mLeft)) {
-            left = "(" + left + ")";
-        } else if (isPlusOperator(ast->mLeft)
-                   || isMinusOperator(ast->mLeft)) {
-            if (ast->mLeft->mRight != nullptr) {
-                left = "(" + left + ")";
+        for (const auto &equation : mEquations) {
+            if ((equation->mType == GeneratorInternalEquation::Type::TRUE_CONSTANT)
+                || (equation->mType == GeneratorInternalEquation::Type::VARIABLE_BASED_CONSTANT)) {
+                addEquationCode(methodBody, equation, remainingEquations);
             }
-        } else if (isPowerOperator(ast->mLeft)) {
-            left = "(" + left + ")";
-        } else if (isRootOperator(ast->mLeft)) {
-            left = "(" + left + ")";
         }
 
-        if (isRelationalOperator(ast->mRight)
-            || isAndOperator(ast->mRight)
-            || isXorOperator(ast->mRight)
-            || isPiecewiseStatement(ast->mRight)) {
-            right = "(" + right + ")";
-        } else if (isPlusOperator(ast->mRight)
-                   || isMinusOperator(ast->mRight)) {
-            if (ast->mRight->mRight != nullptr) {
-                right = "(" + right + ")";
+        mGeneratingBatchCode = false;
+        mGeneratingExactCode = false;
+
+        GeneratorTemplate(mProfile->implementationInitializeStatesAndConstantsBatchMethodString(),
+                          {"<CODE>"})
+            .expandInto(code, generateIndentedCode(generateMethodBodyCode(methodBody)));
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationComputeRatesBatchMethodCode(GeneratorCodeWriter &code)
+{
+    if (!mSweepParameterVariables.empty()
+        && !mProfile->implementationComputeRatesBatchMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        // Compute our rates (and any variables on which they depend) for the
+        // current instance.
+
+        mGeneratingBatchCode = true;
+        mGeneratingExactCode = true;
+
+        GeneratorEquationSet remainingEquations(mEquations.size());
+
+        for (const auto &equation : mEquations) {
+            if ((equation->mType == GeneratorInternalEquation::Type::RATE)
+                || (equation->mType == GeneratorInternalEquation::Type::ALGEBRAIC)) {
+                remainingEquations.insert(equation);
             }
-        } else if (isPowerOperator(ast->mRight)) {
-            right = "(" + right + ")";
-        } else if (isRootOperator(ast->mRight)) {
-            right = "(" + right + ")";
         }
-    } else if (isXorOperator(ast)) {
-        // Note: according to the precedence rules above, we only need to add
-        //       parentheses around AND, OR and PIECEWISE. However, it looks
-        //       better/clearer to have some around some other operators
-        //       (agreed, this is somewhat subjective).
 
-        if (isRelationalOperator(ast->mLeft)
-            || isAndOperator(ast->mLeft)
-            || isOrOperator(ast->mLeft)
-            || isPiecewiseStatement(ast->mLeft)) {
-            left = "(" + left + ")";
-        } else if (isPlusOperator(ast->mLeft)
-                   || isMinusOperator(ast->mLeft)) {
-            if (ast->mLeft->mRight != nullptr) {
-                left = "(" + left + ")";
+        std::string methodBody;
+
+        for (const auto &equation : mEquations) {
+            if (equation->mType == GeneratorInternalEquation::Type::RATE) {
+                addEquationCode(methodBody, equation, remainingEquations);
             }
-        } else if (isPowerOperator(ast->mLeft)) {
-            left = "(" + left + ")";
-        } else if (isRootOperator(ast->mLeft)) {
-            left = "(" + left + ")";
         }
 
-        if (isRelationalOperator(ast->mRight)
-            || isAndOperator(ast->mRight)
-            || isOrOperator(ast->mRight)
-            || isPiecewiseStatement(ast->mRight)) {
-            right = "(" + right + ")";
-        } else if (isPlusOperator(ast->mRight)
-                   || isMinusOperator(ast->mRight)) {
-            if (ast->mRight->mRight != nullptr) {
-                right = "(" + right + ")";
-            }
-        } else if (isPowerOperator(ast->mRight)) {
-            right = "(" + right + ")";
-        } else if (isRootOperator(ast->mRight)) {
-            right = "(" + right + ")";
+        mGeneratingBatchCode = false;
+        mGeneratingExactCode = false;
+
+        GeneratorTemplate(mProfile->implementationComputeRatesBatchMethodString(),
+                          {"<CODE>"})
+            .expandInto(code, generateIndentedCode(generateMethodBodyCode(methodBody)));
+    }
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::specializedAst(const GeneratorEquationAstPtr &ast)
+{
+    // Make a deep copy of the given AST, replacing any (computed) constant
+    // which value we know with that value.
+
+    if (ast->mType == GeneratorEquationAst::Type::CI) {
+        auto specializedValue = mSpecializedValues.find(generatorVariable(ast->mVariable));
+
+        if (specializedValue != mSpecializedValues.end()) {
+            return newConstantAst(specializedValue->second);
+        }
+    }
+
+    GeneratorEquationAstPtr res = createAst(ast->mType, *ast->mValue, nullptr);
+
+    res->mVariable = ast->mVariable;
+
+    if (ast->mLeft != nullptr) {
+        res->mLeft = specializedAst(ast->mLeft);
+        res->mLeft->mParent = res.get();
+    }
+
+    if (ast->mRight != nullptr) {
+        res->mRight = specializedAst(ast->mRight);
+        res->mRight->mParent = res.get();
+    }
+
+    return res;
+}
+
+GeneratorEquationAstPtr Generator::GeneratorImpl::specializedEquationAst(const GeneratorInternalEquationPtr &equation)
+{
+    // Return a copy of the AST of the given equation in which the (computed)
+    // constants which value we know have been replaced with that value, and
+    // which right hand side has then been optimised, thus folding whatever
+    // can now be folded.
+
+    GeneratorEquationAstPtr res = createAst(equation->mAst->mType, equation->mAst->mVariable, nullptr);
+
+    res->mLeft = copyAst(equation->mAst->mLeft, res);
+    res->mRight = optimizeAst(specializedAst(equation->mAst->mRight));
+    res->mRight->mParent = res.get();
+
+    return res;
+}
+
+void Generator::GeneratorImpl::addSpecializedValue(const GeneratorInternalEquationPtr &equation,
+                                                   GeneratorEquationSet &remainingEquations)
+{
+    // Fold the value of the (computed) constant computed by the given
+    // equation, after having folded the ones on which it depends.
+
+    if (!remainingEquations.visit(equation)) {
+        return;
+    }
+
+    for (const auto &dependency : equation->mDependencies) {
+        addSpecializedValue(dependency, remainingEquations);
+    }
+
+    if (remainingEquations.erase(equation) && (equation->mVariable != nullptr)) {
+        double value;
+
+        if (isConstantAst(specializedEquationAst(equation)->mRight, value)) {
+            mSpecializedValues[equation->mVariable] = value;
+        }
+    }
+}
+
+void Generator::GeneratorImpl::computeSpecializedValues()
+{
+    // Retrieve the current initial value of our constants and fold our
+    // computed constants from them. A (computed) constant which value we
+    // cannot determine keeps being read from the variables array.
+
+    mSpecializedValues.clear();
+
+    for (const auto &internalVariable : mInternalVariables) {
+        double value;
+
+        if ((internalVariable->mType == GeneratorInternalVariable::Type::CONSTANT)
+            && convertToDouble(internalVariable->mVariable->initialValue(), value)
+            && std::isfinite(value)) {
+            mSpecializedValues[internalVariable] = value;
+        }
+    }
+
+    GeneratorEquationSet remainingEquations(mEquations.size());
+
+    for (const auto &equation : mEquations) {
+        if ((equation->mType == GeneratorInternalEquation::Type::TRUE_CONSTANT)
+            || (equation->mType == GeneratorInternalEquation::Type::VARIABLE_BASED_CONSTANT)) {
+            remainingEquations.insert(equation);
         }
-    } else if (isPowerOperator(ast)) {
-        if (isRelationalOperator(ast->mLeft)
-            || isLogicalOperator(ast->mLeft)
-            || isMinusOperator(ast->mLeft)
-            || isTimesOperator(ast->mLeft)
-            || isDivideOperator(ast->mLeft)
-            || isPiecewiseStatement(ast->mLeft)) {
-            left = "(" + left + ")";
-        } else if (isPlusOperator(ast->mLeft)) {
-            if (ast->mLeft->mRight != nullptr) {
-                left = "(" + left + ")";
-            }
+    }
+
+    for (const auto &equation : mEquations) {
+        if ((equation->mType == GeneratorInternalEquation::Type::TRUE_CONSTANT)
+            || (equation->mType == GeneratorInternalEquation::Type::VARIABLE_BASED_CONSTANT)) {
+            addSpecializedValue(equation, remainingEquations);
         }
+    }
+}
 
-        if (isRelationalOperator(ast->mRight)
-            || isLogicalOperator(ast->mRight)
-            || isMinusOperator(ast->mLeft)
-            || isTimesOperator(ast->mRight)
-            || isDivideOperator(ast->mRight)
-            || isPowerOperator(ast->mRight)
-            || isRootOperator(ast->mRight)
-            || isPiecewiseStatement(ast->mRight)) {
-            right = "(" + right + ")";
-        } else if (isPlusOperator(ast->mRight)) {
-            if (ast->mRight->mRight != nullptr) {
-                right = "(" + right + ")";
-            }
+void Generator::GeneratorImpl::addImplementationComputeRatesSpecializedMethodCode(GeneratorCodeWriter &code)
+{
+    if (mHasSpecializedMethods
+        && !mProfile->implementationComputeRatesSpecializedMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
         }
-    } else if (isRootOperator(ast)) {
-        if (isRelationalOperator(ast->mRight)
-            || isLogicalOperator(ast->mRight)
-            || isMinusOperator(ast->mRight)
-            || isTimesOperator(ast->mRight)
-            || isDivideOperator(ast->mRight)
-            || isPiecewiseStatement(ast->mRight)) {
-            right = "(" + right + ")";
-        } else if (isPlusOperator(ast->mRight)) {
-            if (ast->mRight->mRight != nullptr) {
-                right = "(" + right + ")";
+
+        // Compute our rates (and any variables on which they depend) using the
+        // values of our (computed) constants. We don't want to use our lookup
+        // table, if any, since it would hide those values from the compiler.
+
+        GeneratorEquationSet remainingEquations(mEquations.size());
+
+        for (const auto &equation : mEquations) {
+            if ((equation->mType == GeneratorInternalEquation::Type::RATE)
+                || (equation->mType == GeneratorInternalEquation::Type::ALGEBRAIC)) {
+                remainingEquations.insert(equation);
             }
         }
 
-        if (isRelationalOperator(ast->mLeft)
-            || isLogicalOperator(ast->mLeft)
-            || isMinusOperator(ast->mLeft)
-            || isTimesOperator(ast->mLeft)
-            || isDivideOperator(ast->mLeft)
-            || isPowerOperator(ast->mLeft)
-            || isRootOperator(ast->mLeft)
-            || isPiecewiseStatement(ast->mLeft)) {
-            left = "(" + left + ")";
-        } else if (isPlusOperator(ast->mLeft)) {
-            if (ast->mLeft->mRight != nullptr) {
-                left = "(" + left + ")";
+        std::vector<GeneratorInternalEquationPtr> equations;
+
+        for (const auto &equation : mEquations) {
+            if (equation->mType == GeneratorInternalEquation::Type::RATE) {
+                addEquations(equations, equation, remainingEquations);
             }
         }
 
-        return right + op + "(1.0/" + left + ")";
-    }
+        GeneratorMethodCodeWriter methodCode(code, mProfile->implementationComputeRatesSpecializedMethodString(),
+                                             generateEmptyMethodBodyCode());
 
-    return left + op + right;
+        mGeneratingSpecializedCode = true;
+        mGeneratingExactCode = true;
+
+        for (const auto &equation : equations) {
+            methodCode += generateStatementCode(equation);
+        }
+
+        mGeneratingSpecializedCode = false;
+        mGeneratingExactCode = false;
+
+        methodCode.close();
+    }
 }
 
-std::string Generator::GeneratorImpl::generateMinusUnaryCode(const GeneratorEquationAstPtr &ast)
+void Generator::GeneratorImpl::addImplementationComputeVariablesSpecializedMethodCode(GeneratorCodeWriter &code,
+                                                                                      const GeneratorEquationSet &remainingEquations)
 {
-    // Generate the code for the left branch of the given AST.
+    if (mHasSpecializedMethods
+        && !mProfile->implementationComputeVariablesSpecializedMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
 
-    std::string left = generateCode(ast->mLeft);
+        // Compute the same variables as our generic method, but using the
+        // values of our (computed) constants.
 
-    // Determine whether parentheses should be added around the left code.
+        GeneratorMethodCodeWriter methodCode(code, mProfile->implementationComputeVariablesSpecializedMethodString(),
+                                             generateEmptyMethodBodyCode());
 
-    if (isRelationalOperator(ast->mLeft)
-        || isLogicalOperator(ast->mLeft)
-        || isPlusOperator(ast->mLeft)
-        || isMinusOperator(ast->mLeft)
-        || isPiecewiseStatement(ast->mLeft)) {
-        left = "(" + left + ")";
-    }
+        mGeneratingSpecializedCode = true;
+        mGeneratingExactCode = true;
 
-    return mProfile->minusString() + left;
-}
+        for (const auto &equation : computeVariablesEquations(remainingEquations)) {
+            methodCode += generateStatementCode(equation);
+        }
 
-std::string Generator::GeneratorImpl::generateOneParameterFunctionCode(const std::string &function,
-                                                                       const GeneratorEquationAstPtr &ast)
-{
-    return function + "(" + generateCode(ast->mLeft) + ")";
+        mGeneratingSpecializedCode = false;
+        mGeneratingExactCode = false;
+
+        methodCode.close();
+    }
 }
 
-std::string Generator::GeneratorImpl::generateTwoParameterFunctionCode(const std::string &function,
-                                                                       const GeneratorEquationAstPtr &ast)
+GeneratorEquationAstPtr Generator::GeneratorImpl::eventAst(size_t index)
 {
-    return function + "(" + generateCode(ast->mLeft) + ", " + generateCode(ast->mRight) + ")";
+    // Return an AST for the event at the given index in the events array. Like
+    // for a sensitivity, each event is represented by a dummy variable.
+
+    while (mEvents.size() <= index) {
+        mEvents.push_back(Variable::create());
+    }
+
+    return createAst(GeneratorEquationAst::Type::CI, mEvents[index], nullptr);
 }
 
-std::string Generator::GeneratorImpl::generatePiecewiseIfCode(const std::string &condition,
-                                                              const std::string &value)
+GeneratorEquationAstPtr Generator::GeneratorImpl::resetValueAst(size_t index)
 {
-    return replace(replace(mProfile->hasConditionalOperator() ?
-                               mProfile->conditionalOperatorIfString() :
-                               mProfile->piecewiseIfString(),
-                           "<CONDITION>", condition),
-                   "<IF_STATEMENT>", value);
+    // Return an AST for the reset value at the given index in the reset values
+    // array.
+
+    while (mResetValues.size() <= index) {
+        mResetValues.push_back(Variable::create());
+    }
+
+    return createAst(GeneratorEquationAst::Type::CI, mResetValues[index], nullptr);
 }
 
-std::string Generator::GeneratorImpl::generatePiecewiseElseCode(const std::string &value)
+bool Generator::GeneratorImpl::hasResets() const
 {
-    return replace(mProfile->hasConditionalOperator() ?
-                       mProfile->conditionalOperatorElseString() :
-                       mProfile->piecewiseElseString(),
-                   "<ELSE_STATEMENT>", value);
+    return (mModelType == Generator::ModelType::ODE) && !mResets.empty();
 }
 
-std::string Generator::GeneratorImpl::generateCode(const GeneratorEquationAstPtr &ast)
+void Generator::GeneratorImpl::addImplementationComputeRootsMethodCode(GeneratorCodeWriter &code)
 {
-    // Generate the code for the given AST.
+    if (hasResets()
+        && !mProfile->implementationComputeRootsMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
 
-    std::string code;
+        // The root of a reset is the difference between its test variable and
+        // its test value, i.e. a reset is to be applied when its root changes
+        // sign. Our states may have changed since our algebraic variables were
+        // last computed, so first compute the ones that our roots need.
 
-    switch (ast->mType) {
-        // Assignment.
+        std::vector<GeneratorEquationAstPtr> roots;
+        std::vector<GeneratorInternalVariablePtr> algebraicVariables;
 
-    case GeneratorEquationAst::Type::ASSIGNMENT:
-        code = generateOperatorCode(mProfile->assignmentString(), ast);
+        for (const auto &reset : mResets) {
+            // Note: our root is the right hand side of an assignment since the
+            //       code generation relies on an AST having a parent.
 
-        break;
+            GeneratorEquationAstPtr root = newAst(GeneratorEquationAst::Type::ASSIGNMENT, nullptr,
+                                                  newAst(GeneratorEquationAst::Type::MINUS,
+                                                         createAst(GeneratorEquationAst::Type::CI, reset->mTestVariable, nullptr),
+                                                         copyAst(reset->mTestValue, nullptr)));
 
-        // Relational and logical operators.
+            collectAlgebraicVariables(root->mRight, algebraicVariables);
 
-    case GeneratorEquationAst::Type::EQ:
-        if (mProfile->hasEqOperator()) {
-            code = generateOperatorCode(mProfile->eqString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->eqString(), ast);
+            roots.push_back(root);
         }
 
-        break;
-    case GeneratorEquationAst::Type::NEQ:
-        if (mProfile->hasNeqOperator()) {
-            code = generateOperatorCode(mProfile->neqString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->neqString(), ast);
+        std::string methodBody = algebraicVariablesCode(algebraicVariables);
+
+        if (!methodBody.empty()) {
+            methodBody += "\n";
         }
 
-        break;
-    case GeneratorEquationAst::Type::LT:
-        if (mProfile->hasLtOperator()) {
-            code = generateOperatorCode(mProfile->ltString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->ltString(), ast);
+        for (size_t i = 0; i < roots.size(); ++i) {
+            methodBody += mProfile->indentString()
+                          + mProfile->rootsArrayString() + mProfile->openArrayString() + std::to_string(i) + mProfile->closeArrayString()
+                          + mProfile->assignmentString() + generateCode(roots[i]->mRight)
+                          + mProfile->commandSeparatorString() + "\n";
         }
 
-        break;
-    case GeneratorEquationAst::Type::LEQ:
-        if (mProfile->hasLeqOperator()) {
-            code = generateOperatorCode(mProfile->leqString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->leqString(), ast);
+        GeneratorTemplate(mProfile->implementationComputeRootsMethodString(),
+                          {"<CODE>"})
+            .expandInto(code, generateMethodBodyCode(methodBody));
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationApplyResetsMethodCode(GeneratorCodeWriter &code)
+{
+    if (hasResets()
+        && !mProfile->implementationApplyResetsMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
         }
 
-        break;
-    case GeneratorEquationAst::Type::GT:
-        if (mProfile->hasGtOperator()) {
-            code = generateOperatorCode(mProfile->gtString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->gtString(), ast);
+        // Determine the variables that can be reset, in the order in which they
+        // are first reset.
+
+        std::vector<GeneratorInternalVariablePtr> variables;
+
+        for (const auto &reset : mResets) {
+            GeneratorInternalVariablePtr variable = generatorVariable(reset->mVariable);
+
+            if (std::find(variables.begin(), variables.end(), variable) == variables.end()) {
+                variables.push_back(variable);
+            }
         }
 
-        break;
-    case GeneratorEquationAst::Type::GEQ:
-        if (mProfile->hasGeqOperator()) {
-            code = generateOperatorCode(mProfile->geqString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->geqString(), ast);
+        // Compute the new value of each of our variables, using the values of
+        // our states and variables from before any reset is applied. The new
+        // value of a variable is given by its active reset with the lowest
+        // order or, if none of its resets is active, by its current value.
+        // Our states may have changed since our algebraic variables were last
+        // computed, so first compute the ones that our reset values need.
+
+        std::vector<GeneratorInternalVariablePtr> algebraicVariables;
+
+        for (const auto &reset : mResets) {
+            collectAlgebraicVariables(reset->mResetValue, algebraicVariables);
         }
 
-        break;
-    case GeneratorEquationAst::Type::AND:
-        if (mProfile->hasAndOperator()) {
-            code = generateOperatorCode(mProfile->andString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->andString(), ast);
+        std::string algebraicCode = algebraicVariablesCode(algebraicVariables);
+
+        if (!algebraicCode.empty()) {
+            algebraicCode += "\n";
+        }
+
+        std::string resetValuesCode;
+        std::string assignmentsCode;
+
+        for (size_t i = 0; i < variables.size(); ++i) {
+            GeneratorEquationAstPtr value = createAst(GeneratorEquationAst::Type::CI, variables[i]->mVariable, nullptr);
+
+            for (size_t j = mResets.size(); j-- > 0;) {
+                if (generatorVariable(mResets[j]->mVariable) == variables[i]) {
+                    value = piecewiseAst(copyAst(mResets[j]->mResetValue, nullptr), eventAst(j), value);
+                }
+            }
+
+            GeneratorEquationAstPtr resetValue = newAst(GeneratorEquationAst::Type::ASSIGNMENT, resetValueAst(i), value);
+            GeneratorEquationAstPtr assignment = newAst(GeneratorEquationAst::Type::ASSIGNMENT,
+                                                        createAst(GeneratorEquationAst::Type::CI, variables[i]->mVariable, nullptr),
+                                                        resetValueAst(i));
+
+            resetValuesCode += mProfile->indentString()
+                               + generateCode(resetValue->mLeft) + mProfile->assignmentString() + generateCode(resetValue->mRight)
+                               + mProfile->commandSeparatorString() + "\n";
+            assignmentsCode += mProfile->indentString()
+                               + generateCode(assignment->mLeft) + mProfile->assignmentString() + generateCode(assignment->mRight)
+                               + mProfile->commandSeparatorString() + "\n";
+        }
+
+        GeneratorTemplate(mProfile->implementationApplyResetsMethodString(),
+                          {"<RESET_VARIABLE_COUNT>", "<CODE>"})
+            .expandInto(code, std::to_string(variables.size()), algebraicCode + resetValuesCode + "\n" + assignmentsCode);
+    }
+}
+
+std::string Generator::GeneratorImpl::generateLookupTableDoubleCode(double value)
+{
+    // Generate the code for the given value, making sure that it can safely be
+    // used as an operand in our lookup table code.
+
+    std::string res = generateDoubleCode(convertToShortestString(value));
+
+    return std::signbit(value) ? "(" + res + ")" : res;
+}
+
+std::string Generator::GeneratorImpl::generateLookupTableValueCode(const GeneratorEquationAstPtr &ast)
+{
+    // Generate the code to retrieve the value of the given AST from our lookup
+    // table, falling back to its exact value outside the range of our lookup
+    // table.
+
+    mGeneratingExactCode = true;
+
+    std::string exactCode = generateCode(ast);
+
+    mGeneratingExactCode = false;
+
+    auto iter = std::find(mLookupTableColumnCodes.begin(), mLookupTableColumnCodes.end(), exactCode);
+
+    if (iter == mLookupTableColumnCodes.end()) {
+        return exactCode;
+    }
+
+    auto column = std::to_string(iter - mLookupTableColumnCodes.begin());
+    auto condition = newAst(GeneratorEquationAst::Type::AND,
+                            newAst(GeneratorEquationAst::Type::GEQ,
+                                   stateAst(mLookupTableState),
+                                   newConstantAst(mLookupTableMinimum)),
+                            newAst(GeneratorEquationAst::Type::LT,
+                                   stateAst(mLookupTableState),
+                                   newConstantAst(mLookupTableMinimum + static_cast<double>(mLookupTableIntervalCount) * mLookupTableStep)));
+    auto value = profileTemplate(ProfileTemplate::LOOKUP_TABLE_VALUE).expanded(column, generateCode(condition->mLeft->mLeft));
+
+    // Note: we always branch here, even if piecewise statements are to be
+    //       branchless, since our lookup table must never be read outside of
+    //       its range and the exact value should only be computed when it is
+    //       needed.
+
+    auto res = profileTemplate(ProfileTemplate::PIECEWISE_IF).expanded(generateCode(condition), value)
+               + profileTemplate(ProfileTemplate::PIECEWISE_ELSE).expanded(exactCode);
+    auto parent = ast->mParent;
+
+    return ((parent == nullptr) || (parent->mType == GeneratorEquationAst::Type::ASSIGNMENT)) ?
+               res :
+               "(" + res + ")";
+}
+
+void Generator::GeneratorImpl::addImplementationLookupTableCode(GeneratorCodeWriter &code)
+{
+    if (!mLookupTableColumns.empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        auto columnCount = std::to_string(mLookupTableColumns.size());
+        auto rowCount = std::to_string(mLookupTableIntervalCount + 1);
+        auto minimum = generateLookupTableDoubleCode(mLookupTableMinimum);
+        auto step = generateLookupTableDoubleCode(mLookupTableStep);
+        auto maximumIndex = std::to_string(mLookupTableIntervalCount - 1);
+
+        GeneratorTemplate(mProfile->implementationLookupTableString(),
+                          {"<ROW_COUNT>", "<COLUMN_COUNT>", "<MINIMUM>", "<STEP>", "<MAXIMUM_INDEX>"})
+            .expandInto(code, rowCount, columnCount, minimum, step, maximumIndex);
+
+        // Compute the entries of our lookup table, using the argument of our
+        // lookup table rather than our state.
+
+        std::string methodBody;
+
+        mGeneratingLookupTableCode = true;
+
+        for (size_t i = 0; i < mLookupTableColumns.size(); ++i) {
+            methodBody += mProfile->indentString() + mProfile->indentString()
+                          + profileTemplate(ProfileTemplate::LOOKUP_TABLE_ENTRY).expanded(std::to_string(i))
+                          + mProfile->assignmentString() + generateCode(mLookupTableColumns[i])
+                          + mProfile->commandSeparatorString() + "\n";
         }
 
-        break;
-    case GeneratorEquationAst::Type::OR:
-        if (mProfile->hasOrOperator()) {
-            code = generateOperatorCode(mProfile->orString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->orString(), ast);
-        }
+        mGeneratingLookupTableCode = false;
+
+        code += "\n";
+
+        GeneratorTemplate(mProfile->implementationComputeLookupTableMethodString(),
+                          {"<ROW_COUNT>", "<MINIMUM>", "<STEP>", "<CODE>"})
+            .expandInto(code, rowCount, minimum, step, methodBody);
+    }
+}
+
+size_t Generator::GeneratorImpl::codeCapacity() const
+{
+    // Estimate the size of the code to be generated, so that it can be
+    // reserved upfront rather than be reallocated as the code grows.
+
+    return MINIMUM_CODE_CAPACITY + CODE_CAPACITY_PER_ITEM * (mInternalVariables.size() + mEquations.size());
+}
+
+void Generator::GeneratorImpl::interfaceCode(GeneratorCodeWriter &code)
+{
+    if (!hasValidModel() || !mProfile->hasInterface()) {
+        return;
+    }
+
+    // Add code for the origin comment.
+
+    addOriginCommentCode(code);
+
+    // Add code for the header.
+
+    addInterfaceHeaderCode(code);
+
+    // Add code for the interface of the version of the profile and libCellML.
+
+    addVersionAndLibcellmlVersionCode(code, true);
+
+    // Add code for the interface of the number of states and variables.
 
-        break;
-    case GeneratorEquationAst::Type::XOR:
-        if (mProfile->hasXorOperator()) {
-            code = generateOperatorCode(mProfile->xorString(), ast);
-        } else {
-            code = generateTwoParameterFunctionCode(mProfile->xorString(), ast);
-        }
+    addStateAndVariableCountCode(code, true);
 
-        break;
-    case GeneratorEquationAst::Type::NOT:
-        if (mProfile->hasNotOperator()) {
-            code = mProfile->notString() + generateCode(ast->mLeft);
-        } else {
-            code = generateOneParameterFunctionCode(mProfile->notString(), ast);
-        }
+    // Add code for the variable information related objects.
 
-        break;
+    if (mProfile->hasInterface()) {
+        addVariableTypeObjectCode(code);
+        addVariableInfoObjectCode(code);
+        addVariableInfoWithTypeObjectCode(code);
+    }
 
-        // Arithmetic operators.
+    // Add code for the interface of the information about the variable of
+    // integration, states and (other) variables.
 
-    case GeneratorEquationAst::Type::PLUS:
-        if (ast->mRight != nullptr) {
-            code = generateOperatorCode(mProfile->plusString(), ast);
-        } else {
-            code = generateCode(ast->mLeft);
-        }
+    addInterfaceVoiStateAndVariableInfoCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::MINUS:
-        if (ast->mRight != nullptr) {
-            code = generateOperatorCode(mProfile->minusString(), ast);
-        } else {
-            code = generateMinusUnaryCode(ast);
-        }
+    // Add code for the interface of the sparsity pattern of the Jacobian.
 
-        break;
-    case GeneratorEquationAst::Type::TIMES:
-        code = generateOperatorCode(mProfile->timesString(), ast);
+    addInterfaceJacobianSparsityCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::DIVIDE:
-        code = generateOperatorCode(mProfile->divideString(), ast);
+    // Add code for the interface of the number of sensitivity and sweep
+    // parameters.
 
-        break;
-    case GeneratorEquationAst::Type::POWER: {
-        std::string stringValue = generateCode(ast->mRight);
-        double doubleValue;
-        bool validConversion = convertToDouble(stringValue, doubleValue);
+    determineParameterVariables();
+    addInterfaceSensitivityParameterCountCode(code);
+    addInterfaceSweepParameterCountCode(code);
 
-        if (validConversion && areEqual(doubleValue, 0.5)) {
-            code = generateOneParameterFunctionCode(mProfile->squareRootString(), ast);
-        } else if (validConversion && areEqual(doubleValue, 2.0)
-                   && !mProfile->squareString().empty()) {
-            code = generateOneParameterFunctionCode(mProfile->squareString(), ast);
-        } else {
-            code = mProfile->hasPowerOperator() ?
-                       generateOperatorCode(mProfile->powerString(), ast) :
-                       mProfile->powerString() + "(" + generateCode(ast->mLeft) + ", " + stringValue + ")";
-        }
+    // Add code for the interface of the number of resets.
 
-        break;
-    }
-    case GeneratorEquationAst::Type::ROOT:
-        if (ast->mRight != nullptr) {
-            double doubleValue;
+    addInterfaceResetCountCode(code);
 
-            if (convertToDouble(generateCode(ast->mLeft), doubleValue)
-                && areEqual(doubleValue, 2.0)) {
-                code = mProfile->squareRootString() + "(" + generateCode(ast->mRight) + ")";
-            } else {
-                GeneratorEquationAstPtr rootValueAst = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::DIVIDE, ast);
+    // Add code for the interface to create and delete arrays.
 
-                rootValueAst->mLeft = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::CN, "1.0", rootValueAst);
-                rootValueAst->mRight = std::make_shared<GeneratorEquationAst>(ast->mLeft, rootValueAst);
+    addInterfaceCreateDeleteArrayMethodsCode(code);
 
-                code = mProfile->hasPowerOperator() ?
-                           generateOperatorCode(mProfile->powerString(), ast) :
-                           mProfile->powerString() + "(" + generateCode(ast->mRight) + ", " + generateOperatorCode(mProfile->divideString(), rootValueAst) + ")";
-            }
-        } else {
-            code = generateOneParameterFunctionCode(mProfile->squareRootString(), ast);
-        }
+    // Add code for the interface to compute the model.
 
-        break;
-    case GeneratorEquationAst::Type::ABS:
-        code = generateOneParameterFunctionCode(mProfile->absoluteValueString(), ast);
+    addInterfaceComputeModelMethodsCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::EXP:
-        code = generateOneParameterFunctionCode(mProfile->exponentialString(), ast);
+}
 
-        break;
-    case GeneratorEquationAst::Type::LN:
-        code = generateOneParameterFunctionCode(mProfile->napierianLogarithmString(), ast);
 
-        break;
-    case GeneratorEquationAst::Type::LOG:
-        if (ast->mRight != nullptr) {
-            std::string stringValue = generateCode(ast->mLeft);
-            double doubleValue;
+void Generator::GeneratorImpl::implementationCode(GeneratorCodeWriter &code)
+{
+    if (!hasValidModel()) {
+        return;
+    }
 
-            if (convertToDouble(stringValue, doubleValue)
-                && areEqual(doubleValue, 10.0)) {
-                code = mProfile->commonLogarithmString() + "(" + generateCode(ast->mRight) + ")";
-            } else {
-                code = mProfile->napierianLogarithmString() + "(" + generateCode(ast->mRight) + ")/" + mProfile->napierianLogarithmString() + "(" + stringValue + ")";
-            }
-        } else {
-            code = generateOneParameterFunctionCode(mProfile->commonLogarithmString(), ast);
-        }
+    // Allocate the ASTs that we need to generate our code, e.g. for our
+    // Jacobian, from a new arena.
 
-        break;
-    case GeneratorEquationAst::Type::CEILING:
-        code = generateOneParameterFunctionCode(mProfile->ceilingString(), ast);
+    GeneratorAstArenaScope astArenaScope(std::make_shared<GeneratorAstArena>());
 
-        break;
-    case GeneratorEquationAst::Type::FLOOR:
-        code = generateOneParameterFunctionCode(mProfile->floorString(), ast);
+    // Forget about the derivatives that we may have memoised while generating
+    // some code for a previous version of our model.
 
-        break;
-    case GeneratorEquationAst::Type::MIN:
-        code = generateTwoParameterFunctionCode(mProfile->minString(), ast);
+    mDerivatives.clear();
 
-        break;
-    case GeneratorEquationAst::Type::MAX:
-        code = generateTwoParameterFunctionCode(mProfile->maxString(), ast);
+    // Compute our Jacobian, if needed, and this before generating any code
+    // since it may require some additional functions.
 
-        break;
-    case GeneratorEquationAst::Type::REM:
-        code = generateTwoParameterFunctionCode(mProfile->remString(), ast);
+    if (useJacobian()) {
+        computeJacobian();
+    }
 
-        break;
+    // Likewise for our Rush-Larsen step.
 
-        // Calculus elements.
+    if (mProfile->hasRushLarsen() && (mModelType == Generator::ModelType::ODE)) {
+        computeRushLarsenSteps();
+    }
 
-    case GeneratorEquationAst::Type::DIFF:
-        code = generateCode(ast->mRight);
+    // Likewise for our sensitivity rates.
 
-        break;
+    determineParameterVariables();
+    computeSensitivityRates();
 
-        // Trigonometric operators.
+    // Likewise for our lookup table, although the functions it may require are
+    // only needed for this implementation.
 
-    case GeneratorEquationAst::Type::SIN:
-        code = generateOneParameterFunctionCode(mProfile->sinString(), ast);
+    bool needLt = mNeedLt;
+    bool needGeq = mNeedGeq;
+    bool needAnd = mNeedAnd;
 
-        break;
-    case GeneratorEquationAst::Type::COS:
-        code = generateOneParameterFunctionCode(mProfile->cosString(), ast);
+    computeLookupTable();
 
-        break;
-    case GeneratorEquationAst::Type::TAN:
-        code = generateOneParameterFunctionCode(mProfile->tanString(), ast);
+    // Add code for the origin comment.
 
-        break;
-    case GeneratorEquationAst::Type::SEC:
-        code = generateOneParameterFunctionCode(mProfile->secString(), ast);
+    addOriginCommentCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::CSC:
-        code = generateOneParameterFunctionCode(mProfile->cscString(), ast);
+    // Add code for the header.
 
-        break;
-    case GeneratorEquationAst::Type::COT:
-        code = generateOneParameterFunctionCode(mProfile->cotString(), ast);
+    addImplementationHeaderCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::SINH:
-        code = generateOneParameterFunctionCode(mProfile->sinhString(), ast);
+    // Add code for the implementation of the version of the profile and
+    // libCellML.
 
-        break;
-    case GeneratorEquationAst::Type::COSH:
-        code = generateOneParameterFunctionCode(mProfile->coshString(), ast);
+    addVersionAndLibcellmlVersionCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::TANH:
-        code = generateOneParameterFunctionCode(mProfile->tanhString(), ast);
+    // Add code for the implementation of the number of states and variables.
 
-        break;
-    case GeneratorEquationAst::Type::SECH:
-        code = generateOneParameterFunctionCode(mProfile->sechString(), ast);
+    addStateAndVariableCountCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::CSCH:
-        code = generateOneParameterFunctionCode(mProfile->cschString(), ast);
+    // Add code for the variable information related objects.
 
-        break;
-    case GeneratorEquationAst::Type::COTH:
-        code = generateOneParameterFunctionCode(mProfile->cothString(), ast);
+    if (!mProfile->hasInterface()) {
+        addVariableTypeObjectCode(code);
+        addVariableInfoObjectCode(code);
+        addVariableInfoWithTypeObjectCode(code);
+    }
 
-        break;
-    case GeneratorEquationAst::Type::ASIN:
-        code = generateOneParameterFunctionCode(mProfile->asinString(), ast);
+    // Add code for the implementation of the information about the variable of
+    // integration, states and (other) variables.
 
-        break;
-    case GeneratorEquationAst::Type::ACOS:
-        code = generateOneParameterFunctionCode(mProfile->acosString(), ast);
+    addImplementationVoiInfoCode(code);
+    addImplementationStateInfoCode(code);
+    addImplementationVariableInfoCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::ATAN:
-        code = generateOneParameterFunctionCode(mProfile->atanString(), ast);
+    // Add code for the implementation of the sparsity pattern of the Jacobian.
 
-        break;
-    case GeneratorEquationAst::Type::ASEC:
-        code = generateOneParameterFunctionCode(mProfile->asecString(), ast);
+    addImplementationJacobianSparsityCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::ACSC:
-        code = generateOneParameterFunctionCode(mProfile->acscString(), ast);
+    // Add code for the implementation of the number of sensitivity and sweep
+    // parameters.
 
-        break;
-    case GeneratorEquationAst::Type::ACOT:
-        code = generateOneParameterFunctionCode(mProfile->acotString(), ast);
+    addImplementationSensitivityParameterCountCode(code);
+    addImplementationSweepParameterCountCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::ASINH:
-        code = generateOneParameterFunctionCode(mProfile->asinhString(), ast);
+    // Add code for the implementation of the number of resets.
 
-        break;
-    case GeneratorEquationAst::Type::ACOSH:
-        code = generateOneParameterFunctionCode(mProfile->acoshString(), ast);
+    addImplementationResetCountCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::ATANH:
-        code = generateOneParameterFunctionCode(mProfile->atanhString(), ast);
+    // Add code for the arithmetic and trigonometric functions.
 
-        break;
-    case GeneratorEquationAst::Type::ASECH:
-        code = generateOneParameterFunctionCode(mProfile->asechString(), ast);
+    addArithmeticFunctionsCode(code);
+    addTrigonometricFunctionsCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::ACSCH:
-        code = generateOneParameterFunctionCode(mProfile->acschString(), ast);
+    // Add code for the implementation of our lookup table and of the method to
+    // compute it.
 
-        break;
-    case GeneratorEquationAst::Type::ACOTH:
-        code = generateOneParameterFunctionCode(mProfile->acothString(), ast);
+    addImplementationLookupTableCode(code);
 
-        break;
+    // Add code for the implementation to create and delete arrays.
 
-        // Piecewise statement.
+    addImplementationCreateStatesArrayMethodCode(code);
+    addImplementationCreateVariablesArrayMethodCode(code);
+    addImplementationDeleteArrayMethodCode(code);
 
-    case GeneratorEquationAst::Type::PIECEWISE:
-        if (ast->mRight != nullptr) {
-            if (ast->mRight->mType == GeneratorEquationAst::Type::PIECE) {
-                code = generateCode(ast->mLeft) + generatePiecewiseElseCode(generateCode(ast->mRight) + generatePiecewiseElseCode(mProfile->nanString()));
-            } else {
-                code = generateCode(ast->mLeft) + generatePiecewiseElseCode(generateCode(ast->mRight));
-            }
-        } else {
-            code = generateCode(ast->mLeft) + generatePiecewiseElseCode(mProfile->nanString());
-        }
+    // Add code for the implementation to initialise our states and constants.
 
-        break;
-    case GeneratorEquationAst::Type::PIECE:
-        code = generatePiecewiseIfCode(generateCode(ast->mRight), generateCode(ast->mLeft));
+    GeneratorEquationSet remainingEquations(mEquations.size());
 
-        break;
-    case GeneratorEquationAst::Type::OTHERWISE:
-        code = generateCode(ast->mLeft);
+    for (const auto &equation : mEquations) {
+        remainingEquations.insert(equation);
+    }
 
-        break;
+    addImplementationInitializeStatesAndConstantsMethodCode(code, remainingEquations);
 
-        // Token elements.
+    // Add code for the implementation to compute our computed constants.
 
-    case GeneratorEquationAst::Type::CI:
-        code = generateVariableNameCode(ast->mVariable, ast);
+    addImplementationComputeComputedConstantsMethodCode(code, remainingEquations);
 
-        break;
-    case GeneratorEquationAst::Type::CN:
-        code = generateDoubleCode(ast->mValue);
+    // Add code for the implementation to compute our rates (and any variables
+    // on which they depend).
 
-        break;
+    addImplementationComputeRatesMethodCode(code, remainingEquations);
 
-        // Qualifier elements.
+    // Add code for the implementation to compute our variables.
+    // Note: this method computes the remaining variables, i.e. the ones not
+    //       needed to compute our rates, but also the variables that depend on
+    //       the value of some states/rates. Indeed, this method is typically
+    //       called after having integrated a model, thus ensuring that
+    //       variables that rely on the value of some states/rates are up to
+    //       date.
 
-    case GeneratorEquationAst::Type::DEGREE:
-    case GeneratorEquationAst::Type::LOGBASE:
-    case GeneratorEquationAst::Type::BVAR:
-        code = generateCode(ast->mLeft);
+    addImplementationComputeVariablesMethodCode(code, remainingEquations);
 
-        break;
+    // Add code for the implementation to compute our Jacobian.
+
+    addImplementationComputeJacobianMethodCode(code);
 
-        // Constants.
+    // Add code for the implementation to compute a Rush-Larsen step.
 
-    case GeneratorEquationAst::Type::TRUE:
-        code = mProfile->trueString();
+    addImplementationComputeRushLarsenStepMethodCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::FALSE:
-        code = mProfile->falseString();
+    // Add code for the implementation to compute our sensitivity rates.
 
-        break;
-    case GeneratorEquationAst::Type::E:
-        code = mProfile->eString();
+    addImplementationComputeSensitivityRatesMethodCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::PI:
-        code = mProfile->piString();
+    // Add code for the implementation of the batch methods to initialise our
+    // states and constants, and to compute our rates.
 
-        break;
-    case GeneratorEquationAst::Type::INF:
-        code = mProfile->infString();
+    addImplementationInitializeStatesAndConstantsBatchMethodCode(code);
+    addImplementationComputeRatesBatchMethodCode(code);
 
-        break;
-    case GeneratorEquationAst::Type::NAN:
-        code = mProfile->nanString();
+    // Add code for the implementation of the specialised methods to compute our
+    // rates and variables, i.e. using the current values of our (computed)
+    // constants.
 
-        break;
+    if (mHasSpecializedMethods) {
+        computeSpecializedValues();
     }
 
-    return code;
+    addImplementationComputeRatesSpecializedMethodCode(code);
+    addImplementationComputeVariablesSpecializedMethodCode(code, remainingEquations);
+
+    // Add code for the implementation to compute the roots of our resets and to
+    // apply them.
+
+    addImplementationComputeRootsMethodCode(code);
+    addImplementationApplyResetsMethodCode(code);
+
+    mNeedLt = needLt;
+    mNeedGeq = needGeq;
+    mNeedAnd = needAnd;
 }
 
-std::string Generator::GeneratorImpl::generateInitializationCode(const GeneratorInternalVariablePtr &variable)
+Generator::Generator()
+    : mPimpl(new GeneratorImpl())
 {
-    return mProfile->indentString() + generateVariableNameCode(variable->mVariable) + " = " + generateDoubleCode(variable->mVariable->initialValue()) + mProfile->commandSeparatorString() + "\n";
+    mPimpl->mGenerator = this;
 }
 
-std::string Generator::GeneratorImpl::generateEquationCode(const GeneratorEquationPtr &equation,
-                                                           std::vector<GeneratorEquationPtr> &remainingEquations,
-                                                           bool onlyStateRateBasedEquations)
+Generator::~Generator()
 {
-    std::string res;
+    delete mPimpl;
+}
 
-    for (const auto &dependency : equation->mDependencies) {
-        if (!onlyStateRateBasedEquations
-            || ((dependency->mType == GeneratorEquation::Type::ALGEBRAIC)
-                && dependency->mIsStateRateBased)) {
-            res += generateEquationCode(dependency, remainingEquations, onlyStateRateBasedEquations);
-        }
-    }
+GeneratorPtr Generator::create() noexcept
+{
+    return std::shared_ptr<Generator> {new Generator {}};
+}
 
-    auto equationIter = std::find(remainingEquations.begin(), remainingEquations.end(), equation);
+GeneratorProfilePtr Generator::profile()
+{
+    return mPimpl->mProfile;
+}
 
-    if (equationIter != remainingEquations.end()) {
-        res += mProfile->indentString() + generateCode(equation->mAst) + mProfile->commandSeparatorString() + "\n";
+void Generator::setProfile(const GeneratorProfilePtr &profile)
+{
+    mPimpl->mProfile = profile;
+    mPimpl->mCachedProfile.reset();
+}
 
-        remainingEquations.erase(equationIter);
+void Generator::addRequiredOutput(const VariablePtr &variable)
+{
+    if ((variable == nullptr)
+        || !mPimpl->mRequiredOutputSet.insert(variable).second) {
+        return;
     }
 
-    return res;
+    mPimpl->mRequiredOutputs.push_back(variable);
+
+    if (mPimpl->hasValidModel()) {
+        mPimpl->checkRequiredOutput(variable);
+    }
 }
-void Generator::GeneratorImpl::addInterfaceComputeModelMethodsCode(std::string &code)
+
+void Generator::removeAllRequiredOutputs()
 {
-    std::string interfaceComputeModelMethodsCode;
+    mPimpl->mRequiredOutputs.clear();
+    mPimpl->mRequiredOutputSet.clear();
+}
 
-    if (!mProfile->interfaceInitializeStatesAndConstantsMethodString().empty()) {
-        interfaceComputeModelMethodsCode += mProfile->interfaceInitializeStatesAndConstantsMethodString();
-    }
+void Generator::setLookupTable(const VariablePtr &variable, double minimum,
+                               double maximum, double step)
+{
+    mPimpl->mHasLookupTable = (minimum < maximum) && (step > 0.0);
+    mPimpl->mLookupTableVariable = mPimpl->mHasLookupTable ? variable : nullptr;
+    mPimpl->mLookupTableMinimum = mPimpl->mHasLookupTable ? minimum : 0.0;
+    mPimpl->mLookupTableMaximum = mPimpl->mHasLookupTable ? maximum : 0.0;
+    mPimpl->mLookupTableStep = mPimpl->mHasLookupTable ? step : 0.0;
+}
 
-    if (!mProfile->interfaceComputeComputedConstantsMethodString().empty()) {
-        interfaceComputeModelMethodsCode += mProfile->interfaceComputeComputedConstantsMethodString();
-    }
+void Generator::removeLookupTable()
+{
+    setLookupTable(nullptr, 0.0, 0.0, 0.0);
+}
 
-    if (!mProfile->interfaceComputeRatesMethodString().empty()) {
-        interfaceComputeModelMethodsCode += mProfile->interfaceComputeRatesMethodString();
-    }
+bool Generator::hasLookupTable() const
+{
+    return mPimpl->mHasLookupTable;
+}
 
-    if (!mProfile->interfaceComputeVariablesMethodString().empty()) {
-        interfaceComputeModelMethodsCode += mProfile->interfaceComputeVariablesMethodString();
-    }
+VariablePtr Generator::lookupTableVariable() const
+{
+    return mPimpl->mLookupTableVariable;
+}
 
-    if (!interfaceComputeModelMethodsCode.empty()) {
-        code += "\n";
-    }
+double Generator::lookupTableMinimum() const
+{
+    return mPimpl->mLookupTableMinimum;
+}
 
-    code += interfaceComputeModelMethodsCode;
+double Generator::lookupTableMaximum() const
+{
+    return mPimpl->mLookupTableMaximum;
 }
 
-void Generator::GeneratorImpl::addImplementationInitializeStatesAndConstantsMethodCode(std::string &code,
-                                                                                       std::vector<GeneratorEquationPtr> &remainingEquations)
+double Generator::lookupTableStep() const
 {
-    if (!mProfile->implementationInitializeStatesAndConstantsMethodString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    return mPimpl->mLookupTableStep;
+}
 
-        std::string methodBody;
+void Generator::setHasSpecializedMethods(bool hasSpecializedMethods)
+{
+    mPimpl->mHasSpecializedMethods = hasSpecializedMethods;
+}
 
-        for (const auto &internalVariable : mInternalVariables) {
-            if ((internalVariable->mType == GeneratorInternalVariable::Type::STATE)
-                || (internalVariable->mType == GeneratorInternalVariable::Type::CONSTANT)) {
-                methodBody += generateInitializationCode(internalVariable);
-            }
-        }
+bool Generator::hasSpecializedMethods() const
+{
+    return mPimpl->mHasSpecializedMethods;
+}
 
-        for (const auto &equation : mEquations) {
-            if (equation->mType == GeneratorEquation::Type::TRUE_CONSTANT) {
-                methodBody += generateEquationCode(equation, remainingEquations);
-            }
-        }
+void Generator::setMaximumStatementCount(size_t maximumStatementCount)
+{
+    mPimpl->mMaximumStatementCount = maximumStatementCount;
+}
 
-        code += replace(mProfile->implementationInitializeStatesAndConstantsMethodString(),
-                        "<CODE>", generateMethodBodyCode(methodBody));
-    }
+size_t Generator::maximumStatementCount() const
+{
+    return mPimpl->mMaximumStatementCount;
 }
 
-void Generator::GeneratorImpl::addImplementationComputeComputedConstantsMethodCode(std::string &code,
-                                                                                   std::vector<GeneratorEquationPtr> &remainingEquations)
+void Generator::setParallelChunkSize(size_t parallelChunkSize)
 {
-    if (!mProfile->implementationComputeComputedConstantsMethodString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    mPimpl->mParallelChunkSize = parallelChunkSize;
+}
 
-        std::string methodBody;
+size_t Generator::parallelChunkSize() const
+{
+    return mPimpl->mParallelChunkSize;
+}
 
-        for (const auto &equation : mEquations) {
-            if (equation->mType == GeneratorEquation::Type::VARIABLE_BASED_CONSTANT) {
-                methodBody += generateEquationCode(equation, remainingEquations);
-            }
-        }
+void Generator::setMinimumInstanceCount(size_t minimumInstanceCount)
+{
+    mPimpl->mMinimumInstanceCount = minimumInstanceCount;
+}
 
-        code += replace(mProfile->implementationComputeComputedConstantsMethodString(),
-                        "<CODE>", generateMethodBodyCode(methodBody));
-    }
+size_t Generator::minimumInstanceCount() const
+{
+    return mPimpl->mMinimumInstanceCount;
 }
 
-void Generator::GeneratorImpl::addImplementationComputeRatesMethodCode(std::string &code,
-                                                                       std::vector<GeneratorEquationPtr> &remainingEquations)
+void Generator::setMaximumThreadCount(size_t maximumThreadCount)
 {
-    if (!mProfile->implementationComputeRatesMethodString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    mPimpl->mMaximumThreadCount = maximumThreadCount;
+}
 
-        std::string methodBody;
+size_t Generator::maximumThreadCount() const
+{
+    return mPimpl->mMaximumThreadCount;
+}
 
-        for (const auto &equation : mEquations) {
-            if (equation->mType == GeneratorEquation::Type::RATE) {
-                methodBody += generateEquationCode(equation, remainingEquations);
-            }
-        }
+void Generator::setVariableOrdering(VariableOrdering variableOrdering)
+{
+    mPimpl->mVariableOrdering = variableOrdering;
 
-        code += replace(mProfile->implementationComputeRatesMethodString(),
-                        "<CODE>", generateMethodBodyCode(methodBody));
+    if (mPimpl->hasValidModel()) {
+        mPimpl->orderVariables();
     }
 }
 
-void Generator::GeneratorImpl::addImplementationComputeVariablesMethodCode(std::string &code,
-                                                                           std::vector<GeneratorEquationPtr> &remainingEquations)
+Generator::VariableOrdering Generator::variableOrdering() const
 {
-    if (!mProfile->implementationComputeVariablesMethodString().empty()) {
-        if (!code.empty()) {
-            code += "\n";
-        }
+    return mPimpl->mVariableOrdering;
+}
 
-        std::vector<GeneratorEquationPtr> newRemainingEquations {std::begin(mEquations), std::end(mEquations)};
+void Generator::setAnalysisCacheSize(size_t analysisCacheSize)
+{
+    mPimpl->mAnalysisCacheSize = analysisCacheSize;
 
-        std::string methodBody;
+    while (mPimpl->mAnalysisCache.size() > analysisCacheSize) {
+        mPimpl->mAnalysisCache.pop_back();
+    }
+}
 
-        for (const auto &equation : mEquations) {
-            if ((std::find(remainingEquations.begin(), remainingEquations.end(), equation) != remainingEquations.end())
-                || ((equation->mType == GeneratorEquation::Type::ALGEBRAIC)
-                    && equation->mIsStateRateBased)) {
-                methodBody += generateEquationCode(equation, newRemainingEquations, true);
-            }
-        }
+size_t Generator::analysisCacheSize() const
+{
+    return mPimpl->mAnalysisCacheSize;
+}
+
+size_t Generator::requiredOutputCount() const
+{
+    return mPimpl->mRequiredOutputs.size();
+}
 
-        code += replace(mProfile->implementationComputeVariablesMethodString(),
-                        "<CODE>", generateMethodBodyCode(methodBody));
+VariablePtr Generator::requiredOutput(size_t index) const
+{
+    VariablePtr variable = nullptr;
+    if (index < mPimpl->mRequiredOutputs.size()) {
+        variable = mPimpl->mRequiredOutputs.at(index);
     }
+    return variable;
 }
 
-Generator::Generator()
-    : mPimpl(new GeneratorImpl())
+void Generator::addSensitivityParameter(const VariablePtr &variable)
 {
-    mPimpl->mGenerator = this;
+    if (variable != nullptr) {
+        mPimpl->mSensitivityParameters.push_back(variable);
+    }
 }
 
-Generator::~Generator()
+void Generator::removeAllSensitivityParameters()
 {
-    delete mPimpl;
+    mPimpl->mSensitivityParameters.clear();
 }
 
-GeneratorPtr Generator::create() noexcept
+size_t Generator::sensitivityParameterCount() const
 {
-    return std::shared_ptr<Generator> {new Generator {}};
+    return mPimpl->mSensitivityParameters.size();
 }
 
-GeneratorProfilePtr Generator::profile()
+VariablePtr Generator::sensitivityParameter(size_t index) const
 {
-    return mPimpl->mProfile;
+    VariablePtr variable = nullptr;
+    if (index < mPimpl->mSensitivityParameters.size()) {
+        variable = mPimpl->mSensitivityParameters.at(index);
+    }
+    return variable;
 }
 
-void Generator::setProfile(const GeneratorProfilePtr &profile)
+void Generator::addSweepParameter(const VariablePtr &variable)
 {
-    mPimpl->mProfile = profile;
+    if (variable != nullptr) {
+        mPimpl->mSweepParameters.push_back(variable);
+    }
+}
+
+void Generator::removeAllSweepParameters()
+{
+    mPimpl->mSweepParameters.clear();
+}
+
+size_t Generator::sweepParameterCount() const
+{
+    return mPimpl->mSweepParameters.size();
+}
+
+VariablePtr Generator::sweepParameter(size_t index) const
+{
+    VariablePtr variable = nullptr;
+    if (index < mPimpl->mSweepParameters.size()) {
+        variable = mPimpl->mSweepParameters.at(index);
+    }
+    return variable;
 }
 
 void Generator::processModel(const ModelPtr &model)
@@ -3551,131 +9596,58 @@ GeneratorVariablePtr Generator::variable(size_t index) const
     return mPimpl->mVariables[index];
 }
 
-std::string Generator::interfaceCode() const
+size_t Generator::equationCount() const
 {
-    if (!mPimpl->hasValidModel() || !mPimpl->mProfile->hasInterface()) {
-        return {};
-    }
-
-    // Add code for the origin comment.
-
-    std::string res;
-
-    mPimpl->addOriginCommentCode(res);
-
-    // Add code for the header.
-
-    mPimpl->addInterfaceHeaderCode(res);
-
-    // Add code for the interface of the version of the profile and libCellML.
-
-    mPimpl->addVersionAndLibcellmlVersionCode(res, true);
-
-    // Add code for the interface of the number of states and variables.
-
-    mPimpl->addStateAndVariableCountCode(res, true);
-
-    // Add code for the variable information related objects.
-
-    if (mPimpl->mProfile->hasInterface()) {
-        mPimpl->addVariableTypeObjectCode(res);
-        mPimpl->addVariableInfoObjectCode(res);
-        mPimpl->addVariableInfoWithTypeObjectCode(res);
+    if (!mPimpl->hasValidModel()) {
+        return 0;
     }
 
-    // Add code for the interface of the information about the variable of
-    // integration, states and (other) variables.
-
-    mPimpl->addInterfaceVoiStateAndVariableInfoCode(res);
-
-    // Add code for the interface to create and delete arrays.
-
-    mPimpl->addInterfaceCreateDeleteArrayMethodsCode(res);
-
-    // Add code for the interface to compute the model.
-
-    mPimpl->addInterfaceComputeModelMethodsCode(res);
-
-    return res;
+    return mPimpl->apiEquations().size();
 }
 
-std::string Generator::implementationCode() const
+GeneratorEquationPtr Generator::equation(size_t index) const
 {
-    if (!mPimpl->hasValidModel()) {
+    if (!mPimpl->hasValidModel() || (index >= mPimpl->apiEquations().size())) {
         return {};
     }
 
-    std::string res;
-
-    // Add code for the origin comment.
-
-    mPimpl->addOriginCommentCode(res);
-
-    // Add code for the header.
-
-    mPimpl->addImplementationHeaderCode(res);
-
-    // Add code for the implementation of the version of the profile and
-    // libCellML.
-
-    mPimpl->addVersionAndLibcellmlVersionCode(res);
-
-    // Add code for the implementation of the number of states and variables.
-
-    mPimpl->addStateAndVariableCountCode(res);
-
-    // Add code for the variable information related objects.
-
-    if (!mPimpl->mProfile->hasInterface()) {
-        mPimpl->addVariableTypeObjectCode(res);
-        mPimpl->addVariableInfoObjectCode(res);
-        mPimpl->addVariableInfoWithTypeObjectCode(res);
-    }
-
-    // Add code for the implementation of the information about the variable of
-    // integration, states and (other) variables.
-
-    mPimpl->addImplementationVoiInfoCode(res);
-    mPimpl->addImplementationStateInfoCode(res);
-    mPimpl->addImplementationVariableInfoCode(res);
-
-    // Add code for the arithmetic and trigonometric functions.
-
-    mPimpl->addArithmeticFunctionsCode(res);
-    mPimpl->addTrigonometricFunctionsCode(res);
+    return mPimpl->apiEquations()[index];
+}
 
-    // Add code for the implementation to create and delete arrays.
+std::string Generator::interfaceCode() const
+{
+    GeneratorCodeWriter code(mPimpl->codeCapacity());
 
-    mPimpl->addImplementationCreateStatesArrayMethodCode(res);
-    mPimpl->addImplementationCreateVariablesArrayMethodCode(res);
-    mPimpl->addImplementationDeleteArrayMethodCode(res);
+    mPimpl->interfaceCode(code);
 
-    // Add code for the implementation to initialise our states and constants.
+    return code.code();
+}
 
-    std::vector<GeneratorEquationPtr> remainingEquations {std::begin(mPimpl->mEquations), std::end(mPimpl->mEquations)};
+std::string Generator::implementationCode() const
+{
+    GeneratorCodeWriter code(mPimpl->codeCapacity());
 
-    mPimpl->addImplementationInitializeStatesAndConstantsMethodCode(res, remainingEquations);
+    mPimpl->implementationCode(code);
 
-    // Add code for the implementation to compute our computed constants.
+    return code.code();
+}
 
-    mPimpl->addImplementationComputeComputedConstantsMethodCode(res, remainingEquations);
+void Generator::writeInterfaceCode(std::ostream &stream) const
+{
+    GeneratorCodeWriter code(STREAMED_CODE_CAPACITY, &stream);
 
-    // Add code for the implementation to compute our rates (and any variables
-    // on which they depend).
+    mPimpl->interfaceCode(code);
 
-    mPimpl->addImplementationComputeRatesMethodCode(res, remainingEquations);
+    code.flush();
+}
 
-    // Add code for the implementation to compute our variables.
-    // Note: this method computes the remaining variables, i.e. the ones not
-    //       needed to compute our rates, but also the variables that depend on
-    //       the value of some states/rates. Indeed, this method is typically
-    //       called after having integrated a model, thus ensuring that
-    //       variables that rely on the value of some states/rates are up to
-    //       date.
+void Generator::writeImplementationCode(std::ostream &stream) const
+{
+    GeneratorCodeWriter code(STREAMED_CODE_CAPACITY, &stream);
 
-    mPimpl->addImplementationComputeVariablesMethodCode(res, remainingEquations);
+    mPimpl->implementationCode(code);
 
-    return res;
+    code.flush();
 }
 
 } // namespace libcellml
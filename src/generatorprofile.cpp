@@ -21,6 +21,7 @@ limitations under the License.
 #include "libcellml/generatorprofile.h"
 
 #include <cmath>
+#include <regex>
 #include <string>
 
 #include "utilities.h"
@@ -34,14 +35,39 @@ namespace libcellml {
  */
 struct GeneratorProfile::GeneratorProfileImpl
 {
+    // The revision of the profile, which gets incremented every time the
+    // profile is modified.
+
+    size_t mRevision = 0;
+
     // Whether the profile is official.
 
     GeneratorProfile::Profile mProfile = Profile::C;
 
+    // The floating-point precision of the generated code.
+
+    GeneratorProfile::Precision mPrecision = Precision::DOUBLE;
+
     // Whether the profile requires an interface to be generated.
 
     bool mHasInterface = true;
 
+    // Whether the profile requires the generated code to be optimised.
+
+    bool mHasCodeOptimization = false;
+
+    // Whether the profile requires the Jacobian to be generated.
+
+    bool mHasJacobian = false;
+
+    // Whether the profile requires a Rush-Larsen step to be generated.
+
+    bool mHasRushLarsen = false;
+
+    // Whether the profile requires piecewise statements to be branchless.
+
+    bool mHasBranchlessPiecewise = false;
+
     // Assignment.
 
     std::string mAssignmentString;
@@ -122,6 +148,9 @@ struct GeneratorProfile::GeneratorProfileImpl
 
     std::string mConditionalOperatorIfString;
     std::string mConditionalOperatorElseString;
+
+    std::string mBranchlessPiecewiseIfString;
+    std::string mBranchlessPiecewiseElseString;
     std::string mPiecewiseIfString;
     std::string mPiecewiseElseString;
 
@@ -136,6 +165,8 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mInfString;
     std::string mNanString;
 
+    std::string mFloatingPointLiteralSuffixString;
+
     // Arithmetic functions.
 
     std::string mEqFunctionString;
@@ -151,6 +182,8 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mMinFunctionString;
     std::string mMaxFunctionString;
 
+    std::string mBlendFunctionString;
+
     // Trigonometric functions.
 
     std::string mSecFunctionString;
@@ -206,15 +239,46 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mInterfaceVariableInfoString;
     std::string mImplementationVariableInfoString;
 
+    std::string mInterfaceJacobianSparsityString;
+    std::string mImplementationJacobianSparsityString;
+
+    std::string mEmptyJacobianColumnIndicesString;
+
+    std::string mInterfaceSensitivityParameterCountString;
+    std::string mImplementationSensitivityParameterCountString;
+
+    std::string mInterfaceSweepParameterCountString;
+    std::string mImplementationSweepParameterCountString;
+
+    std::string mInterfaceResetCountString;
+    std::string mImplementationResetCountString;
+
     std::string mVariableInfoEntryString;
     std::string mVariableInfoWithTypeEntryString;
 
     std::string mVoiString;
 
+    std::string mTimeStepString;
+
     std::string mStatesArrayString;
     std::string mRatesArrayString;
     std::string mVariablesArrayString;
 
+    std::string mJacobianArrayString;
+
+    std::string mSensitivitiesArrayString;
+    std::string mSensitivityRatesArrayString;
+
+    std::string mSweepParametersArrayString;
+    std::string mBatchArrayIndexString;
+    std::string mBatchSweepParameterIndexString;
+
+    std::string mInstanceArrayIndexString;
+
+    std::string mRootsArrayString;
+    std::string mEventsArrayString;
+    std::string mResetValuesArrayString;
+
     std::string mInterfaceCreateStatesArrayMethodString;
     std::string mImplementationCreateStatesArrayMethodString;
 
@@ -230,12 +294,65 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mInterfaceComputeComputedConstantsMethodString;
     std::string mImplementationComputeComputedConstantsMethodString;
 
+    std::string mImplementationComputeComputedConstantsMethodChunkString;
+    std::string mComputeComputedConstantsMethodChunkCallString;
+
     std::string mInterfaceComputeRatesMethodString;
     std::string mImplementationComputeRatesMethodString;
 
+    std::string mImplementationComputeRatesMethodChunkString;
+    std::string mComputeRatesMethodChunkCallString;
+
+    std::string mImplementationComputeRatesMethodKernelString;
+    std::string mComputeRatesMethodKernelCallString;
+
     std::string mInterfaceComputeVariablesMethodString;
     std::string mImplementationComputeVariablesMethodString;
 
+    std::string mImplementationComputeVariablesMethodChunkString;
+    std::string mComputeVariablesMethodChunkCallString;
+
+    std::string mImplementationComputeVariablesMethodKernelString;
+    std::string mComputeVariablesMethodKernelCallString;
+
+    std::string mParallelRegionString;
+    std::string mParallelLevelString;
+    std::string mParallelTaskString;
+
+    std::string mInterfaceComputeJacobianMethodString;
+    std::string mImplementationComputeJacobianMethodString;
+
+    std::string mInterfaceComputeRushLarsenStepMethodString;
+    std::string mImplementationComputeRushLarsenStepMethodString;
+
+    std::string mRushLarsenExponentString;
+    std::string mImplementationRushLarsenExponentString;
+
+    std::string mInterfaceComputeSensitivityRatesMethodString;
+    std::string mImplementationComputeSensitivityRatesMethodString;
+
+    std::string mInterfaceInitializeStatesAndConstantsBatchMethodString;
+    std::string mImplementationInitializeStatesAndConstantsBatchMethodString;
+    std::string mInterfaceComputeRatesBatchMethodString;
+    std::string mImplementationComputeRatesBatchMethodString;
+
+    std::string mInterfaceComputeRatesSpecializedMethodString;
+    std::string mImplementationComputeRatesSpecializedMethodString;
+    std::string mInterfaceComputeVariablesSpecializedMethodString;
+    std::string mImplementationComputeVariablesSpecializedMethodString;
+
+    std::string mInterfaceComputeRootsMethodString;
+    std::string mImplementationComputeRootsMethodString;
+    std::string mInterfaceApplyResetsMethodString;
+    std::string mImplementationApplyResetsMethodString;
+
+    std::string mLookupTableArgumentString;
+    std::string mImplementationLookupTableString;
+    std::string mImplementationComputeLookupTableMethodString;
+    std::string mComputeLookupTableCallString;
+    std::string mLookupTableEntryString;
+    std::string mLookupTableValueString;
+
     std::string mEmptyMethodString;
 
     std::string mIndentString;
@@ -246,6 +363,8 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mOpenArrayString;
     std::string mCloseArrayString;
 
+    std::string mComputeCastString;
+
     std::string mArrayElementSeparatorString;
 
     std::string mStringDelimiterString;
@@ -253,6 +372,7 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mCommandSeparatorString;
 
     void loadProfile(GeneratorProfile::Profile profile);
+    void loadPrecision();
 };
 
 void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profile profile)
@@ -264,6 +384,22 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
 
         mHasInterface = true;
 
+        // Whether the profile requires the generated code to be optimised.
+
+        mHasCodeOptimization = false;
+
+        // Whether the profile requires the Jacobian to be generated.
+
+        mHasJacobian = false;
+
+        // Whether the profile requires a Rush-Larsen step to be generated.
+
+        mHasRushLarsen = false;
+
+        // Whether the profile requires piecewise statements to be branchless.
+
+        mHasBranchlessPiecewise = false;
+
         // Assignment.
 
         mAssignmentString = " = ";
@@ -345,6 +481,9 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mConditionalOperatorIfString = "(<CONDITION>)?<IF_STATEMENT>";
         mConditionalOperatorElseString = ":<ELSE_STATEMENT>";
 
+        mBranchlessPiecewiseIfString = "blend(<CONDITION>, <IF_STATEMENT>";
+        mBranchlessPiecewiseElseString = ", <ELSE_STATEMENT>)";
+
         mHasConditionalOperator = true;
 
         // Constants.
@@ -356,6 +495,8 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mInfString = "INFINITY";
         mNanString = "NAN";
 
+        mFloatingPointLiteralSuffixString = "";
+
         // Arithmetic functions.
 
         mEqFunctionString = "";
@@ -380,6 +521,11 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                              "    return (x > y)?x:y;\n"
                              "}\n";
 
+        mBlendFunctionString = "double blend(double condition, double trueValue, double falseValue)\n"
+                               "{\n"
+                               "    return (condition != 0.0)?trueValue:falseValue;\n"
+                               "}\n";
+
         // Trigonometric functions.
 
         mSecFunctionString = "double sec(double x)\n"
@@ -499,15 +645,50 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                             "<CODE>"
                                             "};\n";
 
+        mInterfaceJacobianSparsityString = "extern const size_t JACOBIAN_NON_ZERO_COUNT;\n"
+                                           "extern const size_t JACOBIAN_ROW_POINTERS[];\n"
+                                           "extern const size_t JACOBIAN_COLUMN_INDICES[];\n";
+        mImplementationJacobianSparsityString = "const size_t JACOBIAN_NON_ZERO_COUNT = <NON_ZERO_COUNT>;\n"
+                                                "const size_t JACOBIAN_ROW_POINTERS[] = {<ROW_POINTERS>};\n"
+                                                "const size_t JACOBIAN_COLUMN_INDICES[] = {<COLUMN_INDICES>};\n";
+
+        mEmptyJacobianColumnIndicesString = "0";
+
+        mInterfaceSensitivityParameterCountString = "extern const size_t SENSITIVITY_PARAMETER_COUNT;\n";
+        mImplementationSensitivityParameterCountString = "const size_t SENSITIVITY_PARAMETER_COUNT = <SENSITIVITY_PARAMETER_COUNT>;\n";
+
+        mInterfaceSweepParameterCountString = "extern const size_t SWEEP_PARAMETER_COUNT;\n";
+        mImplementationSweepParameterCountString = "const size_t SWEEP_PARAMETER_COUNT = <SWEEP_PARAMETER_COUNT>;\n";
+
+        mInterfaceResetCountString = "extern const size_t RESET_COUNT;\n";
+        mImplementationResetCountString = "const size_t RESET_COUNT = <RESET_COUNT>;\n";
+
         mVariableInfoEntryString = "{\"<NAME>\", \"<UNITS>\", \"<COMPONENT>\"}";
         mVariableInfoWithTypeEntryString = "{\"<NAME>\", \"<UNITS>\", \"<COMPONENT>\", <TYPE>}";
 
         mVoiString = "voi";
 
+        mTimeStepString = "dt";
+
         mStatesArrayString = "states";
         mRatesArrayString = "rates";
         mVariablesArrayString = "variables";
 
+        mJacobianArrayString = "jac";
+
+        mSensitivitiesArrayString = "sensitivities";
+        mSensitivityRatesArrayString = "sensitivityRates";
+
+        mSweepParametersArrayString = "parameters";
+        mBatchArrayIndexString = "<INDEX>*instanceCount+i";
+        mBatchSweepParameterIndexString = "i*SWEEP_PARAMETER_COUNT+<INDEX>";
+
+        mInstanceArrayIndexString = "<INDEX>+<STRIDE>*i";
+
+        mRootsArrayString = "roots";
+        mEventsArrayString = "events";
+        mResetValuesArrayString = "resetValues";
+
         mInterfaceCreateStatesArrayMethodString = "double * createStatesArray();\n";
         mImplementationCreateStatesArrayMethodString = "double * createStatesArray()\n"
                                                        "{\n"
@@ -538,17 +719,158 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                                               "<CODE>"
                                                               "}\n";
 
+        mImplementationComputeComputedConstantsMethodChunkString = "static void computeComputedConstantsChunk<INDEX>(double *variables)\n"
+                                                                   "{\n"
+                                                                   "<CODE>"
+                                                                   "}\n";
+        mComputeComputedConstantsMethodChunkCallString = "computeComputedConstantsChunk<INDEX>(variables)";
+
         mInterfaceComputeRatesMethodString = "void computeRates(double voi, double *states, double *rates, double *variables);\n";
         mImplementationComputeRatesMethodString = "void computeRates(double voi, double *states, double *rates, double *variables)\n{\n"
                                                   "<CODE>"
                                                   "}\n";
 
+        mImplementationComputeRatesMethodChunkString = "static void computeRatesChunk<INDEX>(double voi, double *states, double *rates, double *variables)\n"
+                                                       "{\n"
+                                                       "<CODE>"
+                                                       "}\n";
+        mComputeRatesMethodChunkCallString = "computeRatesChunk<INDEX>(voi, states, rates, variables)";
+
+        mImplementationComputeRatesMethodKernelString = "static void computeRatesKernel<INDEX>(double voi, double *states, double *rates, double *variables)\n"
+                                                        "{\n"
+                                                        "    for (size_t i = 0; i < <INSTANCE_COUNT>; ++i) {\n"
+                                                        "<CODE>"
+                                                        "    }\n"
+                                                        "}\n";
+        mComputeRatesMethodKernelCallString = "computeRatesKernel<INDEX>(voi, states, rates, variables)";
+
         mInterfaceComputeVariablesMethodString = "void computeVariables(double voi, double *states, double *rates, double *variables);\n";
         mImplementationComputeVariablesMethodString = "void computeVariables(double voi, double *states, double *rates, double *variables)\n"
                                                       "{\n"
                                                       "<CODE>"
                                                       "}\n";
 
+        mImplementationComputeVariablesMethodChunkString = "static void computeVariablesChunk<INDEX>(double voi, double *states, double *rates, double *variables)\n"
+                                                           "{\n"
+                                                           "<CODE>"
+                                                           "}\n";
+        mComputeVariablesMethodChunkCallString = "computeVariablesChunk<INDEX>(voi, states, rates, variables)";
+
+        mImplementationComputeVariablesMethodKernelString = "static void computeVariablesKernel<INDEX>(double voi, double *states, double *rates, double *variables)\n"
+                                                            "{\n"
+                                                            "    for (size_t i = 0; i < <INSTANCE_COUNT>; ++i) {\n"
+                                                            "<CODE>"
+                                                            "    }\n"
+                                                            "}\n";
+        mComputeVariablesMethodKernelCallString = "computeVariablesKernel<INDEX>(voi, states, rates, variables)";
+
+        mParallelRegionString = "#pragma omp parallel\n"
+                                "{\n"
+                                "<CODE>"
+                                "}\n";
+        mParallelLevelString = "#pragma omp sections\n"
+                               "{\n"
+                               "<CODE>"
+                               "}\n";
+        mParallelTaskString = "#pragma omp section\n"
+                              "{\n"
+                              "<CODE>"
+                              "}\n";
+
+        mInterfaceComputeJacobianMethodString = "void computeJacobian(double voi, double *states, double *variables, double *jac);\n";
+        mImplementationComputeJacobianMethodString = "void computeJacobian(double voi, double *states, double *variables, double *jac)\n"
+                                                     "{\n"
+                                                     "<CODE>"
+                                                     "}\n";
+
+        mInterfaceComputeRushLarsenStepMethodString = "void computeRushLarsenStep(double voi, double dt, double *states, double *variables);\n";
+        mImplementationComputeRushLarsenStepMethodString = "void computeRushLarsenStep(double voi, double dt, double *states, double *variables)\n"
+                                                           "{\n"
+                                                           "    double rates[<STATE_COUNT>];\n"
+                                                           "\n"
+                                                           "<CODE>"
+                                                           "}\n";
+
+        mRushLarsenExponentString = "exponent";
+        mImplementationRushLarsenExponentString = "    double exponent;\n";
+
+        mInterfaceComputeSensitivityRatesMethodString = "void computeSensitivityRates(double voi, double *states, double *sensitivities, double *sensitivityRates, double *variables);\n";
+        mImplementationComputeSensitivityRatesMethodString = "void computeSensitivityRates(double voi, double *states, double *sensitivities, double *sensitivityRates, double *variables)\n"
+                                                             "{\n"
+                                                             "<CODE>"
+                                                             "}\n";
+
+        mInterfaceInitializeStatesAndConstantsBatchMethodString = "void initializeStatesAndConstantsBatch(size_t instanceCount, const double *parameters, double *states, double *variables);\n";
+        mImplementationInitializeStatesAndConstantsBatchMethodString = "void initializeStatesAndConstantsBatch(size_t instanceCount, const double *parameters, double *states, double *variables)\n"
+                                                                       "{\n"
+                                                                       "#pragma omp simd\n"
+                                                                       "    for (size_t i = 0; i < instanceCount; ++i) {\n"
+                                                                       "<CODE>"
+                                                                       "    }\n"
+                                                                       "}\n";
+        mInterfaceComputeRatesBatchMethodString = "void computeRatesBatch(size_t instanceCount, double voi, const double *parameters, double *states, double *rates, double *variables);\n";
+        mImplementationComputeRatesBatchMethodString = "void computeRatesBatch(size_t instanceCount, double voi, const double *parameters, double *states, double *rates, double *variables)\n"
+                                                       "{\n"
+                                                       "#pragma omp simd\n"
+                                                       "    for (size_t i = 0; i < instanceCount; ++i) {\n"
+                                                       "<CODE>"
+                                                       "    }\n"
+                                                       "}\n";
+
+        mInterfaceComputeRatesSpecializedMethodString = "void computeRatesSpecialized(double voi, double *states, double *rates, double *variables);\n";
+        mImplementationComputeRatesSpecializedMethodString = "void computeRatesSpecialized(double voi, double *states, double *rates, double *variables)\n"
+                                                             "{\n"
+                                                             "<CODE>"
+                                                             "}\n";
+        mInterfaceComputeVariablesSpecializedMethodString = "void computeVariablesSpecialized(double voi, double *states, double *rates, double *variables);\n";
+        mImplementationComputeVariablesSpecializedMethodString = "void computeVariablesSpecialized(double voi, double *states, double *rates, double *variables)\n"
+                                                                 "{\n"
+                                                                 "<CODE>"
+                                                                 "}\n";
+
+        mInterfaceComputeRootsMethodString = "void computeRoots(double voi, double *states, double *variables, double *roots);\n";
+        mImplementationComputeRootsMethodString = "void computeRoots(double voi, double *states, double *variables, double *roots)\n"
+                                                  "{\n"
+                                                  "<CODE>"
+                                                  "}\n";
+        mInterfaceApplyResetsMethodString = "void applyResets(double voi, double *states, double *variables, const int *events);\n";
+        mImplementationApplyResetsMethodString = "void applyResets(double voi, double *states, double *variables, const int *events)\n"
+                                                 "{\n"
+                                                 "    double resetValues[<RESET_VARIABLE_COUNT>];\n"
+                                                 "\n"
+                                                 "<CODE>"
+                                                 "}\n";
+
+        mLookupTableArgumentString = "x";
+        mImplementationLookupTableString = "static double lookupTable[<ROW_COUNT>][<COLUMN_COUNT>];\n"
+                                           "\n"
+                                           "static double lookupTableValue(size_t column, double x)\n"
+                                           "{\n"
+                                           "    double position = (x-<MINIMUM>)/<STEP>;\n"
+                                           "    size_t index = (size_t) fmin(position, <MAXIMUM_INDEX>);\n"
+                                           "\n"
+                                           "    return lookupTable[index][column]+(position-index)*(lookupTable[index+1][column]-lookupTable[index][column]);\n"
+                                           "}\n";
+        mImplementationComputeLookupTableMethodString = "static void computeLookupTable()\n"
+                                                        "{\n"
+                                                        "    static int computed = 0;\n"
+                                                        "\n"
+                                                        "    if (computed) {\n"
+                                                        "        return;\n"
+                                                        "    }\n"
+                                                        "\n"
+                                                        "    for (size_t i = 0; i < <ROW_COUNT>; ++i) {\n"
+                                                        "        double x = <MINIMUM>+i*<STEP>;\n"
+                                                        "\n"
+                                                        "<CODE>"
+                                                        "    }\n"
+                                                        "\n"
+                                                        "    computed = 1;\n"
+                                                        "}\n";
+        mComputeLookupTableCallString = "computeLookupTable()";
+        mLookupTableEntryString = "lookupTable[i][<COLUMN>]";
+        mLookupTableValueString = "lookupTableValue(<COLUMN>, <VALUE>)";
+
         mEmptyMethodString = "";
 
         mIndentString = "    ";
@@ -559,16 +881,35 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mOpenArrayString = "[";
         mCloseArrayString = "]";
 
+        mComputeCastString = "";
+
         mArrayElementSeparatorString = ",";
 
         mStringDelimiterString = "\"";
 
         mCommandSeparatorString = ";";
-    } else if (profile == GeneratorProfile::Profile::PYTHON) {
+    } else if ((profile == GeneratorProfile::Profile::PYTHON)
+               || (profile == GeneratorProfile::Profile::NUMPY)) {
         // Whether the profile requires an interface to be generated.
 
         mHasInterface = false;
 
+        // Whether the profile requires the generated code to be optimised.
+
+        mHasCodeOptimization = false;
+
+        // Whether the profile requires the Jacobian to be generated.
+
+        mHasJacobian = false;
+
+        // Whether the profile requires a Rush-Larsen step to be generated.
+
+        mHasRushLarsen = false;
+
+        // Whether the profile requires piecewise statements to be branchless.
+
+        mHasBranchlessPiecewise = false;
+
         // Assignment.
 
         mAssignmentString = " = ";
@@ -650,6 +991,9 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mConditionalOperatorIfString = "<IF_STATEMENT> if <CONDITION>";
         mConditionalOperatorElseString = " else <ELSE_STATEMENT>";
 
+        mBranchlessPiecewiseIfString = "";
+        mBranchlessPiecewiseElseString = "";
+
         mHasConditionalOperator = true;
 
         // Constants.
@@ -661,6 +1005,8 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mInfString = "inf";
         mNanString = "nan";
 
+        mFloatingPointLiteralSuffixString = "";
+
         // Arithmetic functions.
 
         mEqFunctionString = "\n"
@@ -700,6 +1046,8 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                              "def max(x, y):\n"
                              "    return x if x > y else y\n";
 
+        mBlendFunctionString = "";
+
         // Trigonometric functions.
 
         mSecFunctionString = "\n"
@@ -796,15 +1144,48 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                             "<CODE>"
                                             "]\n";
 
+        mInterfaceJacobianSparsityString = "";
+        mImplementationJacobianSparsityString = "JACOBIAN_NON_ZERO_COUNT = <NON_ZERO_COUNT>\n"
+                                                "JACOBIAN_ROW_POINTERS = [<ROW_POINTERS>]\n"
+                                                "JACOBIAN_COLUMN_INDICES = [<COLUMN_INDICES>]\n";
+
+        mEmptyJacobianColumnIndicesString = "";
+
+        mInterfaceSensitivityParameterCountString = "";
+        mImplementationSensitivityParameterCountString = "SENSITIVITY_PARAMETER_COUNT = <SENSITIVITY_PARAMETER_COUNT>\n";
+
+        mInterfaceSweepParameterCountString = "";
+        mImplementationSweepParameterCountString = "";
+
+        mInterfaceResetCountString = "";
+        mImplementationResetCountString = "RESET_COUNT = <RESET_COUNT>\n";
+
         mVariableInfoEntryString = "{\"name\": \"<NAME>\", \"units\": \"<UNITS>\", \"component\": \"<COMPONENT>\"}";
         mVariableInfoWithTypeEntryString = "{\"name\": \"<NAME>\", \"units\": \"<UNITS>\", \"component\": \"<COMPONENT>\", \"type\": <TYPE>}";
 
         mVoiString = "voi";
 
+        mTimeStepString = "dt";
+
         mStatesArrayString = "states";
         mRatesArrayString = "rates";
         mVariablesArrayString = "variables";
 
+        mJacobianArrayString = "jac";
+
+        mSensitivitiesArrayString = "sensitivities";
+        mSensitivityRatesArrayString = "sensitivity_rates";
+
+        mSweepParametersArrayString = "";
+        mBatchArrayIndexString = "";
+        mBatchSweepParameterIndexString = "";
+
+        mInstanceArrayIndexString = "<INDEX>+<STRIDE>*i";
+
+        mRootsArrayString = "roots";
+        mEventsArrayString = "events";
+        mResetValuesArrayString = "reset_values";
+
         mInterfaceCreateStatesArrayMethodString = "";
         mImplementationCreateStatesArrayMethodString = "\n"
                                                        "def create_states_array():\n"
@@ -828,16 +1209,115 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                                               "def compute_computed_constants(variables):\n"
                                                               "<CODE>";
 
+        mImplementationComputeComputedConstantsMethodChunkString = "\n"
+                                                                   "def compute_computed_constants_chunk_<INDEX>(variables):\n"
+                                                                   "<CODE>";
+        mComputeComputedConstantsMethodChunkCallString = "compute_computed_constants_chunk_<INDEX>(variables)";
+
         mInterfaceComputeRatesMethodString = "";
         mImplementationComputeRatesMethodString = "\n"
                                                   "def compute_rates(voi, states, rates, variables):\n"
                                                   "<CODE>";
 
+        mImplementationComputeRatesMethodChunkString = "\n"
+                                                       "def compute_rates_chunk_<INDEX>(voi, states, rates, variables):\n"
+                                                       "<CODE>";
+        mComputeRatesMethodChunkCallString = "compute_rates_chunk_<INDEX>(voi, states, rates, variables)";
+
+        mImplementationComputeRatesMethodKernelString = "\n"
+                                                        "def compute_rates_kernel_<INDEX>(voi, states, rates, variables):\n"
+                                                        "    for i in range(<INSTANCE_COUNT>):\n"
+                                                        "<CODE>";
+        mComputeRatesMethodKernelCallString = "compute_rates_kernel_<INDEX>(voi, states, rates, variables)";
+
         mInterfaceComputeVariablesMethodString = "";
         mImplementationComputeVariablesMethodString = "\n"
                                                       "def compute_variables(voi, states, rates, variables):\n"
                                                       "<CODE>";
 
+        mImplementationComputeVariablesMethodChunkString = "\n"
+                                                           "def compute_variables_chunk_<INDEX>(voi, states, rates, variables):\n"
+                                                           "<CODE>";
+        mComputeVariablesMethodChunkCallString = "compute_variables_chunk_<INDEX>(voi, states, rates, variables)";
+
+        mImplementationComputeVariablesMethodKernelString = "\n"
+                                                            "def compute_variables_kernel_<INDEX>(voi, states, rates, variables):\n"
+                                                            "    for i in range(<INSTANCE_COUNT>):\n"
+                                                            "<CODE>";
+        mComputeVariablesMethodKernelCallString = "compute_variables_kernel_<INDEX>(voi, states, rates, variables)";
+
+        mParallelRegionString = "";
+        mParallelLevelString = "";
+        mParallelTaskString = "";
+
+        mInterfaceComputeJacobianMethodString = "";
+        mImplementationComputeJacobianMethodString = "\n"
+                                                     "def compute_jacobian(voi, states, variables, jac):\n"
+                                                     "<CODE>";
+
+        mInterfaceComputeRushLarsenStepMethodString = "";
+        mImplementationComputeRushLarsenStepMethodString = "\n"
+                                                           "def compute_rush_larsen_step(voi, dt, states, variables):\n"
+                                                           "    rates = [nan]*STATE_COUNT\n"
+                                                           "\n"
+                                                           "<CODE>";
+
+        mRushLarsenExponentString = "exponent";
+        mImplementationRushLarsenExponentString = "";
+
+        mInterfaceComputeSensitivityRatesMethodString = "";
+        mImplementationComputeSensitivityRatesMethodString = "\n"
+                                                             "def compute_sensitivity_rates(voi, states, sensitivities, sensitivity_rates, variables):\n"
+                                                             "<CODE>";
+
+        mInterfaceInitializeStatesAndConstantsBatchMethodString = "";
+        mImplementationInitializeStatesAndConstantsBatchMethodString = "";
+        mInterfaceComputeRatesBatchMethodString = "";
+        mImplementationComputeRatesBatchMethodString = "";
+
+        mInterfaceComputeRatesSpecializedMethodString = "";
+        mImplementationComputeRatesSpecializedMethodString = "";
+        mInterfaceComputeVariablesSpecializedMethodString = "";
+        mImplementationComputeVariablesSpecializedMethodString = "";
+
+        mInterfaceComputeRootsMethodString = "";
+        mImplementationComputeRootsMethodString = "\n"
+                                                  "def compute_roots(voi, states, variables, roots):\n"
+                                                  "<CODE>";
+        mInterfaceApplyResetsMethodString = "";
+        mImplementationApplyResetsMethodString = "\n"
+                                                 "def apply_resets(voi, states, variables, events):\n"
+                                                 "    reset_values = [0.0]*<RESET_VARIABLE_COUNT>\n"
+                                                 "\n"
+                                                 "<CODE>";
+
+        mLookupTableArgumentString = "x";
+        mImplementationLookupTableString = "lookup_table = [[nan]*<COLUMN_COUNT> for i in range(<ROW_COUNT>)]\n"
+                                           "lookup_table_computed = False\n"
+                                           "\n"
+                                           "\n"
+                                           "def lookup_table_value(column, x):\n"
+                                           "    position = (x-<MINIMUM>)/<STEP>\n"
+                                           "    index = int(min(position, <MAXIMUM_INDEX>))\n"
+                                           "\n"
+                                           "    return lookup_table[index][column]+(position-index)*(lookup_table[index+1][column]-lookup_table[index][column])\n";
+        mImplementationComputeLookupTableMethodString = "\n"
+                                                        "def compute_lookup_table():\n"
+                                                        "    global lookup_table_computed\n"
+                                                        "\n"
+                                                        "    if lookup_table_computed:\n"
+                                                        "        return\n"
+                                                        "\n"
+                                                        "    for i in range(0, <ROW_COUNT>):\n"
+                                                        "        x = <MINIMUM>+i*<STEP>\n"
+                                                        "\n"
+                                                        "<CODE>"
+                                                        "\n"
+                                                        "    lookup_table_computed = True\n";
+        mComputeLookupTableCallString = "compute_lookup_table()";
+        mLookupTableEntryString = "lookup_table[i][<COLUMN>]";
+        mLookupTableValueString = "lookup_table_value(<COLUMN>, <VALUE>)";
+
         mEmptyMethodString = "pass\n";
 
         mIndentString = "    ";
@@ -848,12 +1328,296 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mOpenArrayString = "[";
         mCloseArrayString = "]";
 
+        mComputeCastString = "";
+
         mArrayElementSeparatorString = ",";
 
         mStringDelimiterString = "\"";
 
         mCommandSeparatorString = "";
     }
+
+    if (profile == GeneratorProfile::Profile::NUMPY) {
+        // The NumPy profile is the Python profile, except that the states,
+        // rates and variables arrays are 2-D NumPy arrays with one row per
+        // state/variable and one column per instance of the model. Mathematical
+        // functions are therefore mapped to NumPy ufuncs and piecewise
+        // statements to numpy.where() so that a single call to a method
+        // evaluates all the instances at once.
+
+        // Relational and logical operators.
+
+        mEqFunctionString = "\n"
+                            "def eq_func(x, y):\n"
+                            "    return numpy.where(x == y, 1.0, 0.0)\n";
+        mNeqFunctionString = "\n"
+                             "def neq_func(x, y):\n"
+                             "    return numpy.where(x != y, 1.0, 0.0)\n";
+        mLtFunctionString = "\n"
+                            "def lt_func(x, y):\n"
+                            "    return numpy.where(x < y, 1.0, 0.0)\n";
+        mLeqFunctionString = "\n"
+                             "def leq_func(x, y):\n"
+                             "    return numpy.where(x <= y, 1.0, 0.0)\n";
+        mGtFunctionString = "\n"
+                            "def gt_func(x, y):\n"
+                            "    return numpy.where(x > y, 1.0, 0.0)\n";
+        mGeqFunctionString = "\n"
+                             "def geq_func(x, y):\n"
+                             "    return numpy.where(x >= y, 1.0, 0.0)\n";
+        mAndFunctionString = "\n"
+                             "def and_func(x, y):\n"
+                             "    return numpy.where(numpy.logical_and(x, y), 1.0, 0.0)\n";
+        mOrFunctionString = "\n"
+                            "def or_func(x, y):\n"
+                            "    return numpy.where(numpy.logical_or(x, y), 1.0, 0.0)\n";
+        mXorFunctionString = "\n"
+                             "def xor_func(x, y):\n"
+                             "    return numpy.where(numpy.logical_xor(x, y), 1.0, 0.0)\n";
+        mNotFunctionString = "\n"
+                             "def not_func(x):\n"
+                             "    return numpy.where(numpy.logical_not(x), 1.0, 0.0)\n";
+
+        // Arithmetic operators.
+
+        mPowerString = "numpy.power";
+        mSquareRootString = "numpy.sqrt";
+        mAbsoluteValueString = "numpy.fabs";
+        mExponentialString = "numpy.exp";
+        mNapierianLogarithmString = "numpy.log";
+        mCommonLogarithmString = "numpy.log10";
+        mCeilingString = "numpy.ceil";
+        mFloorString = "numpy.floor";
+        mMinString = "numpy.minimum";
+        mMaxString = "numpy.maximum";
+        mRemString = "numpy.fmod";
+
+        mMinFunctionString = "";
+        mMaxFunctionString = "";
+
+        // Trigonometric operators.
+
+        mSinString = "numpy.sin";
+        mCosString = "numpy.cos";
+        mTanString = "numpy.tan";
+        mSinhString = "numpy.sinh";
+        mCoshString = "numpy.cosh";
+        mTanhString = "numpy.tanh";
+        mAsinString = "numpy.arcsin";
+        mAcosString = "numpy.arccos";
+        mAtanString = "numpy.arctan";
+        mAsinhString = "numpy.arcsinh";
+        mAcoshString = "numpy.arccosh";
+        mAtanhString = "numpy.arctanh";
+
+        // Piecewise statement.
+
+        mConditionalOperatorIfString = "numpy.where(<CONDITION>, <IF_STATEMENT>";
+        mConditionalOperatorElseString = ", <ELSE_STATEMENT>)";
+
+        // Constants.
+
+        mInfString = "numpy.inf";
+        mNanString = "numpy.nan";
+
+        // Trigonometric functions.
+
+        mSecFunctionString = "\n"
+                             "def sec(x):\n"
+                             "    return 1.0/numpy.cos(x)\n";
+        mCscFunctionString = "\n"
+                             "def csc(x):\n"
+                             "    return 1.0/numpy.sin(x)\n";
+        mCotFunctionString = "\n"
+                             "def cot(x):\n"
+                             "    return 1.0/numpy.tan(x)\n";
+        mSechFunctionString = "\n"
+                              "def sech(x):\n"
+                              "    return 1.0/numpy.cosh(x)\n";
+        mCschFunctionString = "\n"
+                              "def csch(x):\n"
+                              "    return 1.0/numpy.sinh(x)\n";
+        mCothFunctionString = "\n"
+                              "def coth(x):\n"
+                              "    return 1.0/numpy.tanh(x)\n";
+        mAsecFunctionString = "\n"
+                              "def asec(x):\n"
+                              "    return numpy.arccos(1.0/x)\n";
+        mAcscFunctionString = "\n"
+                              "def acsc(x):\n"
+                              "    return numpy.arcsin(1.0/x)\n";
+        mAcotFunctionString = "\n"
+                              "def acot(x):\n"
+                              "    return numpy.arctan(1.0/x)\n";
+        mAsechFunctionString = "\n"
+                               "def asech(x):\n"
+                               "    one_over_x = 1.0/x\n"
+                               "\n"
+                               "    return numpy.log(one_over_x+numpy.sqrt(one_over_x*one_over_x-1.0))\n";
+        mAcschFunctionString = "\n"
+                               "def acsch(x):\n"
+                               "    one_over_x = 1.0/x\n"
+                               "\n"
+                               "    return numpy.log(one_over_x+numpy.sqrt(one_over_x*one_over_x+1.0))\n";
+        mAcothFunctionString = "\n"
+                               "def acoth(x):\n"
+                               "    one_over_x = 1.0/x\n"
+                               "\n"
+                               "    return 0.5*numpy.log((1.0+one_over_x)/(1.0-one_over_x))\n";
+
+        // Miscellaneous.
+
+        mImplementationHeaderString = "from enum import Enum\n"
+                                      "\n"
+                                      "import numpy\n"
+                                      "\n";
+
+        mImplementationCreateStatesArrayMethodString = "\n"
+                                                       "def create_states_array(instance_count=1):\n"
+                                                       "    return numpy.full((STATE_COUNT, instance_count), numpy.nan)\n";
+
+        mImplementationCreateVariablesArrayMethodString = "\n"
+                                                          "def create_variables_array(instance_count=1):\n"
+                                                          "    return numpy.full((VARIABLE_COUNT, instance_count), numpy.nan)\n";
+
+        mImplementationComputeRushLarsenStepMethodString = "\n"
+                                                           "def compute_rush_larsen_step(voi, dt, states, variables):\n"
+                                                           "    rates = numpy.empty_like(states)\n"
+                                                           "\n"
+                                                           "<CODE>";
+
+        // The interpolation of a lookup table is not vectorised, so no lookup
+        // table.
+
+        mImplementationLookupTableString = "";
+        mImplementationComputeLookupTableMethodString = "";
+        mComputeLookupTableCallString = "";
+        mLookupTableEntryString = "";
+        mLookupTableValueString = "";
+    }
+
+    loadPrecision();
+}
+
+void GeneratorProfile::GeneratorProfileImpl::loadPrecision()
+{
+    // Only our C profile can be generated in single or mixed precision, i.e.
+    // with its arrays of states, rates and variables stored as floats and its
+    // computations done using floats or doubles, respectively.
+
+    if ((mProfile != GeneratorProfile::Profile::C)
+        || (mPrecision == GeneratorProfile::Precision::DOUBLE)) {
+        return;
+    }
+
+    static const std::regex DOUBLE_POINTER_REGEX("double \\*");
+    static const std::regex SIZEOF_DOUBLE_REGEX("sizeof\\(double\\)");
+    static const std::regex DOUBLE_REGEX("\\bdouble\\b");
+    static const std::regex MATH_FUNCTION_REGEX("\\b(exp|log|log10|pow|sqrt|fabs|ceil|floor|fmod|sin|cos|tan|sinh|cosh|tanh|asin|acos|atan|asinh|acosh|atanh)\\(");
+    static const std::regex LITERAL_REGEX("\\b(\\d+\\.\\d+)\\b");
+
+    auto single = mPrecision == GeneratorProfile::Precision::SINGLE;
+
+    for (auto string : {
+        &mTrueString,
+        &mFalseString,
+        &mXorFunctionString,
+        &mMinFunctionString,
+        &mMaxFunctionString,
+        &mBlendFunctionString,
+        &mSecFunctionString,
+        &mCscFunctionString,
+        &mCotFunctionString,
+        &mSechFunctionString,
+        &mCschFunctionString,
+        &mCothFunctionString,
+        &mAsecFunctionString,
+        &mAcscFunctionString,
+        &mAcotFunctionString,
+        &mAsechFunctionString,
+        &mAcschFunctionString,
+        &mAcothFunctionString,
+        &mInterfaceCreateStatesArrayMethodString,
+        &mImplementationCreateStatesArrayMethodString,
+        &mInterfaceCreateVariablesArrayMethodString,
+        &mImplementationCreateVariablesArrayMethodString,
+        &mInterfaceDeleteArrayMethodString,
+        &mImplementationDeleteArrayMethodString,
+        &mInterfaceInitializeStatesAndConstantsMethodString,
+        &mImplementationInitializeStatesAndConstantsMethodString,
+        &mInterfaceComputeComputedConstantsMethodString,
+        &mImplementationComputeComputedConstantsMethodString,
+        &mImplementationComputeComputedConstantsMethodChunkString,
+        &mInterfaceComputeRatesMethodString,
+        &mImplementationComputeRatesMethodString,
+        &mImplementationComputeRatesMethodChunkString,
+        &mImplementationComputeRatesMethodKernelString,
+        &mInterfaceComputeVariablesMethodString,
+        &mImplementationComputeVariablesMethodString,
+        &mImplementationComputeVariablesMethodChunkString,
+        &mImplementationComputeVariablesMethodKernelString,
+        &mInterfaceComputeJacobianMethodString,
+        &mImplementationComputeJacobianMethodString,
+        &mInterfaceComputeRushLarsenStepMethodString,
+        &mImplementationComputeRushLarsenStepMethodString,
+        &mInterfaceComputeSensitivityRatesMethodString,
+        &mImplementationComputeSensitivityRatesMethodString,
+        &mInterfaceInitializeStatesAndConstantsBatchMethodString,
+        &mImplementationInitializeStatesAndConstantsBatchMethodString,
+        &mInterfaceComputeRatesBatchMethodString,
+        &mImplementationComputeRatesBatchMethodString,
+        &mInterfaceComputeRatesSpecializedMethodString,
+        &mImplementationComputeRatesSpecializedMethodString,
+        &mInterfaceComputeVariablesSpecializedMethodString,
+        &mImplementationComputeVariablesSpecializedMethodString,
+        &mInterfaceComputeRootsMethodString,
+        &mImplementationComputeRootsMethodString,
+        &mInterfaceApplyResetsMethodString,
+        &mImplementationApplyResetsMethodString,
+        &mImplementationLookupTableString,
+        &mImplementationComputeLookupTableMethodString
+         }) {
+        *string = std::regex_replace(*string, DOUBLE_POINTER_REGEX, "float *");
+        *string = std::regex_replace(*string, SIZEOF_DOUBLE_REGEX, "sizeof(float)");
+
+        if (single) {
+            *string = std::regex_replace(*string, DOUBLE_REGEX, "float");
+            *string = std::regex_replace(*string, MATH_FUNCTION_REGEX, "$1f(");
+            *string = std::regex_replace(*string, LITERAL_REGEX, "$1f");
+        }
+    }
+
+    if (single) {
+        mPowerString = "powf";
+        mSquareRootString = "sqrtf";
+        mAbsoluteValueString = "fabsf";
+        mExponentialString = "expf";
+        mNapierianLogarithmString = "logf";
+        mCommonLogarithmString = "log10f";
+        mCeilingString = "ceilf";
+        mFloorString = "floorf";
+        mRemString = "fmodf";
+
+        mSinString = "sinf";
+        mCosString = "cosf";
+        mTanString = "tanf";
+        mSinhString = "sinhf";
+        mCoshString = "coshf";
+        mTanhString = "tanhf";
+        mAsinString = "asinf";
+        mAcosString = "acosf";
+        mAtanString = "atanf";
+        mAsinhString = "asinhf";
+        mAcoshString = "acoshf";
+        mAtanhString = "atanhf";
+
+        mEString += "f";
+        mPiString += "f";
+
+        mFloatingPointLiteralSuffixString = "f";
+    } else {
+        mComputeCastString = "(double) ";
+    }
 }
 
 GeneratorProfile::GeneratorProfile(Profile profile)
@@ -872,6 +1636,11 @@ GeneratorProfilePtr GeneratorProfile::create(Profile profile) noexcept
     return std::shared_ptr<GeneratorProfile> {new GeneratorProfile {profile}};
 }
 
+size_t GeneratorProfile::revision() const
+{
+    return mPimpl->mRevision;
+}
+
 GeneratorProfile::Profile GeneratorProfile::profile() const
 {
     return mPimpl->mProfile;
@@ -880,6 +1649,21 @@ GeneratorProfile::Profile GeneratorProfile::profile() const
 void GeneratorProfile::setProfile(Profile profile)
 {
     mPimpl->loadProfile(profile);
+    ++mPimpl->mRevision;
+}
+
+GeneratorProfile::Precision GeneratorProfile::precision() const
+{
+    return mPimpl->mPrecision;
+}
+
+void GeneratorProfile::setPrecision(Precision precision)
+{
+    mPimpl->mPrecision = precision;
+
+    mPimpl->loadProfile(mPimpl->mProfile);
+
+    ++mPimpl->mRevision;
 }
 
 bool GeneratorProfile::hasInterface() const
@@ -890,6 +1674,51 @@ bool GeneratorProfile::hasInterface() const
 void GeneratorProfile::setHasInterface(bool hasInterface)
 {
     mPimpl->mHasInterface = hasInterface;
+    ++mPimpl->mRevision;
+}
+
+bool GeneratorProfile::hasCodeOptimization() const
+{
+    return mPimpl->mHasCodeOptimization;
+}
+
+void GeneratorProfile::setHasCodeOptimization(bool hasCodeOptimization)
+{
+    mPimpl->mHasCodeOptimization = hasCodeOptimization;
+    ++mPimpl->mRevision;
+}
+
+bool GeneratorProfile::hasJacobian() const
+{
+    return mPimpl->mHasJacobian;
+}
+
+void GeneratorProfile::setHasJacobian(bool hasJacobian)
+{
+    mPimpl->mHasJacobian = hasJacobian;
+    ++mPimpl->mRevision;
+}
+
+bool GeneratorProfile::hasRushLarsen() const
+{
+    return mPimpl->mHasRushLarsen;
+}
+
+void GeneratorProfile::setHasRushLarsen(bool hasRushLarsen)
+{
+    mPimpl->mHasRushLarsen = hasRushLarsen;
+    ++mPimpl->mRevision;
+}
+
+bool GeneratorProfile::hasBranchlessPiecewise() const
+{
+    return mPimpl->mHasBranchlessPiecewise;
+}
+
+void GeneratorProfile::setHasBranchlessPiecewise(bool hasBranchlessPiecewise)
+{
+    mPimpl->mHasBranchlessPiecewise = hasBranchlessPiecewise;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::assignmentString() const
@@ -900,6 +1729,7 @@ std::string GeneratorProfile::assignmentString() const
 void GeneratorProfile::setAssignmentString(const std::string &assignmentString)
 {
     mPimpl->mAssignmentString = assignmentString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::eqString() const
@@ -910,6 +1740,7 @@ std::string GeneratorProfile::eqString() const
 void GeneratorProfile::setEqString(const std::string &eqString)
 {
     mPimpl->mEqString = eqString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::neqString() const
@@ -920,6 +1751,7 @@ std::string GeneratorProfile::neqString() const
 void GeneratorProfile::setNeqString(const std::string &neqString)
 {
     mPimpl->mNeqString = neqString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::ltString() const
@@ -930,6 +1762,7 @@ std::string GeneratorProfile::ltString() const
 void GeneratorProfile::setLtString(const std::string &ltString)
 {
     mPimpl->mLtString = ltString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::leqString() const
@@ -940,6 +1773,7 @@ std::string GeneratorProfile::leqString() const
 void GeneratorProfile::setLeqString(const std::string &leqString)
 {
     mPimpl->mLeqString = leqString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::gtString() const
@@ -950,6 +1784,7 @@ std::string GeneratorProfile::gtString() const
 void GeneratorProfile::setGtString(const std::string &gtString)
 {
     mPimpl->mGtString = gtString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::geqString() const
@@ -960,6 +1795,7 @@ std::string GeneratorProfile::geqString() const
 void GeneratorProfile::setGeqString(const std::string &geqString)
 {
     mPimpl->mGeqString = geqString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::andString() const
@@ -970,6 +1806,7 @@ std::string GeneratorProfile::andString() const
 void GeneratorProfile::setAndString(const std::string &andString)
 {
     mPimpl->mAndString = andString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::orString() const
@@ -980,6 +1817,7 @@ std::string GeneratorProfile::orString() const
 void GeneratorProfile::setOrString(const std::string &orString)
 {
     mPimpl->mOrString = orString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::xorString() const
@@ -990,6 +1828,7 @@ std::string GeneratorProfile::xorString() const
 void GeneratorProfile::setXorString(const std::string &xorString)
 {
     mPimpl->mXorString = xorString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::notString() const
@@ -1000,6 +1839,7 @@ std::string GeneratorProfile::notString() const
 void GeneratorProfile::setNotString(const std::string &notString)
 {
     mPimpl->mNotString = notString;
+    ++mPimpl->mRevision;
 }
 
 bool GeneratorProfile::hasEqOperator() const
@@ -1010,6 +1850,7 @@ bool GeneratorProfile::hasEqOperator() const
 void GeneratorProfile::setHasEqOperator(bool hasEqOperator)
 {
     mPimpl->mHasEqOperator = hasEqOperator;
+    ++mPimpl->mRevision;
 }
 
 bool GeneratorProfile::hasNeqOperator() const
@@ -1020,6 +1861,7 @@ bool GeneratorProfile::hasNeqOperator() const
 void GeneratorProfile::setHasNeqOperator(bool hasNeqOperator)
 {
     mPimpl->mHasNeqOperator = hasNeqOperator;
+    ++mPimpl->mRevision;
 }
 
 bool GeneratorProfile::hasLtOperator() const
@@ -1030,6 +1872,7 @@ bool GeneratorProfile::hasLtOperator() const
 void GeneratorProfile::setHasLtOperator(bool hasLtOperator)
 {
     mPimpl->mHasLtOperator = hasLtOperator;
+    ++mPimpl->mRevision;
 }
 
 bool GeneratorProfile::hasLeqOperator() const
@@ -1040,6 +1883,7 @@ bool GeneratorProfile::hasLeqOperator() const
 void GeneratorProfile::setHasLeqOperator(bool hasLeqOperator)
 {
     mPimpl->mHasLeqOperator = hasLeqOperator;
+    ++mPimpl->mRevision;
 }
 
 bool GeneratorProfile::hasGtOperator() const
@@ -1050,6 +1894,7 @@ bool GeneratorProfile::hasGtOperator() const
 void GeneratorProfile::setHasGtOperator(bool hasGtOperator)
 {
     mPimpl->mHasGtOperator = hasGtOperator;
+    ++mPimpl->mRevision;
 }
 
 bool GeneratorProfile::hasGeqOperator() const
@@ -1060,6 +1905,7 @@ bool GeneratorProfile::hasGeqOperator() const
 void GeneratorProfile::setHasGeqOperator(bool hasGeqOperator)
 {
     mPimpl->mHasGeqOperator = hasGeqOperator;
+    ++mPimpl->mRevision;
 }
 
 bool GeneratorProfile::hasAndOperator() const
@@ -1070,6 +1916,7 @@ bool GeneratorProfile::hasAndOperator() const
 void GeneratorProfile::setHasAndOperator(bool hasAndOperator)
 {
     mPimpl->mHasAndOperator = hasAndOperator;
+    ++mPimpl->mRevision;
 }
 
 bool GeneratorProfile::hasOrOperator() const
@@ -1080,6 +1927,7 @@ bool GeneratorProfile::hasOrOperator() const
 void GeneratorProfile::setHasOrOperator(bool hasOrOperator)
 {
     mPimpl->mHasOrOperator = hasOrOperator;
+    ++mPimpl->mRevision;
 }
 
 bool GeneratorProfile::hasXorOperator() const
@@ -1090,6 +1938,7 @@ bool GeneratorProfile::hasXorOperator() const
 void GeneratorProfile::setHasXorOperator(bool hasXorOperator)
 {
     mPimpl->mHasXorOperator = hasXorOperator;
+    ++mPimpl->mRevision;
 }
 
 bool GeneratorProfile::hasNotOperator() const
@@ -1100,6 +1949,7 @@ bool GeneratorProfile::hasNotOperator() const
 void GeneratorProfile::setHasNotOperator(bool hasNotOperator)
 {
     mPimpl->mHasNotOperator = hasNotOperator;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::plusString() const
@@ -1110,6 +1960,7 @@ std::string GeneratorProfile::plusString() const
 void GeneratorProfile::setPlusString(const std::string &plusString)
 {
     mPimpl->mPlusString = plusString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::minusString() const
@@ -1120,6 +1971,7 @@ std::string GeneratorProfile::minusString() const
 void GeneratorProfile::setMinusString(const std::string &minusString)
 {
     mPimpl->mMinusString = minusString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::timesString() const
@@ -1130,6 +1982,7 @@ std::string GeneratorProfile::timesString() const
 void GeneratorProfile::setTimesString(const std::string &timesString)
 {
     mPimpl->mTimesString = timesString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::divideString() const
@@ -1140,6 +1993,7 @@ std::string GeneratorProfile::divideString() const
 void GeneratorProfile::setDivideString(const std::string &divideString)
 {
     mPimpl->mDivideString = divideString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::powerString() const
@@ -1150,6 +2004,7 @@ std::string GeneratorProfile::powerString() const
 void GeneratorProfile::setPowerString(const std::string &powerString)
 {
     mPimpl->mPowerString = powerString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::squareRootString() const
@@ -1160,6 +2015,7 @@ std::string GeneratorProfile::squareRootString() const
 void GeneratorProfile::setSquareRootString(const std::string &squareRootString)
 {
     mPimpl->mSquareRootString = squareRootString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::squareString() const
@@ -1170,6 +2026,7 @@ std::string GeneratorProfile::squareString() const
 void GeneratorProfile::setSquareString(const std::string &squareString)
 {
     mPimpl->mSquareString = squareString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::absoluteValueString() const
@@ -1180,6 +2037,7 @@ std::string GeneratorProfile::absoluteValueString() const
 void GeneratorProfile::setAbsoluteValueString(const std::string &absoluteValueString)
 {
     mPimpl->mAbsoluteValueString = absoluteValueString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::exponentialString() const
@@ -1190,6 +2048,7 @@ std::string GeneratorProfile::exponentialString() const
 void GeneratorProfile::setExponentialString(const std::string &exponentialString)
 {
     mPimpl->mExponentialString = exponentialString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::napierianLogarithmString() const
@@ -1200,6 +2059,7 @@ std::string GeneratorProfile::napierianLogarithmString() const
 void GeneratorProfile::setNapierianLogarithmString(const std::string &napierianLogarithmString)
 {
     mPimpl->mNapierianLogarithmString = napierianLogarithmString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::commonLogarithmString() const
@@ -1210,6 +2070,7 @@ std::string GeneratorProfile::commonLogarithmString() const
 void GeneratorProfile::setCommonLogarithmString(const std::string &commonLogarithmString)
 {
     mPimpl->mCommonLogarithmString = commonLogarithmString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::ceilingString() const
@@ -1220,6 +2081,7 @@ std::string GeneratorProfile::ceilingString() const
 void GeneratorProfile::setCeilingString(const std::string &ceilingString)
 {
     mPimpl->mCeilingString = ceilingString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::floorString() const
@@ -1230,6 +2092,7 @@ std::string GeneratorProfile::floorString() const
 void GeneratorProfile::setFloorString(const std::string &floorString)
 {
     mPimpl->mFloorString = floorString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::minString() const
@@ -1240,6 +2103,7 @@ std::string GeneratorProfile::minString() const
 void GeneratorProfile::setMinString(const std::string &minString)
 {
     mPimpl->mMinString = minString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::maxString() const
@@ -1250,6 +2114,7 @@ std::string GeneratorProfile::maxString() const
 void GeneratorProfile::setMaxString(const std::string &maxString)
 {
     mPimpl->mMaxString = maxString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::remString() const
@@ -1260,6 +2125,7 @@ std::string GeneratorProfile::remString() const
 void GeneratorProfile::setRemString(const std::string &remString)
 {
     mPimpl->mRemString = remString;
+    ++mPimpl->mRevision;
 }
 
 bool GeneratorProfile::hasPowerOperator() const
@@ -1270,6 +2136,7 @@ bool GeneratorProfile::hasPowerOperator() const
 void GeneratorProfile::setHasPowerOperator(bool hasPowerOperator)
 {
     mPimpl->mHasPowerOperator = hasPowerOperator;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::sinString() const
@@ -1280,6 +2147,7 @@ std::string GeneratorProfile::sinString() const
 void GeneratorProfile::setSinString(const std::string &sinString)
 {
     mPimpl->mSinString = sinString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::cosString() const
@@ -1290,6 +2158,7 @@ std::string GeneratorProfile::cosString() const
 void GeneratorProfile::setCosString(const std::string &cosString)
 {
     mPimpl->mCosString = cosString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::tanString() const
@@ -1300,6 +2169,7 @@ std::string GeneratorProfile::tanString() const
 void GeneratorProfile::setTanString(const std::string &tanString)
 {
     mPimpl->mTanString = tanString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::secString() const
@@ -1310,6 +2180,7 @@ std::string GeneratorProfile::secString() const
 void GeneratorProfile::setSecString(const std::string &secString)
 {
     mPimpl->mSecString = secString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::cscString() const
@@ -1320,6 +2191,7 @@ std::string GeneratorProfile::cscString() const
 void GeneratorProfile::setCscString(const std::string &cscString)
 {
     mPimpl->mCscString = cscString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::cotString() const
@@ -1330,6 +2202,7 @@ std::string GeneratorProfile::cotString() const
 void GeneratorProfile::setCotString(const std::string &cotString)
 {
     mPimpl->mCotString = cotString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::sinhString() const
@@ -1340,6 +2213,7 @@ std::string GeneratorProfile::sinhString() const
 void GeneratorProfile::setSinhString(const std::string &sinhString)
 {
     mPimpl->mSinhString = sinhString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::coshString() const
@@ -1350,6 +2224,7 @@ std::string GeneratorProfile::coshString() const
 void GeneratorProfile::setCoshString(const std::string &coshString)
 {
     mPimpl->mCoshString = coshString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::tanhString() const
@@ -1360,6 +2235,7 @@ std::string GeneratorProfile::tanhString() const
 void GeneratorProfile::setTanhString(const std::string &tanhString)
 {
     mPimpl->mTanhString = tanhString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::sechString() const
@@ -1370,6 +2246,7 @@ std::string GeneratorProfile::sechString() const
 void GeneratorProfile::setSechString(const std::string &sechString)
 {
     mPimpl->mSechString = sechString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::cschString() const
@@ -1380,6 +2257,7 @@ std::string GeneratorProfile::cschString() const
 void GeneratorProfile::setCschString(const std::string &cschString)
 {
     mPimpl->mCschString = cschString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::cothString() const
@@ -1390,6 +2268,7 @@ std::string GeneratorProfile::cothString() const
 void GeneratorProfile::setCothString(const std::string &cothString)
 {
     mPimpl->mCothString = cothString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::asinString() const
@@ -1400,6 +2279,7 @@ std::string GeneratorProfile::asinString() const
 void GeneratorProfile::setAsinString(const std::string &asinString)
 {
     mPimpl->mAsinString = asinString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::acosString() const
@@ -1410,6 +2290,7 @@ std::string GeneratorProfile::acosString() const
 void GeneratorProfile::setAcosString(const std::string &acosString)
 {
     mPimpl->mAcosString = acosString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::atanString() const
@@ -1420,6 +2301,7 @@ std::string GeneratorProfile::atanString() const
 void GeneratorProfile::setAtanString(const std::string &atanString)
 {
     mPimpl->mAtanString = atanString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::asecString() const
@@ -1430,6 +2312,7 @@ std::string GeneratorProfile::asecString() const
 void GeneratorProfile::setAsecString(const std::string &asecString)
 {
     mPimpl->mAsecString = asecString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::acscString() const
@@ -1440,6 +2323,7 @@ std::string GeneratorProfile::acscString() const
 void GeneratorProfile::setAcscString(const std::string &acscString)
 {
     mPimpl->mAcscString = acscString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::acotString() const
@@ -1450,6 +2334,7 @@ std::string GeneratorProfile::acotString() const
 void GeneratorProfile::setAcotString(const std::string &acotString)
 {
     mPimpl->mAcotString = acotString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::asinhString() const
@@ -1460,6 +2345,7 @@ std::string GeneratorProfile::asinhString() const
 void GeneratorProfile::setAsinhString(const std::string &asinhString)
 {
     mPimpl->mAsinhString = asinhString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::acoshString() const
@@ -1470,6 +2356,7 @@ std::string GeneratorProfile::acoshString() const
 void GeneratorProfile::setAcoshString(const std::string &acoshString)
 {
     mPimpl->mAcoshString = acoshString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::atanhString() const
@@ -1480,6 +2367,7 @@ std::string GeneratorProfile::atanhString() const
 void GeneratorProfile::setAtanhString(const std::string &atanhString)
 {
     mPimpl->mAtanhString = atanhString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::asechString() const
@@ -1490,6 +2378,7 @@ std::string GeneratorProfile::asechString() const
 void GeneratorProfile::setAsechString(const std::string &asechString)
 {
     mPimpl->mAsechString = asechString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::acschString() const
@@ -1500,6 +2389,7 @@ std::string GeneratorProfile::acschString() const
 void GeneratorProfile::setAcschString(const std::string &acschString)
 {
     mPimpl->mAcschString = acschString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::acothString() const
@@ -1510,6 +2400,7 @@ std::string GeneratorProfile::acothString() const
 void GeneratorProfile::setAcothString(const std::string &acothString)
 {
     mPimpl->mAcothString = acothString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::conditionalOperatorIfString() const
@@ -1520,6 +2411,7 @@ std::string GeneratorProfile::conditionalOperatorIfString() const
 void GeneratorProfile::setConditionalOperatorIfString(const std::string &conditionalOperatorIfString)
 {
     mPimpl->mConditionalOperatorIfString = conditionalOperatorIfString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::conditionalOperatorElseString() const
@@ -1530,6 +2422,29 @@ std::string GeneratorProfile::conditionalOperatorElseString() const
 void GeneratorProfile::setConditionalOperatorElseString(const std::string &conditionalOperatorElseString)
 {
     mPimpl->mConditionalOperatorElseString = conditionalOperatorElseString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::branchlessPiecewiseIfString() const
+{
+    return mPimpl->mBranchlessPiecewiseIfString;
+}
+
+void GeneratorProfile::setBranchlessPiecewiseIfString(const std::string &branchlessPiecewiseIfString)
+{
+    mPimpl->mBranchlessPiecewiseIfString = branchlessPiecewiseIfString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::branchlessPiecewiseElseString() const
+{
+    return mPimpl->mBranchlessPiecewiseElseString;
+}
+
+void GeneratorProfile::setBranchlessPiecewiseElseString(const std::string &branchlessPiecewiseElseString)
+{
+    mPimpl->mBranchlessPiecewiseElseString = branchlessPiecewiseElseString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::piecewiseIfString() const
@@ -1540,6 +2455,7 @@ std::string GeneratorProfile::piecewiseIfString() const
 void GeneratorProfile::setPiecewiseIfString(const std::string &piecewiseIfString)
 {
     mPimpl->mPiecewiseIfString = piecewiseIfString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::piecewiseElseString() const
@@ -1550,6 +2466,7 @@ std::string GeneratorProfile::piecewiseElseString() const
 void GeneratorProfile::setPiecewiseElseString(const std::string &piecewiseElseString)
 {
     mPimpl->mPiecewiseElseString = piecewiseElseString;
+    ++mPimpl->mRevision;
 }
 
 bool GeneratorProfile::hasConditionalOperator() const
@@ -1560,6 +2477,7 @@ bool GeneratorProfile::hasConditionalOperator() const
 void GeneratorProfile::setHasConditionalOperator(bool hasConditionalOperator)
 {
     mPimpl->mHasConditionalOperator = hasConditionalOperator;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::trueString() const
@@ -1570,6 +2488,7 @@ std::string GeneratorProfile::trueString() const
 void GeneratorProfile::setTrueString(const std::string &trueString)
 {
     mPimpl->mTrueString = trueString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::falseString() const
@@ -1580,6 +2499,7 @@ std::string GeneratorProfile::falseString() const
 void GeneratorProfile::setFalseString(const std::string &falseString)
 {
     mPimpl->mFalseString = falseString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::eString() const
@@ -1590,6 +2510,7 @@ std::string GeneratorProfile::eString() const
 void GeneratorProfile::setEString(const std::string &eString)
 {
     mPimpl->mEString = eString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::piString() const
@@ -1600,6 +2521,7 @@ std::string GeneratorProfile::piString() const
 void GeneratorProfile::setPiString(const std::string &piString)
 {
     mPimpl->mPiString = piString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::infString() const
@@ -1610,6 +2532,7 @@ std::string GeneratorProfile::infString() const
 void GeneratorProfile::setInfString(const std::string &infString)
 {
     mPimpl->mInfString = infString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::nanString() const
@@ -1620,6 +2543,18 @@ std::string GeneratorProfile::nanString() const
 void GeneratorProfile::setNanString(const std::string &nanString)
 {
     mPimpl->mNanString = nanString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::floatingPointLiteralSuffixString() const
+{
+    return mPimpl->mFloatingPointLiteralSuffixString;
+}
+
+void GeneratorProfile::setFloatingPointLiteralSuffixString(const std::string &floatingPointLiteralSuffixString)
+{
+    mPimpl->mFloatingPointLiteralSuffixString = floatingPointLiteralSuffixString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::eqFunctionString() const
@@ -1630,6 +2565,7 @@ std::string GeneratorProfile::eqFunctionString() const
 void GeneratorProfile::setEqFunctionString(const std::string &eqFunctionString)
 {
     mPimpl->mEqFunctionString = eqFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::neqFunctionString() const
@@ -1640,6 +2576,7 @@ std::string GeneratorProfile::neqFunctionString() const
 void GeneratorProfile::setNeqFunctionString(const std::string &neqFunctionString)
 {
     mPimpl->mNeqFunctionString = neqFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::ltFunctionString() const
@@ -1650,6 +2587,7 @@ std::string GeneratorProfile::ltFunctionString() const
 void GeneratorProfile::setLtFunctionString(const std::string &ltFunctionString)
 {
     mPimpl->mLtFunctionString = ltFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::leqFunctionString() const
@@ -1660,6 +2598,7 @@ std::string GeneratorProfile::leqFunctionString() const
 void GeneratorProfile::setLeqFunctionString(const std::string &leqFunctionString)
 {
     mPimpl->mLeqFunctionString = leqFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::gtFunctionString() const
@@ -1670,6 +2609,7 @@ std::string GeneratorProfile::gtFunctionString() const
 void GeneratorProfile::setGtFunctionString(const std::string &gtFunctionString)
 {
     mPimpl->mGtFunctionString = gtFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::geqFunctionString() const
@@ -1680,6 +2620,7 @@ std::string GeneratorProfile::geqFunctionString() const
 void GeneratorProfile::setGeqFunctionString(const std::string &geqFunctionString)
 {
     mPimpl->mGeqFunctionString = geqFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::andFunctionString() const
@@ -1690,6 +2631,7 @@ std::string GeneratorProfile::andFunctionString() const
 void GeneratorProfile::setAndFunctionString(const std::string &andFunctionString)
 {
     mPimpl->mAndFunctionString = andFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::orFunctionString() const
@@ -1700,6 +2642,7 @@ std::string GeneratorProfile::orFunctionString() const
 void GeneratorProfile::setOrFunctionString(const std::string &orFunctionString)
 {
     mPimpl->mOrFunctionString = orFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::xorFunctionString() const
@@ -1710,6 +2653,7 @@ std::string GeneratorProfile::xorFunctionString() const
 void GeneratorProfile::setXorFunctionString(const std::string &xorFunctionString)
 {
     mPimpl->mXorFunctionString = xorFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::notFunctionString() const
@@ -1720,6 +2664,7 @@ std::string GeneratorProfile::notFunctionString() const
 void GeneratorProfile::setNotFunctionString(const std::string &notFunctionString)
 {
     mPimpl->mNotFunctionString = notFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::minFunctionString() const
@@ -1730,6 +2675,7 @@ std::string GeneratorProfile::minFunctionString() const
 void GeneratorProfile::setMinFunctionString(const std::string &minFunctionString)
 {
     mPimpl->mMinFunctionString = minFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::maxFunctionString() const
@@ -1740,6 +2686,18 @@ std::string GeneratorProfile::maxFunctionString() const
 void GeneratorProfile::setMaxFunctionString(const std::string &maxFunctionString)
 {
     mPimpl->mMaxFunctionString = maxFunctionString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::blendFunctionString() const
+{
+    return mPimpl->mBlendFunctionString;
+}
+
+void GeneratorProfile::setBlendFunctionString(const std::string &blendFunctionString)
+{
+    mPimpl->mBlendFunctionString = blendFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::secFunctionString() const
@@ -1750,6 +2708,7 @@ std::string GeneratorProfile::secFunctionString() const
 void GeneratorProfile::setSecFunctionString(const std::string &secFunctionString)
 {
     mPimpl->mSecFunctionString = secFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::cscFunctionString() const
@@ -1760,6 +2719,7 @@ std::string GeneratorProfile::cscFunctionString() const
 void GeneratorProfile::setCscFunctionString(const std::string &cscFunctionString)
 {
     mPimpl->mCscFunctionString = cscFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::cotFunctionString() const
@@ -1770,6 +2730,7 @@ std::string GeneratorProfile::cotFunctionString() const
 void GeneratorProfile::setCotFunctionString(const std::string &cotFunctionString)
 {
     mPimpl->mCotFunctionString = cotFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::sechFunctionString() const
@@ -1780,6 +2741,7 @@ std::string GeneratorProfile::sechFunctionString() const
 void GeneratorProfile::setSechFunctionString(const std::string &sechFunctionString)
 {
     mPimpl->mSechFunctionString = sechFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::cschFunctionString() const
@@ -1790,6 +2752,7 @@ std::string GeneratorProfile::cschFunctionString() const
 void GeneratorProfile::setCschFunctionString(const std::string &cschFunctionString)
 {
     mPimpl->mCschFunctionString = cschFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::cothFunctionString() const
@@ -1800,6 +2763,7 @@ std::string GeneratorProfile::cothFunctionString() const
 void GeneratorProfile::setCothFunctionString(const std::string &cothFunctionString)
 {
     mPimpl->mCothFunctionString = cothFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::asecFunctionString() const
@@ -1810,6 +2774,7 @@ std::string GeneratorProfile::asecFunctionString() const
 void GeneratorProfile::setAsecFunctionString(const std::string &asecFunctionString)
 {
     mPimpl->mAsecFunctionString = asecFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::acscFunctionString() const
@@ -1820,6 +2785,7 @@ std::string GeneratorProfile::acscFunctionString() const
 void GeneratorProfile::setAcscFunctionString(const std::string &acscFunctionString)
 {
     mPimpl->mAcscFunctionString = acscFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::acotFunctionString() const
@@ -1830,6 +2796,7 @@ std::string GeneratorProfile::acotFunctionString() const
 void GeneratorProfile::setAcotFunctionString(const std::string &acotFunctionString)
 {
     mPimpl->mAcotFunctionString = acotFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::asechFunctionString() const
@@ -1840,6 +2807,7 @@ std::string GeneratorProfile::asechFunctionString() const
 void GeneratorProfile::setAsechFunctionString(const std::string &asechFunctionString)
 {
     mPimpl->mAsechFunctionString = asechFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::acschFunctionString() const
@@ -1850,6 +2818,7 @@ std::string GeneratorProfile::acschFunctionString() const
 void GeneratorProfile::setAcschFunctionString(const std::string &acschFunctionString)
 {
     mPimpl->mAcschFunctionString = acschFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::acothFunctionString() const
@@ -1860,6 +2829,7 @@ std::string GeneratorProfile::acothFunctionString() const
 void GeneratorProfile::setAcothFunctionString(const std::string &acothFunctionString)
 {
     mPimpl->mAcothFunctionString = acothFunctionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::commentString() const
@@ -1870,6 +2840,7 @@ std::string GeneratorProfile::commentString() const
 void GeneratorProfile::setCommentString(const std::string &commentString)
 {
     mPimpl->mCommentString = commentString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::originCommentString() const
@@ -1880,6 +2851,7 @@ std::string GeneratorProfile::originCommentString() const
 void GeneratorProfile::setOriginCommentString(const std::string &originCommentString)
 {
     mPimpl->mOriginCommentString = originCommentString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceFileNameString() const
@@ -1890,6 +2862,7 @@ std::string GeneratorProfile::interfaceFileNameString() const
 void GeneratorProfile::setInterfaceFileNameString(const std::string &interfaceFileNameString)
 {
     mPimpl->mInterfaceFileNameString = interfaceFileNameString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceHeaderString() const
@@ -1900,6 +2873,7 @@ std::string GeneratorProfile::interfaceHeaderString() const
 void GeneratorProfile::setInterfaceHeaderString(const std::string &interfaceHeaderString)
 {
     mPimpl->mInterfaceHeaderString = interfaceHeaderString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationHeaderString() const
@@ -1910,6 +2884,7 @@ std::string GeneratorProfile::implementationHeaderString() const
 void GeneratorProfile::setImplementationHeaderString(const std::string &implementationHeaderString)
 {
     mPimpl->mImplementationHeaderString = implementationHeaderString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceVersionString() const
@@ -1920,6 +2895,7 @@ std::string GeneratorProfile::interfaceVersionString() const
 void GeneratorProfile::setInterfaceVersionString(const std::string &interfaceVersionString)
 {
     mPimpl->mInterfaceVersionString = interfaceVersionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationVersionString() const
@@ -1930,6 +2906,7 @@ std::string GeneratorProfile::implementationVersionString() const
 void GeneratorProfile::setImplementationVersionString(const std::string &implementationVersionString)
 {
     mPimpl->mImplementationVersionString = implementationVersionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceLibcellmlVersionString() const
@@ -1940,6 +2917,7 @@ std::string GeneratorProfile::interfaceLibcellmlVersionString() const
 void GeneratorProfile::setInterfaceLibcellmlVersionString(const std::string &interfaceLibcellmlVersionString)
 {
     mPimpl->mInterfaceLibcellmlVersionString = interfaceLibcellmlVersionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationLibcellmlVersionString() const
@@ -1950,6 +2928,7 @@ std::string GeneratorProfile::implementationLibcellmlVersionString() const
 void GeneratorProfile::setImplementationLibcellmlVersionString(const std::string &implementationLibcellmlVersionString)
 {
     mPimpl->mImplementationLibcellmlVersionString = implementationLibcellmlVersionString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceStateCountString() const
@@ -1960,6 +2939,7 @@ std::string GeneratorProfile::interfaceStateCountString() const
 void GeneratorProfile::setInterfaceStateCountString(const std::string &interfaceStateCountString)
 {
     mPimpl->mInterfaceStateCountString = interfaceStateCountString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationStateCountString() const
@@ -1970,6 +2950,7 @@ std::string GeneratorProfile::implementationStateCountString() const
 void GeneratorProfile::setImplementationStateCountString(const std::string &implementationStateCountString)
 {
     mPimpl->mImplementationStateCountString = implementationStateCountString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceVariableCountString() const
@@ -1980,6 +2961,7 @@ std::string GeneratorProfile::interfaceVariableCountString() const
 void GeneratorProfile::setInterfaceVariableCountString(const std::string &interfaceVariableCountString)
 {
     mPimpl->mInterfaceVariableCountString = interfaceVariableCountString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationVariableCountString() const
@@ -1990,6 +2972,7 @@ std::string GeneratorProfile::implementationVariableCountString() const
 void GeneratorProfile::setImplementationVariableCountString(const std::string &implementationVariableCountString)
 {
     mPimpl->mImplementationVariableCountString = implementationVariableCountString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::variableTypeObjectString() const
@@ -2000,6 +2983,7 @@ std::string GeneratorProfile::variableTypeObjectString() const
 void GeneratorProfile::setVariableTypeObjectString(const std::string &variableTypeObjectString)
 {
     mPimpl->mVariableTypeObjectString = variableTypeObjectString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::constantVariableTypeString() const
@@ -2010,6 +2994,7 @@ std::string GeneratorProfile::constantVariableTypeString() const
 void GeneratorProfile::setConstantVariableTypeString(const std::string &constantVariableTypeString)
 {
     mPimpl->mConstantVariableTypeString = constantVariableTypeString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::computedConstantVariableTypeString() const
@@ -2020,6 +3005,7 @@ std::string GeneratorProfile::computedConstantVariableTypeString() const
 void GeneratorProfile::setComputedConstantVariableTypeString(const std::string &computedConstantVariableTypeString)
 {
     mPimpl->mComputedConstantVariableTypeString = computedConstantVariableTypeString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::algebraicVariableTypeString() const
@@ -2030,6 +3016,7 @@ std::string GeneratorProfile::algebraicVariableTypeString() const
 void GeneratorProfile::setAlgebraicVariableTypeString(const std::string &algebraicVariableTypeString)
 {
     mPimpl->mAlgebraicVariableTypeString = algebraicVariableTypeString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::variableInfoObjectString() const
@@ -2040,6 +3027,7 @@ std::string GeneratorProfile::variableInfoObjectString() const
 void GeneratorProfile::setVariableInfoObjectString(const std::string &variableInfoObjectString)
 {
     mPimpl->mVariableInfoObjectString = variableInfoObjectString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::variableInfoWithTypeObjectString() const
@@ -2050,6 +3038,7 @@ std::string GeneratorProfile::variableInfoWithTypeObjectString() const
 void GeneratorProfile::setVariableInfoWithTypeObjectString(const std::string &variableInfoWithTypeObjectString)
 {
     mPimpl->mVariableInfoWithTypeObjectString = variableInfoWithTypeObjectString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceVoiInfoString() const
@@ -2060,6 +3049,7 @@ std::string GeneratorProfile::interfaceVoiInfoString() const
 void GeneratorProfile::setInterfaceVoiInfoString(const std::string &interfaceVoiInfoString)
 {
     mPimpl->mInterfaceVoiInfoString = interfaceVoiInfoString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationVoiInfoString() const
@@ -2070,6 +3060,7 @@ std::string GeneratorProfile::implementationVoiInfoString() const
 void GeneratorProfile::setImplementationVoiInfoString(const std::string &implementationVoiInfoString)
 {
     mPimpl->mImplementationVoiInfoString = implementationVoiInfoString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceStateInfoString() const
@@ -2080,6 +3071,7 @@ std::string GeneratorProfile::interfaceStateInfoString() const
 void GeneratorProfile::setInterfaceStateInfoString(const std::string &interfaceStateInfoString)
 {
     mPimpl->mInterfaceStateInfoString = interfaceStateInfoString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationStateInfoString() const
@@ -2090,6 +3082,7 @@ std::string GeneratorProfile::implementationStateInfoString() const
 void GeneratorProfile::setImplementationStateInfoString(const std::string &implementationStateInfoString)
 {
     mPimpl->mImplementationStateInfoString = implementationStateInfoString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceVariableInfoString() const
@@ -2100,6 +3093,7 @@ std::string GeneratorProfile::interfaceVariableInfoString() const
 void GeneratorProfile::setInterfaceVariableInfoString(const std::string &interfaceVariableInfoString)
 {
     mPimpl->mInterfaceVariableInfoString = interfaceVariableInfoString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationVariableInfoString() const
@@ -2110,6 +3104,106 @@ std::string GeneratorProfile::implementationVariableInfoString() const
 void GeneratorProfile::setImplementationVariableInfoString(const std::string &implementationVariableInfoString)
 {
     mPimpl->mImplementationVariableInfoString = implementationVariableInfoString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::interfaceJacobianSparsityString() const
+{
+    return mPimpl->mInterfaceJacobianSparsityString;
+}
+
+void GeneratorProfile::setInterfaceJacobianSparsityString(const std::string &interfaceJacobianSparsityString)
+{
+    mPimpl->mInterfaceJacobianSparsityString = interfaceJacobianSparsityString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationJacobianSparsityString() const
+{
+    return mPimpl->mImplementationJacobianSparsityString;
+}
+
+void GeneratorProfile::setImplementationJacobianSparsityString(const std::string &implementationJacobianSparsityString)
+{
+    mPimpl->mImplementationJacobianSparsityString = implementationJacobianSparsityString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::emptyJacobianColumnIndicesString() const
+{
+    return mPimpl->mEmptyJacobianColumnIndicesString;
+}
+
+void GeneratorProfile::setEmptyJacobianColumnIndicesString(const std::string &emptyJacobianColumnIndicesString)
+{
+    mPimpl->mEmptyJacobianColumnIndicesString = emptyJacobianColumnIndicesString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::interfaceSensitivityParameterCountString() const
+{
+    return mPimpl->mInterfaceSensitivityParameterCountString;
+}
+
+void GeneratorProfile::setInterfaceSensitivityParameterCountString(const std::string &interfaceSensitivityParameterCountString)
+{
+    mPimpl->mInterfaceSensitivityParameterCountString = interfaceSensitivityParameterCountString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationSensitivityParameterCountString() const
+{
+    return mPimpl->mImplementationSensitivityParameterCountString;
+}
+
+void GeneratorProfile::setImplementationSensitivityParameterCountString(const std::string &implementationSensitivityParameterCountString)
+{
+    mPimpl->mImplementationSensitivityParameterCountString = implementationSensitivityParameterCountString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::interfaceSweepParameterCountString() const
+{
+    return mPimpl->mInterfaceSweepParameterCountString;
+}
+
+void GeneratorProfile::setInterfaceSweepParameterCountString(const std::string &interfaceSweepParameterCountString)
+{
+    mPimpl->mInterfaceSweepParameterCountString = interfaceSweepParameterCountString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationSweepParameterCountString() const
+{
+    return mPimpl->mImplementationSweepParameterCountString;
+}
+
+void GeneratorProfile::setImplementationSweepParameterCountString(const std::string &implementationSweepParameterCountString)
+{
+    mPimpl->mImplementationSweepParameterCountString = implementationSweepParameterCountString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::interfaceResetCountString() const
+{
+    return mPimpl->mInterfaceResetCountString;
+}
+
+void GeneratorProfile::setInterfaceResetCountString(const std::string &interfaceResetCountString)
+{
+    mPimpl->mInterfaceResetCountString = interfaceResetCountString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationResetCountString() const
+{
+    return mPimpl->mImplementationResetCountString;
+}
+
+void GeneratorProfile::setImplementationResetCountString(const std::string &implementationResetCountString)
+{
+    mPimpl->mImplementationResetCountString = implementationResetCountString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::variableInfoEntryString() const
@@ -2120,6 +3214,7 @@ std::string GeneratorProfile::variableInfoEntryString() const
 void GeneratorProfile::setVariableInfoEntryString(const std::string &variableInfoEntryString)
 {
     mPimpl->mVariableInfoEntryString = variableInfoEntryString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::variableInfoWithTypeEntryString() const
@@ -2130,6 +3225,7 @@ std::string GeneratorProfile::variableInfoWithTypeEntryString() const
 void GeneratorProfile::setVariableInfoWithTypeEntryString(const std::string &variableInfoWithTypeEntryString)
 {
     mPimpl->mVariableInfoWithTypeEntryString = variableInfoWithTypeEntryString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::voiString() const
@@ -2140,6 +3236,18 @@ std::string GeneratorProfile::voiString() const
 void GeneratorProfile::setVoiString(const std::string &voiString)
 {
     mPimpl->mVoiString = voiString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::timeStepString() const
+{
+    return mPimpl->mTimeStepString;
+}
+
+void GeneratorProfile::setTimeStepString(const std::string &timeStepString)
+{
+    mPimpl->mTimeStepString = timeStepString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::statesArrayString() const
@@ -2150,6 +3258,7 @@ std::string GeneratorProfile::statesArrayString() const
 void GeneratorProfile::setStatesArrayString(const std::string &statesArrayString)
 {
     mPimpl->mStatesArrayString = statesArrayString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::ratesArrayString() const
@@ -2160,6 +3269,7 @@ std::string GeneratorProfile::ratesArrayString() const
 void GeneratorProfile::setRatesArrayString(const std::string &ratesArrayString)
 {
     mPimpl->mRatesArrayString = ratesArrayString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::variablesArrayString() const
@@ -2170,6 +3280,117 @@ std::string GeneratorProfile::variablesArrayString() const
 void GeneratorProfile::setVariablesArrayString(const std::string &variablesArrayString)
 {
     mPimpl->mVariablesArrayString = variablesArrayString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::jacobianArrayString() const
+{
+    return mPimpl->mJacobianArrayString;
+}
+
+void GeneratorProfile::setJacobianArrayString(const std::string &jacobianArrayString)
+{
+    mPimpl->mJacobianArrayString = jacobianArrayString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::sensitivitiesArrayString() const
+{
+    return mPimpl->mSensitivitiesArrayString;
+}
+
+void GeneratorProfile::setSensitivitiesArrayString(const std::string &sensitivitiesArrayString)
+{
+    mPimpl->mSensitivitiesArrayString = sensitivitiesArrayString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::sensitivityRatesArrayString() const
+{
+    return mPimpl->mSensitivityRatesArrayString;
+}
+
+void GeneratorProfile::setSensitivityRatesArrayString(const std::string &sensitivityRatesArrayString)
+{
+    mPimpl->mSensitivityRatesArrayString = sensitivityRatesArrayString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::sweepParametersArrayString() const
+{
+    return mPimpl->mSweepParametersArrayString;
+}
+
+void GeneratorProfile::setSweepParametersArrayString(const std::string &sweepParametersArrayString)
+{
+    mPimpl->mSweepParametersArrayString = sweepParametersArrayString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::batchArrayIndexString() const
+{
+    return mPimpl->mBatchArrayIndexString;
+}
+
+void GeneratorProfile::setBatchArrayIndexString(const std::string &batchArrayIndexString)
+{
+    mPimpl->mBatchArrayIndexString = batchArrayIndexString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::batchSweepParameterIndexString() const
+{
+    return mPimpl->mBatchSweepParameterIndexString;
+}
+
+void GeneratorProfile::setBatchSweepParameterIndexString(const std::string &batchSweepParameterIndexString)
+{
+    mPimpl->mBatchSweepParameterIndexString = batchSweepParameterIndexString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::instanceArrayIndexString() const
+{
+    return mPimpl->mInstanceArrayIndexString;
+}
+
+void GeneratorProfile::setInstanceArrayIndexString(const std::string &instanceArrayIndexString)
+{
+    mPimpl->mInstanceArrayIndexString = instanceArrayIndexString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::rootsArrayString() const
+{
+    return mPimpl->mRootsArrayString;
+}
+
+void GeneratorProfile::setRootsArrayString(const std::string &rootsArrayString)
+{
+    mPimpl->mRootsArrayString = rootsArrayString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::eventsArrayString() const
+{
+    return mPimpl->mEventsArrayString;
+}
+
+void GeneratorProfile::setEventsArrayString(const std::string &eventsArrayString)
+{
+    mPimpl->mEventsArrayString = eventsArrayString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::resetValuesArrayString() const
+{
+    return mPimpl->mResetValuesArrayString;
+}
+
+void GeneratorProfile::setResetValuesArrayString(const std::string &resetValuesArrayString)
+{
+    mPimpl->mResetValuesArrayString = resetValuesArrayString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceCreateStatesArrayMethodString() const
@@ -2180,6 +3401,7 @@ std::string GeneratorProfile::interfaceCreateStatesArrayMethodString() const
 void GeneratorProfile::setInterfaceCreateStatesArrayMethodString(const std::string &interfaceCreateStatesArrayMethodString)
 {
     mPimpl->mInterfaceCreateStatesArrayMethodString = interfaceCreateStatesArrayMethodString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationCreateStatesArrayMethodString() const
@@ -2190,6 +3412,7 @@ std::string GeneratorProfile::implementationCreateStatesArrayMethodString() cons
 void GeneratorProfile::setImplementationCreateStatesArrayMethodString(const std::string &implementationCreateStatesArrayMethodString)
 {
     mPimpl->mImplementationCreateStatesArrayMethodString = implementationCreateStatesArrayMethodString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceCreateVariablesArrayMethodString() const
@@ -2200,6 +3423,7 @@ std::string GeneratorProfile::interfaceCreateVariablesArrayMethodString() const
 void GeneratorProfile::setInterfaceCreateVariablesArrayMethodString(const std::string &interfaceCreateVariablesArrayMethodString)
 {
     mPimpl->mInterfaceCreateVariablesArrayMethodString = interfaceCreateVariablesArrayMethodString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationCreateVariablesArrayMethodString() const
@@ -2210,6 +3434,7 @@ std::string GeneratorProfile::implementationCreateVariablesArrayMethodString() c
 void GeneratorProfile::setImplementationCreateVariablesArrayMethodString(const std::string &implementationCreateVariablesArrayMethodString)
 {
     mPimpl->mImplementationCreateVariablesArrayMethodString = implementationCreateVariablesArrayMethodString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceDeleteArrayMethodString() const
@@ -2220,6 +3445,7 @@ std::string GeneratorProfile::interfaceDeleteArrayMethodString() const
 void GeneratorProfile::setInterfaceDeleteArrayMethodString(const std::string &interfaceDeleteArrayMethodString)
 {
     mPimpl->mInterfaceDeleteArrayMethodString = interfaceDeleteArrayMethodString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationDeleteArrayMethodString() const
@@ -2230,6 +3456,7 @@ std::string GeneratorProfile::implementationDeleteArrayMethodString() const
 void GeneratorProfile::setImplementationDeleteArrayMethodString(const std::string &implementationDeleteArrayMethodString)
 {
     mPimpl->mImplementationDeleteArrayMethodString = implementationDeleteArrayMethodString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceInitializeStatesAndConstantsMethodString() const
@@ -2240,6 +3467,7 @@ std::string GeneratorProfile::interfaceInitializeStatesAndConstantsMethodString(
 void GeneratorProfile::setInterfaceInitializeStatesAndConstantsMethodString(const std::string &interfaceInitializeStatesAndConstantsMethodString)
 {
     mPimpl->mInterfaceInitializeStatesAndConstantsMethodString = interfaceInitializeStatesAndConstantsMethodString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationInitializeStatesAndConstantsMethodString() const
@@ -2250,6 +3478,7 @@ std::string GeneratorProfile::implementationInitializeStatesAndConstantsMethodSt
 void GeneratorProfile::setImplementationInitializeStatesAndConstantsMethodString(const std::string &implementationInitializeStatesAndConstantsMethodString)
 {
     mPimpl->mImplementationInitializeStatesAndConstantsMethodString = implementationInitializeStatesAndConstantsMethodString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceComputeComputedConstantsMethodString() const
@@ -2260,6 +3489,7 @@ std::string GeneratorProfile::interfaceComputeComputedConstantsMethodString() co
 void GeneratorProfile::setInterfaceComputeComputedConstantsMethodString(const std::string &interfaceComputeComputedConstantsMethodString)
 {
     mPimpl->mInterfaceComputeComputedConstantsMethodString = interfaceComputeComputedConstantsMethodString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationComputeComputedConstantsMethodString() const
@@ -2270,6 +3500,29 @@ std::string GeneratorProfile::implementationComputeComputedConstantsMethodString
 void GeneratorProfile::setImplementationComputeComputedConstantsMethodString(const std::string &implementationComputeComputedConstantsMethodString)
 {
     mPimpl->mImplementationComputeComputedConstantsMethodString = implementationComputeComputedConstantsMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationComputeComputedConstantsMethodChunkString() const
+{
+    return mPimpl->mImplementationComputeComputedConstantsMethodChunkString;
+}
+
+void GeneratorProfile::setImplementationComputeComputedConstantsMethodChunkString(const std::string &implementationComputeComputedConstantsMethodChunkString)
+{
+    mPimpl->mImplementationComputeComputedConstantsMethodChunkString = implementationComputeComputedConstantsMethodChunkString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::computeComputedConstantsMethodChunkCallString() const
+{
+    return mPimpl->mComputeComputedConstantsMethodChunkCallString;
+}
+
+void GeneratorProfile::setComputeComputedConstantsMethodChunkCallString(const std::string &computeComputedConstantsMethodChunkCallString)
+{
+    mPimpl->mComputeComputedConstantsMethodChunkCallString = computeComputedConstantsMethodChunkCallString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceComputeRatesMethodString() const
@@ -2280,6 +3533,7 @@ std::string GeneratorProfile::interfaceComputeRatesMethodString() const
 void GeneratorProfile::setInterfaceComputeRatesMethodString(const std::string &interfaceComputeRatesMethodString)
 {
     mPimpl->mInterfaceComputeRatesMethodString = interfaceComputeRatesMethodString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationComputeRatesMethodString() const
@@ -2290,6 +3544,51 @@ std::string GeneratorProfile::implementationComputeRatesMethodString() const
 void GeneratorProfile::setImplementationComputeRatesMethodString(const std::string &implementationComputeRatesMethodString)
 {
     mPimpl->mImplementationComputeRatesMethodString = implementationComputeRatesMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationComputeRatesMethodChunkString() const
+{
+    return mPimpl->mImplementationComputeRatesMethodChunkString;
+}
+
+void GeneratorProfile::setImplementationComputeRatesMethodChunkString(const std::string &implementationComputeRatesMethodChunkString)
+{
+    mPimpl->mImplementationComputeRatesMethodChunkString = implementationComputeRatesMethodChunkString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::computeRatesMethodChunkCallString() const
+{
+    return mPimpl->mComputeRatesMethodChunkCallString;
+}
+
+void GeneratorProfile::setComputeRatesMethodChunkCallString(const std::string &computeRatesMethodChunkCallString)
+{
+    mPimpl->mComputeRatesMethodChunkCallString = computeRatesMethodChunkCallString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationComputeRatesMethodKernelString() const
+{
+    return mPimpl->mImplementationComputeRatesMethodKernelString;
+}
+
+void GeneratorProfile::setImplementationComputeRatesMethodKernelString(const std::string &implementationComputeRatesMethodKernelString)
+{
+    mPimpl->mImplementationComputeRatesMethodKernelString = implementationComputeRatesMethodKernelString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::computeRatesMethodKernelCallString() const
+{
+    return mPimpl->mComputeRatesMethodKernelCallString;
+}
+
+void GeneratorProfile::setComputeRatesMethodKernelCallString(const std::string &computeRatesMethodKernelCallString)
+{
+    mPimpl->mComputeRatesMethodKernelCallString = computeRatesMethodKernelCallString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::interfaceComputeVariablesMethodString() const
@@ -2300,6 +3599,7 @@ std::string GeneratorProfile::interfaceComputeVariablesMethodString() const
 void GeneratorProfile::setInterfaceComputeVariablesMethodString(const std::string &interfaceComputeVariablesMethodString)
 {
     mPimpl->mInterfaceComputeVariablesMethodString = interfaceComputeVariablesMethodString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::implementationComputeVariablesMethodString() const
@@ -2310,6 +3610,370 @@ std::string GeneratorProfile::implementationComputeVariablesMethodString() const
 void GeneratorProfile::setImplementationComputeVariablesMethodString(const std::string &implementationComputeVariablesMethodString)
 {
     mPimpl->mImplementationComputeVariablesMethodString = implementationComputeVariablesMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationComputeVariablesMethodChunkString() const
+{
+    return mPimpl->mImplementationComputeVariablesMethodChunkString;
+}
+
+void GeneratorProfile::setImplementationComputeVariablesMethodChunkString(const std::string &implementationComputeVariablesMethodChunkString)
+{
+    mPimpl->mImplementationComputeVariablesMethodChunkString = implementationComputeVariablesMethodChunkString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::computeVariablesMethodChunkCallString() const
+{
+    return mPimpl->mComputeVariablesMethodChunkCallString;
+}
+
+void GeneratorProfile::setComputeVariablesMethodChunkCallString(const std::string &computeVariablesMethodChunkCallString)
+{
+    mPimpl->mComputeVariablesMethodChunkCallString = computeVariablesMethodChunkCallString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationComputeVariablesMethodKernelString() const
+{
+    return mPimpl->mImplementationComputeVariablesMethodKernelString;
+}
+
+void GeneratorProfile::setImplementationComputeVariablesMethodKernelString(const std::string &implementationComputeVariablesMethodKernelString)
+{
+    mPimpl->mImplementationComputeVariablesMethodKernelString = implementationComputeVariablesMethodKernelString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::computeVariablesMethodKernelCallString() const
+{
+    return mPimpl->mComputeVariablesMethodKernelCallString;
+}
+
+void GeneratorProfile::setComputeVariablesMethodKernelCallString(const std::string &computeVariablesMethodKernelCallString)
+{
+    mPimpl->mComputeVariablesMethodKernelCallString = computeVariablesMethodKernelCallString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::parallelRegionString() const
+{
+    return mPimpl->mParallelRegionString;
+}
+
+void GeneratorProfile::setParallelRegionString(const std::string &parallelRegionString)
+{
+    mPimpl->mParallelRegionString = parallelRegionString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::parallelLevelString() const
+{
+    return mPimpl->mParallelLevelString;
+}
+
+void GeneratorProfile::setParallelLevelString(const std::string &parallelLevelString)
+{
+    mPimpl->mParallelLevelString = parallelLevelString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::parallelTaskString() const
+{
+    return mPimpl->mParallelTaskString;
+}
+
+void GeneratorProfile::setParallelTaskString(const std::string &parallelTaskString)
+{
+    mPimpl->mParallelTaskString = parallelTaskString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::interfaceComputeJacobianMethodString() const
+{
+    return mPimpl->mInterfaceComputeJacobianMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeJacobianMethodString(const std::string &interfaceComputeJacobianMethodString)
+{
+    mPimpl->mInterfaceComputeJacobianMethodString = interfaceComputeJacobianMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationComputeJacobianMethodString() const
+{
+    return mPimpl->mImplementationComputeJacobianMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeJacobianMethodString(const std::string &implementationComputeJacobianMethodString)
+{
+    mPimpl->mImplementationComputeJacobianMethodString = implementationComputeJacobianMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::interfaceComputeRushLarsenStepMethodString() const
+{
+    return mPimpl->mInterfaceComputeRushLarsenStepMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeRushLarsenStepMethodString(const std::string &interfaceComputeRushLarsenStepMethodString)
+{
+    mPimpl->mInterfaceComputeRushLarsenStepMethodString = interfaceComputeRushLarsenStepMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationComputeRushLarsenStepMethodString() const
+{
+    return mPimpl->mImplementationComputeRushLarsenStepMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeRushLarsenStepMethodString(const std::string &implementationComputeRushLarsenStepMethodString)
+{
+    mPimpl->mImplementationComputeRushLarsenStepMethodString = implementationComputeRushLarsenStepMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::rushLarsenExponentString() const
+{
+    return mPimpl->mRushLarsenExponentString;
+}
+
+void GeneratorProfile::setRushLarsenExponentString(const std::string &rushLarsenExponentString)
+{
+    mPimpl->mRushLarsenExponentString = rushLarsenExponentString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationRushLarsenExponentString() const
+{
+    return mPimpl->mImplementationRushLarsenExponentString;
+}
+
+void GeneratorProfile::setImplementationRushLarsenExponentString(const std::string &implementationRushLarsenExponentString)
+{
+    mPimpl->mImplementationRushLarsenExponentString = implementationRushLarsenExponentString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::interfaceComputeSensitivityRatesMethodString() const
+{
+    return mPimpl->mInterfaceComputeSensitivityRatesMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeSensitivityRatesMethodString(const std::string &interfaceComputeSensitivityRatesMethodString)
+{
+    mPimpl->mInterfaceComputeSensitivityRatesMethodString = interfaceComputeSensitivityRatesMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationComputeSensitivityRatesMethodString() const
+{
+    return mPimpl->mImplementationComputeSensitivityRatesMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeSensitivityRatesMethodString(const std::string &implementationComputeSensitivityRatesMethodString)
+{
+    mPimpl->mImplementationComputeSensitivityRatesMethodString = implementationComputeSensitivityRatesMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::interfaceInitializeStatesAndConstantsBatchMethodString() const
+{
+    return mPimpl->mInterfaceInitializeStatesAndConstantsBatchMethodString;
+}
+
+void GeneratorProfile::setInterfaceInitializeStatesAndConstantsBatchMethodString(const std::string &interfaceInitializeStatesAndConstantsBatchMethodString)
+{
+    mPimpl->mInterfaceInitializeStatesAndConstantsBatchMethodString = interfaceInitializeStatesAndConstantsBatchMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationInitializeStatesAndConstantsBatchMethodString() const
+{
+    return mPimpl->mImplementationInitializeStatesAndConstantsBatchMethodString;
+}
+
+void GeneratorProfile::setImplementationInitializeStatesAndConstantsBatchMethodString(const std::string &implementationInitializeStatesAndConstantsBatchMethodString)
+{
+    mPimpl->mImplementationInitializeStatesAndConstantsBatchMethodString = implementationInitializeStatesAndConstantsBatchMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::interfaceComputeRatesBatchMethodString() const
+{
+    return mPimpl->mInterfaceComputeRatesBatchMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeRatesBatchMethodString(const std::string &interfaceComputeRatesBatchMethodString)
+{
+    mPimpl->mInterfaceComputeRatesBatchMethodString = interfaceComputeRatesBatchMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationComputeRatesBatchMethodString() const
+{
+    return mPimpl->mImplementationComputeRatesBatchMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeRatesBatchMethodString(const std::string &implementationComputeRatesBatchMethodString)
+{
+    mPimpl->mImplementationComputeRatesBatchMethodString = implementationComputeRatesBatchMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::interfaceComputeRatesSpecializedMethodString() const
+{
+    return mPimpl->mInterfaceComputeRatesSpecializedMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeRatesSpecializedMethodString(const std::string &interfaceComputeRatesSpecializedMethodString)
+{
+    mPimpl->mInterfaceComputeRatesSpecializedMethodString = interfaceComputeRatesSpecializedMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationComputeRatesSpecializedMethodString() const
+{
+    return mPimpl->mImplementationComputeRatesSpecializedMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeRatesSpecializedMethodString(const std::string &implementationComputeRatesSpecializedMethodString)
+{
+    mPimpl->mImplementationComputeRatesSpecializedMethodString = implementationComputeRatesSpecializedMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::interfaceComputeVariablesSpecializedMethodString() const
+{
+    return mPimpl->mInterfaceComputeVariablesSpecializedMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeVariablesSpecializedMethodString(const std::string &interfaceComputeVariablesSpecializedMethodString)
+{
+    mPimpl->mInterfaceComputeVariablesSpecializedMethodString = interfaceComputeVariablesSpecializedMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationComputeVariablesSpecializedMethodString() const
+{
+    return mPimpl->mImplementationComputeVariablesSpecializedMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeVariablesSpecializedMethodString(const std::string &implementationComputeVariablesSpecializedMethodString)
+{
+    mPimpl->mImplementationComputeVariablesSpecializedMethodString = implementationComputeVariablesSpecializedMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::interfaceComputeRootsMethodString() const
+{
+    return mPimpl->mInterfaceComputeRootsMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeRootsMethodString(const std::string &interfaceComputeRootsMethodString)
+{
+    mPimpl->mInterfaceComputeRootsMethodString = interfaceComputeRootsMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationComputeRootsMethodString() const
+{
+    return mPimpl->mImplementationComputeRootsMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeRootsMethodString(const std::string &implementationComputeRootsMethodString)
+{
+    mPimpl->mImplementationComputeRootsMethodString = implementationComputeRootsMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::interfaceApplyResetsMethodString() const
+{
+    return mPimpl->mInterfaceApplyResetsMethodString;
+}
+
+void GeneratorProfile::setInterfaceApplyResetsMethodString(const std::string &interfaceApplyResetsMethodString)
+{
+    mPimpl->mInterfaceApplyResetsMethodString = interfaceApplyResetsMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationApplyResetsMethodString() const
+{
+    return mPimpl->mImplementationApplyResetsMethodString;
+}
+
+void GeneratorProfile::setImplementationApplyResetsMethodString(const std::string &implementationApplyResetsMethodString)
+{
+    mPimpl->mImplementationApplyResetsMethodString = implementationApplyResetsMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::lookupTableArgumentString() const
+{
+    return mPimpl->mLookupTableArgumentString;
+}
+
+void GeneratorProfile::setLookupTableArgumentString(const std::string &lookupTableArgumentString)
+{
+    mPimpl->mLookupTableArgumentString = lookupTableArgumentString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationLookupTableString() const
+{
+    return mPimpl->mImplementationLookupTableString;
+}
+
+void GeneratorProfile::setImplementationLookupTableString(const std::string &implementationLookupTableString)
+{
+    mPimpl->mImplementationLookupTableString = implementationLookupTableString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::implementationComputeLookupTableMethodString() const
+{
+    return mPimpl->mImplementationComputeLookupTableMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeLookupTableMethodString(const std::string &implementationComputeLookupTableMethodString)
+{
+    mPimpl->mImplementationComputeLookupTableMethodString = implementationComputeLookupTableMethodString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::computeLookupTableCallString() const
+{
+    return mPimpl->mComputeLookupTableCallString;
+}
+
+void GeneratorProfile::setComputeLookupTableCallString(const std::string &computeLookupTableCallString)
+{
+    mPimpl->mComputeLookupTableCallString = computeLookupTableCallString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::lookupTableEntryString() const
+{
+    return mPimpl->mLookupTableEntryString;
+}
+
+void GeneratorProfile::setLookupTableEntryString(const std::string &lookupTableEntryString)
+{
+    mPimpl->mLookupTableEntryString = lookupTableEntryString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::lookupTableValueString() const
+{
+    return mPimpl->mLookupTableValueString;
+}
+
+void GeneratorProfile::setLookupTableValueString(const std::string &lookupTableValueString)
+{
+    mPimpl->mLookupTableValueString = lookupTableValueString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::emptyMethodString() const
@@ -2320,6 +3984,7 @@ std::string GeneratorProfile::emptyMethodString() const
 void GeneratorProfile::setEmptyMethodString(const std::string &emptyMethodString)
 {
     mPimpl->mEmptyMethodString = emptyMethodString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::indentString() const
@@ -2330,6 +3995,7 @@ std::string GeneratorProfile::indentString() const
 void GeneratorProfile::setIndentString(const std::string &indentString)
 {
     mPimpl->mIndentString = indentString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::openArrayInitializerString() const
@@ -2340,6 +4006,7 @@ std::string GeneratorProfile::openArrayInitializerString() const
 void GeneratorProfile::setOpenArrayInitializerString(const std::string &openArrayInitializerString)
 {
     mPimpl->mOpenArrayInitializerString = openArrayInitializerString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::closeArrayInitializerString() const
@@ -2350,6 +4017,7 @@ std::string GeneratorProfile::closeArrayInitializerString() const
 void GeneratorProfile::setCloseArrayInitializerString(const std::string &closeArrayInitializerString)
 {
     mPimpl->mCloseArrayInitializerString = closeArrayInitializerString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::openArrayString() const
@@ -2360,6 +4028,7 @@ std::string GeneratorProfile::openArrayString() const
 void GeneratorProfile::setOpenArrayString(const std::string &openArrayString)
 {
     mPimpl->mOpenArrayString = openArrayString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::closeArrayString() const
@@ -2370,6 +4039,18 @@ std::string GeneratorProfile::closeArrayString() const
 void GeneratorProfile::setCloseArrayString(const std::string &closeArrayString)
 {
     mPimpl->mCloseArrayString = closeArrayString;
+    ++mPimpl->mRevision;
+}
+
+std::string GeneratorProfile::computeCastString() const
+{
+    return mPimpl->mComputeCastString;
+}
+
+void GeneratorProfile::setComputeCastString(const std::string &computeCastString)
+{
+    mPimpl->mComputeCastString = computeCastString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::arrayElementSeparatorString() const
@@ -2380,6 +4061,7 @@ std::string GeneratorProfile::arrayElementSeparatorString() const
 void GeneratorProfile::setArrayElementSeparatorString(const std::string &arrayElementSeparatorString)
 {
     mPimpl->mArrayElementSeparatorString = arrayElementSeparatorString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::stringDelimiterString() const
@@ -2390,6 +4072,7 @@ std::string GeneratorProfile::stringDelimiterString() const
 void GeneratorProfile::setStringDelimiterString(const std::string &stringDelimiterString)
 {
     mPimpl->mStringDelimiterString = stringDelimiterString;
+    ++mPimpl->mRevision;
 }
 
 std::string GeneratorProfile::commandSeparatorString() const
@@ -2400,6 +4083,7 @@ std::string GeneratorProfile::commandSeparatorString() const
 void GeneratorProfile::setCommandSeparatorString(const std::string &commandSeparatorString)
 {
     mPimpl->mCommandSeparatorString = commandSeparatorString;
+    ++mPimpl->mRevision;
 }
 
 } // namespace libcellml
@@ -19,6 +19,7 @@ limitations under the License.
 #include <cstring>
 #include <libxml/tree.h>
 #include <libxml/xmlerror.h>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -50,6 +51,43 @@ void structuredErrorCallback(void *userData, xmlErrorPtr error)
     doc->addXmlError(errorString);
 }
 
+static std::mutex xmlParserMutex;
+static size_t xmlParserUserCount = 0;
+
+/**
+ * @brief Start using libxml2.
+ *
+ * Initialise the global state of libxml2, unless it is already in use,
+ * possibly by another thread. Each @c XmlDoc uses libxml2 from its creation
+ * until its destruction, since its tree is still used after it has been parsed
+ * and is only freed when it gets destroyed. This, together with
+ * @c stopXmlParser(), allows documents to be used concurrently.
+ */
+void startXmlParser()
+{
+    std::lock_guard<std::mutex> lock(xmlParserMutex);
+
+    if (xmlParserUserCount++ == 0) {
+        xmlInitParser();
+    }
+}
+
+/**
+ * @brief Stop using libxml2.
+ *
+ * Clean up the global state of libxml2, but only once it is no longer in use
+ * by any thread, i.e. once no @c XmlDoc exists anymore.
+ */
+void stopXmlParser()
+{
+    std::lock_guard<std::mutex> lock(xmlParserMutex);
+
+    if (--xmlParserUserCount == 0) {
+        xmlCleanupParser();
+        xmlCleanupGlobals();
+    }
+}
+
 /**
  * @brief The XmlDoc::XmlDocImpl struct.
  *
@@ -66,6 +104,7 @@ struct XmlDoc::XmlDocImpl
 XmlDoc::XmlDoc()
     : mPimpl(new XmlDocImpl())
 {
+    startXmlParser();
 }
 
 XmlDoc::~XmlDoc()
@@ -74,24 +113,21 @@ XmlDoc::~XmlDoc()
         xmlFreeDoc(mPimpl->mXmlDocPtr);
     }
     delete mPimpl;
+    stopXmlParser();
 }
 
 void XmlDoc::parse(const std::string &input)
 {
-    xmlInitParser();
     xmlParserCtxtPtr context = xmlNewParserCtxt();
     context->_private = reinterpret_cast<void *>(this);
     xmlSetStructuredErrorFunc(context, structuredErrorCallback);
     mPimpl->mXmlDocPtr = xmlCtxtReadDoc(context, reinterpret_cast<const xmlChar *>(input.c_str()), "/", nullptr, 0);
     xmlFreeParserCtxt(context);
     xmlSetStructuredErrorFunc(nullptr, nullptr);
-    xmlCleanupParser();
-    xmlCleanupGlobals();
 }
 
 void XmlDoc::parseMathML(const std::string &input, bool validate)
 {
-    xmlInitParser();
     std::string mathmlString = input;
     if (validate) {
         mathmlString = "<!DOCTYPE math SYSTEM \"" + LIBCELLML_MATHML_DTD_LOCATION + "\">" + mathmlString;
@@ -103,8 +139,6 @@ void XmlDoc::parseMathML(const std::string &input, bool validate)
                                         validate ? XML_PARSE_DTDVALID : 0);
     xmlFreeParserCtxt(context);
     xmlSetStructuredErrorFunc(nullptr, nullptr);
-    xmlCleanupParser();
-    xmlCleanupGlobals();
 }
 
 std::string XmlDoc::prettyPrint() const
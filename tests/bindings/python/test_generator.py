@@ -1,6 +1,7 @@
 #
 # Tests the Parser class bindings
 #
+import importlib.util
 import unittest
 
 from test_resources import file_contents
@@ -14,6 +15,24 @@ class GeneratorVariableTestCase(unittest.TestCase):
         del(x)
 
 
+class GeneratorAstTestCase(unittest.TestCase):
+
+    def test_create_destroy(self):
+        from libcellml import GeneratorAst
+
+        x = GeneratorAst()
+        del(x)
+
+
+class GeneratorEquationTestCase(unittest.TestCase):
+
+    def test_create_destroy(self):
+        from libcellml import GeneratorEquation
+
+        x = GeneratorEquation()
+        del(x)
+
+
 class GeneratorTestCase(unittest.TestCase):
 
     def test_create_destroy(self):
@@ -70,6 +89,352 @@ class GeneratorTestCase(unittest.TestCase):
         self.assertEqual(file_contents("generator/algebraic_eqn_computed_var_on_rhs/model.h"), g.interfaceCode())
         self.assertEqual(file_contents("generator/algebraic_eqn_computed_var_on_rhs/model.c"), g.implementationCode())
 
+    def test_required_outputs(self):
+        from libcellml import Parser
+        from libcellml import Generator
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        g = Generator()
+
+        g.processModel(m)
+
+        i_Na = m.component('membrane').variable('i_Na')
+        i_K = m.component('potassium_channel', True).variable('i_K')
+
+        self.assertEqual(0, g.requiredOutputCount())
+        self.assertIsNone(g.requiredOutput(0))
+
+        g.addRequiredOutput(i_Na)
+        g.addRequiredOutput(i_K)
+        g.addRequiredOutput(i_Na)
+
+        self.assertEqual(2, g.requiredOutputCount())
+        self.assertEqual(0, g.issueCount())
+
+        g.addRequiredOutput(m.component('membrane').variable('V'))
+
+        self.assertEqual(1, g.issueCount())
+
+        g.removeAllRequiredOutputs()
+        g.addRequiredOutput(i_Na)
+        g.addRequiredOutput(i_K)
+        self.assertEqual('i_Na', g.requiredOutput(0).name())
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.required.outputs.py"), g.implementationCode())
+
+        g.removeAllRequiredOutputs()
+
+        self.assertEqual(0, g.requiredOutputCount())
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), g.implementationCode())
+
+    def test_sensitivity_parameters(self):
+        from libcellml import Parser
+        from libcellml import Generator
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        g = Generator()
+
+        g.processModel(m)
+
+        g_Na = m.component('sodium_channel', True).variable('g_Na')
+        V = m.component('membrane').variable('V')
+        E_R = m.component('membrane').variable('E_R')
+
+        self.assertEqual(0, g.sensitivityParameterCount())
+        self.assertIsNone(g.sensitivityParameter(0))
+
+        g.addSensitivityParameter(g_Na)
+        g.addSensitivityParameter(V)
+        g.addSensitivityParameter(E_R)
+
+        self.assertEqual(3, g.sensitivityParameterCount())
+        self.assertEqual('g_Na', g.sensitivityParameter(0).name())
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.sensitivities.py"), g.implementationCode())
+
+        g.removeAllSensitivityParameters()
+
+        self.assertEqual(0, g.sensitivityParameterCount())
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), g.implementationCode())
+
+    def test_sweep_parameters(self):
+        from libcellml import Parser
+        from libcellml import Generator
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        g = Generator()
+
+        g.processModel(m)
+
+        g_Na = m.component('sodium_channel', True).variable('g_Na')
+        E_R = m.component('membrane').variable('E_R')
+
+        self.assertEqual(0, g.sweepParameterCount())
+        self.assertIsNone(g.sweepParameter(0))
+
+        g.addSweepParameter(g_Na)
+        g.addSweepParameter(E_R)
+
+        self.assertEqual(2, g.sweepParameterCount())
+        self.assertEqual('E_R', g.sweepParameter(1).name())
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), g.implementationCode())
+
+        g.removeAllSweepParameters()
+
+        self.assertEqual(0, g.sweepParameterCount())
+
+    def test_specialized_methods(self):
+        from libcellml import Parser
+        from libcellml import Generator
+        from libcellml import GeneratorProfile
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        g = Generator()
+
+        g.processModel(m)
+
+        self.assertFalse(g.hasSpecializedMethods())
+
+        g.setHasSpecializedMethods(True)
+
+        self.assertTrue(g.hasSpecializedMethods())
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), g.implementationCode())
+
+        profile = GeneratorProfile(GeneratorProfile.Profile.C)
+        profile.setInterfaceFileNameString('model.specialized.h')
+
+        g.setProfile(profile)
+
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.specialized.h"), g.interfaceCode())
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.specialized.c"), g.implementationCode())
+
+        g.setHasSpecializedMethods(False)
+
+        self.assertFalse(g.hasSpecializedMethods())
+
+    def test_lookup_table(self):
+        from libcellml import Parser
+        from libcellml import Generator
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        g = Generator()
+
+        g.processModel(m)
+
+        V = m.component('membrane').variable('V')
+
+        self.assertFalse(g.hasLookupTable())
+        self.assertIsNone(g.lookupTableVariable())
+
+        g.setLookupTable(V, -150.005, 50.005, 0.01)
+
+        self.assertTrue(g.hasLookupTable())
+        self.assertEqual('V', g.lookupTableVariable().name())
+        self.assertEqual(-150.005, g.lookupTableMinimum())
+        self.assertEqual(50.005, g.lookupTableMaximum())
+        self.assertEqual(0.01, g.lookupTableStep())
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.lookup.table.py"), g.implementationCode())
+
+        g.removeLookupTable()
+
+        self.assertFalse(g.hasLookupTable())
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), g.implementationCode())
+
+
+    def test_maximum_statement_count(self):
+        from libcellml import Parser
+        from libcellml import Generator
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        g = Generator()
+
+        g.processModel(m)
+
+        self.assertEqual(0, g.maximumStatementCount())
+
+        g.setMaximumStatementCount(2)
+
+        self.assertEqual(2, g.maximumStatementCount())
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.split.py"), g.implementationCode())
+
+    def test_parallel_chunk_size(self):
+        from libcellml import Generator
+
+        g = Generator()
+
+        self.assertEqual(0, g.parallelChunkSize())
+
+        g.setParallelChunkSize(2)
+
+        self.assertEqual(2, g.parallelChunkSize())
+
+    def test_minimum_instance_count(self):
+        from libcellml import Generator
+
+        g = Generator()
+
+        self.assertEqual(0, g.minimumInstanceCount())
+
+        g.setMinimumInstanceCount(3)
+
+        self.assertEqual(3, g.minimumInstanceCount())
+
+    def test_maximum_thread_count(self):
+        from libcellml import Generator
+
+        g = Generator()
+
+        self.assertEqual(0, g.maximumThreadCount())
+
+        g.setMaximumThreadCount(4)
+
+        self.assertEqual(4, g.maximumThreadCount())
+
+    def test_variable_ordering(self):
+        from libcellml import Parser
+        from libcellml import Generator
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        g = Generator()
+
+        g.processModel(m)
+
+        self.assertEqual(Generator.VariableOrdering.DEFAULT, g.variableOrdering())
+
+        self.assertRaises(RuntimeError, g.setVariableOrdering, Generator.VariableOrdering.DEFAULT - 1)
+        self.assertRaises(RuntimeError, g.setVariableOrdering, Generator.VariableOrdering.FIRST_USE_BY_COMPONENT + 1)
+
+        g.setVariableOrdering(Generator.VariableOrdering.FIRST_USE_BY_COMPONENT)
+
+        self.assertEqual(Generator.VariableOrdering.FIRST_USE_BY_COMPONENT, g.variableOrdering())
+        self.assertEqual(1, g.state(1).index())
+        self.assertEqual(3, g.state(1).defaultIndex())
+        self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.variable.ordering.py"), g.implementationCode())
+
+    def test_equations(self):
+        from libcellml import Parser
+        from libcellml import Generator
+        from libcellml import GeneratorAst
+        from libcellml import GeneratorEquation
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+        g = Generator()
+
+        g.processModel(m)
+
+        self.assertEqual(17, g.equationCount())
+        self.assertIsNone(g.equation(g.equationCount()))
+
+        rate_equations = [g.equation(i) for i in range(g.equationCount())
+                          if g.equation(i).type() == GeneratorEquation.Type.RATE]
+
+        self.assertEqual(g.stateCount(), len(rate_equations))
+
+        e = rate_equations[0]
+        a = e.ast()
+
+        self.assertTrue(e.isStateRateBased())
+        self.assertEqual(GeneratorAst.Type.ASSIGNMENT, a.type())
+        self.assertIsNone(a.parent())
+        self.assertEqual(GeneratorAst.Type.DIFF, a.leftChild().type())
+        self.assertEqual(e.variable().index(), a.leftChild().rightChild().variable().index())
+        self.assertIsNone(e.dependency(e.dependencyCount()))
+
+    def test_analysis_cache_size(self):
+        from libcellml import Parser
+        from libcellml import Generator
+
+        p = Parser()
+        g = Generator()
+
+        self.assertEqual(0, g.analysisCacheSize())
+
+        g.setAnalysisCacheSize(1)
+
+        self.assertEqual(1, g.analysisCacheSize())
+
+        for i in range(2):
+            m = p.parseModel(file_contents('generator/hodgkin_huxley_squid_axon_model_1952/model.cellml'))
+
+            g.processModel(m)
+
+            self.assertEqual(0, g.issueCount())
+            self.assertEqual(file_contents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), g.implementationCode())
+
+    @unittest.skipIf(importlib.util.find_spec('numpy') is None, 'NumPy is not installed')
+    def test_numpy_profile(self):
+        import numpy
+        from libcellml import Parser
+        from libcellml import Generator
+        from libcellml import GeneratorProfile
+
+        # Evaluate the code generated using the NumPy profile for several
+        # instances at once and check that each instance gives the same results
+        # as the code generated using the Python profile.
+
+        instance_count = 3
+
+        for model_name, voi in (('hodgkin_huxley_squid_axon_model_1952', 10.2), ('coverage', 1.5)):
+            p = Parser()
+            m = p.parseModel(file_contents('generator/' + model_name + '/model.cellml'))
+
+            g = Generator()
+
+            g.processModel(m)
+
+            scalar_model = {}
+            exec(g.implementationCode(), scalar_model)
+
+            g.setProfile(GeneratorProfile(GeneratorProfile.Profile.NUMPY))
+
+            numpy_model = {}
+            exec(g.implementationCode(), numpy_model)
+
+            states = numpy_model['create_states_array'](instance_count)
+            rates = numpy_model['create_states_array'](instance_count)
+            variables = numpy_model['create_variables_array'](instance_count)
+
+            numpy_model['initialize_states_and_constants'](states, variables)
+
+            for i in range(instance_count):
+                states[:, i] += 0.1 * i
+
+            with numpy.errstate(all='ignore'):
+                numpy_model['compute_computed_constants'](variables)
+                numpy_model['compute_rates'](voi, states, rates, variables)
+                numpy_model['compute_variables'](voi, states, rates, variables)
+
+            for i in range(instance_count):
+                scalar_states = scalar_model['create_states_array']()
+                scalar_rates = scalar_model['create_states_array']()
+                scalar_variables = scalar_model['create_variables_array']()
+
+                scalar_model['initialize_states_and_constants'](scalar_states, scalar_variables)
+
+                for j in range(len(scalar_states)):
+                    scalar_states[j] += 0.1 * i
+
+                scalar_model['compute_computed_constants'](scalar_variables)
+                scalar_model['compute_rates'](voi, scalar_states, scalar_rates, scalar_variables)
+                scalar_model['compute_variables'](voi, scalar_states, scalar_rates, scalar_variables)
+
+                numpy.testing.assert_allclose(rates[:, i], scalar_rates, rtol=1.0e-12, equal_nan=True)
+                numpy.testing.assert_allclose(variables[:, i], scalar_variables, rtol=1.0e-12, equal_nan=True)
+
 
 if __name__ == '__main__':
     unittest.main()
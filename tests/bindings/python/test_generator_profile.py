@@ -21,6 +21,23 @@ class GeneratorProfileTestCase(unittest.TestCase):
         p.setProfile(GeneratorProfile.Profile.PYTHON)
         self.assertEqual(GeneratorProfile.Profile.PYTHON, p.profile())
 
+        p.setProfile(GeneratorProfile.Profile.NUMPY)
+        self.assertEqual(GeneratorProfile.Profile.NUMPY, p.profile())
+
+    def test_precision(self):
+        from libcellml import GeneratorProfile
+
+        p = GeneratorProfile()
+        self.assertEqual(GeneratorProfile.Precision.DOUBLE, p.precision())
+
+        p.setPrecision(GeneratorProfile.Precision.SINGLE)
+        self.assertEqual(GeneratorProfile.Precision.SINGLE, p.precision())
+        self.assertEqual('expf', p.exponentialString())
+
+        p.setPrecision(GeneratorProfile.Precision.MIXED)
+        self.assertEqual(GeneratorProfile.Precision.MIXED, p.precision())
+        self.assertEqual('(double) ', p.computeCastString())
+
     def test_has_interface(self):
         from libcellml import GeneratorProfile
 
@@ -31,6 +48,51 @@ class GeneratorProfileTestCase(unittest.TestCase):
         p.setHasInterface(False)
         self.assertFalse(p.hasInterface())
 
+    def test_has_code_optimization(self):
+        from libcellml import GeneratorProfile
+
+        p = GeneratorProfile()
+
+        self.assertFalse(p.hasCodeOptimization())
+
+        p.setHasCodeOptimization(True)
+        self.assertTrue(p.hasCodeOptimization())
+
+    def test_has_jacobian(self):
+        from libcellml import GeneratorProfile
+
+        p = GeneratorProfile()
+
+        self.assertFalse(p.hasJacobian())
+        self.assertEqual('0', p.emptyJacobianColumnIndicesString())
+
+        p.setHasJacobian(True)
+        self.assertTrue(p.hasJacobian())
+
+        p.setEmptyJacobianColumnIndicesString('')
+        self.assertEqual('', p.emptyJacobianColumnIndicesString())
+
+    def test_has_rush_larsen(self):
+        from libcellml import GeneratorProfile
+
+        p = GeneratorProfile()
+
+        self.assertFalse(p.hasRushLarsen())
+
+        p.setHasRushLarsen(True)
+        self.assertTrue(p.hasRushLarsen())
+
+    def test_has_branchless_piecewise(self):
+        from libcellml import GeneratorProfile
+
+        p = GeneratorProfile()
+
+        self.assertFalse(p.hasBranchlessPiecewise())
+        self.assertEqual('blend(<CONDITION>, <IF_STATEMENT>', p.branchlessPiecewiseIfString())
+
+        p.setHasBranchlessPiecewise(True)
+        self.assertTrue(p.hasBranchlessPiecewise())
+
 
 if __name__ == '__main__':
     unittest.main()
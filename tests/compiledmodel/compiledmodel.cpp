@@ -0,0 +1,317 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+#include <libcellml>
+
+// Use the code generated for the Hodgkin-Huxley model, compiled as part of this
+// test, as a reference for the code compiled by CompiledModel.
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+namespace hh {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.c"
+} // namespace hh
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#endif
+
+class CompiledModelTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        char directory[] = "/tmp/libcellml_compiled_model.XXXXXX";
+
+        ASSERT_NE(nullptr, mkdtemp(directory));
+
+        mCacheDirectory = directory;
+
+        libcellml::ParserPtr parser = libcellml::Parser::create();
+
+        mModel = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+        mGenerator = libcellml::Generator::create();
+
+        mGenerator->processModel(mModel);
+    }
+
+    void TearDown() override
+    {
+        std::string command = "rm -rf '" + mCacheDirectory + "'";
+
+        EXPECT_EQ(0, std::system(command.c_str()));
+    }
+
+    libcellml::CompiledModelPtr compiledModel()
+    {
+        libcellml::CompiledModelPtr res = libcellml::CompiledModel::create();
+
+        res->setCacheDirectory(mCacheDirectory + "/cache");
+
+        return res;
+    }
+
+    std::string mCacheDirectory;
+    libcellml::ModelPtr mModel;
+    libcellml::GeneratorPtr mGenerator;
+};
+
+TEST_F(CompiledModelTest, defaults)
+{
+    libcellml::CompiledModelPtr compiledModel = libcellml::CompiledModel::create();
+
+    EXPECT_EQ("cc", compiledModel->compiler());
+    EXPECT_EQ("-O2", compiledModel->compilerFlags());
+    EXPECT_NE("", compiledModel->cacheDirectory());
+    EXPECT_FALSE(compiledModel->isCompiled());
+    EXPECT_FALSE(compiledModel->isFromCache());
+    EXPECT_EQ("", compiledModel->cacheKey());
+    EXPECT_EQ(size_t(0), compiledModel->stateCount());
+    EXPECT_EQ(size_t(0), compiledModel->variableCount());
+    EXPECT_EQ(nullptr, compiledModel->initializeStatesAndConstants());
+    EXPECT_EQ(nullptr, compiledModel->computeComputedConstants());
+    EXPECT_EQ(nullptr, compiledModel->computeRates());
+    EXPECT_EQ(nullptr, compiledModel->computeVariables());
+}
+
+static void checkHodgkinHuxleySquidAxonModel1952(const libcellml::CompiledModelPtr &compiledModel)
+{
+    EXPECT_EQ(hh::STATE_COUNT, compiledModel->stateCount());
+    EXPECT_EQ(hh::VARIABLE_COUNT, compiledModel->variableCount());
+
+    std::vector<double> states(hh::STATE_COUNT);
+    std::vector<double> rates(hh::STATE_COUNT);
+    std::vector<double> variables(hh::VARIABLE_COUNT);
+    std::vector<double> expectedStates(hh::STATE_COUNT);
+    std::vector<double> expectedRates(hh::STATE_COUNT);
+    std::vector<double> expectedVariables(hh::VARIABLE_COUNT);
+
+    compiledModel->initializeStatesAndConstants()(states.data(), variables.data());
+    compiledModel->computeComputedConstants()(variables.data());
+    compiledModel->computeRates()(10.25, states.data(), rates.data(), variables.data());
+    compiledModel->computeVariables()(10.25, states.data(), rates.data(), variables.data());
+
+    hh::initializeStatesAndConstants(expectedStates.data(), expectedVariables.data());
+    hh::computeComputedConstants(expectedVariables.data());
+    hh::computeRates(10.25, expectedStates.data(), expectedRates.data(), expectedVariables.data());
+    hh::computeVariables(10.25, expectedStates.data(), expectedRates.data(), expectedVariables.data());
+
+    for (size_t i = 0; i < hh::STATE_COUNT; ++i) {
+        EXPECT_DOUBLE_EQ(expectedStates[i], states[i]);
+        EXPECT_DOUBLE_EQ(expectedRates[i], rates[i]);
+    }
+
+    for (size_t i = 0; i < hh::VARIABLE_COUNT; ++i) {
+        EXPECT_DOUBLE_EQ(expectedVariables[i], variables[i]);
+    }
+}
+
+TEST_F(CompiledModelTest, hodgkinHuxleySquidAxonModel1952)
+{
+    libcellml::CompiledModelPtr compiledModel = this->compiledModel();
+
+    EXPECT_TRUE(compiledModel->compile(mGenerator));
+    EXPECT_EQ(size_t(0), compiledModel->issueCount());
+    EXPECT_TRUE(compiledModel->isCompiled());
+    EXPECT_FALSE(compiledModel->isFromCache());
+    EXPECT_EQ(size_t(40), compiledModel->cacheKey().size());
+
+    checkHodgkinHuxleySquidAxonModel1952(compiledModel);
+}
+
+TEST_F(CompiledModelTest, hodgkinHuxleySquidAxonModel1952WithMaximumStatementCount)
+{
+    // Splitting the compute methods into chunks doesn't change their results.
+
+    libcellml::CompiledModelPtr compiledModel = this->compiledModel();
+
+    mGenerator->setMaximumStatementCount(2);
+
+    EXPECT_TRUE(compiledModel->compile(mGenerator));
+    EXPECT_EQ(size_t(0), compiledModel->issueCount());
+
+    checkHodgkinHuxleySquidAxonModel1952(compiledModel);
+}
+
+TEST_F(CompiledModelTest, hodgkinHuxleySquidAxonModel1952WithParallelChunkSize)
+{
+    // Computing the rates and variables level by level doesn't change their
+    // results.
+
+    libcellml::CompiledModelPtr compiledModel = this->compiledModel();
+
+    mGenerator->setParallelChunkSize(2);
+
+    EXPECT_TRUE(compiledModel->compile(mGenerator));
+    EXPECT_EQ(size_t(0), compiledModel->issueCount());
+
+    checkHodgkinHuxleySquidAxonModel1952(compiledModel);
+}
+
+TEST_F(CompiledModelTest, hodgkinHuxleySquidAxonModel1952WithVariableOrdering)
+{
+    // Reordering the states and variables doesn't change their values, which
+    // we can retrieve using their default index.
+
+    libcellml::CompiledModelPtr compiledModel = this->compiledModel();
+
+    mGenerator->setVariableOrdering(libcellml::Generator::VariableOrdering::FIRST_USE_BY_COMPONENT);
+
+    EXPECT_TRUE(compiledModel->compile(mGenerator));
+    EXPECT_EQ(size_t(0), compiledModel->issueCount());
+
+    std::vector<double> states(hh::STATE_COUNT);
+    std::vector<double> rates(hh::STATE_COUNT);
+    std::vector<double> variables(hh::VARIABLE_COUNT);
+    std::vector<double> expectedStates(hh::STATE_COUNT);
+    std::vector<double> expectedRates(hh::STATE_COUNT);
+    std::vector<double> expectedVariables(hh::VARIABLE_COUNT);
+
+    compiledModel->initializeStatesAndConstants()(states.data(), variables.data());
+    compiledModel->computeComputedConstants()(variables.data());
+    compiledModel->computeRates()(10.25, states.data(), rates.data(), variables.data());
+    compiledModel->computeVariables()(10.25, states.data(), rates.data(), variables.data());
+
+    hh::initializeStatesAndConstants(expectedStates.data(), expectedVariables.data());
+    hh::computeComputedConstants(expectedVariables.data());
+    hh::computeRates(10.25, expectedStates.data(), expectedRates.data(), expectedVariables.data());
+    hh::computeVariables(10.25, expectedStates.data(), expectedRates.data(), expectedVariables.data());
+
+    for (size_t i = 0; i < hh::STATE_COUNT; ++i) {
+        auto state = mGenerator->state(i);
+
+        EXPECT_DOUBLE_EQ(expectedStates[state->defaultIndex()], states[state->index()]);
+        EXPECT_DOUBLE_EQ(expectedRates[state->defaultIndex()], rates[state->index()]);
+    }
+
+    for (size_t i = 0; i < hh::VARIABLE_COUNT; ++i) {
+        auto variable = mGenerator->variable(i);
+
+        EXPECT_DOUBLE_EQ(expectedVariables[variable->defaultIndex()], variables[variable->index()]);
+    }
+}
+
+TEST_F(CompiledModelTest, cache)
+{
+    libcellml::CompiledModelPtr compiledModel = this->compiledModel();
+
+    EXPECT_TRUE(compiledModel->compile(mGenerator));
+    EXPECT_FALSE(compiledModel->isFromCache());
+
+    std::string cacheKey = compiledModel->cacheKey();
+
+    // Compiling the same code again, be it with the same or another compiled
+    // model, only requires loading it from the cache.
+
+    EXPECT_TRUE(compiledModel->compile(mGenerator));
+    EXPECT_TRUE(compiledModel->isFromCache());
+    EXPECT_EQ(cacheKey, compiledModel->cacheKey());
+
+    libcellml::CompiledModelPtr otherCompiledModel = this->compiledModel();
+
+    EXPECT_TRUE(otherCompiledModel->compile(mGenerator));
+    EXPECT_TRUE(otherCompiledModel->isFromCache());
+    EXPECT_EQ(cacheKey, otherCompiledModel->cacheKey());
+    EXPECT_NE(nullptr, otherCompiledModel->computeRates());
+
+    // Different compiler flags or different code mean a different cache key.
+
+    otherCompiledModel->setCompilerFlags("-O0");
+
+    EXPECT_TRUE(otherCompiledModel->compile(mGenerator));
+    EXPECT_FALSE(otherCompiledModel->isFromCache());
+    EXPECT_NE(cacheKey, otherCompiledModel->cacheKey());
+
+    mGenerator->profile()->setHasCodeOptimization(true);
+
+    EXPECT_TRUE(compiledModel->compile(mGenerator));
+    EXPECT_FALSE(compiledModel->isFromCache());
+    EXPECT_NE(cacheKey, compiledModel->cacheKey());
+}
+
+TEST_F(CompiledModelTest, invalidCompiler)
+{
+    libcellml::CompiledModelPtr compiledModel = this->compiledModel();
+
+    compiledModel->setCompiler("this_is_not_a_compiler");
+
+    EXPECT_FALSE(compiledModel->compile(mGenerator));
+    EXPECT_EQ(size_t(1), compiledModel->issueCount());
+    EXPECT_EQ(0u, compiledModel->issue(0)->description().find("The generated code could not be compiled using 'this_is_not_a_compiler -O2':"));
+    EXPECT_FALSE(compiledModel->isCompiled());
+    EXPECT_EQ("", compiledModel->cacheKey());
+    EXPECT_EQ(nullptr, compiledModel->computeRates());
+}
+
+TEST_F(CompiledModelTest, invalidGenerator)
+{
+    libcellml::CompiledModelPtr compiledModel = this->compiledModel();
+
+    EXPECT_FALSE(compiledModel->compile(nullptr));
+    EXPECT_EQ(size_t(1), compiledModel->issueCount());
+    EXPECT_EQ("Only code generated using a C profile can be compiled.", compiledModel->issue(0)->description());
+
+    mGenerator->setProfile(libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON));
+
+    EXPECT_FALSE(compiledModel->compile(mGenerator));
+    EXPECT_EQ(size_t(1), compiledModel->issueCount());
+    EXPECT_EQ("Only code generated using a C profile can be compiled.", compiledModel->issue(0)->description());
+
+    EXPECT_FALSE(compiledModel->compile(libcellml::Generator::create()));
+    EXPECT_EQ(size_t(1), compiledModel->issueCount());
+    EXPECT_EQ("The generator has no code to compile.", compiledModel->issue(0)->description());
+}
+
+TEST_F(CompiledModelTest, nonDoublePrecision)
+{
+    // Our functions work with doubles, so code generated using single or mixed
+    // precision cannot be compiled.
+
+    libcellml::CompiledModelPtr compiledModel = this->compiledModel();
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create();
+
+    mGenerator->setProfile(profile);
+
+    for (auto precision : {libcellml::GeneratorProfile::Precision::SINGLE,
+                           libcellml::GeneratorProfile::Precision::MIXED}) {
+        profile->setPrecision(precision);
+
+        EXPECT_FALSE(compiledModel->compile(mGenerator));
+        EXPECT_EQ(size_t(1), compiledModel->issueCount());
+        EXPECT_EQ("Only code generated using a double-precision C profile can be compiled.", compiledModel->issue(0)->description());
+        EXPECT_FALSE(compiledModel->isCompiled());
+        EXPECT_EQ(nullptr, compiledModel->initializeStatesAndConstants());
+    }
+
+    profile->setPrecision(libcellml::GeneratorProfile::Precision::DOUBLE);
+
+    EXPECT_TRUE(compiledModel->compile(mGenerator));
+    EXPECT_EQ(size_t(0), compiledModel->issueCount());
+}
@@ -0,0 +1,9 @@
+# CompiledModel relies on dlopen() and on a C compiler being available.
+if(UNIX)
+  set(CURRENT_TEST compiledmodel)
+  set(${CURRENT_TEST}_CATEGORY io)
+  list(APPEND LIBCELLML_TESTS ${CURRENT_TEST})
+  set(${CURRENT_TEST}_SRCS
+    ${CMAKE_CURRENT_LIST_DIR}/compiledmodel.cpp
+  )
+endif()
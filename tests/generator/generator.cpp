@@ -18,6 +18,9 @@ limitations under the License.
 
 #include "gtest/gtest.h"
 
+#include <map>
+#include <sstream>
+
 #include <libcellml>
 
 static const std::string EMPTY_STRING;
@@ -414,6 +417,64 @@ TEST(Generator, algebraicEqnConstVarOnRhs)
     EXPECT_EQ(fileContents("generator/algebraic_eqn_const_var_on_rhs/model.py"), generator->implementationCode());
 }
 
+TEST(Generator, unaryMinusAsRightOperandOfMinus)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/unary_minus_as_right_operand_of_minus/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ALGEBRAIC, generator->modelType());
+
+    // The right operand of our minus operator starts with a unary minus, so it
+    // must be parenthesised, or we would otherwise generate "a--b*c".
+
+    EXPECT_EQ(fileContents("generator/unary_minus_as_right_operand_of_minus/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/unary_minus_as_right_operand_of_minus/model.c"), generator->implementationCode());
+
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/unary_minus_as_right_operand_of_minus/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, unaryMinusOfProductAsDivisor)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/unary_minus_of_product_as_divisor/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ALGEBRAIC, generator->modelType());
+
+    // Our divisor is a negated product, so it must be parenthesised, or we
+    // would otherwise generate "a/-b*c", i.e. (a/-b)*c.
+
+    EXPECT_EQ(fileContents("generator/unary_minus_of_product_as_divisor/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/unary_minus_of_product_as_divisor/model.c"), generator->implementationCode());
+
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/unary_minus_of_product_as_divisor/model.py"), generator->implementationCode());
+}
+
 TEST(Generator, algebraicEqnConstantOnRhs)
 {
     libcellml::ParserPtr parser = libcellml::Parser::create();
@@ -1041,6 +1102,101 @@ TEST(Generator, garnyKohlHunterBoyettNobleRabbitSanModel2003)
     EXPECT_EQ(fileContents("generator/garny_kohl_hunter_boyett_noble_rabbit_san_model_2003/model.py"), generator->implementationCode());
 }
 
+TEST(Generator, integrateAndFire)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/integrate_and_fire/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    // Incomplete resets get ignored.
+
+    libcellml::ComponentPtr component = model->component("membrane");
+    libcellml::ResetPtr reset = libcellml::Reset::create(3);
+
+    reset->setVariable(component->variable("V"));
+
+    component->addReset(reset);
+
+    reset = libcellml::Reset::create(4);
+
+    reset->setVariable(component->variable("V"));
+    reset->setTestVariable(component->variable("t"));
+
+    component->addReset(reset);
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+
+    EXPECT_EQ(size_t(2), generator->stateCount());
+    EXPECT_EQ(size_t(5), generator->variableCount());
+
+    EXPECT_EQ(fileContents("generator/integrate_and_fire/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/integrate_and_fire/model.c"), generator->implementationCode());
+
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/integrate_and_fire/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, integrateAndFireWithAlgebraicResets)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/integrate_and_fire_with_algebraic_resets/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+
+    EXPECT_EQ(fileContents("generator/integrate_and_fire_with_algebraic_resets/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/integrate_and_fire_with_algebraic_resets/model.c"), generator->implementationCode());
+
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/integrate_and_fire_with_algebraic_resets/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, integrateAndFireWithNonStateResets)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/integrate_and_fire_with_non_state_resets/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    const std::vector<std::string> expectedIssues = {
+        "Variable 'V_distance' in component 'membrane' of model 'integrate_and_fire_with_non_state_resets' is reset, but it is not a state.",
+        "Variable 'V_reset' in component 'membrane' of model 'integrate_and_fire_with_non_state_resets' is reset, but it is not a state.",
+    };
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ_ISSUES(expectedIssues, generator);
+
+    EXPECT_EQ(libcellml::Generator::ModelType::INVALID, generator->modelType());
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(EMPTY_STRING, generator->implementationCode());
+}
+
 TEST(Generator, hodgkinHuxleySquidAxonModel1952)
 {
     libcellml::ParserPtr parser = libcellml::Parser::create();
@@ -1101,10 +1257,10 @@ TEST(Generator, hodgkinHuxleySquidAxonModel1952)
     EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
 }
 
-TEST(Generator, nobleModel1962)
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithRequiredOutputs)
 {
     libcellml::ParserPtr parser = libcellml::Parser::create();
-    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/noble_model_1962/model.cellml"));
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
 
     EXPECT_EQ(size_t(0), parser->issueCount());
 
@@ -1114,162 +1270,1593 @@ TEST(Generator, nobleModel1962)
 
     EXPECT_EQ(size_t(0), generator->issueCount());
 
-    EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+    libcellml::VariablePtr iNa = model->component("membrane")->variable("i_Na");
+    libcellml::VariablePtr iK = model->component("potassium_channel", true)->variable("i_K");
 
-    EXPECT_EQ(size_t(4), generator->stateCount());
-    EXPECT_EQ(size_t(17), generator->variableCount());
+    EXPECT_EQ(size_t(0), generator->requiredOutputCount());
 
-    EXPECT_NE(nullptr, generator->voi());
-    EXPECT_NE(nullptr, generator->state(0));
-    EXPECT_EQ(nullptr, generator->state(generator->stateCount()));
-    EXPECT_NE(nullptr, generator->variable(0));
-    EXPECT_EQ(nullptr, generator->variable(generator->variableCount()));
+    generator->addRequiredOutput(iNa);
+    generator->addRequiredOutput(iK);
 
-    EXPECT_EQ(fileContents("generator/noble_model_1962/model.h"), generator->interfaceCode());
-    EXPECT_EQ(fileContents("generator/noble_model_1962/model.c"), generator->implementationCode());
+    EXPECT_EQ(size_t(2), generator->requiredOutputCount());
+    EXPECT_EQ(iNa, generator->requiredOutput(0));
+    EXPECT_EQ(iK, generator->requiredOutput(1));
+    EXPECT_EQ(nullptr, generator->requiredOutput(2));
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.required.outputs.c"), generator->implementationCode());
 
     libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
 
     generator->setProfile(profile);
 
-    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
-    EXPECT_EQ(fileContents("generator/noble_model_1962/model.py"), generator->implementationCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.required.outputs.py"), generator->implementationCode());
+
+    generator->removeAllRequiredOutputs();
+
+    EXPECT_EQ(size_t(0), generator->requiredOutputCount());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
 }
 
-TEST(Generator, coverage)
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithInvalidRequiredOutputs)
 {
     libcellml::ParserPtr parser = libcellml::Parser::create();
-    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/coverage/model.cellml"));
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
 
     EXPECT_EQ(size_t(0), parser->issueCount());
 
+    libcellml::VariablePtr membranePotential = model->component("membrane")->variable("V");
+    libcellml::VariablePtr capacitance = model->component("membrane")->variable("Cm");
+    libcellml::VariablePtr iNa = model->component("membrane")->variable("i_Na");
+    libcellml::VariablePtr unrelatedVariable = libcellml::Variable::create("unrelated");
+
+    const std::vector<std::string> expectedIssues = {
+        "Required output 'V' in component 'membrane' of model 'hodgkin_huxley_squid_axon_model_1952' is a state and is therefore not computed by the method to compute the variables.",
+    };
+    const std::vector<std::string> expectedIssuesAfterProcessing = {
+        "Required output 'V' in component 'membrane' of model 'hodgkin_huxley_squid_axon_model_1952' is a state and is therefore not computed by the method to compute the variables.",
+        "Required output 'Cm' in component 'membrane' of model 'hodgkin_huxley_squid_axon_model_1952' is a constant and is therefore not computed by the method to compute the variables.",
+        "Required output 'unrelated' is not in the model and is therefore not computed by the method to compute the variables.",
+    };
+
     libcellml::GeneratorPtr generator = libcellml::Generator::create();
 
+    // Required outputs added before processing the model get checked when the
+    // model gets processed.
+
+    generator->addRequiredOutput(membranePotential);
+    generator->addRequiredOutput(membranePotential);
+    generator->addRequiredOutput(iNa);
+
+    EXPECT_EQ(size_t(2), generator->requiredOutputCount());
+
     generator->processModel(model);
 
-    EXPECT_EQ(size_t(0), generator->issueCount());
+    EXPECT_EQ_ISSUES(expectedIssues, generator);
 
-    EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+    // Required outputs added after processing the model get checked straight
+    // away.
 
-    EXPECT_EQ(size_t(1), generator->stateCount());
-    EXPECT_EQ(size_t(186), generator->variableCount());
+    generator->addRequiredOutput(capacitance);
+    generator->addRequiredOutput(unrelatedVariable);
+    generator->addRequiredOutput(nullptr);
 
-    EXPECT_NE(nullptr, generator->voi());
-    EXPECT_NE(nullptr, generator->state(0));
-    EXPECT_EQ(nullptr, generator->state(generator->stateCount()));
-    EXPECT_NE(nullptr, generator->variable(0));
-    EXPECT_EQ(nullptr, generator->variable(generator->variableCount()));
+    EXPECT_EQ(size_t(4), generator->requiredOutputCount());
+    EXPECT_EQ_ISSUES(expectedIssuesAfterProcessing, generator);
+}
 
-    EXPECT_EQ(fileContents("generator/coverage/model.h"), generator->interfaceCode());
-    EXPECT_EQ(fileContents("generator/coverage/model.c"), generator->implementationCode());
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithRushLarsen)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
 
     libcellml::GeneratorProfilePtr profile = generator->profile();
 
-    profile->setInterfaceCreateStatesArrayMethodString("double * createStatesVector();\n");
-    profile->setImplementationCreateStatesArrayMethodString("double * createStatesVector()\n"
-                                                            "{\n"
-                                                            "    return (double *) malloc(STATE_COUNT*sizeof(double));\n"
-                                                            "}\n");
+    profile->setHasRushLarsen(true);
 
-    EXPECT_EQ(fileContents("generator/coverage/model.modified.profile.h"), generator->interfaceCode());
-    EXPECT_EQ(fileContents("generator/coverage/model.modified.profile.c"), generator->implementationCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.rush.larsen.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.rush.larsen.c"), generator->implementationCode());
 
-    profile = libcellml::GeneratorProfile::create();
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
 
     generator->setProfile(profile);
 
-    profile->setHasInterface(false);
+    profile->setHasRushLarsen(true);
 
-    profile->setXorString("^");
-    profile->setHasXorOperator(true);
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.rush.larsen.py"), generator->implementationCode());
+}
 
-    profile->setPowerString("^^");
-    profile->setSquareString("sqr");
-    profile->setHasPowerOperator(true);
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithBranchlessPiecewise)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
 
-    profile->setPiecewiseIfString("piecewise(<CONDITION>, <IF_STATEMENT>");
-    profile->setPiecewiseElseString(", <ELSE_STATEMENT>)");
-    profile->setHasConditionalOperator(false);
+    EXPECT_EQ(size_t(0), parser->issueCount());
 
-    profile->setInterfaceFileNameString("customheaderfile.h");
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
 
-    profile->setImplementationHeaderString("#include \"<INTERFACE_FILE_NAME>\"\n");
+    generator->processModel(model);
 
-    profile->setImplementationVersionString("");
+    EXPECT_EQ(size_t(0), generator->issueCount());
 
-    profile->setImplementationLibcellmlVersionString("");
+    libcellml::GeneratorProfilePtr profile = generator->profile();
 
-    profile->setImplementationStateCountString("");
+    profile->setHasBranchlessPiecewise(true);
+    profile->setInterfaceFileNameString("model.branchless.h");
 
-    profile->setImplementationVariableCountString("");
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.branchless.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.branchless.c"), generator->implementationCode());
 
-    profile->setVariableTypeObjectString("");
+    // The code to retrieve a value from a lookup table still branches.
 
-    profile->setConstantVariableTypeString("");
-    profile->setComputedConstantVariableTypeString("");
-    profile->setAlgebraicVariableTypeString("");
+    generator->setLookupTable(nullptr, -150.005, 50.005, 0.01);
 
-    profile->setVariableInfoObjectString("");
-    profile->setVariableInfoWithTypeObjectString("");
+    auto implementationCode = generator->implementationCode();
 
-    profile->setImplementationVoiInfoString("");
+    EXPECT_NE(std::string::npos, implementationCode.find("    variables[5] = blend((voi >= 10.0) && (voi <= 10.5), -20.0, 0.0);\n"));
+    EXPECT_NE(std::string::npos, implementationCode.find("    variables[10] = ((states[3] >= -150.005) && (states[3] < 50.004999999999995))?lookupTableValue(0, states[3]):"));
 
-    profile->setImplementationStateInfoString("");
+    generator->removeLookupTable();
 
-    profile->setImplementationVariableInfoString("");
+    // Without a string for the if part of a branchless piecewise statement,
+    // our piecewise statements branch.
 
-    profile->setVariableInfoEntryString("");
-    profile->setVariableInfoWithTypeEntryString("");
+    profile->setBranchlessPiecewiseIfString("");
 
-    profile->setImplementationCreateStatesArrayMethodString("");
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("blend"));
 
-    profile->setImplementationCreateVariablesArrayMethodString("");
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
 
-    profile->setImplementationDeleteArrayMethodString("");
+    generator->setProfile(profile);
 
-    profile->setImplementationComputeVariablesMethodString("// We should have computeVariables() here, but we replaced it with this comment\n"
-                                                           "// and no code template that can be replaced so that our replace() method can\n"
-                                                           "// is forced to return an empty string, ensuring 100% coverage using llvm-cov...\n");
+    profile->setHasBranchlessPiecewise(true);
+
+    // The Python profile has no branchless piecewise statements.
 
     EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
-    EXPECT_EQ(fileContents("generator/coverage/model.out"), generator->implementationCode());
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("    variables[5] = -20.0 if and_func(geq_func(voi, 10.0), leq_func(voi, 10.5)) else 0.0\n"));
+}
 
-    profile = libcellml::GeneratorProfile::create();
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithLookupTable)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
 
-    generator->setProfile(profile);
+    EXPECT_EQ(size_t(0), parser->issueCount());
 
-    profile->setHasInterface(true);
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
 
-    profile->setEqString("eq");
-    profile->setNeqString("neq");
-    profile->setLtString("lt");
-    profile->setLeqString("leq");
-    profile->setGtString("gt");
-    profile->setGeqString("geq");
-    profile->setAndString("and");
-    profile->setOrString("or");
-    profile->setNotString("not");
+    generator->processModel(model);
 
-    profile->setHasEqOperator(false);
-    profile->setHasNeqOperator(false);
-    profile->setHasLtOperator(false);
-    profile->setHasLeqOperator(false);
-    profile->setHasGtOperator(false);
-    profile->setHasGeqOperator(false);
-    profile->setHasAndOperator(false);
-    profile->setHasOrOperator(false);
-    profile->setHasNotOperator(false);
+    EXPECT_EQ(size_t(0), generator->issueCount());
 
-    profile->setImplementationHeaderString("");
+    libcellml::VariablePtr membranePotential = model->component("membrane", true)->variable("V");
 
-    profile->setInterfaceVersionString("");
-    profile->setImplementationVersionString("");
+    EXPECT_FALSE(generator->hasLookupTable());
 
-    profile->setInterfaceLibcellmlVersionString("");
-    profile->setImplementationLibcellmlVersionString("");
+    generator->setLookupTable(membranePotential, -150.005, 50.005, 0.01);
 
-    profile->setInterfaceStateCountString("");
-    profile->setImplementationStateCountString("");
+    EXPECT_TRUE(generator->hasLookupTable());
+    EXPECT_EQ(membranePotential, generator->lookupTableVariable());
+    EXPECT_EQ(-150.005, generator->lookupTableMinimum());
+    EXPECT_EQ(50.005, generator->lookupTableMaximum());
+    EXPECT_EQ(0.01, generator->lookupTableStep());
+
+    libcellml::GeneratorProfilePtr profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.lookup.table.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.lookup.table.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.lookup.table.c"), generator->implementationCode());
+
+    // Automatically detecting the state to use gives the same code.
+
+    generator->setLookupTable(nullptr, -150.005, 50.005, 0.01);
+
+    EXPECT_EQ(nullptr, generator->lookupTableVariable());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.lookup.table.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.lookup.table.py"), generator->implementationCode());
+
+    // An invalid range or step means no lookup table.
+
+    generator->setLookupTable(membranePotential, 50.0, -150.0, 0.01);
+
+    EXPECT_FALSE(generator->hasLookupTable());
+    EXPECT_EQ(nullptr, generator->lookupTableVariable());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+
+    generator->setLookupTable(membranePotential, -150.0, 50.0, 0.0);
+
+    EXPECT_FALSE(generator->hasLookupTable());
+
+    generator->setLookupTable(membranePotential, -150.0, 50.0, 0.01);
+    generator->removeLookupTable();
+
+    EXPECT_FALSE(generator->hasLookupTable());
+    EXPECT_EQ(nullptr, generator->lookupTableVariable());
+    EXPECT_EQ(0.0, generator->lookupTableMinimum());
+    EXPECT_EQ(0.0, generator->lookupTableMaximum());
+    EXPECT_EQ(0.0, generator->lookupTableStep());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, lookupTableWithConstants)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/lookup_table_with_constants/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    // Our lookup table is shared by all the callers of the generated code, so
+    // only exp(c*x) and exp(d*x) get tabulated since c and d are true
+    // constants while k, in exp(x/k), can be set by a caller. Our lookup table
+    // is also computed only once, so it uses the definition of c and d rather
+    // than their value in the variables array.
+
+    generator->setLookupTable(model->component("my_component")->variable("x"), -1.0, 1.0, 0.5);
+
+    EXPECT_EQ(fileContents("generator/lookup_table_with_constants/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/lookup_table_with_constants/model.c"), generator->implementationCode());
+
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/lookup_table_with_constants/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithMaximumStatementCount)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(size_t(0), generator->maximumStatementCount());
+
+    generator->setMaximumStatementCount(2);
+
+    EXPECT_EQ(size_t(2), generator->maximumStatementCount());
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.split.c"), generator->implementationCode());
+
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.split.py"), generator->implementationCode());
+
+    // A maximum number of statements that is large enough, or no chunk strings,
+    // means no splitting.
+
+    generator->setMaximumStatementCount(1000);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+
+    generator->setMaximumStatementCount(2);
+
+    profile->setImplementationComputeComputedConstantsMethodChunkString("");
+    profile->setImplementationComputeRatesMethodChunkString("");
+    profile->setComputeVariablesMethodChunkCallString("");
+
+    std::string implementationCode = generator->implementationCode();
+
+    EXPECT_EQ(std::string::npos, implementationCode.find("chunk"));
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithParallelChunkSize)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(size_t(0), generator->parallelChunkSize());
+
+    generator->setParallelChunkSize(2);
+
+    EXPECT_EQ(size_t(2), generator->parallelChunkSize());
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.parallel.c"), generator->implementationCode());
+
+    // The Python profile has no parallel strings, so sequential code is
+    // generated.
+
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+
+    // No parallel task string means no parallel code either.
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::C);
+
+    profile->setParallelTaskString("");
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("#pragma"));
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithVariableOrdering)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(libcellml::Generator::VariableOrdering::DEFAULT, generator->variableOrdering());
+
+    generator->setVariableOrdering(libcellml::Generator::VariableOrdering::FIRST_USE_BY_COMPONENT);
+
+    EXPECT_EQ(libcellml::Generator::VariableOrdering::FIRST_USE_BY_COMPONENT, generator->variableOrdering());
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.variable.ordering.c"), generator->implementationCode());
+
+    // The sodium channel m gate is used first, so its states and variables come
+    // first, followed by the ones of the membrane, which is used next.
+
+    EXPECT_EQ("m", generator->state(0)->variable()->name());
+    EXPECT_EQ(size_t(0), generator->state(0)->index());
+    EXPECT_EQ(size_t(0), generator->state(0)->defaultIndex());
+    EXPECT_EQ("V", generator->state(1)->variable()->name());
+    EXPECT_EQ(size_t(1), generator->state(1)->index());
+    EXPECT_EQ(size_t(3), generator->state(1)->defaultIndex());
+    EXPECT_EQ("alpha_m", generator->variable(0)->variable()->name());
+    EXPECT_EQ(size_t(0), generator->variable(0)->index());
+    EXPECT_EQ(size_t(10), generator->variable(0)->defaultIndex());
+
+    for (size_t i = 0; i < generator->stateCount(); ++i) {
+        EXPECT_EQ(i, generator->state(i)->index());
+    }
+
+    for (size_t i = 0; i < generator->variableCount(); ++i) {
+        EXPECT_EQ(i, generator->variable(i)->index());
+    }
+
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.variable.ordering.py"), generator->implementationCode());
+
+    // Reverting to the default ordering gives the default code back.
+
+    generator->setVariableOrdering(libcellml::Generator::VariableOrdering::DEFAULT);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+
+    for (size_t i = 0; i < generator->variableCount(); ++i) {
+        EXPECT_EQ(generator->variable(i)->defaultIndex(), generator->variable(i)->index());
+    }
+
+    // The ordering can also be set before processing a model, in which case
+    // the membrane potential, which is used first, comes first.
+
+    generator = libcellml::Generator::create();
+
+    generator->setVariableOrdering(libcellml::Generator::VariableOrdering::FIRST_USE);
+    generator->processModel(model);
+
+    EXPECT_EQ("V", generator->state(0)->variable()->name());
+    EXPECT_EQ("alpha_m", generator->variable(0)->variable()->name());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithSensitivityParameters)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    libcellml::VariablePtr gNa = model->component("sodium_channel", true)->variable("g_Na");
+    libcellml::VariablePtr membranePotential = model->component("membrane")->variable("V");
+    libcellml::VariablePtr restingPotential = model->component("membrane")->variable("E_R");
+
+    EXPECT_EQ(size_t(0), generator->sensitivityParameterCount());
+
+    // The membrane potential is a state, not a constant, so it gets ignored
+    // when generating the code while the resting potential is used to compute
+    // some computed constants, so its sensitivities go through them.
+
+    generator->addSensitivityParameter(gNa);
+    generator->addSensitivityParameter(membranePotential);
+    generator->addSensitivityParameter(restingPotential);
+    generator->addSensitivityParameter(nullptr);
+
+    EXPECT_EQ(size_t(3), generator->sensitivityParameterCount());
+    EXPECT_EQ(gNa, generator->sensitivityParameter(0));
+    EXPECT_EQ(membranePotential, generator->sensitivityParameter(1));
+    EXPECT_EQ(restingPotential, generator->sensitivityParameter(2));
+    EXPECT_EQ(nullptr, generator->sensitivityParameter(3));
+
+    libcellml::GeneratorProfilePtr profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.sensitivities.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.sensitivities.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.sensitivities.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.sensitivities.py"), generator->implementationCode());
+
+    generator->removeAllSensitivityParameters();
+
+    EXPECT_EQ(size_t(0), generator->sensitivityParameterCount());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithSweepParameters)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    libcellml::VariablePtr gNa = model->component("sodium_channel", true)->variable("g_Na");
+    libcellml::VariablePtr membranePotential = model->component("membrane")->variable("V");
+    libcellml::VariablePtr restingPotential = model->component("membrane")->variable("E_R");
+
+    EXPECT_EQ(size_t(0), generator->sweepParameterCount());
+
+    // The membrane potential is a state, not a constant, so it gets ignored
+    // when generating the code while the resting potential is used to compute
+    // some computed constants, which are therefore computed for each instance.
+
+    generator->addSweepParameter(gNa);
+    generator->addSweepParameter(membranePotential);
+    generator->addSweepParameter(restingPotential);
+    generator->addSweepParameter(nullptr);
+
+    EXPECT_EQ(size_t(3), generator->sweepParameterCount());
+    EXPECT_EQ(gNa, generator->sweepParameter(0));
+    EXPECT_EQ(membranePotential, generator->sweepParameter(1));
+    EXPECT_EQ(restingPotential, generator->sweepParameter(2));
+    EXPECT_EQ(nullptr, generator->sweepParameter(3));
+
+    libcellml::GeneratorProfilePtr profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.sweep.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.sweep.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.sweep.c"), generator->implementationCode());
+
+    // The Python profile has no batch methods.
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+
+    generator->removeAllSweepParameters();
+
+    EXPECT_EQ(size_t(0), generator->sweepParameterCount());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithSpecializedMethods)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+    EXPECT_FALSE(generator->hasSpecializedMethods());
+
+    generator->setHasSpecializedMethods(true);
+
+    EXPECT_TRUE(generator->hasSpecializedMethods());
+
+    libcellml::GeneratorProfilePtr profile = generator->profile();
+
+    profile->setInterfaceFileNameString("model.specialized.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.specialized.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.specialized.c"), generator->implementationCode());
+
+    // The values of the constants are those at the time the code is generated.
+
+    libcellml::VariablePtr gNa = model->component("sodium_channel", true)->variable("g_Na");
+
+    gNa->setInitialValue(60.0);
+
+    auto implementationCode = generator->implementationCode();
+
+    EXPECT_NE(std::string::npos, implementationCode.find("    variables[9] = 60.0*states[0]*states[0]*states[0]*states[1]*(states[3]+115.0);\n"));
+
+    gNa->setInitialValue(120.0);
+
+    // The Python profile has no specialised methods.
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+
+    generator->setHasSpecializedMethods(false);
+
+    EXPECT_FALSE(generator->hasSpecializedMethods());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithSinglePrecision)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    libcellml::GeneratorProfilePtr profile = generator->profile();
+
+    profile->setPrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.single.h"), generator->interfaceCode());
+
+    profile->setInterfaceFileNameString("model.single.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.single.c"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithMixedPrecision)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    libcellml::GeneratorProfilePtr profile = generator->profile();
+
+    profile->setPrecision(libcellml::GeneratorProfile::Precision::MIXED);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.mixed.h"), generator->interfaceCode());
+
+    profile->setInterfaceFileNameString("model.mixed.h");
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.mixed.c"), generator->implementationCode());
+}
+
+TEST(Generator, hodgkinHuxleySquidAxonModel1952WithNumPyProfile)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::NUMPY);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.numpy.py"), generator->implementationCode());
+
+    // A lookup table is not supported by the NumPy profile.
+
+    generator->setLookupTable(nullptr, -150.005, 50.005, 0.01);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.numpy.py"), generator->implementationCode());
+}
+
+TEST(Generator, nobleModel1962)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/noble_model_1962/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+
+    EXPECT_EQ(size_t(4), generator->stateCount());
+    EXPECT_EQ(size_t(17), generator->variableCount());
+
+    EXPECT_NE(nullptr, generator->voi());
+    EXPECT_NE(nullptr, generator->state(0));
+    EXPECT_EQ(nullptr, generator->state(generator->stateCount()));
+    EXPECT_NE(nullptr, generator->variable(0));
+    EXPECT_EQ(nullptr, generator->variable(generator->variableCount()));
+
+    EXPECT_EQ(fileContents("generator/noble_model_1962/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/noble_model_1962/model.c"), generator->implementationCode());
+
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/noble_model_1962/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, codeOptimization)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/code_optimization/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+
+    EXPECT_EQ(size_t(1), generator->stateCount());
+    EXPECT_EQ(size_t(13), generator->variableCount());
+
+    libcellml::GeneratorProfilePtr profile = generator->profile();
+
+    profile->setHasCodeOptimization(true);
+
+    EXPECT_EQ(fileContents("generator/code_optimization/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/code_optimization/model.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    profile->setHasCodeOptimization(true);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/code_optimization/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, jacobian)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/jacobian/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+
+    EXPECT_EQ(size_t(5), generator->stateCount());
+    EXPECT_EQ(size_t(2), generator->variableCount());
+
+    libcellml::GeneratorProfilePtr profile = generator->profile();
+
+    profile->setHasJacobian(true);
+
+    EXPECT_EQ(fileContents("generator/jacobian/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/jacobian/model.c"), generator->implementationCode());
+
+    profile->setHasCodeOptimization(true);
+
+    EXPECT_EQ(fileContents("generator/jacobian/model.optimized.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    profile->setHasJacobian(true);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/jacobian/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, jacobianWithoutNonZeroEntries)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/ode_constant_on_rhs/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+
+    libcellml::GeneratorProfilePtr profile = generator->profile();
+
+    profile->setHasJacobian(true);
+
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("const size_t JACOBIAN_NON_ZERO_COUNT = 0;\n"
+                                                                      "const size_t JACOBIAN_ROW_POINTERS[] = {0, 0};\n"
+                                                                      "const size_t JACOBIAN_COLUMN_INDICES[] = {0};\n"));
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    profile->setHasJacobian(true);
+
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("JACOBIAN_NON_ZERO_COUNT = 0\n"
+                                                                      "JACOBIAN_ROW_POINTERS = [0, 0]\n"
+                                                                      "JACOBIAN_COLUMN_INDICES = []\n"));
+}
+
+TEST(Generator, jacobianWithSharedDependencyChains)
+{
+    // A chain of algebraic variables, each of which uses the previous one
+    // twice, i.e. a_i = a_(i-1)+a_(i-1), which would take forever to
+    // differentiate if we didn't memoise the derivative of each variable.
+
+    static const size_t CHAIN_LENGTH = 64;
+
+    libcellml::ModelPtr model = libcellml::Model::create("shared_dependency_chains");
+    libcellml::ComponentPtr component = libcellml::Component::create("main");
+    libcellml::VariablePtr t = libcellml::Variable::create("t");
+    libcellml::VariablePtr x = libcellml::Variable::create("x");
+    std::string math = "<math xmlns=\"http://www.w3.org/1998/Math/MathML\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\">"
+                       "<apply><eq/><ci>a_0</ci><ci>t</ci></apply>";
+
+    t->setUnits("dimensionless");
+    x->setUnits("dimensionless");
+    x->setInitialValue(1.0);
+
+    component->addVariable(t);
+    component->addVariable(x);
+
+    for (size_t i = 0; i <= CHAIN_LENGTH; ++i) {
+        libcellml::VariablePtr a = libcellml::Variable::create("a_" + std::to_string(i));
+
+        a->setUnits("dimensionless");
+
+        component->addVariable(a);
+
+        if (i != 0) {
+            std::string previous = "<ci>a_" + std::to_string(i - 1) + "</ci>";
+
+            math += "<apply><eq/><ci>a_" + std::to_string(i) + "</ci><apply><plus/>" + previous + previous + "</apply></apply>";
+        }
+    }
+
+    math += "<apply><eq/><apply><diff/><bvar><ci>t</ci></bvar><ci>x</ci></apply>"
+            "<apply><times/><ci>a_" + std::to_string(CHAIN_LENGTH) + "</ci><ci>x</ci></apply></apply>"
+            "</math>";
+
+    component->setMath(math);
+    model->addComponent(component);
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    generator->profile()->setHasJacobian(true);
+
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("    jac[0] = variables[" + std::to_string(CHAIN_LENGTH) + "];\n"));
+}
+
+TEST(Generator, jacobianOfAlgebraicModel)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/algebraic_eqn_const_var_on_rhs/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ALGEBRAIC, generator->modelType());
+
+    libcellml::GeneratorProfilePtr profile = generator->profile();
+
+    profile->setHasJacobian(true);
+
+    EXPECT_EQ(std::string::npos, generator->interfaceCode().find("JACOBIAN"));
+    EXPECT_EQ(std::string::npos, generator->interfaceCode().find("computeJacobian"));
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("JACOBIAN"));
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("computeJacobian"));
+
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    profile->setHasJacobian(true);
+
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("JACOBIAN"));
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("compute_jacobian"));
+}
+
+TEST(Generator, writeCodeToStream)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    std::ostringstream interfaceStream;
+    std::ostringstream implementationStream;
+
+    generator->writeInterfaceCode(interfaceStream);
+    generator->writeImplementationCode(implementationStream);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.h"), interfaceStream.str());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.c"), implementationStream.str());
+
+    // Nothing gets written for an invalid model.
+
+    std::ostringstream invalidStream;
+
+    generator->processModel(libcellml::Model::create());
+    generator->writeInterfaceCode(invalidStream);
+    generator->writeImplementationCode(invalidStream);
+
+    EXPECT_EQ(EMPTY_STRING, invalidStream.str());
+}
+
+TEST(Generator, writeMethodsWithUnusualCodePlaceholders)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+    libcellml::GeneratorProfilePtr profile = generator->profile();
+
+    generator->processModel(model);
+
+    // The body of a method is written as it gets generated, yet only the first
+    // occurrence of <CODE> gets replaced and nothing is written if there is no
+    // <CODE>, just like when expanding a profile string.
+
+    profile->setImplementationComputeRatesMethodString("void computeRates()\n{\n<CODE>}\n/* <CODE> */\n");
+    profile->setImplementationComputeComputedConstantsMethodString("void computeComputedConstants()\n{\n}\n");
+    profile->setImplementationComputeVariablesMethodString("void computeVariables()\n{\n<CODE>}\n");
+    profile->setEmptyMethodString("/* Nothing to compute. */\n");
+
+    std::ostringstream implementationStream;
+
+    generator->writeImplementationCode(implementationStream);
+
+    auto implementationCode = implementationStream.str();
+
+    EXPECT_EQ(generator->implementationCode(), implementationCode);
+    EXPECT_NE(std::string::npos, implementationCode.find("void computeRates()\n{\n    variables[10] = 0.1*(states[3]+25.0)/(exp((states[3]+25.0)/10.0)-1.0);\n"));
+    EXPECT_NE(std::string::npos, implementationCode.find("}\n/* <CODE> */\n"));
+    EXPECT_NE(std::string::npos, implementationCode.find("void computeComputedConstants()\n{\n}\n"));
+    EXPECT_EQ(std::string::npos, implementationCode.find("variables[6] = variables[2]-10.613;"));
+    EXPECT_EQ(std::string::npos, implementationCode.find("/* Nothing to compute. */"));
+
+    // An empty body is replaced with the empty method string.
+
+    model = parser->parseModel(fileContents("generator/ode_constant_on_rhs/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    generator->processModel(model);
+
+    implementationStream.str("");
+
+    generator->writeImplementationCode(implementationStream);
+
+    implementationCode = implementationStream.str();
+
+    EXPECT_EQ(generator->implementationCode(), implementationCode);
+    EXPECT_NE(std::string::npos, implementationCode.find("void computeRates()\n{\n    rates[0] = 1.0;\n}\n/* <CODE> */\n"));
+    EXPECT_NE(std::string::npos, implementationCode.find("void computeVariables()\n{\n    /* Nothing to compute. */\n}\n"));
+}
+
+TEST(Generator, profileModifiedAfterGeneratingCode)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+    libcellml::GeneratorProfilePtr profile = generator->profile();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.c"), generator->implementationCode());
+
+    // Modifying the profile after having generated some code must be taken
+    // into account the next time we generate some code.
+
+    auto commentString = profile->commentString();
+    auto variableInfoWithTypeEntryString = profile->variableInfoWithTypeEntryString();
+
+    profile->setCommentString("// <CODE>\n");
+    profile->setVariableInfoWithTypeEntryString("{\"<NAME>\", \"<UNITS>\", <TYPE>}");
+
+    auto implementationCode = generator->implementationCode();
+
+    EXPECT_EQ(size_t(0), implementationCode.find("// The content of this file was generated using a modified C profile of libCellML "));
+    EXPECT_NE(std::string::npos, implementationCode.find("    {\"g_L\", \"milliS_per_cm2\", CONSTANT},\n"));
+    EXPECT_EQ(std::string::npos, implementationCode.find("leakage_current"));
+
+    // Reverting our changes gives us back an official profile.
+
+    profile->setCommentString(commentString);
+    profile->setVariableInfoWithTypeEntryString(variableInfoWithTypeEntryString);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.c"), generator->implementationCode());
+
+    // Using another profile must also be taken into account.
+
+    generator->setProfile(libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON));
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, profileReplacedByProfileWithSameRevision)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->processModel(model);
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+
+    // Release our Python profile and use a new C profile, which has the same
+    // revision and may be allocated where our Python profile was, i.e. the
+    // cache must not rely on the address of a profile.
+
+    generator->setProfile(libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::C));
+
+    profile = nullptr;
+    profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::C);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.c"), generator->implementationCode());
+}
+
+TEST(Generator, deeplyInterdependentEquations)
+{
+    // Each variable depends on the two previous ones, meaning that the number
+    // of paths through the dependencies of the last variable grows
+    // exponentially with the number of variables. Code generation must
+    // nonetheless only visit each equation once.
+
+    static const size_t VARIABLE_COUNT = 1000;
+
+    std::string maths;
+    std::string variables;
+
+    for (size_t i = 0; i < VARIABLE_COUNT; ++i) {
+        auto name = "x" + std::to_string(i);
+
+        if (i < 2) {
+            variables += "<variable name=\"" + name + "\" units=\"dimensionless\" initial_value=\"1\"/>";
+        } else {
+            variables += "<variable name=\"" + name + "\" units=\"dimensionless\"/>";
+            maths += "<apply><eq/><ci>" + name + "</ci>"
+                     "<apply><plus/><ci>x" + std::to_string(i - 1) + "</ci><ci>x" + std::to_string(i - 2) + "</ci></apply>"
+                     "</apply>";
+        }
+    }
+
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel("<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                                                   "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\">"
+                                                   "<component name=\"component\">"
+                                                   + variables
+                                                   + "<math xmlns=\"http://www.w3.org/1998/Math/MathML\">"
+                                                   + maths
+                                                   + "</math>"
+                                                     "</component>"
+                                                     "</model>");
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ALGEBRAIC, generator->modelType());
+    EXPECT_EQ(VARIABLE_COUNT, generator->variableCount());
+
+    auto code = generator->implementationCode();
+
+    for (size_t i = 2; i < VARIABLE_COUNT; ++i) {
+        EXPECT_NE(std::string::npos, code.find("variables[" + std::to_string(i) + "] = "));
+    }
+
+    // The code is big enough to be written to a stream in several blocks.
+
+    std::ostringstream stream;
+
+    generator->writeImplementationCode(stream);
+
+    EXPECT_EQ(code, stream.str());
+}
+
+TEST(Generator, instances)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/instances/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    model->resolveImports(resourcePath("generator/instances/"));
+
+    EXPECT_FALSE(model->hasUnresolvedImports());
+
+    model->flatten();
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(fileContents("generator/instances/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/instances/model.c"), generator->implementationCode());
+
+    // The first cell is the only one to be stimulated, so only the three other
+    // cells share a kernel to compute their rates while all four cells share a
+    // kernel to compute their variables.
+
+    EXPECT_EQ(size_t(0), generator->minimumInstanceCount());
+
+    generator->setMinimumInstanceCount(3);
+
+    EXPECT_EQ(size_t(3), generator->minimumInstanceCount());
+
+    EXPECT_EQ(fileContents("generator/instances/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/instances/model.instances.c"), generator->implementationCode());
+
+    // Requiring more instances than there are means that no kernels are used.
+
+    generator->setMinimumInstanceCount(5);
+
+    EXPECT_EQ(fileContents("generator/instances/model.c"), generator->implementationCode());
+
+    // Neither is a kernel used with parallel code or if the profile has no
+    // kernel strings.
+
+    generator->setMinimumInstanceCount(2);
+    generator->setParallelChunkSize(2);
+
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("Kernel"));
+
+    generator->setParallelChunkSize(0);
+
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(fileContents("generator/instances/model.instances.py"), generator->implementationCode());
+
+    profile->setImplementationComputeRatesMethodKernelString("");
+    profile->setComputeVariablesMethodKernelCallString("");
+
+    EXPECT_EQ(std::string::npos, generator->implementationCode().find("kernel"));
+}
+
+TEST(Generator, maximumThreadCount)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/fabbri_fantini_wilders_severi_human_san_model_2017/model.cellml"));
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    EXPECT_EQ(size_t(0), generator->maximumThreadCount());
+
+    generator->setMaximumThreadCount(4);
+
+    EXPECT_EQ(size_t(4), generator->maximumThreadCount());
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(fileContents("generator/fabbri_fantini_wilders_severi_human_san_model_2017/model.c"), generator->implementationCode());
+
+    // Issues are reported in the same order, whatever the number of threads.
+
+    static const size_t COMPONENT_COUNT = 64;
+
+    std::string components;
+
+    for (size_t i = 0; i < COMPONENT_COUNT; ++i) {
+        components += "<component name=\"component_" + std::to_string(i) + "\">"
+                      "<variable name=\"x\" units=\"dimensionless\"/>"
+                      "<math xmlns=\"http://www.w3.org/1998/Math/MathML\">"
+                      "<apply><eq/><ci>x</ci><ci>y_" + std::to_string(i) + "</ci></apply>"
+                      "</math>"
+                      "</component>";
+    }
+
+    model = parser->parseModel("<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                               "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"components\">"
+                               + components + "</model>");
+
+    for (size_t maximumThreadCount : {size_t(1), size_t(8)}) {
+        generator->setMaximumThreadCount(maximumThreadCount);
+        generator->processModel(model);
+
+        EXPECT_EQ(COMPONENT_COUNT, generator->issueCount());
+
+        for (size_t i = 0; i < std::min(COMPONENT_COUNT, generator->issueCount()); ++i) {
+            EXPECT_EQ("Variable 'y_" + std::to_string(i) + "' in component 'component_" + std::to_string(i) + "' of model 'components' is referenced in an equation, but it is not defined anywhere.",
+                      generator->issue(i)->description());
+        }
+    }
+}
+
+TEST(Generator, analysisCache)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+    auto owningModel = [](const libcellml::VariablePtr &variable) {
+        auto parent = variable->parent();
+
+        while (parent->parent() != nullptr) {
+            parent = parent->parent();
+        }
+
+        return std::dynamic_pointer_cast<libcellml::Model>(parent);
+    };
+
+    EXPECT_EQ(size_t(0), generator->analysisCacheSize());
+
+    generator->setAnalysisCacheSize(2);
+
+    EXPECT_EQ(size_t(2), generator->analysisCacheSize());
+
+    // Process a model with resets and then another instance of it, which
+    // should get the cached analysis re-attached to it. The cached analysis
+    // must not keep the first instance, or any of its variables, alive.
+
+    std::weak_ptr<libcellml::Model> firstModel;
+    std::weak_ptr<libcellml::Variable> firstVariable;
+
+    for (size_t i = 0; i < 2; ++i) {
+        libcellml::ModelPtr model = parser->parseModel(fileContents("generator/integrate_and_fire/model.cellml"));
+
+        if (i == 0) {
+            firstModel = model;
+            firstVariable = model->component("membrane")->variable("V");
+        }
+
+        generator->processModel(model);
+
+        EXPECT_EQ(size_t(0), generator->issueCount());
+
+        EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+        EXPECT_EQ(model, owningModel(generator->voi()->variable()));
+
+        for (size_t j = 0; j < generator->stateCount(); ++j) {
+            EXPECT_EQ(model, owningModel(generator->state(j)->variable()));
+        }
+
+        for (size_t j = 0; j < generator->variableCount(); ++j) {
+            EXPECT_EQ(model, owningModel(generator->variable(j)->variable()));
+        }
+
+        EXPECT_EQ(fileContents("generator/integrate_and_fire/model.h"), generator->interfaceCode());
+        EXPECT_EQ(fileContents("generator/integrate_and_fire/model.c"), generator->implementationCode());
+    }
+
+    EXPECT_TRUE(firstModel.expired());
+    EXPECT_TRUE(firstVariable.expired());
+
+    // A model with a different structure doesn't use that cached analysis.
+
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.c"), generator->implementationCode());
+
+    model->component("membrane", true)->variable("Cm")->setInitialValue(2.0);
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_NE(std::string::npos, generator->implementationCode().find("variables[1] = 2.0;"));
+
+    // Invalid models are not cached, and neither are the analyses of a
+    // generator with no analysis cache.
+
+    generator->processModel(libcellml::Model::create());
+
+    EXPECT_EQ(libcellml::Generator::ModelType::UNKNOWN, generator->modelType());
+
+    generator->setAnalysisCacheSize(0);
+
+    model = parser->parseModel(fileContents("generator/integrate_and_fire/model.cellml"));
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(fileContents("generator/integrate_and_fire/model.c"), generator->implementationCode());
+}
+
+TEST(Generator, equations)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    EXPECT_EQ(size_t(0), generator->equationCount());
+    EXPECT_EQ(nullptr, generator->equation(0));
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(size_t(17), generator->equationCount());
+    EXPECT_EQ(nullptr, generator->equation(generator->equationCount()));
+
+    // Equations are scheduled, i.e. they come after their dependencies, and
+    // there is one rate equation per state.
+
+    std::map<libcellml::GeneratorEquationPtr, size_t> equationIndices;
+    size_t rateEquationCount = 0;
+
+    for (size_t i = 0; i < generator->equationCount(); ++i) {
+        auto equation = generator->equation(i);
+
+        for (size_t j = 0; j < equation->dependencyCount(); ++j) {
+            EXPECT_EQ(size_t(1), equationIndices.count(equation->dependency(j)));
+        }
+
+        EXPECT_EQ(nullptr, equation->dependency(equation->dependencyCount()));
+
+        equationIndices[equation] = i;
+
+        if (equation->type() == libcellml::GeneratorEquation::Type::RATE) {
+            ++rateEquationCount;
+
+            EXPECT_TRUE(equation->isStateRateBased());
+            EXPECT_EQ(libcellml::GeneratorVariable::Type::STATE, equation->variable()->type());
+        }
+    }
+
+    EXPECT_EQ(generator->stateCount(), rateEquationCount);
+
+    // Check the AST of the rate equation for the membrane potential, i.e.
+    // dV/dt = -(-i_Stim+i_Na+i_K+i_L)/Cm.
+
+    libcellml::GeneratorEquationPtr equation;
+
+    for (size_t i = 0; i < generator->equationCount(); ++i) {
+        if ((generator->equation(i)->type() == libcellml::GeneratorEquation::Type::RATE)
+            && (generator->equation(i)->variable()->variable()->name() == "V")) {
+            equation = generator->equation(i);
+        }
+    }
+
+    ASSERT_NE(nullptr, equation);
+
+    EXPECT_EQ("membrane", equation->component()->name());
+    EXPECT_EQ(size_t(4), equation->dependencyCount());
+
+    auto ast = equation->ast();
+
+    EXPECT_EQ(libcellml::GeneratorAst::Type::ASSIGNMENT, ast->type());
+    EXPECT_EQ(nullptr, ast->parent());
+    EXPECT_EQ(libcellml::GeneratorAst::Type::DIFF, ast->leftChild()->type());
+    EXPECT_EQ(ast, ast->leftChild()->parent());
+    EXPECT_EQ(libcellml::GeneratorAst::Type::BVAR, ast->leftChild()->leftChild()->type());
+    EXPECT_EQ(generator->voi(), ast->leftChild()->leftChild()->leftChild()->variable());
+    EXPECT_EQ(libcellml::GeneratorAst::Type::CI, ast->leftChild()->rightChild()->type());
+    EXPECT_EQ(equation->variable(), ast->leftChild()->rightChild()->variable());
+    EXPECT_EQ(EMPTY_STRING, ast->leftChild()->rightChild()->value());
+    EXPECT_EQ(libcellml::GeneratorAst::Type::DIVIDE, ast->rightChild()->type());
+    EXPECT_EQ(nullptr, ast->rightChild()->variable());
+    EXPECT_EQ(libcellml::GeneratorAst::Type::CI, ast->rightChild()->rightChild()->type());
+    EXPECT_EQ("Cm", ast->rightChild()->rightChild()->variable()->variable()->name());
+    EXPECT_EQ(libcellml::GeneratorVariable::Type::CONSTANT, ast->rightChild()->rightChild()->variable()->type());
+    EXPECT_EQ(nullptr, ast->rightChild()->rightChild()->leftChild());
+    EXPECT_EQ(nullptr, ast->rightChild()->rightChild()->rightChild());
+
+    // The nodes of an AST are only wrapped once.
+
+    EXPECT_EQ(ast, equation->ast());
+    EXPECT_EQ(ast->rightChild(), ast->rightChild());
+    EXPECT_EQ(ast->rightChild(), ast->rightChild()->rightChild()->parent());
+
+    // Numbers come with their value.
+
+    equation = nullptr;
+
+    for (size_t i = 0; i < generator->equationCount(); ++i) {
+        if (generator->equation(i)->variable()->variable()->name() == "E_L") {
+            equation = generator->equation(i);
+        }
+    }
+
+    ASSERT_NE(nullptr, equation);
+
+    EXPECT_EQ(libcellml::GeneratorEquation::Type::VARIABLE_BASED_CONSTANT, equation->type());
+    EXPECT_FALSE(equation->isStateRateBased());
+    EXPECT_EQ(libcellml::GeneratorAst::Type::MINUS, equation->ast()->rightChild()->type());
+    EXPECT_EQ(libcellml::GeneratorAst::Type::CN, equation->ast()->rightChild()->rightChild()->type());
+    EXPECT_EQ("10.613", equation->ast()->rightChild()->rightChild()->value());
+
+    // Equations refer to the states and variables of the generator, including
+    // after changing the variable ordering.
+
+    generator->setVariableOrdering(libcellml::Generator::VariableOrdering::FIRST_USE);
+
+    for (size_t i = 0; i < generator->equationCount(); ++i) {
+        auto variable = generator->equation(i)->variable();
+        auto sameVariable = (variable->type() == libcellml::GeneratorVariable::Type::STATE) ?
+                                generator->state(variable->index()) :
+                                generator->variable(variable->index());
+
+        EXPECT_EQ(sameVariable, variable);
+    }
+
+    // No equations for an invalid model.
+
+    generator->processModel(libcellml::Model::create());
+
+    EXPECT_EQ(size_t(0), generator->equationCount());
+    EXPECT_EQ(nullptr, generator->equation(0));
+
+    // An AST remains usable once the generator has moved on.
+
+    EXPECT_EQ(libcellml::GeneratorAst::Type::ASSIGNMENT, ast->type());
+    EXPECT_EQ("Cm", ast->rightChild()->rightChild()->variable()->variable()->name());
+
+    // An AST that doesn't come from the generator is empty.
+
+    auto emptyAst = libcellml::GeneratorAst::create();
+
+    EXPECT_EQ(libcellml::GeneratorAst::Type::ASSIGNMENT, emptyAst->type());
+    EXPECT_EQ(EMPTY_STRING, emptyAst->value());
+    EXPECT_EQ(nullptr, emptyAst->variable());
+    EXPECT_EQ(nullptr, emptyAst->parent());
+    EXPECT_EQ(nullptr, emptyAst->leftChild());
+    EXPECT_EQ(nullptr, emptyAst->rightChild());
+}
+
+TEST(Generator, coverage)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/coverage/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->issueCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->issueCount());
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+
+    EXPECT_EQ(size_t(1), generator->stateCount());
+    EXPECT_EQ(size_t(186), generator->variableCount());
+
+    EXPECT_NE(nullptr, generator->voi());
+    EXPECT_NE(nullptr, generator->state(0));
+    EXPECT_EQ(nullptr, generator->state(generator->stateCount()));
+    EXPECT_NE(nullptr, generator->variable(0));
+    EXPECT_EQ(nullptr, generator->variable(generator->variableCount()));
+
+    EXPECT_EQ(fileContents("generator/coverage/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/coverage/model.c"), generator->implementationCode());
+
+    libcellml::GeneratorProfilePtr profile = generator->profile();
+
+    profile->setInterfaceCreateStatesArrayMethodString("double * createStatesVector();\n");
+    profile->setImplementationCreateStatesArrayMethodString("double * createStatesVector()\n"
+                                                            "{\n"
+                                                            "    return (double *) malloc(STATE_COUNT*sizeof(double));\n"
+                                                            "}\n");
+
+    EXPECT_EQ(fileContents("generator/coverage/model.modified.profile.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/coverage/model.modified.profile.c"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create();
+
+    generator->setProfile(profile);
+
+    profile->setHasInterface(false);
+
+    profile->setXorString("^");
+    profile->setHasXorOperator(true);
+
+    profile->setPowerString("^^");
+    profile->setSquareString("sqr");
+    profile->setHasPowerOperator(true);
+
+    profile->setPiecewiseIfString("piecewise(<CONDITION>, <IF_STATEMENT>");
+    profile->setPiecewiseElseString(", <ELSE_STATEMENT>)");
+    profile->setHasConditionalOperator(false);
+
+    profile->setInterfaceFileNameString("customheaderfile.h");
+
+    profile->setImplementationHeaderString("#include \"<INTERFACE_FILE_NAME>\"\n");
+
+    profile->setImplementationVersionString("");
+
+    profile->setImplementationLibcellmlVersionString("");
+
+    profile->setImplementationStateCountString("");
+
+    profile->setImplementationVariableCountString("");
+
+    profile->setVariableTypeObjectString("");
+
+    profile->setConstantVariableTypeString("");
+    profile->setComputedConstantVariableTypeString("");
+    profile->setAlgebraicVariableTypeString("");
+
+    profile->setVariableInfoObjectString("");
+    profile->setVariableInfoWithTypeObjectString("");
+
+    profile->setImplementationVoiInfoString("");
+
+    profile->setImplementationStateInfoString("");
+
+    profile->setImplementationVariableInfoString("");
+
+    profile->setVariableInfoEntryString("");
+    profile->setVariableInfoWithTypeEntryString("");
+
+    profile->setImplementationCreateStatesArrayMethodString("");
+
+    profile->setImplementationCreateVariablesArrayMethodString("");
+
+    profile->setImplementationDeleteArrayMethodString("");
+
+    profile->setImplementationComputeVariablesMethodString("// We should have computeVariables() here, but we replaced it with this comment\n"
+                                                           "// and no code template that can be replaced so that our replace() method can\n"
+                                                           "// is forced to return an empty string, ensuring 100% coverage using llvm-cov...\n");
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/coverage/model.out"), generator->implementationCode());
+
+    profile = libcellml::GeneratorProfile::create();
+
+    generator->setProfile(profile);
+
+    profile->setHasInterface(true);
+
+    profile->setEqString("eq");
+    profile->setNeqString("neq");
+    profile->setLtString("lt");
+    profile->setLeqString("leq");
+    profile->setGtString("gt");
+    profile->setGeqString("geq");
+    profile->setAndString("and");
+    profile->setOrString("or");
+    profile->setNotString("not");
+
+    profile->setHasEqOperator(false);
+    profile->setHasNeqOperator(false);
+    profile->setHasLtOperator(false);
+    profile->setHasLeqOperator(false);
+    profile->setHasGtOperator(false);
+    profile->setHasGeqOperator(false);
+    profile->setHasAndOperator(false);
+    profile->setHasOrOperator(false);
+    profile->setHasNotOperator(false);
+
+    profile->setImplementationHeaderString("");
+
+    profile->setInterfaceVersionString("");
+    profile->setImplementationVersionString("");
+
+    profile->setInterfaceLibcellmlVersionString("");
+    profile->setImplementationLibcellmlVersionString("");
+
+    profile->setInterfaceStateCountString("");
+    profile->setImplementationStateCountString("");
 
     profile->setInterfaceVariableCountString("");
     profile->setImplementationVariableCountString("");
@@ -1309,4 +2896,9 @@ TEST(Generator, coverage)
 
     EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
     EXPECT_EQ(fileContents("generator/coverage/model.modified.profile.py"), generator->implementationCode());
+
+    profile->setProfile(libcellml::GeneratorProfile::Profile::NUMPY);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/coverage/model.numpy.py"), generator->implementationCode());
 }
@@ -0,0 +1,105 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+// Use the code generated for a fibre of four FitzHugh-Nagumo cells, with the
+// cells being computed by instance kernels, to check that the rates and
+// variables of each cell match those computed by hand.
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wunused-parameter"
+#elif defined(_MSC_VER)
+#    pragma warning(push)
+#    pragma warning(disable : 4100)
+#endif
+
+namespace fibre {
+#include "../resources/generator/instances/model.instances.c"
+} // namespace fibre
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#    pragma warning(pop)
+#endif
+
+static const size_t CELL_COUNT = 4;
+
+template<typename Info>
+static size_t infoIndex(const Info *info, size_t count, const char *name, size_t cell)
+{
+    std::string component = "cell_" + std::to_string(cell);
+
+    for (size_t i = 0; i < count; ++i) {
+        if ((strcmp(info[i].name, name) == 0) && (info[i].component == component)) {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+static size_t stateIndex(const char *name, size_t cell)
+{
+    return infoIndex(fibre::STATE_INFO, fibre::STATE_COUNT, name, cell);
+}
+
+TEST(GeneratorInstances, instanceKernelsMatchEquations)
+{
+    std::vector<double> states(fibre::STATE_COUNT);
+    std::vector<double> rates(fibre::STATE_COUNT);
+    std::vector<double> variables(fibre::VARIABLE_COUNT);
+
+    fibre::initializeStatesAndConstants(states.data(), variables.data());
+    fibre::computeComputedConstants(variables.data());
+
+    // Give each cell its own state, away from the resting state.
+
+    std::vector<double> v(CELL_COUNT);
+    std::vector<double> w(CELL_COUNT);
+
+    for (size_t i = 0; i < CELL_COUNT; ++i) {
+        v[i] = -1.0 + 0.5 * static_cast<double>(i);
+        w[i] = 0.25 - 0.1 * static_cast<double>(i);
+
+        states[stateIndex("V", i)] = v[i];
+        states[stateIndex("w", i)] = w[i];
+    }
+
+    for (double voi : {0.5, 1.5}) {
+        fibre::computeRates(voi, states.data(), rates.data(), variables.data());
+        fibre::computeVariables(voi, states.data(), rates.data(), variables.data());
+
+        for (size_t i = 0; i < CELL_COUNT; ++i) {
+            double iIon = v[i] - v[i] * v[i] * v[i] / 3.0 - w[i];
+            double iStim = ((i == 0) && (voi >= 1.0) && (voi <= 2.0)) ? 0.5 : 0.0;
+            double iCoupling = 0.1 * (((i == 0) ? 0.0 : v[i - 1] - v[i]) + ((i == CELL_COUNT - 1) ? 0.0 : v[i + 1] - v[i]));
+
+            EXPECT_NEAR(iIon + iStim + iCoupling, rates[stateIndex("V", i)], 1.0e-12);
+            EXPECT_NEAR(0.08 * (v[i] + 0.7 - 0.8 * w[i]), rates[stateIndex("w", i)], 1.0e-12);
+            EXPECT_NEAR(iIon, variables[infoIndex(fibre::VARIABLE_INFO, fibre::VARIABLE_COUNT, "I_ion", i)], 1.0e-12);
+        }
+    }
+}
@@ -0,0 +1,165 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <vector>
+
+// Use the code generated for the Hodgkin-Huxley model, with and without a
+// lookup table, to check that a lookup table gives essentially the same rates
+// and trajectory as the exact code.
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wunused-parameter"
+#elif defined(_MSC_VER)
+#    pragma warning(push)
+#    pragma warning(disable : 4100)
+#endif
+
+namespace exact {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.c"
+} // namespace exact
+
+namespace lookup {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.lookup.table.c"
+} // namespace lookup
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#    pragma warning(pop)
+#endif
+
+static const double END_TIME = 30.0;
+static const double TIME_STEP = 0.01;
+static const size_t MEMBRANE_POTENTIAL = 3;
+
+struct Model
+{
+    double *(*createStatesArray)();
+    double *(*createVariablesArray)();
+    void (*deleteArray)(double *array);
+    void (*initializeStatesAndConstants)(double *states, double *variables);
+    void (*computeComputedConstants)(double *variables);
+    void (*computeRates)(double voi, double *states, double *rates, double *variables);
+};
+
+static const Model EXACT_MODEL = {exact::createStatesArray, exact::createVariablesArray, exact::deleteArray,
+                                  exact::initializeStatesAndConstants, exact::computeComputedConstants, exact::computeRates};
+static const Model LOOKUP_MODEL = {lookup::createStatesArray, lookup::createVariablesArray, lookup::deleteArray,
+                                   lookup::initializeStatesAndConstants, lookup::computeComputedConstants, lookup::computeRates};
+
+static double maximumRelativeRateError(double membranePotential)
+{
+    double *exactStates = EXACT_MODEL.createStatesArray();
+    double *exactRates = EXACT_MODEL.createStatesArray();
+    double *exactVariables = EXACT_MODEL.createVariablesArray();
+    double *lookupStates = LOOKUP_MODEL.createStatesArray();
+    double *lookupRates = LOOKUP_MODEL.createStatesArray();
+    double *lookupVariables = LOOKUP_MODEL.createVariablesArray();
+    double res = 0.0;
+
+    EXACT_MODEL.initializeStatesAndConstants(exactStates, exactVariables);
+    EXACT_MODEL.computeComputedConstants(exactVariables);
+    LOOKUP_MODEL.initializeStatesAndConstants(lookupStates, lookupVariables);
+    LOOKUP_MODEL.computeComputedConstants(lookupVariables);
+
+    exactStates[MEMBRANE_POTENTIAL] = membranePotential;
+    lookupStates[MEMBRANE_POTENTIAL] = membranePotential;
+
+    EXACT_MODEL.computeRates(0.0, exactStates, exactRates, exactVariables);
+    LOOKUP_MODEL.computeRates(0.0, lookupStates, lookupRates, lookupVariables);
+
+    for (size_t i = 0; i < exact::STATE_COUNT; ++i) {
+        res = std::fmax(res, std::fabs(lookupRates[i] - exactRates[i]) / std::fmax(std::fabs(exactRates[i]), 1.0e-12));
+    }
+
+    EXACT_MODEL.deleteArray(exactStates);
+    EXACT_MODEL.deleteArray(exactRates);
+    EXACT_MODEL.deleteArray(exactVariables);
+    LOOKUP_MODEL.deleteArray(lookupStates);
+    LOOKUP_MODEL.deleteArray(lookupRates);
+    LOOKUP_MODEL.deleteArray(lookupVariables);
+
+    return res;
+}
+
+static std::vector<double> simulate(const Model &model)
+{
+    double *states = model.createStatesArray();
+    double *rates = model.createStatesArray();
+    double *variables = model.createVariablesArray();
+    std::vector<double> res;
+
+    model.initializeStatesAndConstants(states, variables);
+    model.computeComputedConstants(variables);
+
+    auto stepCount = static_cast<size_t>(std::lround(END_TIME / TIME_STEP));
+
+    for (size_t i = 0; i < stepCount; ++i) {
+        model.computeRates(static_cast<double>(i) * TIME_STEP, states, rates, variables);
+
+        for (size_t j = 0; j < exact::STATE_COUNT; ++j) {
+            states[j] += TIME_STEP * rates[j];
+        }
+
+        res.push_back(states[MEMBRANE_POTENTIAL]);
+    }
+
+    model.deleteArray(states);
+    model.deleteArray(rates);
+    model.deleteArray(variables);
+
+    return res;
+}
+
+TEST(GeneratorLookupTable, hodgkinHuxleySquidAxonModel1952Rates)
+{
+    // Within the range of the lookup table, the rates are accurate, including
+    // close to the removable singularities of the model.
+
+    for (double membranePotential : {-149.99, -80.3, -25.0001, -10.0003, 0.123, 49.99}) {
+        EXPECT_LT(maximumRelativeRateError(membranePotential), 1.0e-4);
+    }
+
+    // At the edges of the range of the lookup table, the rates are accurate
+    // too, and the lookup table is not read past its end.
+
+    EXPECT_LT(maximumRelativeRateError(-150.005), 1.0e-4);
+    EXPECT_LT(maximumRelativeRateError(std::nextafter(50.004999999999995, -INFINITY)), 1.0e-4);
+
+    // Outside the range of the lookup table, the rates are exact.
+
+    EXPECT_EQ(0.0, maximumRelativeRateError(-200.0));
+    EXPECT_EQ(0.0, maximumRelativeRateError(60.0));
+}
+
+TEST(GeneratorLookupTable, hodgkinHuxleySquidAxonModel1952Trajectory)
+{
+    auto exactTrajectory = simulate(EXACT_MODEL);
+    auto lookupTrajectory = simulate(LOOKUP_MODEL);
+
+    ASSERT_EQ(exactTrajectory.size(), lookupTrajectory.size());
+
+    for (size_t i = 0; i < exactTrajectory.size(); ++i) {
+        EXPECT_NEAR(exactTrajectory[i], lookupTrajectory[i], 1.0e-3);
+    }
+}
@@ -0,0 +1,131 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <vector>
+
+// Use the code generated for the Hodgkin-Huxley model in double, single, and
+// mixed precision to check that the trajectories obtained in single and mixed
+// precision remain close to the one obtained in double precision.
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wunused-parameter"
+#elif defined(_MSC_VER)
+#    pragma warning(push)
+#    pragma warning(disable : 4100)
+#endif
+
+namespace hhd {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.c"
+} // namespace hhd
+
+namespace hhsp {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.single.c"
+} // namespace hhsp
+
+namespace hhmp {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.mixed.c"
+} // namespace hhmp
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#    pragma warning(pop)
+#endif
+
+static const double END_TIME = 50.0;
+static const double DT = 0.01;
+static const size_t MEMBRANE_POTENTIAL_INDEX = 3;
+
+template<typename Storage, typename Voi>
+static std::vector<double> membranePotentials(size_t stateCount, size_t variableCount,
+                                              void (*initializeStatesAndConstants)(Storage *, Storage *),
+                                              void (*computeComputedConstants)(Storage *),
+                                              void (*computeRates)(Voi, Storage *, Storage *, Storage *))
+{
+    // Integrate our model using forward Euler and return the membrane potential
+    // at each step.
+
+    auto stepCount = static_cast<size_t>(std::lround(END_TIME / DT));
+    std::vector<Storage> states(stateCount);
+    std::vector<Storage> rates(stateCount);
+    std::vector<Storage> variables(variableCount);
+    std::vector<double> res;
+
+    initializeStatesAndConstants(states.data(), variables.data());
+    computeComputedConstants(variables.data());
+
+    for (size_t step = 0; step < stepCount; ++step) {
+        computeRates(static_cast<Voi>(static_cast<double>(step) * DT), states.data(), rates.data(), variables.data());
+
+        for (size_t i = 0; i < stateCount; ++i) {
+            states[i] += static_cast<Storage>(DT) * rates[i];
+        }
+
+        res.push_back(static_cast<double>(states[MEMBRANE_POTENTIAL_INDEX]));
+    }
+
+    return res;
+}
+
+static void expectTrajectoriesNear(const std::vector<double> &expectedTrajectory,
+                                   const std::vector<double> &trajectory,
+                                   double tolerance)
+{
+    ASSERT_EQ(expectedTrajectory.size(), trajectory.size());
+
+    for (size_t i = 0; i < trajectory.size(); ++i) {
+        EXPECT_NEAR(expectedTrajectory[i], trajectory[i], tolerance);
+    }
+}
+
+TEST(GeneratorPrecision, singlePrecisionTrajectoryMatchesDoublePrecision)
+{
+    ASSERT_EQ(hhd::STATE_COUNT, hhsp::STATE_COUNT);
+    ASSERT_EQ(hhd::VARIABLE_COUNT, hhsp::VARIABLE_COUNT);
+
+    expectTrajectoriesNear(membranePotentials(hhd::STATE_COUNT, hhd::VARIABLE_COUNT,
+                                              hhd::initializeStatesAndConstants,
+                                              hhd::computeComputedConstants,
+                                              hhd::computeRates),
+                           membranePotentials(hhsp::STATE_COUNT, hhsp::VARIABLE_COUNT,
+                                              hhsp::initializeStatesAndConstants,
+                                              hhsp::computeComputedConstants,
+                                              hhsp::computeRates),
+                           1.0e-1);
+}
+
+TEST(GeneratorPrecision, mixedPrecisionTrajectoryMatchesDoublePrecision)
+{
+    ASSERT_EQ(hhd::STATE_COUNT, hhmp::STATE_COUNT);
+    ASSERT_EQ(hhd::VARIABLE_COUNT, hhmp::VARIABLE_COUNT);
+
+    expectTrajectoriesNear(membranePotentials(hhd::STATE_COUNT, hhd::VARIABLE_COUNT,
+                                              hhd::initializeStatesAndConstants,
+                                              hhd::computeComputedConstants,
+                                              hhd::computeRates),
+                           membranePotentials(hhmp::STATE_COUNT, hhmp::VARIABLE_COUNT,
+                                              hhmp::initializeStatesAndConstants,
+                                              hhmp::computeComputedConstants,
+                                              hhmp::computeRates),
+                           1.0e-2);
+}
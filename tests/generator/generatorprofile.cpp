@@ -39,7 +39,17 @@ TEST(GeneratorProfile, defaultGeneralValues)
 
     EXPECT_EQ(libcellml::GeneratorProfile::Profile::C, generatorProfile->profile());
 
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::DOUBLE, generatorProfile->precision());
+
     EXPECT_EQ(true, generatorProfile->hasInterface());
+
+    EXPECT_EQ(false, generatorProfile->hasCodeOptimization());
+
+    EXPECT_EQ(false, generatorProfile->hasJacobian());
+
+    EXPECT_EQ(false, generatorProfile->hasRushLarsen());
+
+    EXPECT_EQ(false, generatorProfile->hasBranchlessPiecewise());
 }
 
 TEST(GeneratorProfile, defaultRelationalAndLogicalOperatorValues)
@@ -130,6 +140,8 @@ TEST(GeneratorProfile, defaultPiecewiseStatementValues)
 
     EXPECT_EQ("(<CONDITION>)?<IF_STATEMENT>", generatorProfile->conditionalOperatorIfString());
     EXPECT_EQ(":<ELSE_STATEMENT>", generatorProfile->conditionalOperatorElseString());
+    EXPECT_EQ("blend(<CONDITION>, <IF_STATEMENT>", generatorProfile->branchlessPiecewiseIfString());
+    EXPECT_EQ(", <ELSE_STATEMENT>)", generatorProfile->branchlessPiecewiseElseString());
     EXPECT_EQ("", generatorProfile->piecewiseIfString());
     EXPECT_EQ("", generatorProfile->piecewiseElseString());
 
@@ -146,6 +158,7 @@ TEST(GeneratorProfile, defaultConstantValues)
     EXPECT_EQ(convertToString(M_PI), generatorProfile->piString());
     EXPECT_EQ("INFINITY", generatorProfile->infString());
     EXPECT_EQ("NAN", generatorProfile->nanString());
+    EXPECT_EQ("", generatorProfile->floatingPointLiteralSuffixString());
 }
 
 TEST(GeneratorProfile, defaultArithmeticFunctionValues)
@@ -176,6 +189,11 @@ TEST(GeneratorProfile, defaultArithmeticFunctionValues)
               "    return (x > y)?x:y;\n"
               "}\n",
               generatorProfile->maxFunctionString());
+    EXPECT_EQ("double blend(double condition, double trueValue, double falseValue)\n"
+              "{\n"
+              "    return (condition != 0.0)?trueValue:falseValue;\n"
+              "}\n",
+              generatorProfile->blendFunctionString());
 }
 
 TEST(GeneratorProfile, defaultTrigonometricFunctionValues)
@@ -321,14 +339,51 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               "};\n",
               generatorProfile->implementationVariableInfoString());
 
+    EXPECT_EQ("extern const size_t JACOBIAN_NON_ZERO_COUNT;\n"
+              "extern const size_t JACOBIAN_ROW_POINTERS[];\n"
+              "extern const size_t JACOBIAN_COLUMN_INDICES[];\n",
+              generatorProfile->interfaceJacobianSparsityString());
+    EXPECT_EQ("const size_t JACOBIAN_NON_ZERO_COUNT = <NON_ZERO_COUNT>;\n"
+              "const size_t JACOBIAN_ROW_POINTERS[] = {<ROW_POINTERS>};\n"
+              "const size_t JACOBIAN_COLUMN_INDICES[] = {<COLUMN_INDICES>};\n",
+              generatorProfile->implementationJacobianSparsityString());
+    EXPECT_EQ("0", generatorProfile->emptyJacobianColumnIndicesString());
+
+    EXPECT_EQ("extern const size_t SENSITIVITY_PARAMETER_COUNT;\n",
+              generatorProfile->interfaceSensitivityParameterCountString());
+    EXPECT_EQ("const size_t SENSITIVITY_PARAMETER_COUNT = <SENSITIVITY_PARAMETER_COUNT>;\n",
+              generatorProfile->implementationSensitivityParameterCountString());
+
+    EXPECT_EQ("extern const size_t SWEEP_PARAMETER_COUNT;\n",
+              generatorProfile->interfaceSweepParameterCountString());
+    EXPECT_EQ("const size_t SWEEP_PARAMETER_COUNT = <SWEEP_PARAMETER_COUNT>;\n",
+              generatorProfile->implementationSweepParameterCountString());
+
+    EXPECT_EQ("extern const size_t RESET_COUNT;\n",
+              generatorProfile->interfaceResetCountString());
+    EXPECT_EQ("const size_t RESET_COUNT = <RESET_COUNT>;\n",
+              generatorProfile->implementationResetCountString());
+
     EXPECT_EQ("{\"<NAME>\", \"<UNITS>\", \"<COMPONENT>\"}", generatorProfile->variableInfoEntryString());
     EXPECT_EQ("{\"<NAME>\", \"<UNITS>\", \"<COMPONENT>\", <TYPE>}", generatorProfile->variableInfoWithTypeEntryString());
 
     EXPECT_EQ("voi", generatorProfile->voiString());
 
+    EXPECT_EQ("dt", generatorProfile->timeStepString());
+
     EXPECT_EQ("states", generatorProfile->statesArrayString());
     EXPECT_EQ("rates", generatorProfile->ratesArrayString());
     EXPECT_EQ("variables", generatorProfile->variablesArrayString());
+    EXPECT_EQ("jac", generatorProfile->jacobianArrayString());
+    EXPECT_EQ("sensitivities", generatorProfile->sensitivitiesArrayString());
+    EXPECT_EQ("sensitivityRates", generatorProfile->sensitivityRatesArrayString());
+    EXPECT_EQ("parameters", generatorProfile->sweepParametersArrayString());
+    EXPECT_EQ("<INDEX>*instanceCount+i", generatorProfile->batchArrayIndexString());
+    EXPECT_EQ("i*SWEEP_PARAMETER_COUNT+<INDEX>", generatorProfile->batchSweepParameterIndexString());
+    EXPECT_EQ("<INDEX>+<STRIDE>*i", generatorProfile->instanceArrayIndexString());
+    EXPECT_EQ("roots", generatorProfile->rootsArrayString());
+    EXPECT_EQ("events", generatorProfile->eventsArrayString());
+    EXPECT_EQ("resetValues", generatorProfile->resetValuesArrayString());
 
     EXPECT_EQ("double * createStatesArray();\n",
               generatorProfile->interfaceCreateStatesArrayMethodString());
@@ -369,6 +424,12 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               "<CODE>"
               "}\n",
               generatorProfile->implementationComputeComputedConstantsMethodString());
+    EXPECT_EQ("static void computeComputedConstantsChunk<INDEX>(double *variables)\n"
+              "{\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->implementationComputeComputedConstantsMethodChunkString());
+    EXPECT_EQ("computeComputedConstantsChunk<INDEX>(variables)", generatorProfile->computeComputedConstantsMethodChunkCallString());
 
     EXPECT_EQ("void computeRates(double voi, double *states, double *rates, double *variables);\n",
               generatorProfile->interfaceComputeRatesMethodString());
@@ -377,6 +438,20 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               "<CODE>"
               "}\n",
               generatorProfile->implementationComputeRatesMethodString());
+    EXPECT_EQ("static void computeRatesChunk<INDEX>(double voi, double *states, double *rates, double *variables)\n"
+              "{\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->implementationComputeRatesMethodChunkString());
+    EXPECT_EQ("computeRatesChunk<INDEX>(voi, states, rates, variables)", generatorProfile->computeRatesMethodChunkCallString());
+    EXPECT_EQ("static void computeRatesKernel<INDEX>(double voi, double *states, double *rates, double *variables)\n"
+              "{\n"
+              "    for (size_t i = 0; i < <INSTANCE_COUNT>; ++i) {\n"
+              "<CODE>"
+              "    }\n"
+              "}\n",
+              generatorProfile->implementationComputeRatesMethodKernelString());
+    EXPECT_EQ("computeRatesKernel<INDEX>(voi, states, rates, variables)", generatorProfile->computeRatesMethodKernelCallString());
 
     EXPECT_EQ("void computeVariables(double voi, double *states, double *rates, double *variables);\n",
               generatorProfile->interfaceComputeVariablesMethodString());
@@ -385,6 +460,150 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
               "<CODE>"
               "}\n",
               generatorProfile->implementationComputeVariablesMethodString());
+    EXPECT_EQ("static void computeVariablesChunk<INDEX>(double voi, double *states, double *rates, double *variables)\n"
+              "{\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->implementationComputeVariablesMethodChunkString());
+    EXPECT_EQ("computeVariablesChunk<INDEX>(voi, states, rates, variables)", generatorProfile->computeVariablesMethodChunkCallString());
+    EXPECT_EQ("static void computeVariablesKernel<INDEX>(double voi, double *states, double *rates, double *variables)\n"
+              "{\n"
+              "    for (size_t i = 0; i < <INSTANCE_COUNT>; ++i) {\n"
+              "<CODE>"
+              "    }\n"
+              "}\n",
+              generatorProfile->implementationComputeVariablesMethodKernelString());
+    EXPECT_EQ("computeVariablesKernel<INDEX>(voi, states, rates, variables)", generatorProfile->computeVariablesMethodKernelCallString());
+
+    EXPECT_EQ("#pragma omp parallel\n"
+              "{\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->parallelRegionString());
+    EXPECT_EQ("#pragma omp sections\n"
+              "{\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->parallelLevelString());
+    EXPECT_EQ("#pragma omp section\n"
+              "{\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->parallelTaskString());
+
+    EXPECT_EQ("void computeJacobian(double voi, double *states, double *variables, double *jac);\n",
+              generatorProfile->interfaceComputeJacobianMethodString());
+    EXPECT_EQ("void computeJacobian(double voi, double *states, double *variables, double *jac)\n"
+              "{\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->implementationComputeJacobianMethodString());
+
+    EXPECT_EQ("void computeRushLarsenStep(double voi, double dt, double *states, double *variables);\n",
+              generatorProfile->interfaceComputeRushLarsenStepMethodString());
+    EXPECT_EQ("void computeRushLarsenStep(double voi, double dt, double *states, double *variables)\n"
+              "{\n"
+              "    double rates[<STATE_COUNT>];\n"
+              "\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->implementationComputeRushLarsenStepMethodString());
+
+    EXPECT_EQ("exponent", generatorProfile->rushLarsenExponentString());
+    EXPECT_EQ("    double exponent;\n", generatorProfile->implementationRushLarsenExponentString());
+
+    EXPECT_EQ("void computeSensitivityRates(double voi, double *states, double *sensitivities, double *sensitivityRates, double *variables);\n",
+              generatorProfile->interfaceComputeSensitivityRatesMethodString());
+    EXPECT_EQ("void computeSensitivityRates(double voi, double *states, double *sensitivities, double *sensitivityRates, double *variables)\n"
+              "{\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->implementationComputeSensitivityRatesMethodString());
+
+    EXPECT_EQ("void initializeStatesAndConstantsBatch(size_t instanceCount, const double *parameters, double *states, double *variables);\n",
+              generatorProfile->interfaceInitializeStatesAndConstantsBatchMethodString());
+    EXPECT_EQ("void initializeStatesAndConstantsBatch(size_t instanceCount, const double *parameters, double *states, double *variables)\n"
+              "{\n"
+              "#pragma omp simd\n"
+              "    for (size_t i = 0; i < instanceCount; ++i) {\n"
+              "<CODE>"
+              "    }\n"
+              "}\n",
+              generatorProfile->implementationInitializeStatesAndConstantsBatchMethodString());
+    EXPECT_EQ("void computeRatesBatch(size_t instanceCount, double voi, const double *parameters, double *states, double *rates, double *variables);\n",
+              generatorProfile->interfaceComputeRatesBatchMethodString());
+    EXPECT_EQ("void computeRatesBatch(size_t instanceCount, double voi, const double *parameters, double *states, double *rates, double *variables)\n"
+              "{\n"
+              "#pragma omp simd\n"
+              "    for (size_t i = 0; i < instanceCount; ++i) {\n"
+              "<CODE>"
+              "    }\n"
+              "}\n",
+              generatorProfile->implementationComputeRatesBatchMethodString());
+
+    EXPECT_EQ("void computeRatesSpecialized(double voi, double *states, double *rates, double *variables);\n",
+              generatorProfile->interfaceComputeRatesSpecializedMethodString());
+    EXPECT_EQ("void computeRatesSpecialized(double voi, double *states, double *rates, double *variables)\n"
+              "{\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->implementationComputeRatesSpecializedMethodString());
+    EXPECT_EQ("void computeVariablesSpecialized(double voi, double *states, double *rates, double *variables);\n",
+              generatorProfile->interfaceComputeVariablesSpecializedMethodString());
+    EXPECT_EQ("void computeVariablesSpecialized(double voi, double *states, double *rates, double *variables)\n"
+              "{\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->implementationComputeVariablesSpecializedMethodString());
+
+    EXPECT_EQ("void computeRoots(double voi, double *states, double *variables, double *roots);\n",
+              generatorProfile->interfaceComputeRootsMethodString());
+    EXPECT_EQ("void computeRoots(double voi, double *states, double *variables, double *roots)\n"
+              "{\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->implementationComputeRootsMethodString());
+    EXPECT_EQ("void applyResets(double voi, double *states, double *variables, const int *events);\n",
+              generatorProfile->interfaceApplyResetsMethodString());
+    EXPECT_EQ("void applyResets(double voi, double *states, double *variables, const int *events)\n"
+              "{\n"
+              "    double resetValues[<RESET_VARIABLE_COUNT>];\n"
+              "\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->implementationApplyResetsMethodString());
+
+    EXPECT_EQ("x", generatorProfile->lookupTableArgumentString());
+    EXPECT_EQ("static double lookupTable[<ROW_COUNT>][<COLUMN_COUNT>];\n"
+              "\n"
+              "static double lookupTableValue(size_t column, double x)\n"
+              "{\n"
+              "    double position = (x-<MINIMUM>)/<STEP>;\n"
+              "    size_t index = (size_t) fmin(position, <MAXIMUM_INDEX>);\n"
+              "\n"
+              "    return lookupTable[index][column]+(position-index)*(lookupTable[index+1][column]-lookupTable[index][column]);\n"
+              "}\n",
+              generatorProfile->implementationLookupTableString());
+    EXPECT_EQ("static void computeLookupTable()\n"
+              "{\n"
+              "    static int computed = 0;\n"
+              "\n"
+              "    if (computed) {\n"
+              "        return;\n"
+              "    }\n"
+              "\n"
+              "    for (size_t i = 0; i < <ROW_COUNT>; ++i) {\n"
+              "        double x = <MINIMUM>+i*<STEP>;\n"
+              "\n"
+              "<CODE>"
+              "    }\n"
+              "\n"
+              "    computed = 1;\n"
+              "}\n",
+              generatorProfile->implementationComputeLookupTableMethodString());
+    EXPECT_EQ("computeLookupTable()", generatorProfile->computeLookupTableCallString());
+    EXPECT_EQ("lookupTable[i][<COLUMN>]", generatorProfile->lookupTableEntryString());
+    EXPECT_EQ("lookupTableValue(<COLUMN>, <VALUE>)", generatorProfile->lookupTableValueString());
 
     EXPECT_EQ("", generatorProfile->emptyMethodString());
 
@@ -396,6 +615,8 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
     EXPECT_EQ("[", generatorProfile->openArrayString());
     EXPECT_EQ("]", generatorProfile->closeArrayString());
 
+    EXPECT_EQ("", generatorProfile->computeCastString());
+
     EXPECT_EQ(",", generatorProfile->arrayElementSeparatorString());
 
     EXPECT_EQ("\"", generatorProfile->stringDelimiterString());
@@ -409,14 +630,82 @@ TEST(GeneratorProfile, generalSettings)
 
     const libcellml::GeneratorProfile::Profile profile = libcellml::GeneratorProfile::Profile::PYTHON;
     const bool falseValue = false;
+    const bool trueValue = true;
 
     generatorProfile->setProfile(profile);
 
     generatorProfile->setHasInterface(falseValue);
 
+    generatorProfile->setHasCodeOptimization(trueValue);
+
+    generatorProfile->setHasJacobian(trueValue);
+
+    generatorProfile->setHasRushLarsen(trueValue);
+
+    generatorProfile->setHasBranchlessPiecewise(trueValue);
+
     EXPECT_EQ(profile, generatorProfile->profile());
 
     EXPECT_EQ(falseValue, generatorProfile->hasInterface());
+
+    EXPECT_EQ(trueValue, generatorProfile->hasCodeOptimization());
+
+    EXPECT_EQ(trueValue, generatorProfile->hasJacobian());
+
+    EXPECT_EQ(trueValue, generatorProfile->hasRushLarsen());
+
+    EXPECT_EQ(trueValue, generatorProfile->hasBranchlessPiecewise());
+}
+
+TEST(GeneratorProfile, precisionSettings)
+{
+    libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create();
+
+    generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::SINGLE, generatorProfile->precision());
+    EXPECT_EQ("expf", generatorProfile->exponentialString());
+    EXPECT_EQ("powf", generatorProfile->powerString());
+    EXPECT_EQ("1.0f", generatorProfile->trueString());
+    EXPECT_EQ(convertToString(M_PI) + "f", generatorProfile->piString());
+    EXPECT_EQ("f", generatorProfile->floatingPointLiteralSuffixString());
+    EXPECT_EQ("", generatorProfile->computeCastString());
+    EXPECT_EQ("float sec(float x)\n"
+              "{\n"
+              "    return 1.0f/cosf(x);\n"
+              "}\n",
+              generatorProfile->secFunctionString());
+    EXPECT_EQ("void computeRates(float voi, float *states, float *rates, float *variables);\n",
+              generatorProfile->interfaceComputeRatesMethodString());
+
+    generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::MIXED);
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::MIXED, generatorProfile->precision());
+    EXPECT_EQ("exp", generatorProfile->exponentialString());
+    EXPECT_EQ("1.0", generatorProfile->trueString());
+    EXPECT_EQ("", generatorProfile->floatingPointLiteralSuffixString());
+    EXPECT_EQ("(double) ", generatorProfile->computeCastString());
+    EXPECT_EQ("float * createStatesArray()\n"
+              "{\n"
+              "    return (float *) malloc(STATE_COUNT*sizeof(float));\n"
+              "}\n",
+              generatorProfile->implementationCreateStatesArrayMethodString());
+    EXPECT_EQ("void computeRates(double voi, float *states, float *rates, float *variables);\n",
+              generatorProfile->interfaceComputeRatesMethodString());
+
+    // The precision only affects the C profile.
+
+    generatorProfile->setProfile(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::MIXED, generatorProfile->precision());
+    EXPECT_EQ("exp", generatorProfile->exponentialString());
+    EXPECT_EQ("", generatorProfile->computeCastString());
+
+    generatorProfile->setProfile(libcellml::GeneratorProfile::Profile::C);
+    generatorProfile->setPrecision(libcellml::GeneratorProfile::Precision::DOUBLE);
+
+    EXPECT_EQ("void computeRates(double voi, double *states, double *rates, double *variables);\n",
+              generatorProfile->interfaceComputeRatesMethodString());
 }
 
 TEST(GeneratorProfile, relationalAndLogicalOperators)
@@ -586,6 +875,8 @@ TEST(GeneratorProfile, piecewiseStatement)
 
     generatorProfile->setConditionalOperatorIfString(value);
     generatorProfile->setConditionalOperatorElseString(value);
+    generatorProfile->setBranchlessPiecewiseIfString(value);
+    generatorProfile->setBranchlessPiecewiseElseString(value);
     generatorProfile->setPiecewiseIfString(value);
     generatorProfile->setPiecewiseElseString(value);
 
@@ -593,6 +884,8 @@ TEST(GeneratorProfile, piecewiseStatement)
 
     EXPECT_EQ(value, generatorProfile->conditionalOperatorIfString());
     EXPECT_EQ(value, generatorProfile->conditionalOperatorElseString());
+    EXPECT_EQ(value, generatorProfile->branchlessPiecewiseIfString());
+    EXPECT_EQ(value, generatorProfile->branchlessPiecewiseElseString());
     EXPECT_EQ(value, generatorProfile->piecewiseIfString());
     EXPECT_EQ(value, generatorProfile->piecewiseElseString());
 
@@ -611,6 +904,7 @@ TEST(GeneratorProfile, constants)
     generatorProfile->setPiString(value);
     generatorProfile->setInfString(value);
     generatorProfile->setNanString(value);
+    generatorProfile->setFloatingPointLiteralSuffixString(value);
 
     EXPECT_EQ(value, generatorProfile->trueString());
     EXPECT_EQ(value, generatorProfile->falseString());
@@ -618,6 +912,7 @@ TEST(GeneratorProfile, constants)
     EXPECT_EQ(value, generatorProfile->piString());
     EXPECT_EQ(value, generatorProfile->infString());
     EXPECT_EQ(value, generatorProfile->nanString());
+    EXPECT_EQ(value, generatorProfile->floatingPointLiteralSuffixString());
 }
 
 TEST(GeneratorProfile, arithmeticFunctions)
@@ -638,6 +933,7 @@ TEST(GeneratorProfile, arithmeticFunctions)
     generatorProfile->setNotFunctionString(value);
     generatorProfile->setMinFunctionString(value);
     generatorProfile->setMaxFunctionString(value);
+    generatorProfile->setBlendFunctionString(value);
 
     EXPECT_EQ(value, generatorProfile->eqFunctionString());
     EXPECT_EQ(value, generatorProfile->neqFunctionString());
@@ -651,6 +947,7 @@ TEST(GeneratorProfile, arithmeticFunctions)
     EXPECT_EQ(value, generatorProfile->notFunctionString());
     EXPECT_EQ(value, generatorProfile->minFunctionString());
     EXPECT_EQ(value, generatorProfile->maxFunctionString());
+    EXPECT_EQ(value, generatorProfile->blendFunctionString());
 }
 
 TEST(GeneratorProfile, trigonometricFunctions)
@@ -730,14 +1027,37 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setInterfaceVariableInfoString(value);
     generatorProfile->setImplementationVariableInfoString(value);
 
+    generatorProfile->setInterfaceJacobianSparsityString(value);
+    generatorProfile->setImplementationJacobianSparsityString(value);
+    generatorProfile->setEmptyJacobianColumnIndicesString(value);
+
+    generatorProfile->setInterfaceSensitivityParameterCountString(value);
+    generatorProfile->setImplementationSensitivityParameterCountString(value);
+    generatorProfile->setInterfaceSweepParameterCountString(value);
+    generatorProfile->setImplementationSweepParameterCountString(value);
+    generatorProfile->setInterfaceResetCountString(value);
+    generatorProfile->setImplementationResetCountString(value);
+
     generatorProfile->setVariableInfoEntryString(value);
     generatorProfile->setVariableInfoWithTypeEntryString(value);
 
     generatorProfile->setVoiString(value);
 
+    generatorProfile->setTimeStepString(value);
+
     generatorProfile->setStatesArrayString(value);
     generatorProfile->setRatesArrayString(value);
     generatorProfile->setVariablesArrayString(value);
+    generatorProfile->setJacobianArrayString(value);
+    generatorProfile->setSensitivitiesArrayString(value);
+    generatorProfile->setSensitivityRatesArrayString(value);
+    generatorProfile->setSweepParametersArrayString(value);
+    generatorProfile->setBatchArrayIndexString(value);
+    generatorProfile->setBatchSweepParameterIndexString(value);
+    generatorProfile->setInstanceArrayIndexString(value);
+    generatorProfile->setRootsArrayString(value);
+    generatorProfile->setEventsArrayString(value);
+    generatorProfile->setResetValuesArrayString(value);
 
     generatorProfile->setInterfaceCreateStatesArrayMethodString(value);
     generatorProfile->setImplementationCreateStatesArrayMethodString(value);
@@ -754,12 +1074,60 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setInterfaceComputeComputedConstantsMethodString(value);
     generatorProfile->setImplementationComputeComputedConstantsMethodString(value);
 
+    generatorProfile->setImplementationComputeComputedConstantsMethodChunkString(value);
+    generatorProfile->setComputeComputedConstantsMethodChunkCallString(value);
+
     generatorProfile->setInterfaceComputeRatesMethodString(value);
     generatorProfile->setImplementationComputeRatesMethodString(value);
 
+    generatorProfile->setImplementationComputeRatesMethodChunkString(value);
+    generatorProfile->setComputeRatesMethodChunkCallString(value);
+    generatorProfile->setImplementationComputeRatesMethodKernelString(value);
+    generatorProfile->setComputeRatesMethodKernelCallString(value);
+
     generatorProfile->setInterfaceComputeVariablesMethodString(value);
     generatorProfile->setImplementationComputeVariablesMethodString(value);
 
+    generatorProfile->setImplementationComputeVariablesMethodChunkString(value);
+    generatorProfile->setComputeVariablesMethodChunkCallString(value);
+    generatorProfile->setImplementationComputeVariablesMethodKernelString(value);
+    generatorProfile->setComputeVariablesMethodKernelCallString(value);
+
+    generatorProfile->setParallelRegionString(value);
+    generatorProfile->setParallelLevelString(value);
+    generatorProfile->setParallelTaskString(value);
+
+    generatorProfile->setInterfaceComputeJacobianMethodString(value);
+    generatorProfile->setImplementationComputeJacobianMethodString(value);
+
+    generatorProfile->setInterfaceComputeRushLarsenStepMethodString(value);
+    generatorProfile->setImplementationComputeRushLarsenStepMethodString(value);
+
+    generatorProfile->setRushLarsenExponentString(value);
+    generatorProfile->setImplementationRushLarsenExponentString(value);
+
+    generatorProfile->setInterfaceComputeSensitivityRatesMethodString(value);
+    generatorProfile->setImplementationComputeSensitivityRatesMethodString(value);
+    generatorProfile->setInterfaceInitializeStatesAndConstantsBatchMethodString(value);
+    generatorProfile->setImplementationInitializeStatesAndConstantsBatchMethodString(value);
+    generatorProfile->setInterfaceComputeRatesBatchMethodString(value);
+    generatorProfile->setImplementationComputeRatesBatchMethodString(value);
+    generatorProfile->setInterfaceComputeRatesSpecializedMethodString(value);
+    generatorProfile->setImplementationComputeRatesSpecializedMethodString(value);
+    generatorProfile->setInterfaceComputeVariablesSpecializedMethodString(value);
+    generatorProfile->setImplementationComputeVariablesSpecializedMethodString(value);
+    generatorProfile->setInterfaceComputeRootsMethodString(value);
+    generatorProfile->setImplementationComputeRootsMethodString(value);
+    generatorProfile->setInterfaceApplyResetsMethodString(value);
+    generatorProfile->setImplementationApplyResetsMethodString(value);
+
+    generatorProfile->setLookupTableArgumentString(value);
+    generatorProfile->setImplementationLookupTableString(value);
+    generatorProfile->setImplementationComputeLookupTableMethodString(value);
+    generatorProfile->setComputeLookupTableCallString(value);
+    generatorProfile->setLookupTableEntryString(value);
+    generatorProfile->setLookupTableValueString(value);
+
     generatorProfile->setEmptyMethodString(value);
 
     generatorProfile->setIndentString(value);
@@ -770,6 +1138,8 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setOpenArrayString(value);
     generatorProfile->setCloseArrayString(value);
 
+    generatorProfile->setComputeCastString(value);
+
     generatorProfile->setArrayElementSeparatorString(value);
 
     generatorProfile->setStringDelimiterString(value);
@@ -814,14 +1184,37 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->interfaceVariableInfoString());
     EXPECT_EQ(value, generatorProfile->implementationVariableInfoString());
 
+    EXPECT_EQ(value, generatorProfile->interfaceJacobianSparsityString());
+    EXPECT_EQ(value, generatorProfile->implementationJacobianSparsityString());
+    EXPECT_EQ(value, generatorProfile->emptyJacobianColumnIndicesString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceSensitivityParameterCountString());
+    EXPECT_EQ(value, generatorProfile->implementationSensitivityParameterCountString());
+    EXPECT_EQ(value, generatorProfile->interfaceSweepParameterCountString());
+    EXPECT_EQ(value, generatorProfile->implementationSweepParameterCountString());
+    EXPECT_EQ(value, generatorProfile->interfaceResetCountString());
+    EXPECT_EQ(value, generatorProfile->implementationResetCountString());
+
     EXPECT_EQ(value, generatorProfile->variableInfoEntryString());
     EXPECT_EQ(value, generatorProfile->variableInfoWithTypeEntryString());
 
     EXPECT_EQ(value, generatorProfile->voiString());
 
+    EXPECT_EQ(value, generatorProfile->timeStepString());
+
     EXPECT_EQ(value, generatorProfile->statesArrayString());
     EXPECT_EQ(value, generatorProfile->ratesArrayString());
     EXPECT_EQ(value, generatorProfile->variablesArrayString());
+    EXPECT_EQ(value, generatorProfile->jacobianArrayString());
+    EXPECT_EQ(value, generatorProfile->sensitivitiesArrayString());
+    EXPECT_EQ(value, generatorProfile->sensitivityRatesArrayString());
+    EXPECT_EQ(value, generatorProfile->sweepParametersArrayString());
+    EXPECT_EQ(value, generatorProfile->batchArrayIndexString());
+    EXPECT_EQ(value, generatorProfile->batchSweepParameterIndexString());
+    EXPECT_EQ(value, generatorProfile->instanceArrayIndexString());
+    EXPECT_EQ(value, generatorProfile->rootsArrayString());
+    EXPECT_EQ(value, generatorProfile->eventsArrayString());
+    EXPECT_EQ(value, generatorProfile->resetValuesArrayString());
 
     EXPECT_EQ(value, generatorProfile->interfaceCreateStatesArrayMethodString());
     EXPECT_EQ(value, generatorProfile->implementationCreateStatesArrayMethodString());
@@ -838,12 +1231,60 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->interfaceComputeComputedConstantsMethodString());
     EXPECT_EQ(value, generatorProfile->implementationComputeComputedConstantsMethodString());
 
+    EXPECT_EQ(value, generatorProfile->implementationComputeComputedConstantsMethodChunkString());
+    EXPECT_EQ(value, generatorProfile->computeComputedConstantsMethodChunkCallString());
+
     EXPECT_EQ(value, generatorProfile->interfaceComputeRatesMethodString());
     EXPECT_EQ(value, generatorProfile->implementationComputeRatesMethodString());
 
+    EXPECT_EQ(value, generatorProfile->implementationComputeRatesMethodChunkString());
+    EXPECT_EQ(value, generatorProfile->computeRatesMethodChunkCallString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeRatesMethodKernelString());
+    EXPECT_EQ(value, generatorProfile->computeRatesMethodKernelCallString());
+
     EXPECT_EQ(value, generatorProfile->interfaceComputeVariablesMethodString());
     EXPECT_EQ(value, generatorProfile->implementationComputeVariablesMethodString());
 
+    EXPECT_EQ(value, generatorProfile->implementationComputeVariablesMethodChunkString());
+    EXPECT_EQ(value, generatorProfile->computeVariablesMethodChunkCallString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeVariablesMethodKernelString());
+    EXPECT_EQ(value, generatorProfile->computeVariablesMethodKernelCallString());
+
+    EXPECT_EQ(value, generatorProfile->parallelRegionString());
+    EXPECT_EQ(value, generatorProfile->parallelLevelString());
+    EXPECT_EQ(value, generatorProfile->parallelTaskString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceComputeJacobianMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeJacobianMethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceComputeRushLarsenStepMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeRushLarsenStepMethodString());
+
+    EXPECT_EQ(value, generatorProfile->rushLarsenExponentString());
+    EXPECT_EQ(value, generatorProfile->implementationRushLarsenExponentString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceComputeSensitivityRatesMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeSensitivityRatesMethodString());
+    EXPECT_EQ(value, generatorProfile->interfaceInitializeStatesAndConstantsBatchMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationInitializeStatesAndConstantsBatchMethodString());
+    EXPECT_EQ(value, generatorProfile->interfaceComputeRatesBatchMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeRatesBatchMethodString());
+    EXPECT_EQ(value, generatorProfile->interfaceComputeRatesSpecializedMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeRatesSpecializedMethodString());
+    EXPECT_EQ(value, generatorProfile->interfaceComputeVariablesSpecializedMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeVariablesSpecializedMethodString());
+    EXPECT_EQ(value, generatorProfile->interfaceComputeRootsMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeRootsMethodString());
+    EXPECT_EQ(value, generatorProfile->interfaceApplyResetsMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationApplyResetsMethodString());
+
+    EXPECT_EQ(value, generatorProfile->lookupTableArgumentString());
+    EXPECT_EQ(value, generatorProfile->implementationLookupTableString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeLookupTableMethodString());
+    EXPECT_EQ(value, generatorProfile->computeLookupTableCallString());
+    EXPECT_EQ(value, generatorProfile->lookupTableEntryString());
+    EXPECT_EQ(value, generatorProfile->lookupTableValueString());
+
     EXPECT_EQ(value, generatorProfile->emptyMethodString());
 
     EXPECT_EQ(value, generatorProfile->indentString());
@@ -854,6 +1295,8 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->openArrayString());
     EXPECT_EQ(value, generatorProfile->closeArrayString());
 
+    EXPECT_EQ(value, generatorProfile->computeCastString());
+
     EXPECT_EQ(value, generatorProfile->arrayElementSeparatorString());
 
     EXPECT_EQ(value, generatorProfile->stringDelimiterString());
@@ -0,0 +1,192 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <vector>
+
+// Use the code generated for a leaky integrate-and-fire neuron to check that
+// its roots and resets can be used to simulate it, including when they involve
+// algebraic variables.
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wunused-parameter"
+#elif defined(_MSC_VER)
+#    pragma warning(push)
+#    pragma warning(disable : 4100)
+#endif
+
+namespace iaf {
+#include "../resources/generator/integrate_and_fire/model.c"
+} // namespace iaf
+
+namespace iafa {
+#include "../resources/generator/integrate_and_fire_with_algebraic_resets/model.c"
+} // namespace iafa
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#    pragma warning(pop)
+#endif
+
+TEST(GeneratorResets, applyResets)
+{
+    // Resets are applied using the values from before any reset, with the
+    // reset of lowest order taking precedence.
+
+    std::vector<double> states(iaf::STATE_COUNT);
+    std::vector<double> variables(iaf::VARIABLE_COUNT);
+    std::vector<int> events(iaf::RESET_COUNT);
+
+    iaf::initializeStatesAndConstants(states.data(), variables.data());
+
+    states[0] = -50.0;
+    states[1] = 3.0;
+
+    iaf::applyResets(100.0, states.data(), variables.data(), events.data());
+
+    EXPECT_EQ(-50.0, states[0]);
+    EXPECT_EQ(3.0, states[1]);
+
+    for (auto &event : events) {
+        event = 1;
+    }
+
+    iaf::applyResets(100.0, states.data(), variables.data(), events.data());
+
+    EXPECT_EQ(-75.0, states[0]);
+    EXPECT_EQ(4.0, states[1]);
+
+    events[0] = 0;
+    events[1] = 0;
+
+    iaf::applyResets(100.0, states.data(), variables.data(), events.data());
+
+    EXPECT_EQ(-70.0, states[0]);
+    EXPECT_EQ(4.0, states[1]);
+}
+
+TEST(GeneratorResets, simulation)
+{
+    // Integrate our model using forward Euler and apply a reset whenever its
+    // root goes from negative to non-negative. Our membrane potential relaxes
+    // towards -45 mV with a time constant of 10 ms, so it reaches -50 mV after
+    // 10*ln(5) ms and then every 10*ln(6) ms, i.e. 5 times within 100 ms, at
+    // which point it gets reset to -70 mV.
+
+    static const double END_TIME = 100.5;
+    static const double DT = 0.001;
+
+    std::vector<double> states(iaf::STATE_COUNT);
+    std::vector<double> rates(iaf::STATE_COUNT);
+    std::vector<double> variables(iaf::VARIABLE_COUNT);
+    std::vector<double> roots(iaf::RESET_COUNT);
+    std::vector<double> oldRoots(iaf::RESET_COUNT);
+    std::vector<int> events(iaf::RESET_COUNT);
+    std::vector<double> firstCrossingTimes;
+
+    iaf::initializeStatesAndConstants(states.data(), variables.data());
+    iaf::computeComputedConstants(variables.data());
+    iaf::computeRoots(0.0, states.data(), variables.data(), oldRoots.data());
+
+    auto stepCount = static_cast<size_t>(std::lround(END_TIME / DT));
+
+    for (size_t step = 1; step <= stepCount; ++step) {
+        double voi = static_cast<double>(step) * DT;
+
+        iaf::computeRates(voi, states.data(), rates.data(), variables.data());
+
+        for (size_t i = 0; i < iaf::STATE_COUNT; ++i) {
+            states[i] += DT * rates[i];
+        }
+
+        iaf::computeRoots(voi, states.data(), variables.data(), roots.data());
+
+        bool hasEvents = false;
+
+        for (size_t i = 0; i < iaf::RESET_COUNT; ++i) {
+            events[i] = (oldRoots[i] < 0.0) && (roots[i] >= 0.0);
+            hasEvents = hasEvents || (events[i] != 0);
+        }
+
+        if (hasEvents) {
+            if (events[0] != 0) {
+                firstCrossingTimes.push_back(voi);
+            }
+
+            iaf::applyResets(voi, states.data(), variables.data(), events.data());
+            iaf::computeRoots(voi, states.data(), variables.data(), roots.data());
+        }
+
+        oldRoots = roots;
+    }
+
+    ASSERT_EQ(size_t(5), firstCrossingTimes.size());
+    EXPECT_NEAR(10.0 * std::log(5.0), firstCrossingTimes[0], 0.01);
+    EXPECT_NEAR(10.0 * std::log(5.0) + 40.0 * std::log(6.0), firstCrossingTimes[4], 0.05);
+    EXPECT_EQ(5.0, states[1]);
+    EXPECT_NEAR(-70.0 + 25.0 * (1.0 - std::exp(-0.05)), states[0], 0.01);
+}
+
+TEST(GeneratorResets, algebraicVariables)
+{
+    // Our roots and reset values depend on algebraic variables, which must be
+    // computed from our current states rather than be read from our variables
+    // array, i.e. even if computeVariables() has not been called.
+
+    std::vector<double> states(iafa::STATE_COUNT);
+    std::vector<double> variables(iafa::VARIABLE_COUNT);
+    std::vector<double> roots(iafa::RESET_COUNT);
+    std::vector<int> events(iafa::RESET_COUNT);
+
+    iafa::initializeStatesAndConstants(states.data(), variables.data());
+    iafa::computeComputedConstants(variables.data());
+
+    states[0] = -50.0;
+    states[1] = 2.0;
+
+    iafa::computeRoots(0.0, states.data(), variables.data(), roots.data());
+
+    EXPECT_EQ(0.0, roots[0]);
+    EXPECT_EQ(0.0, roots[1]);
+
+    states[0] = -40.0;
+
+    iafa::computeRoots(0.0, states.data(), variables.data(), roots.data());
+
+    EXPECT_EQ(10.0, roots[0]);
+    EXPECT_EQ(10.0, roots[1]);
+
+    for (auto &event : events) {
+        event = 1;
+    }
+
+    iafa::applyResets(0.0, states.data(), variables.data(), events.data());
+
+    EXPECT_EQ(-77.0, states[0]);
+    EXPECT_EQ(3.0, states[1]);
+
+    iafa::applyResets(0.0, states.data(), variables.data(), events.data());
+
+    EXPECT_EQ(-78.0, states[0]);
+    EXPECT_EQ(4.0, states[1]);
+}
@@ -0,0 +1,160 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+// Use the code generated for the Hodgkin-Huxley model, with a Rush-Larsen step,
+// to check that, at a large time step, a Rush-Larsen step remains both stable
+// and accurate while forward Euler doesn't.
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wunused-parameter"
+#elif defined(_MSC_VER)
+#    pragma warning(push)
+#    pragma warning(disable : 4100)
+#endif
+
+namespace hh {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.rush.larsen.c"
+} // namespace hh
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#    pragma warning(pop)
+#endif
+
+static const double END_TIME = 30.0;
+static const size_t MEMBRANE_POTENTIAL = 3;
+
+struct Trajectory
+{
+    double peak = 0.0; // The membrane potential is negative during an action potential.
+    double peakTime = 0.0;
+    double finalPotential = 0.0;
+};
+
+static Trajectory simulate(bool rushLarsen, double dt)
+{
+    double *states = hh::createStatesArray();
+    double *rates = hh::createStatesArray();
+    double *variables = hh::createVariablesArray();
+    Trajectory res;
+
+    hh::initializeStatesAndConstants(states, variables);
+    hh::computeComputedConstants(variables);
+
+    auto stepCount = static_cast<size_t>(std::lround(END_TIME / dt));
+
+    for (size_t i = 0; i < stepCount; ++i) {
+        double voi = static_cast<double>(i) * dt;
+
+        if (rushLarsen) {
+            hh::computeRushLarsenStep(voi, dt, states, variables);
+        } else {
+            hh::computeRates(voi, states, rates, variables);
+
+            for (size_t j = 0; j < hh::STATE_COUNT; ++j) {
+                states[j] += dt * rates[j];
+            }
+        }
+
+        if (states[MEMBRANE_POTENTIAL] < res.peak) {
+            res.peak = states[MEMBRANE_POTENTIAL];
+            res.peakTime = voi + dt;
+        }
+    }
+
+    res.finalPotential = states[MEMBRANE_POTENTIAL];
+
+    hh::deleteArray(states);
+    hh::deleteArray(rates);
+    hh::deleteArray(variables);
+
+    return res;
+}
+
+TEST(GeneratorRushLarsen, hodgkinHuxleySquidAxonModel1952Trajectory)
+{
+    // Reference solution, using forward Euler with a small time step.
+
+    Trajectory reference = simulate(false, 0.001);
+
+    EXPECT_NEAR(-104.5, reference.peak, 0.5);
+
+    // At a small time step, a Rush-Larsen step and forward Euler agree with
+    // our reference solution.
+
+    Trajectory euler = simulate(false, 0.01);
+    Trajectory rushLarsen = simulate(true, 0.01);
+
+    EXPECT_NEAR(reference.peak, euler.peak, 0.5);
+    EXPECT_NEAR(reference.peak, rushLarsen.peak, 0.5);
+    EXPECT_NEAR(reference.peakTime, rushLarsen.peakTime, 0.05);
+    EXPECT_NEAR(reference.finalPotential, rushLarsen.finalPotential, 0.01);
+
+    // At a time step that is ten times larger, forward Euler blows up while a
+    // Rush-Larsen step still gives an accurate action potential.
+
+    euler = simulate(false, 0.1);
+    rushLarsen = simulate(true, 0.1);
+
+    EXPECT_FALSE(std::isfinite(euler.finalPotential));
+    EXPECT_NEAR(reference.peak, rushLarsen.peak, 0.02 * std::fabs(reference.peak));
+    EXPECT_NEAR(reference.peakTime, rushLarsen.peakTime, 0.5);
+    EXPECT_NEAR(reference.finalPotential, rushLarsen.finalPotential, 0.05);
+}
+
+TEST(GeneratorRushLarsen, hodgkinHuxleySquidAxonModel1952ZeroTimeStep)
+{
+    // A zero time step must leave our states unchanged rather than make them
+    // NaN, and so must (almost) a time step so small that exp(b*dt)-1 cancels
+    // out.
+
+    double *states = hh::createStatesArray();
+    double *initialStates = hh::createStatesArray();
+    double *variables = hh::createVariablesArray();
+
+    hh::initializeStatesAndConstants(states, variables);
+    hh::computeComputedConstants(variables);
+
+    for (size_t i = 0; i < hh::STATE_COUNT; ++i) {
+        initialStates[i] = states[i];
+    }
+
+    hh::computeRushLarsenStep(0.0, 0.0, states, variables);
+
+    for (size_t i = 0; i < hh::STATE_COUNT; ++i) {
+        EXPECT_EQ(initialStates[i], states[i]);
+    }
+
+    hh::computeRushLarsenStep(0.0, 1.0e-300, states, variables);
+
+    for (size_t i = 0; i < hh::STATE_COUNT; ++i) {
+        EXPECT_TRUE(std::isfinite(states[i]));
+        EXPECT_NEAR(initialStates[i], states[i], 1.0e-12);
+    }
+
+    hh::deleteArray(states);
+    hh::deleteArray(initialStates);
+    hh::deleteArray(variables);
+}
@@ -0,0 +1,191 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <cstring>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <vector>
+
+// Use the code generated for the Hodgkin-Huxley model, with the maximum sodium
+// conductance and the resting potential as sensitivity parameters, to check
+// that the generated sensitivity rates match finite differences.
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wunused-parameter"
+#elif defined(_MSC_VER)
+#    pragma warning(push)
+#    pragma warning(disable : 4100)
+#endif
+
+namespace hhs {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.sensitivities.c"
+} // namespace hhs
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#    pragma warning(pop)
+#endif
+
+static const double VOI = 10.25;
+static const double STEP = 1.0e-6;
+
+static std::vector<size_t> sensitivityParameterIndices()
+{
+    std::vector<size_t> res;
+
+    for (const auto &name : {"g_Na", "E_R"}) {
+        for (size_t i = 0; i < hhs::VARIABLE_COUNT; ++i) {
+            if (strcmp(hhs::VARIABLE_INFO[i].name, name) == 0) {
+                res.push_back(i);
+
+                break;
+            }
+        }
+    }
+
+    return res;
+}
+
+static std::vector<double> rates(const std::vector<double> &states, size_t parameterIndex, double parameterDelta)
+{
+    std::vector<double> statesCopy(states);
+    std::vector<double> res(hhs::STATE_COUNT);
+    std::vector<double> dummyStates(hhs::STATE_COUNT);
+    std::vector<double> variables(hhs::VARIABLE_COUNT);
+
+    hhs::initializeStatesAndConstants(dummyStates.data(), variables.data());
+
+    variables[parameterIndex] += parameterDelta;
+
+    hhs::computeComputedConstants(variables.data());
+    hhs::computeRates(VOI, statesCopy.data(), res.data(), variables.data());
+
+    return res;
+}
+
+TEST(GeneratorSensitivities, sensitivityRatesMatchFiniteDifferences)
+{
+    auto parameterIndices = sensitivityParameterIndices();
+
+    ASSERT_EQ(hhs::SENSITIVITY_PARAMETER_COUNT, parameterIndices.size());
+
+    std::vector<double> states(hhs::STATE_COUNT);
+    std::vector<double> variables(hhs::VARIABLE_COUNT);
+    std::vector<double> sensitivities(hhs::SENSITIVITY_PARAMETER_COUNT * hhs::STATE_COUNT);
+    std::vector<double> sensitivityRates(hhs::SENSITIVITY_PARAMETER_COUNT * hhs::STATE_COUNT);
+
+    hhs::initializeStatesAndConstants(states.data(), variables.data());
+    hhs::computeComputedConstants(variables.data());
+
+    states[3] = -12.5; // Away from the resting potential.
+
+    for (size_t i = 0; i < sensitivities.size(); ++i) {
+        sensitivities[i] = 0.1 * static_cast<double>(i % hhs::STATE_COUNT + 1);
+    }
+
+    hhs::computeSensitivityRates(VOI, states.data(), sensitivities.data(), sensitivityRates.data(), variables.data());
+
+    // dS/dt = J.S+df/dp is the directional derivative of our rates along
+    // (S, 1) in the (states, parameter) space, which we can approximate using
+    // central differences.
+
+    for (size_t k = 0; k < hhs::SENSITIVITY_PARAMETER_COUNT; ++k) {
+        std::vector<double> forwardStates(states);
+        std::vector<double> backwardStates(states);
+
+        for (size_t i = 0; i < hhs::STATE_COUNT; ++i) {
+            forwardStates[i] += STEP * sensitivities[k * hhs::STATE_COUNT + i];
+            backwardStates[i] -= STEP * sensitivities[k * hhs::STATE_COUNT + i];
+        }
+
+        auto forwardRates = rates(forwardStates, parameterIndices[k], STEP);
+        auto backwardRates = rates(backwardStates, parameterIndices[k], -STEP);
+
+        for (size_t i = 0; i < hhs::STATE_COUNT; ++i) {
+            double expectedSensitivityRate = (forwardRates[i] - backwardRates[i]) / (2.0 * STEP);
+            double sensitivityRate = sensitivityRates[k * hhs::STATE_COUNT + i];
+
+            EXPECT_NEAR(expectedSensitivityRate, sensitivityRate, 1.0e-5 * std::max(1.0, std::fabs(sensitivityRate)));
+        }
+    }
+}
+
+TEST(GeneratorSensitivities, integratedSensitivitiesMatchFiniteDifferences)
+{
+    // Integrating our states and sensitivities using forward Euler gives the
+    // exact derivatives of the integrated states with respect to our
+    // parameters, so they should match finite differences of two simulations.
+
+    static const double END_TIME = 5.0;
+    static const double DT = 0.01;
+
+    auto parameterIndices = sensitivityParameterIndices();
+    auto stepCount = static_cast<size_t>(std::lround(END_TIME / DT));
+    auto simulate = [&](size_t parameterIndex, double parameterDelta, std::vector<double> *sensitivities) {
+        std::vector<double> states(hhs::STATE_COUNT);
+        std::vector<double> rates(hhs::STATE_COUNT);
+        std::vector<double> variables(hhs::VARIABLE_COUNT);
+        std::vector<double> sensitivityRates(hhs::SENSITIVITY_PARAMETER_COUNT * hhs::STATE_COUNT);
+
+        hhs::initializeStatesAndConstants(states.data(), variables.data());
+
+        variables[parameterIndex] += parameterDelta;
+
+        hhs::computeComputedConstants(variables.data());
+
+        for (size_t step = 0; step < stepCount; ++step) {
+            double voi = static_cast<double>(step) * DT;
+
+            hhs::computeRates(voi, states.data(), rates.data(), variables.data());
+
+            if (sensitivities != nullptr) {
+                hhs::computeSensitivityRates(voi, states.data(), sensitivities->data(), sensitivityRates.data(), variables.data());
+
+                for (size_t i = 0; i < sensitivities->size(); ++i) {
+                    (*sensitivities)[i] += DT * sensitivityRates[i];
+                }
+            }
+
+            for (size_t i = 0; i < hhs::STATE_COUNT; ++i) {
+                states[i] += DT * rates[i];
+            }
+        }
+
+        return states;
+    };
+
+    std::vector<double> sensitivities(hhs::SENSITIVITY_PARAMETER_COUNT * hhs::STATE_COUNT);
+
+    simulate(parameterIndices[0], 0.0, &sensitivities);
+
+    for (size_t k = 0; k < hhs::SENSITIVITY_PARAMETER_COUNT; ++k) {
+        auto forwardStates = simulate(parameterIndices[k], STEP, nullptr);
+        auto backwardStates = simulate(parameterIndices[k], -STEP, nullptr);
+
+        for (size_t i = 0; i < hhs::STATE_COUNT; ++i) {
+            double expectedSensitivity = (forwardStates[i] - backwardStates[i]) / (2.0 * STEP);
+            double sensitivity = sensitivities[k * hhs::STATE_COUNT + i];
+
+            EXPECT_NEAR(expectedSensitivity, sensitivity, 1.0e-4 * std::max(1.0, std::fabs(sensitivity)));
+        }
+    }
+}
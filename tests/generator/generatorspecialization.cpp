@@ -0,0 +1,76 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <vector>
+
+// Use the code generated for the Hodgkin-Huxley model, with specialised
+// methods, to check that those methods give the same results as the generic
+// ones.
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wunused-parameter"
+#elif defined(_MSC_VER)
+#    pragma warning(push)
+#    pragma warning(disable : 4100)
+#endif
+
+namespace hhz {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.specialized.c"
+} // namespace hhz
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#    pragma warning(pop)
+#endif
+
+static const double VOI = 10.25;
+
+TEST(GeneratorSpecialization, specializedMethodsMatchGenericMethods)
+{
+    std::vector<double> states(hhz::STATE_COUNT);
+    std::vector<double> rates(hhz::STATE_COUNT);
+    std::vector<double> variables(hhz::VARIABLE_COUNT);
+
+    hhz::initializeStatesAndConstants(states.data(), variables.data());
+    hhz::computeComputedConstants(variables.data());
+
+    states[3] = -12.5; // Away from the resting potential.
+
+    std::vector<double> specializedStates(states);
+    std::vector<double> specializedRates(hhz::STATE_COUNT);
+    std::vector<double> specializedVariables(variables);
+
+    hhz::computeRates(VOI, states.data(), rates.data(), variables.data());
+    hhz::computeVariables(VOI, states.data(), rates.data(), variables.data());
+
+    hhz::computeRatesSpecialized(VOI, specializedStates.data(), specializedRates.data(), specializedVariables.data());
+    hhz::computeVariablesSpecialized(VOI, specializedStates.data(), specializedRates.data(), specializedVariables.data());
+
+    for (size_t i = 0; i < hhz::STATE_COUNT; ++i) {
+        EXPECT_DOUBLE_EQ(rates[i], specializedRates[i]);
+    }
+
+    for (size_t i = 0; i < hhz::VARIABLE_COUNT; ++i) {
+        EXPECT_DOUBLE_EQ(variables[i], specializedVariables[i]);
+    }
+}
@@ -0,0 +1,122 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <vector>
+
+// Use the code generated for the Hodgkin-Huxley model, with the maximum sodium
+// conductance and the resting potential as sweep parameters, to check that the
+// batch methods give the same results as the scalar ones for each instance.
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wunused-parameter"
+#elif defined(_MSC_VER)
+#    pragma warning(push)
+#    pragma warning(disable : 4068 4100)
+#endif
+
+namespace hhw {
+#include "../resources/generator/hodgkin_huxley_squid_axon_model_1952/model.sweep.c"
+} // namespace hhw
+
+#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#    pragma warning(pop)
+#endif
+
+static const double VOI = 10.25;
+static const size_t INSTANCE_COUNT = 5;
+
+static size_t variableIndex(const char *name)
+{
+    for (size_t i = 0; i < hhw::VARIABLE_COUNT; ++i) {
+        if (strcmp(hhw::VARIABLE_INFO[i].name, name) == 0) {
+            return i;
+        }
+    }
+
+    return hhw::VARIABLE_COUNT;
+}
+
+TEST(GeneratorSweep, batchMethodsMatchScalarMethods)
+{
+    ASSERT_EQ(size_t(2), hhw::SWEEP_PARAMETER_COUNT);
+
+    size_t parameterIndices[] = {variableIndex("g_Na"), variableIndex("E_R")};
+
+    ASSERT_NE(hhw::VARIABLE_COUNT, parameterIndices[0]);
+    ASSERT_NE(hhw::VARIABLE_COUNT, parameterIndices[1]);
+
+    // Our parameters are stored instance by instance while our states, rates
+    // and variables are stored state/variable by state/variable.
+
+    std::vector<double> parameters(INSTANCE_COUNT * hhw::SWEEP_PARAMETER_COUNT);
+    std::vector<double> batchStates(INSTANCE_COUNT * hhw::STATE_COUNT);
+    std::vector<double> batchRates(INSTANCE_COUNT * hhw::STATE_COUNT);
+    std::vector<double> batchVariables(INSTANCE_COUNT * hhw::VARIABLE_COUNT);
+
+    for (size_t i = 0; i < INSTANCE_COUNT; ++i) {
+        parameters[i * hhw::SWEEP_PARAMETER_COUNT] = 60.0 + 20.0 * static_cast<double>(i);
+        parameters[i * hhw::SWEEP_PARAMETER_COUNT + 1] = -5.0 + 2.5 * static_cast<double>(i);
+    }
+
+    hhw::initializeStatesAndConstantsBatch(INSTANCE_COUNT, parameters.data(), batchStates.data(), batchVariables.data());
+
+    for (size_t i = 0; i < INSTANCE_COUNT; ++i) {
+        batchStates[3 * INSTANCE_COUNT + i] = -12.5 + static_cast<double>(i);
+    }
+
+    hhw::computeRatesBatch(INSTANCE_COUNT, VOI, parameters.data(), batchStates.data(), batchRates.data(), batchVariables.data());
+
+    for (size_t i = 0; i < INSTANCE_COUNT; ++i) {
+        std::vector<double> states(hhw::STATE_COUNT);
+        std::vector<double> rates(hhw::STATE_COUNT);
+        std::vector<double> variables(hhw::VARIABLE_COUNT);
+
+        hhw::initializeStatesAndConstants(states.data(), variables.data());
+
+        for (size_t k = 0; k < hhw::SWEEP_PARAMETER_COUNT; ++k) {
+            variables[parameterIndices[k]] = parameters[i * hhw::SWEEP_PARAMETER_COUNT + k];
+        }
+
+        hhw::computeComputedConstants(variables.data());
+
+        states[3] = -12.5 + static_cast<double>(i);
+
+        hhw::computeRates(VOI, states.data(), rates.data(), variables.data());
+
+        for (size_t j = 0; j < hhw::STATE_COUNT; ++j) {
+            EXPECT_DOUBLE_EQ(states[j], batchStates[j * INSTANCE_COUNT + i]);
+            EXPECT_DOUBLE_EQ(rates[j], batchRates[j * INSTANCE_COUNT + i]);
+        }
+
+        // Only our computed constants and algebraic variables are computed by
+        // our batch methods.
+
+        for (size_t j = 0; j < hhw::VARIABLE_COUNT; ++j) {
+            if (hhw::VARIABLE_INFO[j].type != hhw::CONSTANT) {
+                EXPECT_DOUBLE_EQ(variables[j], batchVariables[j * INSTANCE_COUNT + i]);
+            }
+        }
+    }
+}
@@ -0,0 +1,122 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <regex>
+#include <set>
+#include <vector>
+
+#include <libcellml>
+
+// Estimate the number of cache misses caused by a call to the generated method
+// to compute the rates, and this by replaying the sequence of array accesses
+// in that method against a cache line model, rather than by timing it, so that
+// the results are deterministic.
+
+static const size_t CACHE_LINE_SIZE = 64 / sizeof(double);
+
+struct CacheStatistics
+{
+    size_t mAccessCount = 0;
+    size_t mCacheLineCount = 0; // Number of distinct cache lines touched.
+    size_t mCacheLineSwitchCount = 0; // Number of times the accessed cache line changes.
+};
+
+static CacheStatistics computeRatesCacheStatistics(const std::string &modelFileName,
+                                                   libcellml::Generator::VariableOrdering variableOrdering)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents(modelFileName));
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->setVariableOrdering(variableOrdering);
+    generator->processModel(model);
+
+    std::string implementationCode = generator->implementationCode();
+    size_t begin = implementationCode.find("void computeRates(");
+    size_t end = implementationCode.find("\n}\n", begin);
+    std::string computeRatesCode = implementationCode.substr(begin, end - begin);
+
+    static const std::regex ARRAY_ACCESS_REGEX("(states|rates|variables)\\[([0-9]+)\\]");
+
+    CacheStatistics res;
+    std::set<std::pair<std::string, size_t>> cacheLines;
+    std::pair<std::string, size_t> previousCacheLine;
+
+    for (std::sregex_iterator iter(computeRatesCode.begin(), computeRatesCode.end(), ARRAY_ACCESS_REGEX), endIter; iter != endIter; ++iter) {
+        std::pair<std::string, size_t> cacheLine((*iter)[1].str(), std::stoul((*iter)[2].str()) / CACHE_LINE_SIZE);
+
+        ++res.mAccessCount;
+
+        if ((res.mAccessCount == 1) || (cacheLine != previousCacheLine)) {
+            ++res.mCacheLineSwitchCount;
+        }
+
+        cacheLines.insert(cacheLine);
+
+        previousCacheLine = cacheLine;
+    }
+
+    res.mCacheLineCount = cacheLines.size();
+
+    return res;
+}
+
+static void checkVariableOrdering(const std::string &modelFileName,
+                                  size_t accessCount,
+                                  const std::vector<size_t> &cacheLineCounts,
+                                  const std::vector<size_t> &cacheLineSwitchCounts)
+{
+    // Check the statistics for the default, first use and first use by
+    // component orderings, in that order.
+
+    auto defaultStatistics = computeRatesCacheStatistics(modelFileName, libcellml::Generator::VariableOrdering::DEFAULT);
+    auto firstUseStatistics = computeRatesCacheStatistics(modelFileName, libcellml::Generator::VariableOrdering::FIRST_USE);
+    auto firstUseByComponentStatistics = computeRatesCacheStatistics(modelFileName, libcellml::Generator::VariableOrdering::FIRST_USE_BY_COMPONENT);
+
+    EXPECT_EQ(accessCount, defaultStatistics.mAccessCount);
+    EXPECT_EQ(cacheLineCounts[0], defaultStatistics.mCacheLineCount);
+    EXPECT_EQ(cacheLineCounts[1], firstUseStatistics.mCacheLineCount);
+    EXPECT_EQ(cacheLineCounts[2], firstUseByComponentStatistics.mCacheLineCount);
+    EXPECT_EQ(cacheLineSwitchCounts[0], defaultStatistics.mCacheLineSwitchCount);
+    EXPECT_EQ(cacheLineSwitchCounts[1], firstUseStatistics.mCacheLineSwitchCount);
+    EXPECT_EQ(cacheLineSwitchCounts[2], firstUseByComponentStatistics.mCacheLineSwitchCount);
+
+    // The ordering of our states and variables doesn't change the number of
+    // array accesses, but it shouldn't increase the number of cache lines that
+    // are touched.
+
+    EXPECT_EQ(defaultStatistics.mAccessCount, firstUseStatistics.mAccessCount);
+    EXPECT_EQ(defaultStatistics.mAccessCount, firstUseByComponentStatistics.mAccessCount);
+    EXPECT_LE(firstUseStatistics.mCacheLineCount, defaultStatistics.mCacheLineCount);
+    EXPECT_LE(firstUseByComponentStatistics.mCacheLineCount, defaultStatistics.mCacheLineCount);
+    EXPECT_LT(firstUseStatistics.mCacheLineSwitchCount, defaultStatistics.mCacheLineSwitchCount);
+}
+
+TEST(GeneratorVariableOrdering, garnyKohlHunterBoyettNobleRabbitSanModel2003)
+{
+    checkVariableOrdering("generator/garny_kohl_hunter_boyett_noble_rabbit_san_model_2003/model.cellml",
+                          359, {21, 16, 16}, {264, 239, 249});
+}
+
+TEST(GeneratorVariableOrdering, fabbriFantiniWildersSeveriHumanSanModel2017)
+{
+    checkVariableOrdering("generator/fabbri_fantini_wilders_severi_human_san_model_2017/model.cellml",
+                          678, {38, 35, 35}, {571, 487, 503});
+}
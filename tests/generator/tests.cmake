@@ -6,4 +6,20 @@ list(APPEND LIBCELLML_TESTS ${CURRENT_TEST})
 set(${CURRENT_TEST}_SRCS
   ${CMAKE_CURRENT_LIST_DIR}/generator.cpp
   ${CMAKE_CURRENT_LIST_DIR}/generatorprofile.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/generatorlookuptable.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/generatorrushlarsen.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/generatorvariableordering.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/generatorsensitivities.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/generatorsweep.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/generatorspecialization.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/generatorinstances.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/generatorresets.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/generatorprecision.cpp
 )
+
+# The batch methods of the generated code that we test use OpenMP pragmas,
+# which are to be ignored when OpenMP is not enabled.
+if(CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+  set_source_files_properties(${CMAKE_CURRENT_LIST_DIR}/generatorsweep.cpp
+    PROPERTIES COMPILE_OPTIONS -Wno-unknown-pragmas)
+endif()
@@ -0,0 +1,80 @@
+/* The content of this file was generated using a modified C profile of libCellML 0.2.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.1.0.post0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 1;
+const size_t VARIABLE_COUNT = 13;
+
+const VariableInfo VOI_INFO = {"t", "dimensionless", "my_component"};
+
+const VariableInfo STATE_INFO[] = {
+    {"x", "dimensionless", "my_component"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"a", "dimensionless", "my_component", CONSTANT},
+    {"b", "dimensionless", "my_component", CONSTANT},
+    {"c", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"d", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"e", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"f", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"g", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"h", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"i", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"j", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"k", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"l", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"m", "dimensionless", "my_component", ALGEBRAIC}
+};
+
+double * createStatesArray()
+{
+    return (double *) malloc(STATE_COUNT*sizeof(double));
+}
+
+double * createVariablesArray()
+{
+    return (double *) malloc(VARIABLE_COUNT*sizeof(double));
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initializeStatesAndConstants(double *states, double *variables)
+{
+    states[0] = 1.0;
+    variables[0] = 2.0;
+    variables[1] = 3.0;
+    variables[2] = 2.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+    variables[3] = variables[0];
+    variables[4] = variables[0];
+    variables[5] = variables[0]-variables[1];
+    variables[6] = variables[0]-variables[1];
+    variables[7] = variables[0]*variables[0]*variables[0];
+    variables[8] = 1.0/(variables[0]*variables[0]);
+    variables[9] = sqrt(variables[0]);
+    variables[10] = pow(variables[0], 0.3333333333333333);
+    variables[11] = variables[0];
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    rates[0] = -states[0]*states[0]*0.5;
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    variables[12] = states[0]*1.5707963267948966;
+}
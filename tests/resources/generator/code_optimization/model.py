@@ -0,0 +1,79 @@
+# The content of this file was generated using a modified Python profile of libCellML 0.2.0.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.1.0.post0"
+LIBCELLML_VERSION = "0.2.0"
+
+STATE_COUNT = 1
+VARIABLE_COUNT = 13
+
+
+class VariableType(Enum):
+    CONSTANT = 1
+    COMPUTED_CONSTANT = 2
+    ALGEBRAIC = 3
+
+
+VOI_INFO = {"name": "t", "units": "dimensionless", "component": "my_component"}
+
+STATE_INFO = [
+    {"name": "x", "units": "dimensionless", "component": "my_component"}
+]
+
+VARIABLE_INFO = [
+    {"name": "a", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "b", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "c", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "d", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "e", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "f", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "g", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "h", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "i", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "j", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "k", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "l", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "m", "units": "dimensionless", "component": "my_component", "type": VariableType.ALGEBRAIC}
+]
+
+
+def lt_func(x, y):
+    return 1.0 if x < y else 0.0
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+def initialize_states_and_constants(states, variables):
+    states[0] = 1.0
+    variables[0] = 2.0
+    variables[1] = 3.0
+    variables[2] = 2.0
+
+
+def compute_computed_constants(variables):
+    variables[3] = variables[0]
+    variables[4] = variables[0]
+    variables[5] = variables[0]-variables[1]
+    variables[6] = variables[0]-variables[1]
+    variables[7] = variables[0]*variables[0]*variables[0]
+    variables[8] = 1.0/(variables[0]*variables[0])
+    variables[9] = sqrt(variables[0])
+    variables[10] = pow(variables[0], 0.3333333333333333)
+    variables[11] = variables[0]
+
+
+def compute_rates(voi, states, rates, variables):
+    rates[0] = -states[0]*states[0]*0.5
+
+
+def compute_variables(voi, states, rates, variables):
+    variables[12] = states[0]*1.5707963267948966
@@ -0,0 +1,108 @@
+/* The content of this file was generated using the mixed-precision C profile of libCellML 0.2.0. */
+
+#include "model.mixed.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.1.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 4;
+const size_t VARIABLE_COUNT = 18;
+
+const VariableInfo VOI_INFO = {"time", "millisecond", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"m", "dimensionless", "sodium_channel_m_gate"},
+    {"h", "dimensionless", "sodium_channel_h_gate"},
+    {"n", "dimensionless", "potassium_channel_n_gate"},
+    {"V", "millivolt", "membrane"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"g_L", "milliS_per_cm2", "leakage_current", CONSTANT},
+    {"Cm", "microF_per_cm2", "membrane", CONSTANT},
+    {"E_R", "millivolt", "membrane", CONSTANT},
+    {"g_K", "milliS_per_cm2", "potassium_channel", CONSTANT},
+    {"g_Na", "milliS_per_cm2", "sodium_channel", CONSTANT},
+    {"E_L", "millivolt", "leakage_current", COMPUTED_CONSTANT},
+    {"E_Na", "millivolt", "sodium_channel", COMPUTED_CONSTANT},
+    {"E_K", "millivolt", "potassium_channel", COMPUTED_CONSTANT},
+    {"i_Stim", "microA_per_cm2", "membrane", ALGEBRAIC},
+    {"i_L", "microA_per_cm2", "leakage_current", ALGEBRAIC},
+    {"i_Na", "microA_per_cm2", "sodium_channel", ALGEBRAIC},
+    {"alpha_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"beta_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"alpha_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"beta_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"i_K", "microA_per_cm2", "potassium_channel", ALGEBRAIC},
+    {"alpha_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC},
+    {"beta_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC}
+};
+
+float * createStatesArray()
+{
+    return (float *) malloc(STATE_COUNT*sizeof(float));
+}
+
+float * createVariablesArray()
+{
+    return (float *) malloc(VARIABLE_COUNT*sizeof(float));
+}
+
+void deleteArray(float *array)
+{
+    free(array);
+}
+
+void initializeStatesAndConstants(float *states, float *variables)
+{
+    states[0] = 0.05;
+    states[1] = 0.6;
+    states[2] = 0.325;
+    states[3] = 0.0;
+    variables[0] = 0.3;
+    variables[1] = 1.0;
+    variables[2] = 0.0;
+    variables[3] = 36.0;
+    variables[4] = 120.0;
+}
+
+void computeComputedConstants(float *variables)
+{
+    variables[6] = (double) variables[2]-10.613;
+    variables[8] = (double) variables[2]-115.0;
+    variables[14] = (double) variables[2]+12.0;
+}
+
+void computeRates(double voi, float *states, float *rates, float *variables)
+{
+    variables[10] = 0.1*((double) states[3]+25.0)/(exp(((double) states[3]+25.0)/10.0)-1.0);
+    variables[11] = 4.0*exp((double) states[3]/18.0);
+    rates[0] = (double) variables[10]*(1.0-(double) states[0])-(double) variables[11]*(double) states[0];
+    variables[12] = 0.07*exp((double) states[3]/20.0);
+    variables[13] = 1.0/(exp(((double) states[3]+30.0)/10.0)+1.0);
+    rates[1] = (double) variables[12]*(1.0-(double) states[1])-(double) variables[13]*(double) states[1];
+    variables[16] = 0.01*((double) states[3]+10.0)/(exp(((double) states[3]+10.0)/10.0)-1.0);
+    variables[17] = 0.125*exp((double) states[3]/80.0);
+    rates[2] = (double) variables[16]*(1.0-(double) states[2])-(double) variables[17]*(double) states[2];
+    variables[5] = ((voi >= 10.0) && (voi <= 10.5))?-20.0:0.0;
+    variables[7] = (double) variables[0]*((double) states[3]-(double) variables[6]);
+    variables[15] = (double) variables[3]*pow((double) states[2], 4.0)*((double) states[3]-(double) variables[14]);
+    variables[9] = (double) variables[4]*pow((double) states[0], 3.0)*(double) states[1]*((double) states[3]-(double) variables[8]);
+    rates[3] = -(-(double) variables[5]+(double) variables[9]+(double) variables[15]+(double) variables[7])/(double) variables[1];
+}
+
+void computeVariables(double voi, float *states, float *rates, float *variables)
+{
+    variables[7] = (double) variables[0]*((double) states[3]-(double) variables[6]);
+    variables[9] = (double) variables[4]*pow((double) states[0], 3.0)*(double) states[1]*((double) states[3]-(double) variables[8]);
+    variables[10] = 0.1*((double) states[3]+25.0)/(exp(((double) states[3]+25.0)/10.0)-1.0);
+    variables[11] = 4.0*exp((double) states[3]/18.0);
+    variables[12] = 0.07*exp((double) states[3]/20.0);
+    variables[13] = 1.0/(exp(((double) states[3]+30.0)/10.0)+1.0);
+    variables[15] = (double) variables[3]*pow((double) states[2], 4.0)*((double) states[3]-(double) variables[14]);
+    variables[16] = 0.01*((double) states[3]+10.0)/(exp(((double) states[3]+10.0)/10.0)-1.0);
+    variables[17] = 0.125*exp((double) states[3]/80.0);
+}
@@ -0,0 +1,108 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.1.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 4;
+const size_t VARIABLE_COUNT = 18;
+
+const VariableInfo VOI_INFO = {"time", "millisecond", "environment"};
+
+const VariableInfo STATE_INFO[] = {
+    {"m", "dimensionless", "sodium_channel_m_gate"},
+    {"V", "millivolt", "membrane"},
+    {"h", "dimensionless", "sodium_channel_h_gate"},
+    {"n", "dimensionless", "potassium_channel_n_gate"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"alpha_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"beta_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"i_Stim", "microA_per_cm2", "membrane", ALGEBRAIC},
+    {"Cm", "microF_per_cm2", "membrane", CONSTANT},
+    {"alpha_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"beta_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"alpha_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC},
+    {"beta_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC},
+    {"i_L", "microA_per_cm2", "leakage_current", ALGEBRAIC},
+    {"g_L", "milliS_per_cm2", "leakage_current", CONSTANT},
+    {"E_L", "millivolt", "leakage_current", COMPUTED_CONSTANT},
+    {"i_K", "microA_per_cm2", "potassium_channel", ALGEBRAIC},
+    {"g_K", "milliS_per_cm2", "potassium_channel", CONSTANT},
+    {"E_K", "millivolt", "potassium_channel", COMPUTED_CONSTANT},
+    {"i_Na", "microA_per_cm2", "sodium_channel", ALGEBRAIC},
+    {"g_Na", "milliS_per_cm2", "sodium_channel", CONSTANT},
+    {"E_Na", "millivolt", "sodium_channel", COMPUTED_CONSTANT},
+    {"E_R", "millivolt", "membrane", CONSTANT}
+};
+
+double * createStatesArray()
+{
+    return (double *) malloc(STATE_COUNT*sizeof(double));
+}
+
+double * createVariablesArray()
+{
+    return (double *) malloc(VARIABLE_COUNT*sizeof(double));
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initializeStatesAndConstants(double *states, double *variables)
+{
+    states[0] = 0.05;
+    states[2] = 0.6;
+    states[3] = 0.325;
+    states[1] = 0.0;
+    variables[9] = 0.3;
+    variables[3] = 1.0;
+    variables[17] = 0.0;
+    variables[12] = 36.0;
+    variables[15] = 120.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+    variables[10] = variables[17]-10.613;
+    variables[16] = variables[17]-115.0;
+    variables[13] = variables[17]+12.0;
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    variables[0] = 0.1*(states[1]+25.0)/(exp((states[1]+25.0)/10.0)-1.0);
+    variables[1] = 4.0*exp(states[1]/18.0);
+    rates[0] = variables[0]*(1.0-states[0])-variables[1]*states[0];
+    variables[4] = 0.07*exp(states[1]/20.0);
+    variables[5] = 1.0/(exp((states[1]+30.0)/10.0)+1.0);
+    rates[2] = variables[4]*(1.0-states[2])-variables[5]*states[2];
+    variables[6] = 0.01*(states[1]+10.0)/(exp((states[1]+10.0)/10.0)-1.0);
+    variables[7] = 0.125*exp(states[1]/80.0);
+    rates[3] = variables[6]*(1.0-states[3])-variables[7]*states[3];
+    variables[2] = ((voi >= 10.0) && (voi <= 10.5))?-20.0:0.0;
+    variables[8] = variables[9]*(states[1]-variables[10]);
+    variables[11] = variables[12]*pow(states[3], 4.0)*(states[1]-variables[13]);
+    variables[14] = variables[15]*pow(states[0], 3.0)*states[2]*(states[1]-variables[16]);
+    rates[1] = -(-variables[2]+variables[14]+variables[11]+variables[8])/variables[3];
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    variables[8] = variables[9]*(states[1]-variables[10]);
+    variables[14] = variables[15]*pow(states[0], 3.0)*states[2]*(states[1]-variables[16]);
+    variables[0] = 0.1*(states[1]+25.0)/(exp((states[1]+25.0)/10.0)-1.0);
+    variables[1] = 4.0*exp(states[1]/18.0);
+    variables[4] = 0.07*exp(states[1]/20.0);
+    variables[5] = 1.0/(exp((states[1]+30.0)/10.0)+1.0);
+    variables[11] = variables[12]*pow(states[3], 4.0)*(states[1]-variables[13]);
+    variables[6] = 0.01*(states[1]+10.0)/(exp((states[1]+10.0)/10.0)-1.0);
+    variables[7] = 0.125*exp(states[1]/80.0);
+}
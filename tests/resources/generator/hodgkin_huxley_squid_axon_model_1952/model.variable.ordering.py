@@ -0,0 +1,115 @@
+# The content of this file was generated using the Python profile of libCellML 0.2.0.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.1.0"
+LIBCELLML_VERSION = "0.2.0"
+
+STATE_COUNT = 4
+VARIABLE_COUNT = 18
+
+
+class VariableType(Enum):
+    CONSTANT = 1
+    COMPUTED_CONSTANT = 2
+    ALGEBRAIC = 3
+
+
+VOI_INFO = {"name": "time", "units": "millisecond", "component": "environment"}
+
+STATE_INFO = [
+    {"name": "m", "units": "dimensionless", "component": "sodium_channel_m_gate"},
+    {"name": "V", "units": "millivolt", "component": "membrane"},
+    {"name": "h", "units": "dimensionless", "component": "sodium_channel_h_gate"},
+    {"name": "n", "units": "dimensionless", "component": "potassium_channel_n_gate"}
+]
+
+VARIABLE_INFO = [
+    {"name": "alpha_m", "units": "per_millisecond", "component": "sodium_channel_m_gate", "type": VariableType.ALGEBRAIC},
+    {"name": "beta_m", "units": "per_millisecond", "component": "sodium_channel_m_gate", "type": VariableType.ALGEBRAIC},
+    {"name": "i_Stim", "units": "microA_per_cm2", "component": "membrane", "type": VariableType.ALGEBRAIC},
+    {"name": "Cm", "units": "microF_per_cm2", "component": "membrane", "type": VariableType.CONSTANT},
+    {"name": "alpha_h", "units": "per_millisecond", "component": "sodium_channel_h_gate", "type": VariableType.ALGEBRAIC},
+    {"name": "beta_h", "units": "per_millisecond", "component": "sodium_channel_h_gate", "type": VariableType.ALGEBRAIC},
+    {"name": "alpha_n", "units": "per_millisecond", "component": "potassium_channel_n_gate", "type": VariableType.ALGEBRAIC},
+    {"name": "beta_n", "units": "per_millisecond", "component": "potassium_channel_n_gate", "type": VariableType.ALGEBRAIC},
+    {"name": "i_L", "units": "microA_per_cm2", "component": "leakage_current", "type": VariableType.ALGEBRAIC},
+    {"name": "g_L", "units": "milliS_per_cm2", "component": "leakage_current", "type": VariableType.CONSTANT},
+    {"name": "E_L", "units": "millivolt", "component": "leakage_current", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "i_K", "units": "microA_per_cm2", "component": "potassium_channel", "type": VariableType.ALGEBRAIC},
+    {"name": "g_K", "units": "milliS_per_cm2", "component": "potassium_channel", "type": VariableType.CONSTANT},
+    {"name": "E_K", "units": "millivolt", "component": "potassium_channel", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "i_Na", "units": "microA_per_cm2", "component": "sodium_channel", "type": VariableType.ALGEBRAIC},
+    {"name": "g_Na", "units": "milliS_per_cm2", "component": "sodium_channel", "type": VariableType.CONSTANT},
+    {"name": "E_Na", "units": "millivolt", "component": "sodium_channel", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "E_R", "units": "millivolt", "component": "membrane", "type": VariableType.CONSTANT}
+]
+
+
+def leq_func(x, y):
+    return 1.0 if x <= y else 0.0
+
+
+def geq_func(x, y):
+    return 1.0 if x >= y else 0.0
+
+
+def and_func(x, y):
+    return 1.0 if bool(x) & bool(y) else 0.0
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+def initialize_states_and_constants(states, variables):
+    states[0] = 0.05
+    states[2] = 0.6
+    states[3] = 0.325
+    states[1] = 0.0
+    variables[9] = 0.3
+    variables[3] = 1.0
+    variables[17] = 0.0
+    variables[12] = 36.0
+    variables[15] = 120.0
+
+
+def compute_computed_constants(variables):
+    variables[10] = variables[17]-10.613
+    variables[16] = variables[17]-115.0
+    variables[13] = variables[17]+12.0
+
+
+def compute_rates(voi, states, rates, variables):
+    variables[0] = 0.1*(states[1]+25.0)/(exp((states[1]+25.0)/10.0)-1.0)
+    variables[1] = 4.0*exp(states[1]/18.0)
+    rates[0] = variables[0]*(1.0-states[0])-variables[1]*states[0]
+    variables[4] = 0.07*exp(states[1]/20.0)
+    variables[5] = 1.0/(exp((states[1]+30.0)/10.0)+1.0)
+    rates[2] = variables[4]*(1.0-states[2])-variables[5]*states[2]
+    variables[6] = 0.01*(states[1]+10.0)/(exp((states[1]+10.0)/10.0)-1.0)
+    variables[7] = 0.125*exp(states[1]/80.0)
+    rates[3] = variables[6]*(1.0-states[3])-variables[7]*states[3]
+    variables[2] = -20.0 if and_func(geq_func(voi, 10.0), leq_func(voi, 10.5)) else 0.0
+    variables[8] = variables[9]*(states[1]-variables[10])
+    variables[11] = variables[12]*pow(states[3], 4.0)*(states[1]-variables[13])
+    variables[14] = variables[15]*pow(states[0], 3.0)*states[2]*(states[1]-variables[16])
+    rates[1] = -(-variables[2]+variables[14]+variables[11]+variables[8])/variables[3]
+
+
+def compute_variables(voi, states, rates, variables):
+    variables[8] = variables[9]*(states[1]-variables[10])
+    variables[14] = variables[15]*pow(states[0], 3.0)*states[2]*(states[1]-variables[16])
+    variables[0] = 0.1*(states[1]+25.0)/(exp((states[1]+25.0)/10.0)-1.0)
+    variables[1] = 4.0*exp(states[1]/18.0)
+    variables[4] = 0.07*exp(states[1]/20.0)
+    variables[5] = 1.0/(exp((states[1]+30.0)/10.0)+1.0)
+    variables[11] = variables[12]*pow(states[3], 4.0)*(states[1]-variables[13])
+    variables[6] = 0.01*(states[1]+10.0)/(exp((states[1]+10.0)/10.0)-1.0)
+    variables[7] = 0.125*exp(states[1]/80.0)
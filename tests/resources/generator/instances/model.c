@@ -0,0 +1,129 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.1.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 8;
+const size_t VARIABLE_COUNT = 23;
+
+const VariableInfo VOI_INFO = {"t", "dimensionless", "cell_0"};
+
+const VariableInfo STATE_INFO[] = {
+    {"w", "dimensionless", "cell_0"},
+    {"w", "dimensionless", "cell_1"},
+    {"w", "dimensionless", "cell_2"},
+    {"w", "dimensionless", "cell_3"},
+    {"V", "dimensionless", "cell_0"},
+    {"V", "dimensionless", "cell_1"},
+    {"V", "dimensionless", "cell_2"},
+    {"V", "dimensionless", "cell_3"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"a", "dimensionless", "cell_0", CONSTANT},
+    {"b", "dimensionless", "cell_0", CONSTANT},
+    {"epsilon", "dimensionless", "cell_0", CONSTANT},
+    {"a", "dimensionless", "cell_1", CONSTANT},
+    {"b", "dimensionless", "cell_1", CONSTANT},
+    {"epsilon", "dimensionless", "cell_1", CONSTANT},
+    {"a", "dimensionless", "cell_2", CONSTANT},
+    {"b", "dimensionless", "cell_2", CONSTANT},
+    {"epsilon", "dimensionless", "cell_2", CONSTANT},
+    {"a", "dimensionless", "cell_3", CONSTANT},
+    {"b", "dimensionless", "cell_3", CONSTANT},
+    {"epsilon", "dimensionless", "cell_3", CONSTANT},
+    {"I_no_stim", "dimensionless", "cell_1", CONSTANT},
+    {"D", "dimensionless", "fibre", CONSTANT},
+    {"I_ion", "dimensionless", "cell_0", ALGEBRAIC},
+    {"I_ion", "dimensionless", "cell_1", ALGEBRAIC},
+    {"I_ion", "dimensionless", "cell_2", ALGEBRAIC},
+    {"I_ion", "dimensionless", "cell_3", ALGEBRAIC},
+    {"I_stim", "dimensionless", "environment", ALGEBRAIC},
+    {"I_coupling", "dimensionless", "fibre", ALGEBRAIC},
+    {"I_coupling", "dimensionless", "fibre", ALGEBRAIC},
+    {"I_coupling", "dimensionless", "fibre", ALGEBRAIC},
+    {"I_coupling", "dimensionless", "fibre", ALGEBRAIC}
+};
+
+double * createStatesArray()
+{
+    return (double *) malloc(STATE_COUNT*sizeof(double));
+}
+
+double * createVariablesArray()
+{
+    return (double *) malloc(VARIABLE_COUNT*sizeof(double));
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initializeStatesAndConstants(double *states, double *variables)
+{
+    states[0] = -0.6;
+    states[1] = -0.6;
+    states[2] = -0.6;
+    states[3] = -0.6;
+    states[4] = -1.2;
+    states[5] = -1.2;
+    states[6] = -1.2;
+    states[7] = -1.2;
+    variables[0] = 0.7;
+    variables[1] = 0.8;
+    variables[2] = 0.08;
+    variables[3] = 0.7;
+    variables[4] = 0.8;
+    variables[5] = 0.08;
+    variables[6] = 0.7;
+    variables[7] = 0.8;
+    variables[8] = 0.08;
+    variables[9] = 0.7;
+    variables[10] = 0.8;
+    variables[11] = 0.08;
+    variables[12] = 0.0;
+    variables[13] = 0.1;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    rates[0] = variables[2]*(states[4]+variables[0]-variables[1]*states[0]);
+    rates[1] = variables[5]*(states[5]+variables[3]-variables[4]*states[1]);
+    rates[2] = variables[8]*(states[6]+variables[6]-variables[7]*states[2]);
+    rates[3] = variables[11]*(states[7]+variables[9]-variables[10]*states[3]);
+    variables[14] = states[4]-pow(states[4], 3.0)/3.0-states[0];
+    variables[19] = variables[13]*(states[5]-states[4]);
+    variables[18] = ((voi >= 1.0) && (voi <= 2.0))?0.5:0.0;
+    rates[4] = variables[14]+variables[18]+variables[19];
+    variables[15] = states[5]-pow(states[5], 3.0)/3.0-states[1];
+    variables[20] = variables[13]*(states[4]-states[5]+states[6]-states[5]);
+    rates[5] = variables[15]+variables[12]+variables[20];
+    variables[16] = states[6]-pow(states[6], 3.0)/3.0-states[2];
+    variables[21] = variables[13]*(states[5]-states[6]+states[7]-states[6]);
+    rates[6] = variables[16]+variables[12]+variables[21];
+    variables[17] = states[7]-pow(states[7], 3.0)/3.0-states[3];
+    variables[22] = variables[13]*(states[6]-states[7]);
+    rates[7] = variables[17]+variables[12]+variables[22];
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    variables[14] = states[4]-pow(states[4], 3.0)/3.0-states[0];
+    variables[15] = states[5]-pow(states[5], 3.0)/3.0-states[1];
+    variables[16] = states[6]-pow(states[6], 3.0)/3.0-states[2];
+    variables[17] = states[7]-pow(states[7], 3.0)/3.0-states[3];
+    variables[19] = variables[13]*(states[5]-states[4]);
+    variables[20] = variables[13]*(states[4]-states[5]+states[6]-states[5]);
+    variables[21] = variables[13]*(states[5]-states[6]+states[7]-states[6]);
+    variables[22] = variables[13]*(states[6]-states[7]);
+}
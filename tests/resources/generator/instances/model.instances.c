@@ -0,0 +1,134 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.1.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 8;
+const size_t VARIABLE_COUNT = 23;
+
+const VariableInfo VOI_INFO = {"t", "dimensionless", "cell_0"};
+
+const VariableInfo STATE_INFO[] = {
+    {"w", "dimensionless", "cell_0"},
+    {"w", "dimensionless", "cell_1"},
+    {"w", "dimensionless", "cell_2"},
+    {"w", "dimensionless", "cell_3"},
+    {"V", "dimensionless", "cell_0"},
+    {"V", "dimensionless", "cell_1"},
+    {"V", "dimensionless", "cell_2"},
+    {"V", "dimensionless", "cell_3"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"a", "dimensionless", "cell_0", CONSTANT},
+    {"b", "dimensionless", "cell_0", CONSTANT},
+    {"epsilon", "dimensionless", "cell_0", CONSTANT},
+    {"a", "dimensionless", "cell_1", CONSTANT},
+    {"b", "dimensionless", "cell_1", CONSTANT},
+    {"epsilon", "dimensionless", "cell_1", CONSTANT},
+    {"a", "dimensionless", "cell_2", CONSTANT},
+    {"b", "dimensionless", "cell_2", CONSTANT},
+    {"epsilon", "dimensionless", "cell_2", CONSTANT},
+    {"a", "dimensionless", "cell_3", CONSTANT},
+    {"b", "dimensionless", "cell_3", CONSTANT},
+    {"epsilon", "dimensionless", "cell_3", CONSTANT},
+    {"I_no_stim", "dimensionless", "cell_1", CONSTANT},
+    {"D", "dimensionless", "fibre", CONSTANT},
+    {"I_ion", "dimensionless", "cell_0", ALGEBRAIC},
+    {"I_ion", "dimensionless", "cell_1", ALGEBRAIC},
+    {"I_ion", "dimensionless", "cell_2", ALGEBRAIC},
+    {"I_ion", "dimensionless", "cell_3", ALGEBRAIC},
+    {"I_stim", "dimensionless", "environment", ALGEBRAIC},
+    {"I_coupling", "dimensionless", "fibre", ALGEBRAIC},
+    {"I_coupling", "dimensionless", "fibre", ALGEBRAIC},
+    {"I_coupling", "dimensionless", "fibre", ALGEBRAIC},
+    {"I_coupling", "dimensionless", "fibre", ALGEBRAIC}
+};
+
+double * createStatesArray()
+{
+    return (double *) malloc(STATE_COUNT*sizeof(double));
+}
+
+double * createVariablesArray()
+{
+    return (double *) malloc(VARIABLE_COUNT*sizeof(double));
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initializeStatesAndConstants(double *states, double *variables)
+{
+    states[0] = -0.6;
+    states[1] = -0.6;
+    states[2] = -0.6;
+    states[3] = -0.6;
+    states[4] = -1.2;
+    states[5] = -1.2;
+    states[6] = -1.2;
+    states[7] = -1.2;
+    variables[0] = 0.7;
+    variables[1] = 0.8;
+    variables[2] = 0.08;
+    variables[3] = 0.7;
+    variables[4] = 0.8;
+    variables[5] = 0.08;
+    variables[6] = 0.7;
+    variables[7] = 0.8;
+    variables[8] = 0.08;
+    variables[9] = 0.7;
+    variables[10] = 0.8;
+    variables[11] = 0.08;
+    variables[12] = 0.0;
+    variables[13] = 0.1;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+static void computeRatesKernel0(double voi, double *states, double *rates, double *variables)
+{
+    for (size_t i = 0; i < 3; ++i) {
+        rates[1+1*i] = variables[5+3*i]*(states[5+1*i]+variables[3+3*i]-variables[4+3*i]*states[1+1*i]);
+        variables[15+1*i] = states[5+1*i]-pow(states[5+1*i], 3.0)/3.0-states[1+1*i];
+        rates[5+1*i] = variables[15+1*i]+variables[12]+variables[20+1*i];
+    }
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    rates[0] = variables[2]*(states[4]+variables[0]-variables[1]*states[0]);
+    variables[14] = states[4]-pow(states[4], 3.0)/3.0-states[0];
+    variables[19] = variables[13]*(states[5]-states[4]);
+    variables[18] = ((voi >= 1.0) && (voi <= 2.0))?0.5:0.0;
+    rates[4] = variables[14]+variables[18]+variables[19];
+    variables[20] = variables[13]*(states[4]-states[5]+states[6]-states[5]);
+    variables[21] = variables[13]*(states[5]-states[6]+states[7]-states[6]);
+    variables[22] = variables[13]*(states[6]-states[7]);
+    computeRatesKernel0(voi, states, rates, variables);
+}
+
+static void computeVariablesKernel0(double voi, double *states, double *rates, double *variables)
+{
+    for (size_t i = 0; i < 4; ++i) {
+        variables[14+1*i] = states[4+1*i]-pow(states[4+1*i], 3.0)/3.0-states[0+1*i];
+    }
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    computeVariablesKernel0(voi, states, rates, variables);
+    variables[19] = variables[13]*(states[5]-states[4]);
+    variables[20] = variables[13]*(states[4]-states[5]+states[6]-states[5]);
+    variables[21] = variables[13]*(states[5]-states[6]+states[7]-states[6]);
+    variables[22] = variables[13]*(states[6]-states[7]);
+}
@@ -0,0 +1,138 @@
+# The content of this file was generated using the Python profile of libCellML 0.2.0.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.1.0"
+LIBCELLML_VERSION = "0.2.0"
+
+STATE_COUNT = 8
+VARIABLE_COUNT = 23
+
+
+class VariableType(Enum):
+    CONSTANT = 1
+    COMPUTED_CONSTANT = 2
+    ALGEBRAIC = 3
+
+
+VOI_INFO = {"name": "t", "units": "dimensionless", "component": "cell_0"}
+
+STATE_INFO = [
+    {"name": "w", "units": "dimensionless", "component": "cell_0"},
+    {"name": "w", "units": "dimensionless", "component": "cell_1"},
+    {"name": "w", "units": "dimensionless", "component": "cell_2"},
+    {"name": "w", "units": "dimensionless", "component": "cell_3"},
+    {"name": "V", "units": "dimensionless", "component": "cell_0"},
+    {"name": "V", "units": "dimensionless", "component": "cell_1"},
+    {"name": "V", "units": "dimensionless", "component": "cell_2"},
+    {"name": "V", "units": "dimensionless", "component": "cell_3"}
+]
+
+VARIABLE_INFO = [
+    {"name": "a", "units": "dimensionless", "component": "cell_0", "type": VariableType.CONSTANT},
+    {"name": "b", "units": "dimensionless", "component": "cell_0", "type": VariableType.CONSTANT},
+    {"name": "epsilon", "units": "dimensionless", "component": "cell_0", "type": VariableType.CONSTANT},
+    {"name": "a", "units": "dimensionless", "component": "cell_1", "type": VariableType.CONSTANT},
+    {"name": "b", "units": "dimensionless", "component": "cell_1", "type": VariableType.CONSTANT},
+    {"name": "epsilon", "units": "dimensionless", "component": "cell_1", "type": VariableType.CONSTANT},
+    {"name": "a", "units": "dimensionless", "component": "cell_2", "type": VariableType.CONSTANT},
+    {"name": "b", "units": "dimensionless", "component": "cell_2", "type": VariableType.CONSTANT},
+    {"name": "epsilon", "units": "dimensionless", "component": "cell_2", "type": VariableType.CONSTANT},
+    {"name": "a", "units": "dimensionless", "component": "cell_3", "type": VariableType.CONSTANT},
+    {"name": "b", "units": "dimensionless", "component": "cell_3", "type": VariableType.CONSTANT},
+    {"name": "epsilon", "units": "dimensionless", "component": "cell_3", "type": VariableType.CONSTANT},
+    {"name": "I_no_stim", "units": "dimensionless", "component": "cell_1", "type": VariableType.CONSTANT},
+    {"name": "D", "units": "dimensionless", "component": "fibre", "type": VariableType.CONSTANT},
+    {"name": "I_ion", "units": "dimensionless", "component": "cell_0", "type": VariableType.ALGEBRAIC},
+    {"name": "I_ion", "units": "dimensionless", "component": "cell_1", "type": VariableType.ALGEBRAIC},
+    {"name": "I_ion", "units": "dimensionless", "component": "cell_2", "type": VariableType.ALGEBRAIC},
+    {"name": "I_ion", "units": "dimensionless", "component": "cell_3", "type": VariableType.ALGEBRAIC},
+    {"name": "I_stim", "units": "dimensionless", "component": "environment", "type": VariableType.ALGEBRAIC},
+    {"name": "I_coupling", "units": "dimensionless", "component": "fibre", "type": VariableType.ALGEBRAIC},
+    {"name": "I_coupling", "units": "dimensionless", "component": "fibre", "type": VariableType.ALGEBRAIC},
+    {"name": "I_coupling", "units": "dimensionless", "component": "fibre", "type": VariableType.ALGEBRAIC},
+    {"name": "I_coupling", "units": "dimensionless", "component": "fibre", "type": VariableType.ALGEBRAIC}
+]
+
+
+def leq_func(x, y):
+    return 1.0 if x <= y else 0.0
+
+
+def geq_func(x, y):
+    return 1.0 if x >= y else 0.0
+
+
+def and_func(x, y):
+    return 1.0 if bool(x) & bool(y) else 0.0
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+def initialize_states_and_constants(states, variables):
+    states[0] = -0.6
+    states[1] = -0.6
+    states[2] = -0.6
+    states[3] = -0.6
+    states[4] = -1.2
+    states[5] = -1.2
+    states[6] = -1.2
+    states[7] = -1.2
+    variables[0] = 0.7
+    variables[1] = 0.8
+    variables[2] = 0.08
+    variables[3] = 0.7
+    variables[4] = 0.8
+    variables[5] = 0.08
+    variables[6] = 0.7
+    variables[7] = 0.8
+    variables[8] = 0.08
+    variables[9] = 0.7
+    variables[10] = 0.8
+    variables[11] = 0.08
+    variables[12] = 0.0
+    variables[13] = 0.1
+
+
+def compute_computed_constants(variables):
+    pass
+
+
+def compute_rates_kernel_0(voi, states, rates, variables):
+    for i in range(3):
+        rates[1+1*i] = variables[5+3*i]*(states[5+1*i]+variables[3+3*i]-variables[4+3*i]*states[1+1*i])
+        variables[15+1*i] = states[5+1*i]-pow(states[5+1*i], 3.0)/3.0-states[1+1*i]
+        rates[5+1*i] = variables[15+1*i]+variables[12]+variables[20+1*i]
+
+
+def compute_rates(voi, states, rates, variables):
+    rates[0] = variables[2]*(states[4]+variables[0]-variables[1]*states[0])
+    variables[14] = states[4]-pow(states[4], 3.0)/3.0-states[0]
+    variables[19] = variables[13]*(states[5]-states[4])
+    variables[18] = 0.5 if and_func(geq_func(voi, 1.0), leq_func(voi, 2.0)) else 0.0
+    rates[4] = variables[14]+variables[18]+variables[19]
+    variables[20] = variables[13]*(states[4]-states[5]+states[6]-states[5])
+    variables[21] = variables[13]*(states[5]-states[6]+states[7]-states[6])
+    variables[22] = variables[13]*(states[6]-states[7])
+    compute_rates_kernel_0(voi, states, rates, variables)
+
+
+def compute_variables_kernel_0(voi, states, rates, variables):
+    for i in range(4):
+        variables[14+1*i] = states[4+1*i]-pow(states[4+1*i], 3.0)/3.0-states[0+1*i]
+
+
+def compute_variables(voi, states, rates, variables):
+    compute_variables_kernel_0(voi, states, rates, variables)
+    variables[19] = variables[13]*(states[5]-states[4])
+    variables[20] = variables[13]*(states[4]-states[5]+states[6]-states[5])
+    variables[21] = variables[13]*(states[5]-states[6]+states[7]-states[6])
+    variables[22] = variables[13]*(states[6]-states[7])
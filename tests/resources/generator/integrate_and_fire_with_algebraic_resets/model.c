@@ -0,0 +1,94 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.1.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 2;
+const size_t VARIABLE_COUNT = 7;
+
+const VariableInfo VOI_INFO = {"t", "ms", "membrane"};
+
+const VariableInfo STATE_INFO[] = {
+    {"V", "mV", "membrane"},
+    {"n", "dimensionless", "membrane"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"V_input", "mV", "membrane", CONSTANT},
+    {"V_reset", "mV", "membrane", CONSTANT},
+    {"V_rest", "mV", "membrane", CONSTANT},
+    {"V_threshold", "mV", "membrane", CONSTANT},
+    {"tau", "ms", "membrane", CONSTANT},
+    {"V_distance", "mV", "membrane", ALGEBRAIC},
+    {"V_after", "mV", "membrane", ALGEBRAIC}
+};
+
+const size_t RESET_COUNT = 2;
+
+double * createStatesArray()
+{
+    return (double *) malloc(STATE_COUNT*sizeof(double));
+}
+
+double * createVariablesArray()
+{
+    return (double *) malloc(VARIABLE_COUNT*sizeof(double));
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initializeStatesAndConstants(double *states, double *variables)
+{
+    states[0] = -70.0;
+    states[1] = 0.0;
+    variables[0] = 25.0;
+    variables[1] = -75.0;
+    variables[2] = -70.0;
+    variables[3] = -50.0;
+    variables[4] = 10.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    rates[0] = (variables[2]+variables[0]-states[0])/variables[4];
+    rates[1] = 0.0;
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    variables[5] = states[0]-variables[3];
+    variables[6] = variables[1]-states[1]*1.0;
+}
+
+void computeRoots(double voi, double *states, double *variables, double *roots)
+{
+    variables[5] = states[0]-variables[3];
+
+    roots[0] = variables[5]-0.0;
+    roots[1] = variables[5]-0.0;
+}
+
+void applyResets(double voi, double *states, double *variables, const int *events)
+{
+    double resetValues[2];
+
+    variables[6] = variables[1]-states[1]*1.0;
+
+    resetValues[0] = (events[0])?variables[6]:states[0];
+    resetValues[1] = (events[1])?states[1]+1.0:states[1];
+
+    states[0] = resetValues[0];
+    states[1] = resetValues[1];
+}
@@ -0,0 +1,88 @@
+# The content of this file was generated using the Python profile of libCellML 0.2.0.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.1.0"
+LIBCELLML_VERSION = "0.2.0"
+
+STATE_COUNT = 2
+VARIABLE_COUNT = 7
+
+
+class VariableType(Enum):
+    CONSTANT = 1
+    COMPUTED_CONSTANT = 2
+    ALGEBRAIC = 3
+
+
+VOI_INFO = {"name": "t", "units": "ms", "component": "membrane"}
+
+STATE_INFO = [
+    {"name": "V", "units": "mV", "component": "membrane"},
+    {"name": "n", "units": "dimensionless", "component": "membrane"}
+]
+
+VARIABLE_INFO = [
+    {"name": "V_input", "units": "mV", "component": "membrane", "type": VariableType.CONSTANT},
+    {"name": "V_reset", "units": "mV", "component": "membrane", "type": VariableType.CONSTANT},
+    {"name": "V_rest", "units": "mV", "component": "membrane", "type": VariableType.CONSTANT},
+    {"name": "V_threshold", "units": "mV", "component": "membrane", "type": VariableType.CONSTANT},
+    {"name": "tau", "units": "ms", "component": "membrane", "type": VariableType.CONSTANT},
+    {"name": "V_distance", "units": "mV", "component": "membrane", "type": VariableType.ALGEBRAIC},
+    {"name": "V_after", "units": "mV", "component": "membrane", "type": VariableType.ALGEBRAIC}
+]
+
+RESET_COUNT = 2
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+def initialize_states_and_constants(states, variables):
+    states[0] = -70.0
+    states[1] = 0.0
+    variables[0] = 25.0
+    variables[1] = -75.0
+    variables[2] = -70.0
+    variables[3] = -50.0
+    variables[4] = 10.0
+
+
+def compute_computed_constants(variables):
+    pass
+
+
+def compute_rates(voi, states, rates, variables):
+    rates[0] = (variables[2]+variables[0]-states[0])/variables[4]
+    rates[1] = 0.0
+
+
+def compute_variables(voi, states, rates, variables):
+    variables[5] = states[0]-variables[3]
+    variables[6] = variables[1]-states[1]*1.0
+
+
+def compute_roots(voi, states, variables, roots):
+    variables[5] = states[0]-variables[3]
+
+    roots[0] = variables[5]-0.0
+    roots[1] = variables[5]-0.0
+
+
+def apply_resets(voi, states, variables, events):
+    reset_values = [0.0]*2
+
+    variables[6] = variables[1]-states[1]*1.0
+
+    reset_values[0] = variables[6] if events[0] else states[0]
+    reset_values[1] = states[1]+1.0 if events[1] else states[1]
+
+    states[0] = reset_values[0]
+    states[1] = reset_values[1]
@@ -0,0 +1,172 @@
+/* The content of this file was generated using a modified C profile of libCellML 0.2.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.1.0.post0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 5;
+const size_t VARIABLE_COUNT = 2;
+
+const VariableInfo VOI_INFO = {"t", "dimensionless", "my_component"};
+
+const VariableInfo STATE_INFO[] = {
+    {"x", "dimensionless", "my_component"},
+    {"y", "dimensionless", "my_component"},
+    {"z", "dimensionless", "my_component"},
+    {"w", "dimensionless", "my_component"},
+    {"v", "dimensionless", "my_component"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"k", "dimensionless", "my_component", CONSTANT},
+    {"a", "dimensionless", "my_component", ALGEBRAIC}
+};
+
+const size_t JACOBIAN_NON_ZERO_COUNT = 17;
+const size_t JACOBIAN_ROW_POINTERS[] = {0, 2, 4, 8, 12, 17};
+const size_t JACOBIAN_COLUMN_INDICES[] = {0, 1, 0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 4};
+
+double min(double x, double y)
+{
+    return (x < y)?x:y;
+}
+
+double max(double x, double y)
+{
+    return (x > y)?x:y;
+}
+
+double sec(double x)
+{
+    return 1.0/cos(x);
+}
+
+double csc(double x)
+{
+    return 1.0/sin(x);
+}
+
+double cot(double x)
+{
+    return 1.0/tan(x);
+}
+
+double sech(double x)
+{
+    return 1.0/cosh(x);
+}
+
+double csch(double x)
+{
+    return 1.0/sinh(x);
+}
+
+double coth(double x)
+{
+    return 1.0/tanh(x);
+}
+
+double asec(double x)
+{
+    return acos(1.0/x);
+}
+
+double acsc(double x)
+{
+    return asin(1.0/x);
+}
+
+double acot(double x)
+{
+    return atan(1.0/x);
+}
+
+double asech(double x)
+{
+    double oneOverX = 1.0/x;
+
+    return log(oneOverX+sqrt(oneOverX*oneOverX-1.0));
+}
+
+double acsch(double x)
+{
+    double oneOverX = 1.0/x;
+
+    return log(oneOverX+sqrt(oneOverX*oneOverX+1.0));
+}
+
+double acoth(double x)
+{
+    double oneOverX = 1.0/x;
+
+    return 0.5*log((1.0+oneOverX)/(1.0-oneOverX));
+}
+
+double * createStatesArray()
+{
+    return (double *) malloc(STATE_COUNT*sizeof(double));
+}
+
+double * createVariablesArray()
+{
+    return (double *) malloc(VARIABLE_COUNT*sizeof(double));
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initializeStatesAndConstants(double *states, double *variables)
+{
+    states[0] = 0.3;
+    states[1] = 0.5;
+    states[2] = 0.2;
+    states[3] = 1.5;
+    states[4] = 0.7;
+    variables[0] = 2.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    rates[0] = sin(states[0])+cos(states[1])+tan(states[0]*states[1])+sec(states[0])+csc(states[1]+1.0)+cot(states[1]+1.0);
+    rates[1] = sinh(states[0])+cosh(states[1])+tanh(states[0])+sech(states[0])+csch(states[1]+1.0)+coth(states[1]+1.0);
+    rates[2] = asin(states[0])+acos(states[1])+atan(states[2])+asec(states[3])+acsc(states[3])+acot(states[2]);
+    rates[3] = asinh(states[0])+acosh(states[3])+atanh(states[0])+asech(states[1])+acsch(states[2])+acoth(states[3]);
+    variables[1] = states[4]*states[1]-states[2]/states[3];
+    rates[4] = exp(states[0])+log(states[1])+log10(states[2])+log(states[3])/log(2.0)+sqrt(states[4])+pow(states[4], 1.0/3.0)+fabs(states[0]-states[1])+min(states[0], states[1])+max(states[2], states[3])+fmod(states[3], states[4])+pow(states[0], states[1])+pow(states[4], 2.0)+((states[0] < states[1])?states[0]*states[1]:states[0]/states[1])+variables[1]+variables[0]*states[4];
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+    variables[1] = states[4]*states[1]-states[2]/states[3];
+}
+
+void computeJacobian(double voi, double *states, double *variables, double *jac)
+{
+    jac[0] = cos(states[0])+states[1]/(cos(states[0]*states[1])*cos(states[0]*states[1]))+sin(states[0])/(cos(states[0])*cos(states[0]));
+    jac[1] = states[0]/(cos(states[0]*states[1])*cos(states[0]*states[1]))-(cos(states[1]+1.0)/(sin(states[1]+1.0)*sin(states[1]+1.0))+1.0/(sin(states[1]+1.0)*sin(states[1]+1.0)))-sin(states[1]);
+    jac[2] = cosh(states[0])+1.0/(cosh(states[0])*cosh(states[0]))-sinh(states[0])/(cosh(states[0])*cosh(states[0]));
+    jac[3] = sinh(states[1])-(cosh(states[1]+1.0)/(sinh(states[1]+1.0)*sinh(states[1]+1.0))+1.0/(sinh(states[1]+1.0)*sinh(states[1]+1.0)));
+    jac[4] = 1.0/sqrt(1.0-states[0]*states[0]);
+    jac[5] = -1.0/sqrt(1.0-states[1]*states[1]);
+    jac[6] = 1.0/(1.0+states[2]*states[2])-1.0/(1.0+states[2]*states[2]);
+    jac[7] = 1.0/(fabs(states[3])*sqrt(states[3]*states[3]-1.0))-1.0/(fabs(states[3])*sqrt(states[3]*states[3]-1.0));
+    jac[8] = 1.0/sqrt(states[0]*states[0]+1.0)+1.0/(1.0-states[0]*states[0]);
+    jac[9] = -1.0/(states[1]*sqrt(1.0-states[1]*states[1]));
+    jac[10] = -1.0/(fabs(states[2])*sqrt(1.0+states[2]*states[2]));
+    jac[11] = 1.0/sqrt(states[3]*states[3]-1.0)+1.0/(1.0-states[3]*states[3]);
+    jac[12] = exp(states[0])+((states[0]-states[1] < 0.0)?-1.0:1.0)+((states[0] < states[1])?1.0:0.0)+states[1]*pow(states[0], states[1]-1.0)+((states[0] < states[1])?states[1]:1.0/states[1]);
+    jac[13] = 1.0/states[1]+((states[0]-states[1] < 0.0)?1.0:-1.0)+((states[0] < states[1])?0.0:1.0)+pow(states[0], states[1])*log(states[0])+((states[0] < states[1])?states[0]:-states[0]/(states[1]*states[1]))+states[4];
+    jac[14] = 1.0/states[2]/log(10.0)+((states[3] < states[2])?1.0:0.0)-1.0/states[3];
+    jac[15] = 1.0/states[3]/log(2.0)+((states[3] < states[2])?0.0:1.0)+1.0+states[2]/(states[3]*states[3]);
+    jac[16] = 1.0/(2.0*sqrt(states[4]))+pow(states[4], 1.0/3.0)/(3.0*states[4])+2.0*states[4]+states[1]+variables[0]-floor(states[3]/states[4]);
+}
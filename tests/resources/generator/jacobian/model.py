@@ -0,0 +1,157 @@
+# The content of this file was generated using a modified Python profile of libCellML 0.2.0.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.1.0.post0"
+LIBCELLML_VERSION = "0.2.0"
+
+STATE_COUNT = 5
+VARIABLE_COUNT = 2
+
+
+class VariableType(Enum):
+    CONSTANT = 1
+    COMPUTED_CONSTANT = 2
+    ALGEBRAIC = 3
+
+
+VOI_INFO = {"name": "t", "units": "dimensionless", "component": "my_component"}
+
+STATE_INFO = [
+    {"name": "x", "units": "dimensionless", "component": "my_component"},
+    {"name": "y", "units": "dimensionless", "component": "my_component"},
+    {"name": "z", "units": "dimensionless", "component": "my_component"},
+    {"name": "w", "units": "dimensionless", "component": "my_component"},
+    {"name": "v", "units": "dimensionless", "component": "my_component"}
+]
+
+VARIABLE_INFO = [
+    {"name": "k", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "a", "units": "dimensionless", "component": "my_component", "type": VariableType.ALGEBRAIC}
+]
+
+JACOBIAN_NON_ZERO_COUNT = 17
+JACOBIAN_ROW_POINTERS = [0, 2, 4, 8, 12, 17]
+JACOBIAN_COLUMN_INDICES = [0, 1, 0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 4]
+
+
+def lt_func(x, y):
+    return 1.0 if x < y else 0.0
+
+
+def min(x, y):
+    return x if x < y else y
+
+
+def max(x, y):
+    return x if x > y else y
+
+
+def sec(x):
+    return 1.0/cos(x)
+
+
+def csc(x):
+    return 1.0/sin(x)
+
+
+def cot(x):
+    return 1.0/tan(x)
+
+
+def sech(x):
+    return 1.0/cosh(x)
+
+
+def csch(x):
+    return 1.0/sinh(x)
+
+
+def coth(x):
+    return 1.0/tanh(x)
+
+
+def asec(x):
+    return acos(1.0/x)
+
+
+def acsc(x):
+    return asin(1.0/x)
+
+
+def acot(x):
+    return atan(1.0/x)
+
+
+def asech(x):
+    one_over_x = 1.0/x
+
+    return log(one_over_x+sqrt(one_over_x*one_over_x-1.0))
+
+
+def acsch(x):
+    one_over_x = 1.0/x
+
+    return log(one_over_x+sqrt(one_over_x*one_over_x+1.0))
+
+
+def acoth(x):
+    one_over_x = 1.0/x
+
+    return 0.5*log((1.0+one_over_x)/(1.0-one_over_x))
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+def initialize_states_and_constants(states, variables):
+    states[0] = 0.3
+    states[1] = 0.5
+    states[2] = 0.2
+    states[3] = 1.5
+    states[4] = 0.7
+    variables[0] = 2.0
+
+
+def compute_computed_constants(variables):
+    pass
+
+
+def compute_rates(voi, states, rates, variables):
+    rates[0] = sin(states[0])+cos(states[1])+tan(states[0]*states[1])+sec(states[0])+csc(states[1]+1.0)+cot(states[1]+1.0)
+    rates[1] = sinh(states[0])+cosh(states[1])+tanh(states[0])+sech(states[0])+csch(states[1]+1.0)+coth(states[1]+1.0)
+    rates[2] = asin(states[0])+acos(states[1])+atan(states[2])+asec(states[3])+acsc(states[3])+acot(states[2])
+    rates[3] = asinh(states[0])+acosh(states[3])+atanh(states[0])+asech(states[1])+acsch(states[2])+acoth(states[3])
+    variables[1] = states[4]*states[1]-states[2]/states[3]
+    rates[4] = exp(states[0])+log(states[1])+log10(states[2])+log(states[3])/log(2.0)+sqrt(states[4])+pow(states[4], 1.0/3.0)+fabs(states[0]-states[1])+min(states[0], states[1])+max(states[2], states[3])+fmod(states[3], states[4])+pow(states[0], states[1])+pow(states[4], 2.0)+(states[0]*states[1] if lt_func(states[0], states[1]) else states[0]/states[1])+variables[1]+variables[0]*states[4]
+
+
+def compute_variables(voi, states, rates, variables):
+    variables[1] = states[4]*states[1]-states[2]/states[3]
+
+
+def compute_jacobian(voi, states, variables, jac):
+    jac[0] = cos(states[0])+states[1]/(cos(states[0]*states[1])*cos(states[0]*states[1]))+sin(states[0])/(cos(states[0])*cos(states[0]))
+    jac[1] = states[0]/(cos(states[0]*states[1])*cos(states[0]*states[1]))-(cos(states[1]+1.0)/(sin(states[1]+1.0)*sin(states[1]+1.0))+1.0/(sin(states[1]+1.0)*sin(states[1]+1.0)))-sin(states[1])
+    jac[2] = cosh(states[0])+1.0/(cosh(states[0])*cosh(states[0]))-sinh(states[0])/(cosh(states[0])*cosh(states[0]))
+    jac[3] = sinh(states[1])-(cosh(states[1]+1.0)/(sinh(states[1]+1.0)*sinh(states[1]+1.0))+1.0/(sinh(states[1]+1.0)*sinh(states[1]+1.0)))
+    jac[4] = 1.0/sqrt(1.0-states[0]*states[0])
+    jac[5] = -1.0/sqrt(1.0-states[1]*states[1])
+    jac[6] = 1.0/(1.0+states[2]*states[2])-1.0/(1.0+states[2]*states[2])
+    jac[7] = 1.0/(fabs(states[3])*sqrt(states[3]*states[3]-1.0))-1.0/(fabs(states[3])*sqrt(states[3]*states[3]-1.0))
+    jac[8] = 1.0/sqrt(states[0]*states[0]+1.0)+1.0/(1.0-states[0]*states[0])
+    jac[9] = -1.0/(states[1]*sqrt(1.0-states[1]*states[1]))
+    jac[10] = -1.0/(fabs(states[2])*sqrt(1.0+states[2]*states[2]))
+    jac[11] = 1.0/sqrt(states[3]*states[3]-1.0)+1.0/(1.0-states[3]*states[3])
+    jac[12] = exp(states[0])+(-1.0 if lt_func(states[0]-states[1], 0.0) else 1.0)+(1.0 if lt_func(states[0], states[1]) else 0.0)+states[1]*pow(states[0], states[1]-1.0)+(states[1] if lt_func(states[0], states[1]) else 1.0/states[1])
+    jac[13] = 1.0/states[1]+(1.0 if lt_func(states[0]-states[1], 0.0) else -1.0)+(0.0 if lt_func(states[0], states[1]) else 1.0)+pow(states[0], states[1])*log(states[0])+(states[0] if lt_func(states[0], states[1]) else -states[0]/(states[1]*states[1]))+states[4]
+    jac[14] = 1.0/states[2]/log(10.0)+(1.0 if lt_func(states[3], states[2]) else 0.0)-1.0/states[3]
+    jac[15] = 1.0/states[3]/log(2.0)+(0.0 if lt_func(states[3], states[2]) else 1.0)+1.0+states[2]/(states[3]*states[3])
+    jac[16] = 1.0/(2.0*sqrt(states[4]))+pow(states[4], 1.0/3.0)/(3.0*states[4])+2.0*states[4]+states[1]+variables[0]-floor(states[3]/states[4])
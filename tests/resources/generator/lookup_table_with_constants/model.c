@@ -0,0 +1,89 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.1.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 1;
+const size_t VARIABLE_COUNT = 3;
+
+const VariableInfo VOI_INFO = {"t", "dimensionless", "my_component"};
+
+const VariableInfo STATE_INFO[] = {
+    {"x", "dimensionless", "my_component"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"k", "dimensionless", "my_component", CONSTANT},
+    {"c", "dimensionless", "my_component", COMPUTED_CONSTANT},
+    {"d", "dimensionless", "my_component", COMPUTED_CONSTANT}
+};
+
+static double lookupTable[5][2];
+
+static double lookupTableValue(size_t column, double x)
+{
+    double position = (x-(-1.0))/0.5;
+    size_t index = (size_t) fmin(position, 3);
+
+    return lookupTable[index][column]+(position-index)*(lookupTable[index+1][column]-lookupTable[index][column]);
+}
+
+static void computeLookupTable()
+{
+    static int computed = 0;
+
+    if (computed) {
+        return;
+    }
+
+    for (size_t i = 0; i < 5; ++i) {
+        double x = (-1.0)+i*0.5;
+
+        lookupTable[i][0] = exp(3.0*x);
+        lookupTable[i][1] = exp((1.0/2.0)*x);
+    }
+
+    computed = 1;
+}
+
+double * createStatesArray()
+{
+    return (double *) malloc(STATE_COUNT*sizeof(double));
+}
+
+double * createVariablesArray()
+{
+    return (double *) malloc(VARIABLE_COUNT*sizeof(double));
+}
+
+void deleteArray(double *array)
+{
+    free(array);
+}
+
+void initializeStatesAndConstants(double *states, double *variables)
+{
+    states[0] = 0.0;
+    variables[0] = 10.0;
+    variables[1] = 3.0;
+    variables[2] = 1.0/2.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+    computeLookupTable();
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    rates[0] = exp(states[0]/variables[0])-(((states[0] >= -1.0) && (states[0] < 1.0))?lookupTableValue(0, states[0]):exp(variables[1]*states[0]))-(((states[0] >= -1.0) && (states[0] < 1.0))?lookupTableValue(1, states[0]):exp(variables[2]*states[0]));
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+}
@@ -0,0 +1,94 @@
+# The content of this file was generated using the Python profile of libCellML 0.2.0.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.1.0"
+LIBCELLML_VERSION = "0.2.0"
+
+STATE_COUNT = 1
+VARIABLE_COUNT = 3
+
+
+class VariableType(Enum):
+    CONSTANT = 1
+    COMPUTED_CONSTANT = 2
+    ALGEBRAIC = 3
+
+
+VOI_INFO = {"name": "t", "units": "dimensionless", "component": "my_component"}
+
+STATE_INFO = [
+    {"name": "x", "units": "dimensionless", "component": "my_component"}
+]
+
+VARIABLE_INFO = [
+    {"name": "k", "units": "dimensionless", "component": "my_component", "type": VariableType.CONSTANT},
+    {"name": "c", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT},
+    {"name": "d", "units": "dimensionless", "component": "my_component", "type": VariableType.COMPUTED_CONSTANT}
+]
+
+
+def lt_func(x, y):
+    return 1.0 if x < y else 0.0
+
+
+def geq_func(x, y):
+    return 1.0 if x >= y else 0.0
+
+
+def and_func(x, y):
+    return 1.0 if bool(x) & bool(y) else 0.0
+
+lookup_table = [[nan]*2 for i in range(5)]
+lookup_table_computed = False
+
+
+def lookup_table_value(column, x):
+    position = (x-(-1.0))/0.5
+    index = int(min(position, 3))
+
+    return lookup_table[index][column]+(position-index)*(lookup_table[index+1][column]-lookup_table[index][column])
+
+
+def compute_lookup_table():
+    global lookup_table_computed
+
+    if lookup_table_computed:
+        return
+
+    for i in range(0, 5):
+        x = (-1.0)+i*0.5
+
+        lookup_table[i][0] = exp(3.0*x)
+        lookup_table[i][1] = exp((1.0/2.0)*x)
+
+    lookup_table_computed = True
+
+
+def create_states_array():
+    return [nan]*STATE_COUNT
+
+
+def create_variables_array():
+    return [nan]*VARIABLE_COUNT
+
+
+def initialize_states_and_constants(states, variables):
+    states[0] = 0.0
+    variables[0] = 10.0
+    variables[1] = 3.0
+    variables[2] = 1.0/2.0
+
+
+def compute_computed_constants(variables):
+    compute_lookup_table()
+
+
+def compute_rates(voi, states, rates, variables):
+    rates[0] = exp(states[0]/variables[0])-(lookup_table_value(0, states[0]) if and_func(geq_func(states[0], -1.0), lt_func(states[0], 1.0)) else exp(variables[1]*states[0]))-(lookup_table_value(1, states[0]) if and_func(geq_func(states[0], -1.0), lt_func(states[0], 1.0)) else exp(variables[2]*states[0]))
+
+
+def compute_variables(voi, states, rates, variables):
+    pass